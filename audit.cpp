@@ -0,0 +1,541 @@
+// ---------------------------------------- runtime audit
+// The per frame hot spots of the game code, found by the cursors of libclang while the project is parsed anyway:
+// child lookups by name or tag, std::string temporaries built for the engine APIs, cocos2d::Vector copies and the
+// schedules by string keys. A finding is ranked by how often its enclosing function is scheduled: the schedule calls
+// are resolved to the method or lambda they schedule, scheduleUpdate to the update of the class it's called on, and
+// counted once per call site over the project. Nothing is rewritten, the report is json.
+#include "migrate-context.h"
+#include "clang-api.h"
+#include "include-graph.h"
+#include "unit-parser.h"
+#include "base/trace.h"
+#include "base/logger.h"
+#include "base/json.h"
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+
+namespace {
+	// the engine calls by the engine name of the function called
+	const std::string_view child_lookups[] = {
+		"Node::getChildByName",
+		"Node::getChildByTag",
+		"Node::enumerateChildren",
+		"ui::Helper::seekWidgetByName",
+		"ui::Helper::seekWidgetByTag",
+		"ui::Helper::seekNodeByName",
+	};
+
+	// the overloads by a std::string key are the string keyed ones
+	const std::string_view keyed_schedules[] = {
+		"Node::schedule",
+		"Node::scheduleOnce",
+		"Node::unschedule",
+		"Node::isScheduled",
+		"Scheduler::schedule",
+		"Scheduler::unschedule",
+		"Scheduler::isScheduled",
+	};
+
+	const std::string_view repeating_schedules[] = {
+		"Node::schedule",
+		"Scheduler::schedule",
+	};
+
+	const std::string_view update_schedules[] = {
+		"Node::scheduleUpdate",
+		"Node::scheduleUpdateWithPriority",
+	};
+
+	template <size_t N>
+	bool is_one_of(std::string_view name, const std::string_view (&names)[N]) {
+		return std::find(std::begin(names), std::end(names), name) != std::end(names);
+	}
+
+	std::string canonical_type(CXType type) {
+		return clang::to_string(clang::getTypeSpelling(clang::getCanonicalType(type)));
+	}
+
+	bool is_string(std::string_view type) {
+		return type.find("basic_string<char") != std::string_view::npos;
+	}
+
+	bool is_string_view(std::string_view type) {
+		return type.find("basic_string_view<char") != std::string_view::npos;
+	}
+
+	bool is_expression(CXCursor cursor) {
+		auto kind = clang::getCursorKind(cursor);
+		return kind >= CXCursor_FirstExpr && kind <= CXCursor_LastExpr;
+	}
+
+	bool returns_reference(CXCursor function) {
+		auto kind = clang::getCursorResultType(function).kind;
+		return kind == CXType_LValueReference || kind == CXType_RValueReference;
+	}
+
+	// the expression under the implicit conversions, the conversion operators and, if through_constructors, the
+	// constructions from one argument
+	CXCursor strip(CXCursor expr, bool through_constructors) {
+		for (;;) {
+			auto kind = clang::getCursorKind(expr);
+			auto referenced = kind == CXCursor_CallExpr ? clang::getCursorKind(clang::getCursorReferenced(expr)) : CXCursor_NoDeclFound;
+			if (kind != CXCursor_UnexposedExpr && referenced != CXCursor_ConversionFunction && !(through_constructors && referenced == CXCursor_Constructor))
+				return expr;
+			auto children = children_of(expr);
+			if (referenced == CXCursor_ConversionFunction && children.size() == 1 && clang::getCursorKind(children.front()) == CXCursor_MemberRefExpr)
+				children = children_of(children.front()); // the object converted
+			// the default arguments of a constructor follow the first
+			auto first = std::find_if(children.begin(), children.end(), is_expression);
+			if (first == children.end() || (referenced != CXCursor_Constructor && children.size() != 1))
+				return expr;
+			expr = *first;
+		}
+	}
+
+	struct finding {
+		std::string kind;
+		std::string file; // relative to the root
+		unsigned line = 0;
+		unsigned column = 0;
+		std::string function_key; // of the enclosing function, empty if none
+		std::string function;
+		std::string detail;
+		int scheduled = 0;
+	};
+
+	// a call scheduling a function
+	struct schedule_site {
+		std::string file;
+		unsigned line = 0;
+		unsigned column = 0;
+		std::string function_key;
+		std::string function;
+	};
+
+	class unit_auditor {
+	public:
+		explicit unit_auditor(const unit_parser& parser) : _parser(parser) {}
+
+		void visit(CXTranslationUnit unit) { clang::visitChildren(clang::getTranslationUnitCursor(unit), visit_child, this); }
+
+		std::vector<finding> findings;
+		std::vector<schedule_site> schedules;
+
+	private:
+		struct file_info {
+			std::string relative;
+			bool project = false;
+		};
+
+		// the function a finding is in, the update of a class is keyed by the class, as scheduleUpdate refers to it
+		struct function_scope {
+			std::string key;
+			std::string name;
+			std::string class_usr; // of a method, the class of this in a lambda
+		};
+
+		static bool is_function(CXCursorKind kind) {
+			switch (kind) {
+			case CXCursor_FunctionDecl:
+			case CXCursor_CXXMethod:
+			case CXCursor_Constructor:
+			case CXCursor_Destructor:
+			case CXCursor_ConversionFunction:
+			case CXCursor_FunctionTemplate:
+			case CXCursor_LambdaExpr:
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		static CXChildVisitResult visit_child(CXCursor cursor, CXCursor, CXClientData data) {
+			auto self = static_cast<unit_auditor*>(data);
+			CXFile file = nullptr;
+			clang::getSpellingLocation(clang::getCursorLocation(cursor), &file, nullptr, nullptr, nullptr);
+			if (!file || !self->file_of(file).project)
+				return CXChildVisit_Continue; // the engine and system headers
+			auto kind = clang::getCursorKind(cursor);
+			if (!is_function(kind)) {
+				self->inspect(cursor, kind);
+				return CXChildVisit_Recurse;
+			}
+			self->_scopes.push_back(self->scope_of(cursor, kind));
+			clang::visitChildren(cursor, visit_child, data);
+			self->_scopes.pop_back();
+			return CXChildVisit_Continue;
+		}
+
+		const file_info& file_of(CXFile file) {
+			auto it = _files.find(file);
+			if (it != _files.end())
+				return it->second;
+			auto& info = _files[file];
+			auto path = clang::to_string(clang::File_tryGetRealPathName(file));
+			if (path.empty())
+				path = clang::to_string(clang::getFileName(file));
+			path = normalize_path(path);
+			info.project = _parser.is_project(path);
+			info.relative = info.project ? path.substr(_parser.root().size()) : path;
+			return info;
+		}
+
+		// the relative file, line and column of a cursor, false if it isn't in a project file
+		bool location_of(CXCursor cursor, std::string& file, unsigned& line, unsigned& column) {
+			CXFile cxfile = nullptr;
+			clang::getSpellingLocation(clang::getCursorLocation(cursor), &cxfile, &line, &column, nullptr);
+			if (!cxfile || !file_of(cxfile).project)
+				return false;
+			file = file_of(cxfile).relative;
+			return true;
+		}
+
+		static std::string class_usr_of(CXCursor method) {
+			auto parent = clang::getCursorSemanticParent(method);
+			auto kind = clang::getCursorKind(parent);
+			if (kind != CXCursor_ClassDecl && kind != CXCursor_StructDecl && kind != CXCursor_ClassTemplate)
+				return {};
+			return clang::to_string(clang::getCursorUSR(clang::getCanonicalCursor(parent)));
+		}
+
+		static std::string method_key(CXCursor method, const std::string& class_usr) {
+			if (!class_usr.empty() && clang::to_string(clang::getCursorSpelling(method)) == "update")
+				return "update:" + class_usr;
+			return clang::to_string(clang::getCursorUSR(clang::getCanonicalCursor(method)));
+		}
+
+		static std::string name_of(CXCursor function) {
+			auto name = clang::to_string(clang::getCursorSpelling(function));
+			auto parent = clang::getCursorSemanticParent(function);
+			auto kind = clang::getCursorKind(parent);
+			if (kind == CXCursor_ClassDecl || kind == CXCursor_StructDecl || kind == CXCursor_ClassTemplate)
+				name = clang::to_string(clang::getCursorSpelling(parent)) + "::" + name;
+			return name;
+		}
+
+		std::string lambda_key(CXCursor lambda) {
+			std::string file;
+			unsigned line = 0, column = 0;
+			location_of(lambda, file, line, column);
+			return fmt::format("lambda:{}:{}:{}", file, line, column);
+		}
+
+		function_scope scope_of(CXCursor cursor, CXCursorKind kind) {
+			if (kind == CXCursor_LambdaExpr) {
+				auto enclosing = !_scopes.empty() ? &_scopes.back() : nullptr;
+				return function_scope{lambda_key(cursor), enclosing ? "lambda in " + enclosing->name : "lambda", enclosing ? enclosing->class_usr : std::string{}};
+			}
+			auto classUsr = class_usr_of(cursor);
+			return function_scope{method_key(cursor, classUsr), name_of(cursor), classUsr};
+		}
+
+		void add(CXCursor cursor, std::string_view kind, std::string detail) {
+			finding item;
+			if (!location_of(cursor, item.file, item.line, item.column))
+				return;
+			item.kind = kind;
+			item.detail = std::move(detail);
+			if (!_scopes.empty()) {
+				item.function_key = _scopes.back().key;
+				item.function = _scopes.back().name;
+			}
+			findings.push_back(std::move(item));
+		}
+
+		void inspect(CXCursor cursor, CXCursorKind kind) {
+			if (kind == CXCursor_CallExpr)
+				inspect_call(cursor);
+			else if (kind == CXCursor_VarDecl || kind == CXCursor_ParmDecl)
+				inspect_vector_copy(cursor, kind);
+		}
+
+		void inspect_call(CXCursor call) {
+			auto callee = clang::getCursorReferenced(call);
+			auto name = engine_name(callee);
+			if (name.empty())
+				return;
+			if (is_one_of(name, child_lookups))
+				add(call, "child_lookup", name);
+			if (is_one_of(name, keyed_schedules) && has_string_parameter(callee))
+				add(call, "schedule_string_key", name);
+			if (is_one_of(name, repeating_schedules))
+				record_schedule(call);
+			else if (is_one_of(name, update_schedules))
+				record_update_schedule(call);
+			inspect_string_arguments(call, callee, name);
+		}
+
+		static bool has_string_parameter(CXCursor function) {
+			int count = clang::Cursor_getNumArguments(function);
+			for (int i = 0; i < count; ++i) {
+				auto type = canonical_type(clang::getCursorType(clang::Cursor_getArgument(function, i)));
+				if (is_string(type) || is_string_view(type))
+					return true;
+			}
+			return false;
+		}
+
+		// a std::string built for a std::string_view parameter, or from a char pointer for a const std::string& one
+		void inspect_string_arguments(CXCursor call, CXCursor callee, const std::string& name) {
+			int params = clang::Cursor_getNumArguments(callee);
+			int args = clang::Cursor_getNumArguments(call);
+			for (int i = 0; i < params && i < args; ++i) {
+				auto paramType = canonical_type(clang::getCursorType(clang::Cursor_getArgument(callee, i)));
+				auto arg = clang::Cursor_getArgument(call, i);
+				if (is_string_view(paramType)) {
+					auto expr = strip(arg, false);
+					auto kind = clang::getCursorKind(expr);
+					if (!is_string(canonical_type(clang::getCursorType(expr))) || kind == CXCursor_DeclRefExpr || kind == CXCursor_MemberRefExpr ||
+						kind == CXCursor_ArraySubscriptExpr || (kind == CXCursor_CallExpr && returns_reference(clang::getCursorReferenced(expr))))
+						continue;
+					add(arg, "string_temporary", fmt::format("a std::string built for the std::string_view of {}", name));
+				}
+				else if (is_string(paramType) && paramType.find('&') != std::string::npos) {
+					auto expr = strip(arg, true);
+					if (is_string(canonical_type(clang::getCursorType(expr))))
+						continue;
+					add(arg, "string_temporary", fmt::format("a std::string allocated per call for {}", name));
+				}
+			}
+		}
+
+		// a by value cocos2d::Vector, a parameter or a variable copied from a reference
+		void inspect_vector_copy(CXCursor decl, CXCursorKind kind) {
+			auto type = canonical_type(clang::getCursorType(decl));
+			if (!(cxx20::starts_with(type, "cocos2d::Vector<") || cxx20::starts_with(type, "ax::Vector<")) || type.back() == '&' || type.back() == '*')
+				return;
+			if (kind == CXCursor_ParmDecl) {
+				add(decl, "vector_copy", fmt::format("a parameter of {} by value", type));
+				return;
+			}
+			CXCursor init = clang::getNullCursor();
+			for (auto& child : children_of(decl))
+				if (is_expression(child))
+					init = child;
+			if (clang::Cursor_isNull(init))
+				return;
+			auto expr = strip(init, true);
+			auto exprKind = clang::getCursorKind(expr);
+			bool copied = exprKind == CXCursor_DeclRefExpr || exprKind == CXCursor_MemberRefExpr ||
+						  (exprKind == CXCursor_CallExpr && clang::getCursorKind(clang::getCursorReferenced(expr)) != CXCursor_Constructor &&
+							  returns_reference(clang::getCursorReferenced(expr)));
+			if (copied)
+				add(decl, "vector_copy", fmt::format("a {} copied", type));
+		}
+
+		// the method or lambda an argument schedules, by a method reference or a lambda
+		bool schedule_target(CXCursor arg, std::string& key, std::string& name) {
+			struct search {
+				unit_auditor* self;
+				std::string* key;
+				std::string* name;
+				bool found = false;
+			} state{this, &key, &name};
+			auto kind = clang::getCursorKind(arg);
+			auto visit = [](CXCursor cursor, CXCursor, CXClientData data) {
+				auto state = static_cast<search*>(data);
+				auto kind = clang::getCursorKind(cursor);
+				if (kind == CXCursor_LambdaExpr) {
+					*state->key = state->self->lambda_key(cursor);
+					*state->name = !state->self->_scopes.empty() ? "lambda in " + state->self->_scopes.back().name : "lambda";
+					state->found = true;
+					return CXChildVisit_Break;
+				}
+				if (kind == CXCursor_DeclRefExpr || kind == CXCursor_MemberRefExpr) {
+					auto method = clang::getCursorReferenced(cursor);
+					if (clang::getCursorKind(method) == CXCursor_CXXMethod && engine_name(method).empty()) {
+						*state->key = method_key(method, class_usr_of(method));
+						*state->name = name_of(method);
+						state->found = true;
+						return CXChildVisit_Break;
+					}
+				}
+				return CXChildVisit_Recurse;
+			};
+			if (kind == CXCursor_LambdaExpr || kind == CXCursor_DeclRefExpr || kind == CXCursor_MemberRefExpr)
+				visit(arg, clang::getNullCursor(), &state);
+			if (!state.found)
+				clang::visitChildren(arg, visit, &state);
+			return state.found;
+		}
+
+		void record_schedule(CXCursor call) {
+			int args = clang::Cursor_getNumArguments(call);
+			for (int i = 0; i < args; ++i) {
+				schedule_site site;
+				if (!schedule_target(clang::Cursor_getArgument(call, i), site.function_key, site.function))
+					continue;
+				if (location_of(call, site.file, site.line, site.column))
+					schedules.push_back(std::move(site));
+				return;
+			}
+		}
+
+		// the update of the class of the object scheduleUpdate is called on, this if none
+		void record_update_schedule(CXCursor call) {
+			std::string classUsr, className;
+			for (auto& child : children_of(call)) {
+				if (clang::getCursorKind(child) != CXCursor_MemberRefExpr)
+					continue;
+				for (auto& object : children_of(child)) {
+					if (!is_expression(object))
+						continue;
+					auto type = clang::getCursorType(object);
+					if (type.kind == CXType_Pointer)
+						type = clang::getPointeeType(type);
+					auto decl = clang::getTypeDeclaration(clang::getCanonicalType(type));
+					if (!clang::Cursor_isNull(decl) && clang::getCursorKind(decl) != CXCursor_NoDeclFound) {
+						classUsr = clang::to_string(clang::getCursorUSR(clang::getCanonicalCursor(decl)));
+						className = clang::to_string(clang::getCursorSpelling(decl));
+					}
+					break;
+				}
+				break;
+			}
+			if (classUsr.empty() && !_scopes.empty()) {
+				classUsr = _scopes.back().class_usr;
+				auto& name = _scopes.back().name;
+				className = name.substr(0, name.rfind("::"));
+			}
+			schedule_site site;
+			if (classUsr.empty() || !location_of(call, site.file, site.line, site.column))
+				return;
+			site.function_key = "update:" + classUsr;
+			site.function = className + "::update";
+			schedules.push_back(std::move(site));
+		}
+
+		const unit_parser& _parser;
+		std::unordered_map<CXFile, file_info> _files;
+		std::vector<function_scope> _scopes;
+	};
+
+	class audit_pass {
+	public:
+		audit_pass(migrate_context& ctx, std::string root) : _ctx(ctx), _parser(ctx, std::move(root)) {}
+
+		void prepare(const std::vector<std::string>& units) { _parser.prepare(units); }
+
+		void audit_unit(const std::string& path, int index) {
+			TRACE_SCOPE("audit_unit", path);
+			file_events _fe(_ctx, path.c_str(), index);
+			std::string error;
+			auto unit = _parser.parse(index, error);
+			if (!unit) {
+				++_failed;
+				_ctx.emit(AX_MIGRATE_EVENT_WARNING, path.c_str(), index, 0, 0, error.empty() ? "parse fail" : error.c_str());
+				return;
+			}
+			unit_auditor auditor(_parser);
+			auditor.visit(unit);
+			clang::disposeTranslationUnit(unit);
+
+			// a header reached by many units is reported once, by location
+			std::lock_guard<std::mutex> lck(_mutex);
+			for (auto& item : auditor.findings)
+				_findings.emplace(std::make_tuple(item.file, item.line, item.column, item.kind), std::move(item));
+			for (auto& site : auditor.schedules)
+				_schedules.emplace(std::make_tuple(site.file, site.line, site.column), std::move(site));
+		}
+
+		// by the schedules of the enclosing function, then by place
+		std::vector<finding> ranked() const {
+			std::map<std::string, int> counts;
+			for (auto& site : _schedules)
+				++counts[site.second.function_key];
+			std::vector<finding> items;
+			for (auto& item : _findings) {
+				items.push_back(item.second);
+				auto count = counts.find(item.second.function_key);
+				items.back().scheduled = count != counts.end() ? count->second : 0;
+			}
+			std::stable_sort(items.begin(), items.end(), [](const finding& lhs, const finding& rhs) { return lhs.scheduled > rhs.scheduled; });
+			return items;
+		}
+
+		// the scheduled functions and their call sites
+		std::map<std::string, std::pair<std::string, int>> scheduled() const {
+			std::map<std::string, std::pair<std::string, int>> functions;
+			for (auto& site : _schedules) {
+				auto& entry = functions[site.second.function_key];
+				entry.first = site.second.function;
+				++entry.second;
+			}
+			return functions;
+		}
+
+		int failed() const { return _failed.load(); }
+
+	private:
+		migrate_context& _ctx;
+		unit_parser _parser;
+		std::mutex _mutex;
+		std::map<std::tuple<std::string, unsigned, unsigned, std::string>, finding> _findings;
+		std::map<std::tuple<std::string, unsigned, unsigned>, schedule_site> _schedules;
+		std::atomic<int> _failed{0};
+	};
+
+	void write_report(const audit_pass& pass, const std::vector<finding>& items, int units, const std::string& path) {
+		std::string out = fmt::format("{{\"units\":{},\"failed\":{},\"findings\":[", units, pass.failed());
+		for (size_t i = 0; i < items.size(); ++i) {
+			auto& item = items[i];
+			if (i)
+				out.push_back(',');
+			out += "{\"kind\":";
+			json::append_quoted(out, item.kind);
+			out += ",\"file\":";
+			json::append_quoted(out, item.file);
+			out += fmt::format(",\"line\":{},\"column\":{},\"function\":", item.line, item.column);
+			json::append_quoted(out, item.function);
+			out += fmt::format(",\"scheduled\":{},\"detail\":", item.scheduled);
+			json::append_quoted(out, item.detail);
+			out.push_back('}');
+		}
+		out += "],\"scheduled\":[";
+		bool first = true;
+		for (auto& function : pass.scheduled()) {
+			if (!first)
+				out.push_back(',');
+			first = false;
+			out += "{\"function\":";
+			json::append_quoted(out, function.second.first);
+			out += fmt::format(",\"sites\":{}}}", function.second.second);
+		}
+		out += "]}\n";
+		auto fp = fopen(path.c_str(), "wb");
+		if (!fp)
+			throw std::runtime_error(fmt::format("write report {} fail", path));
+		auto written = fwrite(out.data(), 1, out.size(), fp);
+		if (fclose(fp) != 0 || written != out.size())
+			throw std::runtime_error(fmt::format("write report {} fail", path));
+	}
+}
+
+int audit_hot_spots(migrate_context& ctx, std::string_view dir, const std::string& report, int top) {
+	if (!clang::ensure_lib())
+		throw std::runtime_error("libclang is required to audit the code");
+	auto units = scan_tree(dir, is_translation_unit);
+
+	audit_pass pass(ctx, root_of(dir));
+	pass.prepare(units);
+	ctx.total = static_cast<int>(units.size());
+	axstd::parallel_for(units.size(), ctx.jobs, [&](size_t index) { pass.audit_unit(units[index], static_cast<int>(index)); });
+	auto items = pass.ranked();
+	if (!report.empty())
+		write_report(pass, items, static_cast<int>(units.size()), report);
+
+	std::map<std::string_view, int> kinds;
+	for (auto& item : items)
+		++kinds[item.kind];
+	for (auto& kind : kinds)
+		stats::add(fmt::format("audit_{}", kind.first), kind.second);
+	logger::info("Audit found {} hot spots in {} units, the top ones:", items.size(), units.size());
+	for (size_t i = 0; i < items.size() && i < static_cast<size_t>((std::max)(top, 0)); ++i) {
+		auto& item = items[i];
+		logger::info("  {}:{}:{}: {} in {}, scheduled: {}, {}", item.file, item.line, item.column, item.kind, item.function.empty() ? "-" : item.function,
+			item.scheduled, item.detail);
+	}
+	return static_cast<int>(items.size());
+}
@@ -0,0 +1,1213 @@
+#include "axmigrate.h"
+#include "base/posix_io.h"
+#include "base/axstd.h"
+#include "base/lazy_regex.h"
+#include "base/trace.h"
+#include "base/stats.h"
+#include "base/logger.h"
+#include "base/parallel.h"
+#include "base/manifest.h"
+#include "base/journal.h"
+#include "clang-api.h"
+#include "migrate-context.h"
+#include "yasio/string_view.hpp"
+#include <assert.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <regex>
+#include <stdexcept>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include "fmt/compile.h"
+
+namespace stdfs = std::filesystem;
+
+using namespace std::string_view_literals;
+
+const axstd::lazy_regex include_re(R"(#(\s)*(include|import)(\s)*"(.)*\b(CC|cc))");
+const axstd::lazy_regex include_re_fuzzy(R"(#(\s)*(include|import)(\s)*("|<)(.)*\b(CC|cc))");
+const axstd::lazy_regex cmake_re(R"(/CC)", std::regex_constants::ECMAScript | std::regex_constants::icase);
+
+std::string load_file(std::string_view path)
+{
+	TRACE_SCOPE("load_file");
+	auto fd = posix_open_cxx(path, O_READ_FLAGS);
+	if (fd != -1) {
+		struct auto_handle {
+			~auto_handle() { close(_fd); }
+			int _fd;
+		} _h { fd };
+		size_t len = lseek(fd, 0, SEEK_END);
+		if (len > 0) {
+			lseek(fd, 0, SEEK_SET);
+			std::string content;
+			content.reserve(len);
+			char buf[512];
+			int nb = -1;
+			while ((nb = read(fd, buf, sizeof(buf))) > 0) {
+				content.append(buf, static_cast<size_t>(nb));
+			}
+			stats::add("bytes_read", static_cast<int64_t>(content.size()));
+			return content;
+		}
+	}
+	return {};
+}
+
+void save_file(std::string_view path, const std::vector<std::string_view>& chunks)
+{
+	TRACE_SCOPE("save_file");
+	auto fp = fopen(path.data(), "wb");
+	if (!fp) {
+		throw std::runtime_error("open file fail");
+	}
+	size_t bytes = 0;
+	for (auto& chunk : chunks) {
+		fwrite(chunk.data(), chunk.length(), 1, fp);
+		bytes += chunk.length();
+	}
+	fclose(fp);
+	stats::add("bytes_written", static_cast<int64_t>(bytes));
+}
+
+// cheap tests of the literals which the patterns require, most lines never reach std::regex
+static bool may_match_include(std::string_view line) {
+	return line.find('#') != std::string_view::npos &&
+		(line.find("CC"sv) != std::string_view::npos || line.find("cc"sv) != std::string_view::npos);
+}
+
+static bool may_match_cmake(std::string_view line) {
+	return line.find('/') != std::string_view::npos;
+}
+
+// returns the number of lines replaced, the content split to chunks for save_file
+int regex_search_for_replace(const std::string& content, const std::regex& re, bool (*may_match)(std::string_view),
+	bool fuzzy, std::vector<std::string_view>& chunks)
+{
+	TRACE_SCOPE("match");
+	// scan line by line, and put to chunks
+	const char* cur_line = content.c_str();
+	const char* ptr = cur_line;
+
+	int line_count = 0; // for stats only
+	int hints = 0;
+
+	chunks.clear();
+
+	for (;;) {
+		++line_count;
+
+		while (*ptr && *ptr != '\n')
+			++ptr;
+
+		auto next_line = *ptr == '\n' ? ptr + 1 : ptr;
+		std::string_view line { cur_line, static_cast<size_t>(next_line - cur_line)}; // ensure line contains '\n' if not '\0'
+
+		if (line.length() > axstd::regex_max_subject) {
+			stats::add("lines_too_long");
+			chunks.push_back(line);
+		}
+		else if (line.length() > 1 && may_match(line)) {
+			std::match_results<std::string_view::const_iterator> results;
+			if (std::regex_search(line.begin(), line.end(), results, re)
+				// we don't want replace c standard header, but will match
+				// when use fuzzy pattern
+				&& (!fuzzy || line.find("<cctype>") == std::string_view::npos)) {
+				auto& match = results[0];
+				auto first = match.first;
+				auto last = match.second;
+				// assert(first >= line.data() && first <= &line.back());
+				std::string_view word { std::addressof(*first), (size_t) std::distance(first, last)};
+				std::string_view chunk1 { cur_line, (size_t)std::distance(cur_line,  std::addressof(*last) - 2)};
+				chunks.push_back(chunk1);
+				auto chunk2_first = std::addressof(*last);
+				if (chunk2_first < next_line) {
+					std::string_view chunk2 { chunk2_first, (size_t)std::distance(chunk2_first, next_line) };
+					chunks.push_back(chunk2);
+				}
+				++hints;
+			}
+			else {
+				chunks.push_back(line);
+			}
+		}
+		else { // put empty or unmatchable line directly
+			chunks.push_back(line);
+		}
+
+		if (*next_line != '\0') {
+			ptr = cur_line = next_line;
+		}
+		else {
+			break;
+		}
+	}
+
+	return hints;
+}
+
+// rewrite the CC includes of c/c++ sources or the CC paths of cmake files, returns the number of lines replaced
+int migrate_includes(const std::string& content, bool is_cmake, bool fuzzy, std::vector<std::string_view>& chunks)
+{
+	if (!is_cmake)
+		return regex_search_for_replace(content, !fuzzy ? *include_re : *include_re_fuzzy, may_match_include, fuzzy, chunks);
+	return regex_search_for_replace(content, *cmake_re, may_match_cmake, false, chunks);
+}
+
+void process_file(migrate_context& ctx, const std::string& file_path, std::string_view file_name, int index, bool is_cmake, bool needs_rename = false)
+{
+	TRACE_SCOPE("process_file", file_path);
+	stats::file_scope _fs(file_path);
+	file_events _fe(ctx, file_path.c_str(), index);
+	if (ctx.resumed(file_path.c_str(), index))
+		return;
+	journal_finish _jf(ctx, file_path);
+	const char* kind = !is_cmake ? "cpp" : "cmake";
+	auto flags = ctx.output_flags();
+	auto use_manifest = ctx.manifest && !needs_rename; // the rename is pending still
+	if (use_manifest && !ctx.includes && ctx.manifest->unchanged_stat(file_path, flags)) { // the histogram needs the content
+		stats::add("files_unchanged");
+		ctx.emit(AX_MIGRATE_EVENT_UNCHANGED, file_path.c_str(), index, 0, 0, kind);
+		return;
+	}
+
+	auto content = load_file(file_path);
+	if (content.empty()) {
+		throw std::runtime_error("found empty file!");
+	}
+
+	uint64_t hash = 0;
+	if (use_manifest) {
+		hash = manifest::hash_of(content);
+		if (ctx.manifest->unchanged(file_path, hash, flags)) { // touched only
+			if (ctx.includes)
+				record_includes(*ctx.includes, file_path, {content}, is_cmake);
+			if (!ctx.dry_run)
+				ctx.manifest->record(file_path, hash, flags);
+			stats::add("files_unchanged");
+			ctx.emit(AX_MIGRATE_EVENT_UNCHANGED, file_path.c_str(), index, content.size(), 0, kind);
+			return;
+		}
+	}
+
+	std::string rewritten; // the chunks refer to it if the callbacks are rewritten
+	std::vector<std::string_view> chunks;
+
+	if (!is_cmake) {
+		auto callbacks = ctx.lambdas ? rewrite_callbacks(content, rewritten) : 0;
+		if (callbacks)
+			stats::add_match("callback", callbacks);
+		// replacing file include stub from CCxxx to xxx, do in editor is better
+		auto includes = migrate_includes(callbacks ? rewritten : content, false, ctx.fuzzy, chunks);
+		if (includes)
+			stats::add_match(!ctx.fuzzy ? "include" : "include_fuzzy", includes);
+		if (auto hints = includes + callbacks) {
+			if (!ctx.dry_run) {
+				auto id = ctx.plan_write(file_path, content);
+				save_file(file_path, chunks);
+				ctx.commit(id);
+				if (use_manifest)
+					hash = manifest::hash_of(chunks);
+			}
+			++ctx.hints;
+			stats::add("files_replaced");
+			ctx.emit(AX_MIGRATE_EVENT_REPLACED, file_path.c_str(), index, content.size(), hints, kind);
+		}
+		else {
+			ctx.emit(AX_MIGRATE_EVENT_SKIPPED, file_path.c_str(), index, content.size(), 0, kind);
+		}
+
+		if (needs_rename && !ctx.dry_run) {
+			auto new_file_name = file_name.substr(2);
+			std::string new_file_path { file_path.data(), file_path.length() - file_name.length() };
+			new_file_path += new_file_name;
+
+			// rename
+			TRACE_SCOPE("rename");
+			auto id = ctx.journal ? ctx.journal->plan_rename(file_path, new_file_path) : 0;
+			int ret = ::rename(file_path.data(), new_file_path.c_str());
+			if (ret != 0) {
+				throw std::runtime_error("rename file fail");
+			}
+			ctx.commit(id);
+			if (ctx.journal)
+				ctx.journal->finish(new_file_path);
+			stats::add("files_renamed");
+			if (ctx.includes)
+				record_includes(*ctx.includes, new_file_path, chunks, false);
+			if (ctx.manifest) {
+				ctx.manifest->erase(file_path);
+				ctx.manifest->record(new_file_path, manifest::hash_of(chunks), flags);
+			}
+			return;
+		}
+	}
+	else {
+		if (auto hints = migrate_includes(content, true, false, chunks)) {
+			if (!ctx.dry_run) {
+				auto id = ctx.plan_write(file_path, content);
+				save_file(file_path, chunks);
+				ctx.commit(id);
+				if (use_manifest)
+					hash = manifest::hash_of(chunks);
+			}
+			++ctx.hints;
+			stats::add_match("cmake", hints);
+			stats::add("files_replaced");
+			ctx.emit(AX_MIGRATE_EVENT_REPLACED, file_path.c_str(), index, content.size(), hints, kind);
+		}
+		else {
+			ctx.emit(AX_MIGRATE_EVENT_SKIPPED, file_path.c_str(), index, content.size(), 0, kind);
+		}
+	}
+
+	if (ctx.includes) // as migrated
+		record_includes(*ctx.includes, file_path, chunks, is_cmake);
+
+	if (use_manifest && !ctx.dry_run)
+		ctx.manifest->record(file_path, hash, flags);
+}
+
+struct source_file {
+	std::string path;
+	size_t name_offset;
+	bool is_cmake;
+};
+
+// c/c++, objc sources and CMakeLists.txt, returns false for other files
+static bool to_source_file(const stdfs::path& path, std::vector<source_file>& source_files)
+{
+	auto strPath = path.generic_string();
+	auto pathname = path.filename();
+	auto strName = pathname.generic_string();
+	if (cxx20::ic::ends_with(strName, ".h") || cxx20::ic::ends_with(strName, ".hpp") || cxx20::ic::ends_with(strName, ".cpp") || cxx20::ic::ends_with(strName, ".mm") || cxx20::ic::ends_with(strName, ".m") || cxx20::ic::ends_with(strName, ".inl")) {
+		source_files.push_back(source_file{strPath, strPath.size() - strName.size(), false});
+	}
+	else if (cxx20::ic::ends_with(strPath, "CMakeLists.txt")) {
+		source_files.push_back(source_file{strPath, strPath.size() - strName.size(), true});
+	}
+	else
+		return false;
+	return true;
+}
+
+static void process_files(migrate_context& ctx, const std::vector<source_file>& source_files)
+{
+	// files are independent
+	ctx.total = static_cast<int>(source_files.size());
+	axstd::parallel_for(source_files.size(), ctx.jobs, [&](size_t index) {
+		auto& file = source_files[index];
+		std::string_view strName{file.path.c_str() + file.name_offset, file.path.size() - file.name_offset};
+		if (!file.is_cmake)
+			process_file(ctx, file.path, strName, static_cast<int>(index), false, cxx20::ic::starts_with(strName, "CC"));
+		else
+			process_file(ctx, file.path, strName, static_cast<int>(index), true);
+	});
+}
+
+void process_folder(migrate_context& ctx, std::string_view sub_path)
+{
+#if defined(_WIN32)
+	static std::string exclude = "\\DragonBones\\";
+#else
+	static std::string exclude = "/DragonBones/";
+#endif
+	std::vector<source_file> source_files;
+	{
+		TRACE_SCOPE("scan", sub_path);
+		for (const auto& entry : stdfs::recursive_directory_iterator(sub_path)) {
+			if (entry.is_regular_file()) {
+				auto& path = entry.path();
+
+				stats::add("files_scanned");
+				if (path.generic_string().find(exclude) != std::string::npos) {
+					stats::add("files_excluded");
+					continue;
+				}
+
+				if (!to_source_file(path, source_files))
+					stats::add("files_skipped_by_ext");
+			}
+		}
+	}
+
+	// the files of other shards are migrated by other runs
+	if (ctx.shard_count > 1) {
+		auto root_len = stdfs::path{sub_path}.generic_string().size();
+		stats::add("files_other_shards", static_cast<int64_t>(std::erase_if(source_files, [&](const source_file& file) { return !ctx.in_shard(file.path, root_len); })));
+	}
+
+	process_files(ctx, source_files);
+}
+
+// ---------------------------------------- migrate shader glsl 100 to essl 310 for glscc input
+namespace Strings {
+	inline bool replace_bound(std::string& str, const std::string& from, const std::string& to, int start) {
+		size_t start_pos = str.find(from);
+		if (start_pos != std::string::npos || start_pos >= start && start_pos + to.length() <= std::string::npos) {
+			str.replace(start_pos, from.length(), to);
+			return true;
+		}
+		return false;
+	}
+
+	inline bool replace(std::string& str, const std::string& from, const std::string& to) {
+		size_t start_pos = str.find(from);
+		if (start_pos == std::string::npos)
+			return false;
+		str.replace(start_pos, from.length(), to);
+		return true;
+	}
+
+	inline bool wreplace(std::wstring& str, const std::wstring& from, const std::wstring& to) {
+		size_t start_pos = str.find(from);
+		if (start_pos == std::wstring::npos)
+			return false;
+		str.replace(start_pos, from.length(), to);
+		return true;
+	}
+
+	inline std::string replace_const(const std::string str, const std::string& from, const std::string& to) {
+		std::string final = str;
+		size_t start_pos = final.find(from);
+		if (start_pos == std::string::npos)
+			return final;
+		final.replace(start_pos, from.length(), to);
+		return final;
+	}
+
+	inline std::wstring wreplace_const(const std::wstring str, const std::wstring& from, const std::wstring& to) {
+		std::wstring final = str;
+		size_t start_pos = final.find(from);
+		if (start_pos == std::wstring::npos)
+			return final;
+		final.replace(start_pos, from.length(), to);
+		return final;
+	}
+
+	inline void split_single_char(std::string& str, const char* delim, std::vector<char>& out)
+	{
+		size_t start;
+		size_t end = 0;
+
+		while ((start = str.find_first_not_of(delim, end)) != std::string::npos)
+		{
+			end = str.find(delim, start);
+			out.push_back(str.substr(start, end - start)[0]);
+		}
+	}
+
+	inline void split(std::string& str, const char* delim, std::vector<std::string>& out)
+	{
+		size_t start;
+		size_t end = 0;
+
+		while ((start = str.find_first_not_of(delim, end)) != std::string::npos)
+		{
+			end = str.find(delim, start);
+			out.push_back(str.substr(start, end - start));
+		}
+	}
+
+	inline void wsplit(std::wstring& str, const wchar_t* delim, std::vector<std::wstring>& out)
+	{
+		size_t start;
+		size_t end = 0;
+
+		while ((start = str.find_first_not_of(delim, end)) != std::string::npos)
+		{
+			end = str.find(delim, start);
+			out.push_back(str.substr(start, end - start));
+		}
+	}
+}
+
+int replace(std::string& string, const std::string& replaced_key, const std::string& replacing_key)
+{
+	int count = 0;
+	std::string::size_type pos = 0;
+	while ((pos = string.find(replaced_key, pos)) != std::string::npos)
+	{
+		(void)string.replace(pos, replaced_key.length(), replacing_key);
+		pos += replacing_key.length();
+		++count;
+	}
+	return count;
+}
+
+#if !defined(ARRAYSIZE)
+#define ARRAYSIZE(A) (sizeof(A) / sizeof((A)[0]))
+#endif
+
+#include <set>
+
+std::string& migrate_strip_outpath(std::string& outpath, const std::set<std::string>& fileNameSet, bool remove_existing = true, const migrate_context* ctx = nullptr) {
+
+	auto slashpos = outpath.find_last_of("/\\");
+
+	if (slashpos != std::string::npos) {
+		std::string_view fileName {outpath.c_str() + slashpos + 1, outpath.size() - slashpos - 1};
+
+		std::string strippedFileName;
+		bool is3D = false;
+		if (cxx20::ic::starts_with(fileName, "CC2D_")) {
+			strippedFileName = fileName.substr(5);
+		}
+		else if (cxx20::ic::starts_with(fileName, "2D_")) {
+			strippedFileName = fileName.substr(3);
+		}
+		else if (cxx20::ic::starts_with(fileName, "CC3D_")) {
+			strippedFileName = fileName.substr(5);
+			is3D = true;
+		}
+		else if (cxx20::ic::starts_with(fileName, "3D_")) {
+			strippedFileName = fileName.substr(3);
+			is3D = true;
+		}
+		if (!strippedFileName.empty()) {
+			if (is3D) {
+				if (fileNameSet.find(strippedFileName) != fileNameSet.end()) {
+					auto dotpos = strippedFileName.find_last_of('.');
+					if (dotpos != std::string::npos)
+						strippedFileName.insert(dotpos, "3D");
+					else
+						strippedFileName.append("3D");
+				}
+			}
+			if (remove_existing && stdfs::is_regular_file(outpath)) {
+				auto id = ctx ? ctx->plan_remove(outpath) : 0;
+				stdfs::remove(outpath);
+				if (ctx)
+					ctx->commit(id);
+			}
+			outpath.resize(outpath.size() - fileName.size());
+			outpath += strippedFileName;
+		}
+	}
+	return outpath;
+}
+
+void insret_define_guard(std::string& shader, size_t& insertpos, std::string_view defineName) {
+	std::string define_guard_code = fmt::format("\n\n#if !defined({0})\n#define {0} 0\n#endif\n\n"sv, defineName);
+	shader.insert(insertpos, define_guard_code);
+	insertpos += define_guard_code.size();
+}
+
+// GLSL has no string literals and no char type, so a source without any '"' or 'char' outside of
+// comments and preprocessor lines can't embed shaders in c++ variables, i.e. STRINGIFY(...)
+bool looks_like_glsl(std::string_view source) {
+	const char* ptr = source.data();
+	const char* end = ptr + source.size();
+	bool line_start = true;
+	while (ptr < end) {
+		char ch = *ptr;
+		if (ch == '/' && ptr + 1 < end && ptr[1] == '/') {
+			while (ptr < end && *ptr != '\n') ++ptr;
+			continue;
+		}
+		if (ch == '/' && ptr + 1 < end && ptr[1] == '*') {
+			ptr += 2;
+			while (ptr + 1 < end && !(ptr[0] == '*' && ptr[1] == '/')) ++ptr;
+			ptr += 2;
+			continue;
+		}
+		if (line_start && ch == '#') { // #version, #include "xxx" ...
+			while (ptr < end && *ptr != '\n') ++ptr;
+			continue;
+		}
+		if (ch == '"')
+			return false;
+		if (ch == '_' || isalpha((unsigned char)ch)) {
+			auto first = ptr;
+			while (ptr < end && (*ptr == '_' || isalnum((unsigned char)*ptr)))
+				++ptr;
+			if (std::string_view{first, static_cast<size_t>(ptr - first)} == "char"sv)
+				return false;
+			line_start = false;
+			continue;
+		}
+		if (ch == '\n')
+			line_start = true;
+		else if (ch != ' ' && ch != '\t' && ch != '\r')
+			line_start = false;
+		++ptr;
+	}
+	return true;
+}
+
+// the spelling of StringLiteral cursor is the concatenated literal with escapes
+static std::string literal_spelling_to_code(std::string shaderCode) {
+	replace(shaderCode, "\\n", "\n");
+	replace(shaderCode, "\"", "");
+	replace(shaderCode, "\\t", "\t");
+	return shaderCode;
+}
+
+extern void convert_shader_source_one(std::string& shader_source, const std::string& outpath);
+extern void migrate_shader_source_one(std::string& shader_source, const std::string& outpath);
+extern int convert_shader_source_one_ast(std::string& shader_source, const std::string& outpath);
+extern int migrate_shader_source_one_ast(std::string& shader_source, const std::string& outpath);
+extern int extract_shader_literals(std::string_view source, std::vector<std::pair<std::string, std::string>>& decls);
+void migrate_shader_file_one(migrate_context& ctx, const std::string& inpath, int index, const std::set<std::string>& fileNameSet) {
+	TRACE_SCOPE("migrate_shader_file", inpath);
+	stats::file_scope _fs(inpath);
+	file_events _fe(ctx, inpath.c_str(), index);
+	if (ctx.resumed(inpath.c_str(), index))
+		return;
+	journal_finish _jf(ctx, inpath);
+	auto flags = ctx.output_flags();
+	if (ctx.manifest && ctx.manifest->unchanged_stat(inpath, flags)) {
+		stats::add("files_unchanged");
+		ctx.emit(AX_MIGRATE_EVENT_UNCHANGED, inpath.c_str(), index);
+		return;
+	}
+
+#pragma region parse code file by lexer or libclang
+	struct ShaderSourceContext {
+		bool embedded = false;
+		std::vector<std::pair<std::string, std::string>> shaderDecls;
+		std::string curVarName;
+		stdfs::path fileDir;
+		std::string fileName;
+		const std::set<std::string>* fileNameSet;
+
+		void addDecl(std::string varName, std::string shaderCode) {
+			// we assume it's engine builtin shaders
+			auto idx = varName.find_last_of('_');
+			if (idx != std::string::npos)
+				varName[idx] = '.';
+			auto path = fileDir;
+			path += "/";
+			path += varName;
+			shaderDecls.emplace_back(path.generic_string(), std::move(shaderCode));
+		}
+	};
+	ShaderSourceContext context;
+	context.fileDir = stdfs::path(inpath).parent_path();
+	context.fileName = stdfs::path(inpath).filename().generic_string();
+	context.fileNameSet = &fileNameSet;
+	const char* command_line_args[] = {
+		"-xc++",
+		"--std=c++17",
+	};
+
+	auto source = load_file(inpath);
+	if (ctx.manifest) {
+		auto hash = manifest::hash_of(source);
+		if (ctx.manifest->unchanged(inpath, hash, flags)) { // touched only
+			if (!ctx.dry_run)
+				ctx.manifest->record(inpath, hash, flags);
+			stats::add("files_unchanged");
+			ctx.emit(AX_MIGRATE_EVENT_UNCHANGED, inpath.c_str(), index, source.size());
+			return;
+		}
+	}
+	bool use_libclang = false;
+	if (!looks_like_glsl(source)) {
+		context.embedded = true; // the literals only, also if none of them are found
+		std::vector<std::pair<std::string, std::string>> decls;
+		int numDecls = -1;
+		if (ctx.extractor == AX_MIGRATE_EXTRACTOR_LEXER) {
+			TRACE_SCOPE("extract_literals");
+			numDecls = extract_shader_literals(source, decls);
+		}
+		if (numDecls != -1) {
+			for (auto& decl : decls)
+				context.addDecl(std::move(decl.first), std::move(decl.second));
+		}
+		else if (clang::ensure_lib())
+			use_libclang = true;
+		else {
+			ctx.emit(AX_MIGRATE_EVENT_WARNING, inpath.c_str(), index, source.size(), 0, "extracting the shader literals requires libclang");
+			return;
+		}
+	}
+
+	// shader decls are namespace scope vars of main file, so skip includes and function bodies
+	const unsigned parse_options = CXTranslationUnit_SkipFunctionBodies | CXTranslationUnit_Incomplete |
+		CXTranslationUnit_SingleFileParse | CXTranslationUnit_KeepGoing;
+	CXTranslationUnit unit{};
+	auto err = CXError_Failure;
+	if (use_libclang) {
+		TRACE_SCOPE("libclang_parse");
+		CXUnsavedFile unsaved_file{ inpath.data(), source.data(), static_cast<unsigned long>(source.size()) };
+		err = clang::parseTranslationUnit2(
+			clang::thread_index(),
+			inpath.data(), command_line_args, (int)ARRAYSIZE(command_line_args),
+			&unsaved_file, 1,
+			parse_options, &unit);
+	}
+
+	if (unit && err == CXError_Success && ctx.extractor != AX_MIGRATE_EXTRACTOR_AST)
+	{
+		TRACE_SCOPE("libclang_tokens");
+
+		// tokenize main file only, O(file) instead of visiting all cursors of TU
+		auto file = clang::getFile(unit, inpath.data());
+		auto range = clang::getRange(clang::getLocationForOffset(unit, file, 0),
+			clang::getLocationForOffset(unit, file, static_cast<unsigned>(source.size())));
+		CXToken* tokens = nullptr;
+		unsigned numTokens = 0;
+		clang::tokenize(unit, range, &tokens, &numTokens);
+		auto spelled = [&](unsigned k, std::string_view text) {
+			return clang::getTokenKind(tokens[k]) == CXToken_Punctuation && clang::to_string(clang::getTokenSpelling(unit, tokens[k])) == text;
+		};
+		for (unsigned i = 0; i + 2 < numTokens; ++i) {
+			// name = "..." or name = MACRO(...), also name[] = "..." or name[N] = "..."
+			if (clang::getTokenKind(tokens[i]) != CXToken_Identifier)
+				continue;
+			unsigned eq = i + 1;
+			while (eq < numTokens && spelled(eq, "[")) {
+				while (++eq < numTokens && !spelled(eq, "]"))
+					;
+				++eq;
+			}
+			if (eq + 1 >= numTokens || !spelled(eq, "="))
+				continue;
+			auto valueKind = clang::getTokenKind(tokens[eq + 1]);
+			if (valueKind != CXToken_Literal && valueKind != CXToken_Identifier)
+				continue;
+			if (valueKind == CXToken_Literal && clang::to_string(clang::getTokenSpelling(unit, tokens[eq + 1])).find('"') == std::string::npos)
+				continue;
+
+			auto cursor = clang::getCursor(unit, clang::getTokenLocation(unit, tokens[i]));
+			if (clang::getCursorKind(cursor) != CXCursorKind::CXCursor_VarDecl)
+				continue;
+
+			// the initializer is small, find the first string literal of it
+			std::string shaderCode;
+			clang::visitChildren(
+				cursor,
+				[](CXCursor c, CXCursor, CXClientData client_data)
+				{
+					if (clang::getCursorKind(c) != CXCursorKind::CXCursor_StringLiteral)
+						return CXChildVisit_Recurse;
+					*(std::string*)client_data = clang::to_string(clang::getCursorSpelling(c));
+					return CXChildVisit_Break;
+				},
+				&shaderCode);
+			if (!shaderCode.empty())
+				context.addDecl(clang::to_string(clang::getCursorSpelling(cursor)), literal_spelling_to_code(std::move(shaderCode)));
+		}
+		clang::disposeTokens(unit, tokens, numTokens);
+
+		clang::disposeTranslationUnit(unit);
+	}
+	else if (unit && err == CXError_Success)
+	{
+		TRACE_SCOPE("libclang_visit");
+		CXCursor cursor = clang::getTranslationUnitCursor(unit);
+		clang::visitChildren(
+			cursor,
+			[](CXCursor c, CXCursor, CXClientData client_data)
+			{
+				auto context = (ShaderSourceContext*)client_data;
+
+				CXFile from_file{};
+				unsigned line = 0;
+				unsigned column = 0;
+				unsigned offset = 0;
+				auto loc = clang::getCursorLocation(c);
+				clang::getExpansionLocation(loc, &from_file, &line, &column, &offset);
+				if (!from_file) {
+					return CXChildVisit_Continue;
+				}
+				auto from_spelling = clang::getFileName(from_file);
+				std::string fileName = clang::getCString(from_spelling);
+				std::string_view fv{fileName};
+				auto slash = fv.find_last_of("/\\");
+				if (slash != std::string::npos)
+					fv.remove_prefix(slash + 1);
+				clang::disposeString(from_spelling);
+
+				if (cxx20::ic::iequals(fv, context->fileName)) {
+					auto cursorKind = clang::getCursorKind(c);
+					auto cursorValue = clang::getCursorSpelling(c);
+					if (cursorKind == CXCursorKind::CXCursor_VarDecl) {
+						//cursorValue = clang::getCursorSpelling(c);
+						context->curVarName = clang::getCString(cursorValue);
+					}
+					else if (cursorKind == CXCursorKind::CXCursor_StringLiteral) {
+						if (!context->curVarName.empty()) {
+							//cursorValue = clang::getCursorSpelling(c);
+
+							context->addDecl(std::move(context->curVarName), literal_spelling_to_code(clang::getCString(cursorValue)));
+						}
+					}
+					clang::disposeString(cursorValue);
+				}
+				return CXChildVisit_Recurse;
+			},
+			&context);
+
+
+		clang::disposeTranslationUnit(unit);
+	}
+	else if (use_libclang) {
+		ctx.emit(AX_MIGRATE_EVENT_WARNING, inpath.c_str(), index, source.size(), 0, "parsing the shader literals fail");
+		return;
+	}
+	else if (!context.embedded) {
+		// plain shader code, ensure last line terminated
+		if (!source.empty() && source.back() != '\n')
+			source.push_back('\n');
+		context.shaderDecls.emplace_back(inpath, source);
+	}
+#pragma endregion
+
+	if (context.shaderDecls.size() == 1) // single decl, use inpath
+		context.shaderDecls[0].first = inpath;
+	else if (context.shaderDecls.empty()) {
+		// a c++ file without shader literals, never migrate it as glsl
+		if (context.embedded)
+			return;
+		context.shaderDecls.emplace_back(
+			inpath,
+			std::move(source));
+	}
+	int hints = 0;
+	for (auto& item : context.shaderDecls) {
+		auto& shader = item.second;
+		auto& outpath = migrate_strip_outpath(item.first, fileNameSet, !ctx.dry_run, &ctx);
+		auto id = !ctx.dry_run ? ctx.plan_write(outpath) : 0;
+		if (ctx.use_ubo) {
+			hints += !ctx.dry_run ? migrate_shader_source_one_ast(shader, outpath) : convert_shader_source_one_ast(shader, outpath);
+		}
+		else {
+			if (!ctx.dry_run)
+				migrate_shader_source_one(shader, outpath);
+			else
+				convert_shader_source_one(shader, outpath);
+			++hints;
+		}
+		ctx.commit(id);
+		if (ctx.journal && outpath != inpath)
+			ctx.journal->finish(outpath);
+		stats::add("shaders_converted");
+		ctx.emit(AX_MIGRATE_EVENT_CONVERTED, outpath.c_str(), index, shader.size());
+	}
+	ctx.hints += hints;
+	if (ctx.dry_run)
+		return;
+	if (hints && context.shaderDecls.size() > 1) {
+		auto id = ctx.plan_remove(inpath);
+		stdfs::remove(inpath);
+		ctx.commit(id);
+	}
+
+	if (ctx.manifest) {
+		for (auto& item : context.shaderDecls)
+			ctx.manifest->record(item.first, manifest::hash_of(item.second), flags);
+		if (!stdfs::exists(inpath))
+			ctx.manifest->erase(inpath);
+	}
+}
+
+bool is_in_filter(std::string_view fileName, const std::vector<std::string_view>& filterList) {
+	for (auto& filter : filterList)
+		if (cxx20::ic::ends_with(fileName, filter))
+			return true;
+	return false;
+}
+
+// the default suffixes and the ones of options
+static std::vector<std::string_view> shader_filters(const migrate_context& ctx) {
+	std::vector<std::string_view> filterList{".vert", ".frag", ".vsh", ".fsh"};
+	for (auto& filter : ctx.filters)
+		if (std::find_if(filterList.begin(), filterList.end(), [=](const std::string_view& elem) { return cxx20::ic::iequals(elem, filter); }) == filterList.end())
+			filterList.emplace_back(filter);
+	return filterList;
+}
+
+static void migrate_shader_files(migrate_context& ctx, const std::vector<stdfs::path>& shader_files, const std::set<std::string>& fileNameSet) {
+	ctx.total = static_cast<int>(shader_files.size());
+	axstd::parallel_for(shader_files.size(), ctx.jobs, [&](size_t index) {
+		migrate_shader_file_one(ctx, shader_files[index].generic_string(), static_cast<int>(index), fileNameSet);
+	});
+}
+
+void migrate_shader_files_in_dir(migrate_context& ctx, std::string_view dir) {
+	auto filterList = shader_filters(ctx);
+	std::vector<stdfs::path> shader_files;
+	std::set<std::string> fileNameSet;
+	{
+		TRACE_SCOPE("scan", dir);
+		for (const auto& entry : stdfs::recursive_directory_iterator(dir)) {
+			if (entry.is_regular_file()) {
+				auto& path = entry.path();
+				auto strPath = path.generic_string();
+				auto pathname = path.filename();
+				auto strName = pathname.generic_string();
+
+				stats::add("files_scanned");
+				if (is_in_filter(strName, filterList)) {
+					fileNameSet.insert(strName);
+					shader_files.emplace_back(path);
+				}
+				else
+					stats::add("files_skipped_by_ext");
+			}
+		}
+	}
+
+	// the names of all shaders are kept in fileNameSet, so the shards rename the 3D shaders same as a whole run
+	if (ctx.shard_count > 1) {
+		auto root_len = stdfs::path{dir}.generic_string().size();
+		stats::add("files_other_shards", static_cast<int64_t>(std::erase_if(shader_files, [&](const stdfs::path& path) { return !ctx.in_shard(path.generic_string(), root_len); })));
+	}
+
+	migrate_shader_files(ctx, shader_files, fileNameSet);
+}
+
+// ---------------------------------------- C API, no exception crosses it
+static thread_local std::string t_last_error;
+
+template <typename _Fn>
+static int guard_call(_Fn&& func) {
+	try {
+		return func();
+	}
+	catch (const std::exception& ex) {
+		t_last_error = ex.what();
+	}
+	catch (...) {
+		t_last_error = "unknown error";
+	}
+	return -1;
+}
+
+static void copy_out(std::string_view content, char** out, size_t* out_size) {
+	if (!out)
+		return;
+	*out = static_cast<char*>(malloc(content.size() + 1));
+	if (!*out)
+		throw std::bad_alloc();
+	memcpy(*out, content.data(), content.size());
+	(*out)[content.size()] = '\0';
+	if (out_size)
+		*out_size = content.size();
+}
+
+void ax_migrate_options_init(ax_migrate_options* opts) {
+	opts->flags = 0;
+	opts->extractor = AX_MIGRATE_EXTRACTOR_LEXER;
+	opts->jobs = 0;
+	opts->filters = nullptr;
+	opts->manifest = nullptr;
+	opts->shard_index = 0;
+	opts->shard_count = 0;
+	opts->journal = nullptr;
+	opts->compile_commands = nullptr;
+	opts->includes = nullptr;
+	opts->index = nullptr;
+}
+
+int ax_migrate_cpp_buffer(const ax_migrate_options* opts, const char* data, size_t size, int is_cmake, char** out, size_t* out_size) {
+	return guard_call([&] {
+		migrate_context ctx(opts);
+		std::string content{data, size};
+		std::string rewritten;
+		auto callbacks = ctx.lambdas && !is_cmake ? rewrite_callbacks(content, rewritten) : 0;
+		std::vector<std::string_view> chunks;
+		auto hints = migrate_includes(callbacks ? rewritten : content, is_cmake != 0, ctx.fuzzy, chunks) + callbacks;
+		std::string migrated;
+		migrated.reserve(content.size());
+		for (auto& chunk : chunks)
+			migrated += chunk;
+		copy_out(migrated, out, out_size);
+		return hints;
+	});
+}
+
+int ax_migrate_shader_buffer(const ax_migrate_options* opts, const char* data, size_t size, const char* path, char** out, size_t* out_size) {
+	return guard_call([&] {
+		migrate_context ctx(opts);
+		std::string shader{data, size};
+		if (!shader.empty() && shader.back() != '\n')
+			shader.push_back('\n');
+		std::string stage_path = path ? path : "";
+		int hints = 1;
+		if (ctx.use_ubo)
+			hints = convert_shader_source_one_ast(shader, stage_path);
+		else
+			convert_shader_source_one(shader, stage_path);
+		copy_out(shader, out, out_size);
+		return hints;
+	});
+}
+
+int ax_migrate_tree(const ax_migrate_options* opts, int type, const char* dir, ax_migrate_progress_fn callback, void* user) {
+	return guard_call([&] {
+		if (!dir || !stdfs::is_directory(dir))
+			throw std::runtime_error(fmt::format("The source directory: {} not exist", dir ? dir : ""));
+		migrate_context ctx(opts);
+		ctx.callback = callback;
+		ctx.user = user;
+		// the passes editing the headers by the units including them, a shard would edit them by its units only
+		if (ctx.shard_count > 1 && (type == AX_MIGRATE_TYPE_UMBRELLA || type == AX_MIGRATE_TYPE_FORWARD_DECL ||
+				type == AX_MIGRATE_TYPE_SEMANTIC || type == AX_MIGRATE_TYPE_HOIST || type == AX_MIGRATE_TYPE_GL_COMMANDS))
+			throw std::invalid_argument("the passes editing headers by their includers can't be sharded, migrate the tree");
+		if (type == AX_MIGRATE_TYPE_CPP)
+			process_folder(ctx, dir);
+		else if (type == AX_MIGRATE_TYPE_SHADER)
+			migrate_shader_files_in_dir(ctx, dir);
+		else if (type == AX_MIGRATE_TYPE_UMBRELLA)
+			decompose_umbrella_in_dir(ctx, dir);
+		else if (type == AX_MIGRATE_TYPE_FORWARD_DECL)
+			forward_declare_in_dir(ctx, dir);
+		else if (type == AX_MIGRATE_TYPE_SEMANTIC)
+			rewrite_semantic_in_dir(ctx, dir);
+		else if (type == AX_MIGRATE_TYPE_HOIST)
+			hoist_lookups_in_dir(ctx, dir);
+		else if (type == AX_MIGRATE_TYPE_GL_COMMANDS)
+			convert_gl_commands_in_dir(ctx, dir);
+		else
+			throw std::invalid_argument("invalid migrate type");
+		return ctx.hints.load();
+	});
+}
+
+// the files given and the ones a change of them affects by the include index: the units reaching a header for the
+// passes parsing units, the files including a CC header by the name the cpp pass renames
+static std::vector<std::string> affected_files(const migrate_context& ctx, int type, const char* const* paths, int count) {
+	std::vector<std::string> files{paths, paths + count};
+	if (!ctx.index || (type != AX_MIGRATE_TYPE_CPP && type != AX_MIGRATE_TYPE_UMBRELLA && type != AX_MIGRATE_TYPE_SEMANTIC && type != AX_MIGRATE_TYPE_GL_COMMANDS))
+		return files;
+	TRACE_SCOPE("affected_files");
+	std::set<std::string> given, affected;
+	for (auto& file : files)
+		given.insert(normalize_path(file));
+	for (auto& path : given) {
+		auto name = stdfs::path{path}.filename().generic_string();
+		if (type == AX_MIGRATE_TYPE_CPP) {
+			if (cxx20::ic::starts_with(name, "CC"))
+				ctx.index->includers_of(path, false, affected);
+		}
+		else if (!is_translation_unit(name)) {
+			std::set<std::string> includers;
+			ctx.index->includers_of(path, true, includers);
+			for (auto& includer : includers)
+				if (is_translation_unit(stdfs::path{includer}.filename().generic_string()))
+					affected.insert(includer);
+		}
+	}
+	for (auto& path : affected) {
+		if (given.count(path))
+			continue;
+		files.push_back(path);
+		stats::add("files_affected");
+	}
+	return files;
+}
+
+int ax_migrate_files(const ax_migrate_options* opts, int type, const char* const* given, int count, ax_migrate_progress_fn callback, void* user) {
+	return guard_call([&] {
+		migrate_context ctx(opts);
+		ctx.callback = callback;
+		ctx.user = user;
+		auto files = affected_files(ctx, type, given, count);
+		std::vector<const char*> paths;
+		for (auto& file : files)
+			paths.push_back(file.c_str());
+		count = static_cast<int>(paths.size());
+		if (type == AX_MIGRATE_TYPE_CPP) {
+			std::vector<source_file> source_files;
+			for (int i = 0; i < count; ++i)
+				if (!to_source_file(paths[i], source_files))
+					stats::add("files_skipped_by_ext");
+			process_files(ctx, source_files);
+		}
+		else if (type == AX_MIGRATE_TYPE_SHADER) {
+			// the 3D shaders are renamed by the names of given files only
+			auto filterList = shader_filters(ctx);
+			std::vector<stdfs::path> shader_files;
+			std::set<std::string> fileNameSet;
+			for (int i = 0; i < count; ++i) {
+				stdfs::path path{paths[i]};
+				auto strName = path.filename().generic_string();
+				if (is_in_filter(strName, filterList)) {
+					fileNameSet.insert(strName);
+					shader_files.emplace_back(std::move(path));
+				}
+				else
+					stats::add("files_skipped_by_ext");
+			}
+			migrate_shader_files(ctx, shader_files, fileNameSet);
+		}
+		else if (type == AX_MIGRATE_TYPE_UMBRELLA)
+			decompose_umbrella_files(ctx, files);
+		else if (type == AX_MIGRATE_TYPE_FORWARD_DECL)
+			throw std::invalid_argument("forward-decl verifies the edits by all units of the tree, migrate the tree");
+		else if (type == AX_MIGRATE_TYPE_SEMANTIC)
+			rewrite_semantic_files(ctx, files);
+		else if (type == AX_MIGRATE_TYPE_HOIST)
+			throw std::invalid_argument("hoist names the fields of a class by all units of the tree, migrate the tree");
+		else if (type == AX_MIGRATE_TYPE_GL_COMMANDS)
+			convert_gl_commands_files(ctx, files);
+		else
+			throw std::invalid_argument("invalid migrate type");
+		return ctx.hints.load();
+	});
+}
+
+void ax_migrate_free(void* p) {
+	free(p);
+}
+
+ax_migrate_manifest* ax_migrate_manifest_create(void) {
+	return new (std::nothrow) ax_migrate_manifest();
+}
+
+int ax_migrate_manifest_load(ax_migrate_manifest* manifest, const char* path) {
+	return guard_call([&] {
+		if (!manifest->table.load(path))
+			throw std::runtime_error(fmt::format("{} is not a manifest of axmol-migrate", path));
+		return static_cast<int>(manifest->table.size());
+	});
+}
+
+void ax_migrate_manifest_set_root(ax_migrate_manifest* manifest, const char* dir) {
+	manifest->table.set_root(dir ? dir : "");
+}
+
+ax_migrate_journal* ax_migrate_journal_open(const char* path, int resume) {
+	auto journal = new (std::nothrow) ax_migrate_journal();
+	if (!journal) {
+		t_last_error = "out of memory";
+		return nullptr;
+	}
+	std::string error;
+	if (!journal->log.open(path, resume != 0, error)) {
+		t_last_error = std::move(error);
+		delete journal;
+		return nullptr;
+	}
+	return journal;
+}
+
+void ax_migrate_journal_close(ax_migrate_journal* journal) {
+	delete journal;
+}
+
+int ax_migrate_journal_rollback(const char* path) {
+	return guard_call([&] {
+		std::string error;
+		auto restored = journal::log::rollback(path, error);
+		if (restored < 0)
+			throw std::runtime_error(error);
+		return restored;
+	});
+}
+
+int ax_migrate_manifest_merge(ax_migrate_manifest* manifest, const ax_migrate_manifest* other) {
+	return guard_call([&] {
+		manifest->table.merge(other->table);
+		return static_cast<int>(manifest->table.size());
+	});
+}
+
+int ax_migrate_manifest_save(const ax_migrate_manifest* manifest, const char* path) {
+	return guard_call([&] {
+		if (!manifest->table.save(path))
+			throw std::runtime_error(fmt::format("write manifest {} fail", path));
+		return static_cast<int>(manifest->table.size());
+	});
+}
+
+void ax_migrate_manifest_free(ax_migrate_manifest* manifest) {
+	delete manifest;
+}
+
+ax_migrate_index* ax_migrate_index_open(const ax_migrate_options* opts, const char* dir, const char* path) {
+	std::unique_ptr<ax_migrate_index> index;
+	auto ret = guard_call([&] {
+		if (!dir || !stdfs::is_directory(dir))
+			throw std::runtime_error(fmt::format("The source directory: {} not exist", dir ? dir : ""));
+		if (!path)
+			throw std::invalid_argument("no index path");
+		migrate_context ctx(opts);
+		index = std::make_unique<ax_migrate_index>();
+		if (!index->index.open(path))
+			throw std::runtime_error(fmt::format("{} is not an include index of axmol-migrate", path));
+		index->scanned = index->index.update(ctx, dir);
+		if (!index->index.save(path))
+			throw std::runtime_error(fmt::format("write include index {} fail", path));
+		return 0;
+	});
+	return ret == 0 ? index.release() : nullptr;
+}
+
+void ax_migrate_index_free(ax_migrate_index* index) {
+	delete index;
+}
+
+int ax_migrate_index_size(const ax_migrate_index* index, int* scanned) {
+	if (scanned)
+		*scanned = index->scanned;
+	return static_cast<int>(index->index.size());
+}
+
+ax_migrate_includes* ax_migrate_includes_create(void) {
+	return new (std::nothrow) ax_migrate_includes();
+}
+
+void ax_migrate_includes_free(ax_migrate_includes* includes) {
+	delete includes;
+}
+
+int ax_migrate_suggest_pch(const ax_migrate_options* opts, const ax_migrate_includes* includes, const char* root, const char* out_dir, int max_headers) {
+	return guard_call([&] {
+		if (!includes || !root || !out_dir)
+			throw std::invalid_argument("no includes recorded, root or output dir");
+		migrate_context ctx(opts);
+		return suggest_pch(ctx, *includes, root, out_dir, max_headers);
+	});
+}
+
+int ax_migrate_include_cost(const ax_migrate_options* opts, const char* dir, const char* cache_dir, const char* report, int top, ax_migrate_progress_fn callback, void* user) {
+	return guard_call([&] {
+		if (!dir || !stdfs::is_directory(dir))
+			throw std::runtime_error(fmt::format("The source directory: {} not exist", dir ? dir : ""));
+		migrate_context ctx(opts);
+		ctx.callback = callback;
+		ctx.user = user;
+		return profile_include_cost(ctx, dir, cache_dir ? cache_dir : "", report ? report : "", top);
+	});
+}
+
+int ax_migrate_audit(const ax_migrate_options* opts, const char* dir, const char* report, int top, ax_migrate_progress_fn callback, void* user) {
+	return guard_call([&] {
+		if (!dir || !stdfs::is_directory(dir))
+			throw std::runtime_error(fmt::format("The source directory: {} not exist", dir ? dir : ""));
+		migrate_context ctx(opts);
+		ctx.callback = callback;
+		ctx.user = user;
+		return audit_hot_spots(ctx, dir, report ? report : "", top);
+	});
+}
+
+const char* ax_migrate_last_error(void) {
+	return t_last_error.c_str();
+}
+
+void ax_migrate_set_libclang_path(const char* path) {
+	clang::exe_path = path ? path : "";
+}
+
+void ax_migrate_set_log_level(int level) {
+	logger::set_level(static_cast<logger::level>(std::clamp(level, 0, static_cast<int>(logger::level::verbose))));
+}
+
+const char* ax_migrate_version(void) {
+	return AX_MIGRATE_VER;
+}
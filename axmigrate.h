@@ -0,0 +1,240 @@
+#pragma once
+
+/*
+ * libaxmigrate, the migrate engine of axmol-migrate as a library.
+ *
+ * All functions are re-entrant: the options of a call are passed in, nothing
+ * is kept between calls except the patterns compiled on first use and libclang
+ * loaded on first use, so tools may migrate several buffers or trees at once.
+ *
+ *   ax_migrate_options opts;
+ *   ax_migrate_options_init(&opts);
+ *   char* out; size_t out_size;
+ *   if (ax_migrate_cpp_buffer(&opts, data, size, 0, &out, &out_size) > 0) { ... }
+ *   ax_migrate_free(out);
+ */
+
+#include <stddef.h>
+
+#define AX_MIGRATE_VER "1.1.1"
+
+#if defined(_WIN32) && defined(AX_MIGRATE_SHARED)
+#    if defined(AX_MIGRATE_BUILDING)
+#        define AX_MIGRATE_API __declspec(dllexport)
+#    else
+#        define AX_MIGRATE_API __declspec(dllimport)
+#    endif
+#elif defined(AX_MIGRATE_SHARED) && defined(AX_MIGRATE_BUILDING)
+#    define AX_MIGRATE_API __attribute__((visibility("default")))
+#else
+#    define AX_MIGRATE_API
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+// ax_migrate_options::flags
+#define AX_MIGRATE_FUZZY 0x1    // also migrate #include <CCxxx.h>
+#define AX_MIGRATE_USE_UBO 0x2  // convert shaders by AST, pack uniforms to uniform block
+#define AX_MIGRATE_DRY_RUN 0x4  // report what would change, no file is written, renamed or removed
+#define AX_MIGRATE_LAMBDAS 0x8  // also rewrite CC_CALLBACK_N and std::bind of member callbacks to lambdas
+
+// how the shader literals are extracted from c++ sources
+enum ax_migrate_extractor
+{
+    AX_MIGRATE_EXTRACTOR_LEXER,   // builtin c++ lexer, fallback to libclang tokens when literals depends on macros
+    AX_MIGRATE_EXTRACTOR_TOKENS,  // libclang tokens of main file
+    AX_MIGRATE_EXTRACTOR_AST,     // libclang AST of whole translation unit
+};
+
+enum ax_migrate_type
+{
+    AX_MIGRATE_TYPE_CPP,     // CC includes of c/c++, objc sources and CC paths of CMakeLists.txt
+    AX_MIGRATE_TYPE_SHADER,  // glsl 100 shaders to essl 310
+    AX_MIGRATE_TYPE_UMBRELLA,  // the include of axmol.h or cocos2d.h to the headers used, parses by libclang
+    AX_MIGRATE_TYPE_FORWARD_DECL,  // the includes of headers used by pointers only to forward declarations, tree only
+    AX_MIGRATE_TYPE_SEMANTIC,  // the API changes by the declarations referenced, parses by libclang, rewrites by CXRewriter
+    AX_MIGRATE_TYPE_HOIST,  // the string keyed lookups of the per frame methods to member fields, tree only
+    AX_MIGRATE_TYPE_GL_COMMANDS,  // the raw GL of the CustomCommand callbacks to the backend, parses by libclang
+};
+
+// content hashes of the migrated files, see ax_migrate_manifest_create
+typedef struct ax_migrate_manifest ax_migrate_manifest;
+
+// write-ahead journal of the files written, renamed and removed, see ax_migrate_journal_open
+typedef struct ax_migrate_journal ax_migrate_journal;
+
+// the includes of the c++ files and the targets of the cmake files migrated, see ax_migrate_suggest_pch
+typedef struct ax_migrate_includes ax_migrate_includes;
+
+// the include graph of a project persisted between runs, see ax_migrate_index_open
+typedef struct ax_migrate_index ax_migrate_index;
+
+typedef struct ax_migrate_options
+{
+    int flags;
+    int extractor;        // ax_migrate_extractor
+    int jobs;             // threads of ax_migrate_tree, <= 0: hardware concurrency
+    const char* filters;  // extra file name suffixes of shader tree, separated by ';', i.e. ".cpp;.glsl"
+    ax_migrate_manifest* manifest;  // skip the files unchanged since migrated and record the migrated, may be NULL
+    int shard_index;  // migrate only the files of a tree whose relative path hashes to shard_index of shard_count,
+    int shard_count;  // stable across machines, so shards may be migrated in parallel, shard_count <= 1: all files,
+                      // the cpp and shader types only, the passes editing headers by their includers reject it
+    ax_migrate_journal* journal;  // journal the changes for resume and rollback, may be NULL
+    const char* compile_commands;  // build directory of compile_commands.json for the libclang passes, may be NULL
+    ax_migrate_includes* includes;  // record the includes of the c++ files, the ones unchanged too, may be NULL
+    const ax_migrate_index* index;  // the include graph of the tree, ax_migrate_files adds the files a change affects, may be NULL
+} ax_migrate_options;
+
+AX_MIGRATE_API void ax_migrate_options_init(ax_migrate_options* opts);
+
+enum ax_migrate_event
+{
+    AX_MIGRATE_EVENT_BEGIN,      // a file is going to be migrated
+    AX_MIGRATE_EVENT_REPLACED,   // lines of a c++ or cmake file replaced and saved
+    AX_MIGRATE_EVENT_SKIPPED,    // nothing to replace
+    AX_MIGRATE_EVENT_UNCHANGED,  // unchanged since recorded by the manifest, not migrated again
+    AX_MIGRATE_EVENT_CONVERTED,  // a shader converted, path is the output path
+    AX_MIGRATE_EVENT_WARNING,    // the file is skipped, detail is the reason
+    AX_MIGRATE_EVENT_END,        // sent after BEGIN, also when migrating the file fails
+};
+
+typedef struct ax_migrate_progress
+{
+    int event;           // ax_migrate_event
+    const char* path;    // valid during the callback only
+    const char* detail;  // "cpp" or "cmake" of REPLACED and SKIPPED, the reason of WARNING, otherwise NULL
+    int index;           // index of the file in the tree, in scan order
+    int total;           // files to migrate in the tree
+    size_t size;         // bytes of the file
+    int lines;           // lines replaced
+} ax_migrate_progress;
+
+/*
+ * The files of a tree are migrated in parallel, so the callback is invoked
+ * concurrently, the events of a file are sent in order on one thread.
+ */
+typedef void (*ax_migrate_progress_fn)(const ax_migrate_progress* progress, void* user);
+
+/*
+ * Migrates the CC includes of a c/c++, objc source, or the CC paths of a cmake file.
+ * *out receives the migrated content, free it by ax_migrate_free.
+ * Returns the number of lines replaced, < 0 if fails.
+ */
+AX_MIGRATE_API int ax_migrate_cpp_buffer(const ax_migrate_options* opts, const char* data, size_t size, int is_cmake,
+                                         char** out, size_t* out_size);
+
+/*
+ * Converts a glsl 100 shader to essl 310, path is used to detect the stage (.frag), not accessed.
+ * Returns 1 if converted, < 0 if fails.
+ */
+AX_MIGRATE_API int ax_migrate_shader_buffer(const ax_migrate_options* opts, const char* data, size_t size,
+                                            const char* path, char** out, size_t* out_size);
+
+/*
+ * Migrates the files in dir recursively in place.
+ * Returns the number of files replaced or shaders converted, < 0 if fails.
+ */
+AX_MIGRATE_API int ax_migrate_tree(const ax_migrate_options* opts, int type, const char* dir,
+                                   ax_migrate_progress_fn callback, void* user);
+
+/*
+ * Migrates the given files in place, the files of other types than the tree of type migrates are skipped.
+ * Returns the number of files replaced or shaders converted, < 0 if fails.
+ */
+AX_MIGRATE_API int ax_migrate_files(const ax_migrate_options* opts, int type, const char* const* paths, int count,
+                                    ax_migrate_progress_fn callback, void* user);
+
+AX_MIGRATE_API void ax_migrate_free(void* p);
+
+/*
+ * The manifest makes repeated runs incremental, it's thread safe and may be shared by concurrent calls.
+ * Loading a missing file is not an error, returns the number of entries, < 0 if fails.
+ */
+AX_MIGRATE_API ax_migrate_manifest* ax_migrate_manifest_create(void);
+AX_MIGRATE_API int ax_migrate_manifest_load(ax_migrate_manifest* manifest, const char* path);
+
+// the files under dir are recorded by their path relative to it, so the manifest matches the checkouts at other paths
+AX_MIGRATE_API void ax_migrate_manifest_set_root(ax_migrate_manifest* manifest, const char* dir);
+AX_MIGRATE_API int ax_migrate_manifest_save(const ax_migrate_manifest* manifest, const char* path);
+AX_MIGRATE_API void ax_migrate_manifest_free(ax_migrate_manifest* manifest);
+
+// the entries of other replace the ones of same path in manifest, i.e. to combine the manifests of shards
+AX_MIGRATE_API int ax_migrate_manifest_merge(ax_migrate_manifest* manifest, const ax_migrate_manifest* other);
+
+/*
+ * The originals of the files changed are backed up to <path>.d before changed, the journal is thread safe.
+ * resume: keep the journal of an interrupted run, the files it finished are skipped, the ones it was writing
+ * are restored and migrated again; otherwise a new journal is started. Returns NULL if fails.
+ */
+AX_MIGRATE_API ax_migrate_journal* ax_migrate_journal_open(const char* path, int resume);
+AX_MIGRATE_API void ax_migrate_journal_close(ax_migrate_journal* journal);
+
+// restores the files changed by the runs of the journal, then removes it, returns the entries undone, < 0 if fails
+AX_MIGRATE_API int ax_migrate_journal_rollback(const char* path);
+
+/*
+ * The include graph of the project at dir, saved at path: the include directives of each c++ file, the project file
+ * each resolves to and the files including it, keyed by the xxh3 of the relative path. The file is mapped into memory
+ * as is, then the tree is scanned again, the files changed by size and mtime are read and the ones changed by content
+ * have their directives scanned, and saved if anything changed. A missing file is built from the tree. Given by
+ * ax_migrate_options::index, ax_migrate_files migrates the units reaching the headers given too, for the libclang
+ * passes, and the files including a CC header the cpp pass renames, and forward-decl reads the graph from it.
+ * Returns NULL if fails, path isn't an index or can't be written.
+ */
+AX_MIGRATE_API ax_migrate_index* ax_migrate_index_open(const ax_migrate_options* opts, const char* dir, const char* path);
+AX_MIGRATE_API void ax_migrate_index_free(ax_migrate_index* index);
+
+// the files of the index, the ones scanned by the last open in *scanned if not NULL
+AX_MIGRATE_API int ax_migrate_index_size(const ax_migrate_index* index, int* scanned);
+
+AX_MIGRATE_API ax_migrate_includes* ax_migrate_includes_create(void);
+AX_MIGRATE_API void ax_migrate_includes_free(ax_migrate_includes* includes);
+
+/*
+ * Suggests a precompiled header of the project at root by the includes recorded while migrating it: the headers out
+ * of root included by most translation units, ranked by the units including them times their parse cost measured
+ * by libclang. Writes out_dir/axmol_pch.h and out_dir/axmol_pch.cmake, the target_precompile_headers of the targets
+ * of the project. max_headers <= 0: 16. Returns the number of headers suggested, < 0 if fails.
+ */
+AX_MIGRATE_API int ax_migrate_suggest_pch(const ax_migrate_options* opts, const ax_migrate_includes* includes,
+                                          const char* root, const char* out_dir, int max_headers);
+
+/*
+ * Profiles the includes of the project at dir: each header included is parsed by libclang for its parse time, the
+ * headers it includes transitively and the bytes of them, the cost of an include line is the parse time of its
+ * header times the translation units reaching the includer. The top lines are logged, report receives all of them
+ * ranked as .csv or json by its extension, may be NULL. cache_dir keeps the include graph and the costs with a
+ * manifest of the files measured, a rerun parses the headers changed only, may be NULL. The headers measured
+ * are the files of the progress, WARNING if a header fails to parse.
+ * Returns the number of include lines, < 0 if fails.
+ */
+AX_MIGRATE_API int ax_migrate_include_cost(const ax_migrate_options* opts, const char* dir, const char* cache_dir,
+                                           const char* report, int top, ax_migrate_progress_fn callback, void* user);
+
+/*
+ * Audits the project at dir for per frame hot spots by libclang: child lookups by name or tag, std::string temporaries
+ * built for the engine APIs, cocos2d::Vector copies and schedules by string keys, with their call sites. A hot spot is
+ * ranked by the schedule calls of its enclosing function, the method or lambda scheduled or the update of a class.
+ * The top ones are logged, report receives all of them as json, may be NULL. The units parsed are the files of the
+ * progress, WARNING if a unit fails to parse.
+ * Returns the number of hot spots, < 0 if fails.
+ */
+AX_MIGRATE_API int ax_migrate_audit(const ax_migrate_options* opts, const char* dir, const char* report, int top,
+                                    ax_migrate_progress_fn callback, void* user);
+
+// the error of the last failed call on calling thread
+AX_MIGRATE_API const char* ax_migrate_last_error(void);
+
+// libclang is searched in the directory of path, i.e. argv[0], call before migrating
+AX_MIGRATE_API void ax_migrate_set_libclang_path(const char* path);
+
+// shader parse warnings and libclang loading are logged to stdout, 0: errors, 1: warnings, 2: info (default), 3: verbose
+AX_MIGRATE_API void ax_migrate_set_log_level(int level);
+
+AX_MIGRATE_API const char* ax_migrate_version(void);
+
+#if defined(__cplusplus)
+}
+#endif
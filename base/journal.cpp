@@ -0,0 +1,340 @@
+#include "journal.h"
+#include "manifest.h"
+
+#include <string.h>
+#include <inttypes.h>
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
+namespace stdfs = std::filesystem;
+
+namespace journal
+{
+namespace
+{
+constexpr const char* header = "# axmol-migrate journal 1\n";
+
+bool read_all(const std::string& path, std::string& content)
+{
+    auto fp = fopen(path.c_str(), "rb");
+    if (!fp)
+        return false;
+    content.clear();
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+        content.append(buf, n);
+    bool ok = !ferror(fp);
+    fclose(fp);
+    return ok;
+}
+
+bool write_all(const std::string& path, std::string_view content)
+{
+    auto fp = fopen(path.c_str(), "wb");
+    if (!fp)
+        return false;
+    bool ok = fwrite(content.data(), 1, content.size(), fp) == content.size();
+    return fclose(fp) == 0 && ok;
+}
+
+std::string hash_name(uint64_t hash)
+{
+    char buf[17];
+    snprintf(buf, sizeof(buf), "%016" PRIx64, hash);
+    return buf;
+}
+
+std::string make_line(char op, uint64_t id, std::string_view arg1, std::string_view arg2, char sep)
+{
+    std::string line{op};
+    line += ' ';
+    line += std::to_string(id);
+    line += ' ';
+    line += arg1;
+    line += sep;
+    line += arg2;
+    line += '\n';
+    return line;
+}
+
+struct entry
+{
+    char op    = 0;
+    uint64_t id = 0;
+    std::string hash;  // - if path didn't exist
+    std::string path;
+    std::string to;  // of rename
+    bool done = false;
+};
+
+struct parsed
+{
+    std::vector<entry> entries;
+    std::vector<std::string> finished;
+    uint64_t max_id = 0;
+};
+
+bool parse(const std::string& path, parsed& out, std::string& error)
+{
+    std::string text;
+    if (!read_all(path, text))
+    {
+        error = "read journal " + path + " fail";
+        return false;
+    }
+    std::string_view rest{text};
+    if (rest.substr(0, strlen(header)) != header)
+    {
+        error = path + " is not a journal of axmol-migrate";
+        return false;
+    }
+    rest.remove_prefix(strlen(header));
+
+    std::map<uint64_t, size_t> planned;  // id -> index of entries
+    while (!rest.empty())
+    {
+        auto eol = rest.find('\n');
+        if (eol == std::string_view::npos)
+            break;  // the last line was cut by the interruption
+        std::string line{rest.substr(0, eol)};
+        rest.remove_prefix(eol + 1);
+        if (line.size() < 3 || line[1] != ' ')
+            continue;
+        char op = line[0];
+        if (op == 'F')
+        {
+            out.finished.emplace_back(line.substr(2));
+            continue;
+        }
+        uint64_t id     = 0;
+        int args_offset = 0;
+        if (sscanf(line.c_str() + 2, "%" SCNu64 "%n", &id, &args_offset) < 1)
+            continue;
+        out.max_id = (std::max)(out.max_id, id);
+        if (op == 'C')
+        {
+            auto it = planned.find(id);
+            if (it != planned.end())
+                out.entries[it->second].done = true;
+            continue;
+        }
+        std::string_view args{line.c_str() + 2 + args_offset};
+        if (args.empty() || args.front() != ' ')
+            continue;
+        args.remove_prefix(1);
+        entry ent;
+        ent.op = op;
+        ent.id = id;
+        auto sep = args.find(op == 'R' ? '\t' : ' ');
+        if (sep == std::string_view::npos)
+            continue;
+        if (op == 'W' || op == 'D')
+        {
+            ent.hash = args.substr(0, sep);
+            ent.path = args.substr(sep + 1);
+        }
+        else if (op == 'R')
+        {
+            ent.path = args.substr(0, sep);
+            ent.to   = args.substr(sep + 1);
+        }
+        else
+            continue;
+        planned[id] = out.entries.size();
+        out.entries.push_back(std::move(ent));
+    }
+    return true;
+}
+
+// restores the original of an entry, an entry which wasn't done yet is restored as well
+bool undo(const entry& ent, const std::string& store, std::string& error)
+{
+    std::error_code ec;
+    if (ent.op == 'R')
+    {
+        if (stdfs::exists(ent.to, ec) && !stdfs::exists(ent.path, ec))
+            stdfs::rename(ent.to, ent.path, ec);
+    }
+    else if (ent.hash == "-")
+        stdfs::remove(ent.path, ec);  // created by the migration
+    else
+    {
+        std::string content;
+        if (!read_all(store + "/" + ent.hash, content) || !write_all(ent.path, content))
+        {
+            error = "restore " + ent.path + " fail";
+            return false;
+        }
+    }
+    if (ec)
+    {
+        error = "restore " + ent.path + " fail: " + ec.message();
+        return false;
+    }
+    return true;
+}
+}  // namespace
+
+log::~log()
+{
+    close();
+}
+
+bool log::open(const std::string& path, bool resume, std::string& error)
+{
+    close();
+    _store = path + ".d";
+    std::error_code ec;
+    stdfs::create_directories(_store, ec);
+    if (ec)
+    {
+        error = "create journal store " + _store + " fail: " + ec.message();
+        return false;
+    }
+
+    if (resume && stdfs::exists(path, ec))
+    {
+        parsed prev;
+        if (!parse(path, prev, error))
+            return false;
+        // an interrupted write may have left the file half written, restore the original, it's migrated again,
+        // a removal or rename interrupted is either done or not, nothing to recover
+        for (auto& ent : prev.entries)
+            if (!ent.done && ent.op == 'W' && !undo(ent, _store, error))
+                return false;
+        _finished.insert(prev.finished.begin(), prev.finished.end());
+        _next_id = prev.max_id + 1;
+        _fp      = fopen(path.c_str(), "ab");
+    }
+    else
+    {
+        _fp = fopen(path.c_str(), "wb");
+        if (_fp)
+            fputs(header, _fp);
+    }
+    if (!_fp)
+    {
+        error = "open journal " + path + " fail";
+        return false;
+    }
+    fflush(_fp);
+    return true;
+}
+
+void log::close()
+{
+    std::lock_guard<std::mutex> lck(_mutex);
+    if (_fp)
+    {
+        fclose(_fp);
+        _fp = nullptr;
+    }
+}
+
+void log::backup(std::string_view path, std::string_view content, uint64_t hash, uint64_t id)
+{
+    auto target = _store + "/" + hash_name(hash);
+    std::error_code ec;
+    if (stdfs::exists(target, ec))
+        return;  // content addressed, the same content is backed up already
+    auto temp = target + "." + std::to_string(id) + ".tmp";
+    if (!write_all(temp, content))
+        throw std::runtime_error("journal: backup " + std::string{path} + " fail");
+    stdfs::rename(temp, target, ec);
+    if (ec)
+        throw std::runtime_error("journal: backup " + std::string{path} + " fail: " + ec.message());
+}
+
+void log::append(const std::string& line)
+{
+    std::lock_guard<std::mutex> lck(_mutex);
+    if (_fp)
+    {
+        fwrite(line.data(), 1, line.size(), _fp);
+        fflush(_fp);  // to the OS as appended, survives the process killed or aborted
+    }
+}
+
+uint64_t log::plan_write(std::string_view path)
+{
+    std::error_code ec;
+    if (!stdfs::is_regular_file(path, ec))
+    {
+        auto id = _next_id++;
+        append(make_line('W', id, "-", path, ' '));
+        return id;
+    }
+    std::string original;
+    if (!read_all(std::string{path}, original))
+        throw std::runtime_error("journal: read " + std::string{path} + " fail");
+    return plan_write(path, original);
+}
+
+uint64_t log::plan_write(std::string_view path, std::string_view original)
+{
+    auto id   = _next_id++;
+    auto hash = manifest::hash_of(original);
+    backup(path, original, hash, id);
+    append(make_line('W', id, hash_name(hash), path, ' '));
+    return id;
+}
+
+uint64_t log::plan_remove(std::string_view path)
+{
+    std::string original;
+    if (!read_all(std::string{path}, original))
+        throw std::runtime_error("journal: read " + std::string{path} + " fail");
+    auto id   = _next_id++;
+    auto hash = manifest::hash_of(original);
+    backup(path, original, hash, id);
+    append(make_line('D', id, hash_name(hash), path, ' '));
+    return id;
+}
+
+uint64_t log::plan_rename(std::string_view from, std::string_view to)
+{
+    auto id = _next_id++;
+    append(make_line('R', id, from, to, '\t'));
+    return id;
+}
+
+void log::commit(uint64_t id)
+{
+    append("C " + std::to_string(id) + "\n");
+}
+
+void log::finish(std::string_view path)
+{
+    append("F " + std::string{path} + "\n");
+}
+
+bool log::finished(std::string_view path) const
+{
+    std::lock_guard<std::mutex> lck(_mutex);
+    return _finished.find(path) != _finished.end();
+}
+
+int log::rollback(const std::string& path, std::string& error)
+{
+    parsed prev;
+    if (!parse(path, prev, error))
+        return -1;
+    auto store = path + ".d";
+    int restored = 0;
+    for (auto it = prev.entries.rbegin(); it != prev.entries.rend(); ++it)
+    {
+        if (!undo(*it, store, error))
+            return -1;
+        ++restored;
+    }
+    std::error_code ec;
+    stdfs::remove_all(store, ec);
+    stdfs::remove(path, ec);
+    return restored;
+}
+}  // namespace journal
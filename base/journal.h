@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+
+/*
+ * Write-ahead journal of a migration: every write, rename and removal of a file
+ * is appended before it's done and committed after, the original content is
+ * kept in a content addressed store beside the journal (<journal>.d/<xxh3 hex>).
+ * An interrupted run resumes by skipping the files finished, and any run is
+ * rolled back by undoing the entries in reverse. All functions are thread safe.
+ *
+ * Saved as text, one entry per line, flushed as appended:
+ *   W <id> <hash|-> <path>    planned write, - if path didn't exist
+ *   D <id> <hash> <path>      planned removal
+ *   R <id> <from>\t<to>       planned rename
+ *   C <id>                    the entry id is done
+ *   F <path>                  the file is migrated completely
+ */
+namespace journal
+{
+class log
+{
+public:
+    ~log();
+
+    // opens path for appending, resume keeps the entries of the previous run and recovers its pending writes
+    bool open(const std::string& path, bool resume, std::string& error);
+
+    void close();
+
+    // before writing path, backs up the original content, returns the id to commit, throws if backup fails
+    uint64_t plan_write(std::string_view path);
+    uint64_t plan_write(std::string_view path, std::string_view original);
+
+    // before removing path, backs up its content
+    uint64_t plan_remove(std::string_view path);
+
+    uint64_t plan_rename(std::string_view from, std::string_view to);
+
+    void commit(uint64_t id);
+
+    // path is migrated completely, resume skips it
+    void finish(std::string_view path);
+
+    bool finished(std::string_view path) const;
+
+    // restores the original files of the journal at path in reverse order, then removes the journal and its store,
+    // returns the number of files restored, -1 if fails
+    static int rollback(const std::string& path, std::string& error);
+
+private:
+    void backup(std::string_view path, std::string_view content, uint64_t hash, uint64_t id);
+    void append(const std::string& line);
+
+    mutable std::mutex _mutex;
+    FILE* _fp = nullptr;
+    std::string _store;
+    std::atomic<uint64_t> _next_id{1};
+    std::set<std::string, std::less<>> _finished;
+};
+}  // namespace journal
@@ -0,0 +1,346 @@
+#include "json.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+namespace json
+{
+namespace
+{
+constexpr int max_depth = 128;  // parsing recurses per nesting level
+
+struct parser
+{
+    const char* ptr;
+    const char* end;
+
+    void skip_ws()
+    {
+        while (ptr < end && (*ptr == ' ' || *ptr == '\t' || *ptr == '\n' || *ptr == '\r'))
+            ++ptr;
+    }
+
+    bool consume(std::string_view literal)
+    {
+        if (static_cast<size_t>(end - ptr) < literal.size() || std::string_view{ptr, literal.size()} != literal)
+            return false;
+        ptr += literal.size();
+        return true;
+    }
+
+    static void append_utf8(std::string& out, unsigned cp)
+    {
+        if (cp < 0x80)
+            out.push_back(static_cast<char>(cp));
+        else if (cp < 0x800)
+        {
+            out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+        else if (cp < 0x10000)
+        {
+            out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+        else
+        {
+            out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+    }
+
+    bool parse_hex4(unsigned& cp)
+    {
+        if (end - ptr < 4)
+            return false;
+        cp = 0;
+        for (int i = 0; i < 4; ++i, ++ptr)
+        {
+            char ch = *ptr;
+            cp <<= 4;
+            if (ch >= '0' && ch <= '9')
+                cp |= ch - '0';
+            else if (ch >= 'a' && ch <= 'f')
+                cp |= ch - 'a' + 10;
+            else if (ch >= 'A' && ch <= 'F')
+                cp |= ch - 'A' + 10;
+            else
+                return false;
+        }
+        return true;
+    }
+
+    bool parse_string(std::string& out)
+    {
+        if (ptr >= end || *ptr != '"')
+            return false;
+        ++ptr;
+        while (ptr < end)
+        {
+            char ch = *ptr++;
+            if (ch == '"')
+                return true;
+            if (static_cast<unsigned char>(ch) < 0x20)
+                return false;
+            if (ch != '\\')
+            {
+                out.push_back(ch);
+                continue;
+            }
+            if (ptr >= end)
+                return false;
+            switch (*ptr++)
+            {
+            case '"':
+                out.push_back('"');
+                break;
+            case '\\':
+                out.push_back('\\');
+                break;
+            case '/':
+                out.push_back('/');
+                break;
+            case 'b':
+                out.push_back('\b');
+                break;
+            case 'f':
+                out.push_back('\f');
+                break;
+            case 'n':
+                out.push_back('\n');
+                break;
+            case 'r':
+                out.push_back('\r');
+                break;
+            case 't':
+                out.push_back('\t');
+                break;
+            case 'u':
+            {
+                unsigned cp = 0;
+                if (!parse_hex4(cp))
+                    return false;
+                if (cp >= 0xD800 && cp < 0xDC00)  // surrogate pair
+                {
+                    unsigned low = 0;
+                    if (!consume("\\u") || !parse_hex4(low) || low < 0xDC00 || low >= 0xE000)
+                        return false;
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                }
+                append_utf8(out, cp);
+                break;
+            }
+            default:
+                return false;
+            }
+        }
+        return false;
+    }
+
+    bool parse_number(double& out)
+    {
+        auto first = ptr;
+        if (ptr < end && *ptr == '-')
+            ++ptr;
+        bool digits = false;
+        auto skip_digits = [&] {
+            while (ptr < end && *ptr >= '0' && *ptr <= '9')
+            {
+                ++ptr;
+                digits = true;
+            }
+        };
+        skip_digits();
+        if (ptr < end && *ptr == '.')
+        {
+            ++ptr;
+            skip_digits();
+        }
+        if (ptr < end && (*ptr == 'e' || *ptr == 'E'))
+        {
+            ++ptr;
+            if (ptr < end && (*ptr == '+' || *ptr == '-'))
+                ++ptr;
+            skip_digits();
+        }
+        if (!digits)
+            return false;
+        std::string text{first, static_cast<size_t>(ptr - first)};  // strtod needs a terminated string
+        out = strtod(text.c_str(), nullptr);
+        return true;
+    }
+
+    bool parse_value(value& out, int depth)
+    {
+        if (depth > max_depth)
+            return false;
+        skip_ws();
+        if (ptr >= end)
+            return false;
+        switch (*ptr)
+        {
+        case '{':
+            ++ptr;
+            out.type = value::kind::object;
+            skip_ws();
+            if (ptr < end && *ptr == '}')
+            {
+                ++ptr;
+                return true;
+            }
+            for (;;)
+            {
+                skip_ws();
+                std::pair<std::string, value> member;
+                if (!parse_string(member.first))
+                    return false;
+                skip_ws();
+                if (ptr >= end || *ptr++ != ':')
+                    return false;
+                if (!parse_value(member.second, depth + 1))
+                    return false;
+                out.members.push_back(std::move(member));
+                skip_ws();
+                if (ptr >= end)
+                    return false;
+                if (*ptr == ',')
+                    ++ptr;
+                else if (*ptr++ == '}')
+                    return true;
+                else
+                    return false;
+            }
+        case '[':
+            ++ptr;
+            out.type = value::kind::array;
+            skip_ws();
+            if (ptr < end && *ptr == ']')
+            {
+                ++ptr;
+                return true;
+            }
+            for (;;)
+            {
+                out.items.emplace_back();
+                if (!parse_value(out.items.back(), depth + 1))
+                    return false;
+                skip_ws();
+                if (ptr >= end)
+                    return false;
+                if (*ptr == ',')
+                    ++ptr;
+                else if (*ptr++ == ']')
+                    return true;
+                else
+                    return false;
+            }
+        case '"':
+            out.type = value::kind::string;
+            return parse_string(out.string);
+        case 't':
+            out.type    = value::kind::boolean;
+            out.boolean = true;
+            return consume("true");
+        case 'f':
+            out.type = value::kind::boolean;
+            return consume("false");
+        case 'n':
+            return consume("null");
+        default:
+            out.type = value::kind::number;
+            return parse_number(out.number);
+        }
+    }
+};
+}  // namespace
+
+const value* value::find(std::string_view key) const
+{
+    for (auto& member : members)
+        if (member.first == key)
+            return &member.second;
+    return nullptr;
+}
+
+std::string_view value::get_string(std::string_view key, std::string_view default_value) const
+{
+    auto val = find(key);
+    return val && val->is_string() ? std::string_view{val->string} : default_value;
+}
+
+double value::get_number(std::string_view key, double default_value) const
+{
+    auto val = find(key);
+    return val && val->is_number() ? val->number : default_value;
+}
+
+bool value::get_bool(std::string_view key, bool default_value) const
+{
+    auto val = find(key);
+    return val && val->type == kind::boolean ? val->boolean : default_value;
+}
+
+bool parse(std::string_view text, value& out)
+{
+    out = value{};
+    parser p{text.data(), text.data() + text.size()};
+    if (!p.parse_value(out, 0))
+        return false;
+    p.skip_ws();
+    return p.ptr == p.end;
+}
+
+void append(std::string& out, const value& val)
+{
+    switch (val.type)
+    {
+    case value::kind::null:
+        out += "null";
+        break;
+    case value::kind::boolean:
+        out += val.boolean ? "true" : "false";
+        break;
+    case value::kind::number:
+    {
+        char buf[32];
+        if (!isfinite(val.number))
+            snprintf(buf, sizeof(buf), "null");
+        else if (fabs(val.number) < 1e15 && val.number == static_cast<double>(static_cast<int64_t>(val.number)))
+            snprintf(buf, sizeof(buf), "%lld", static_cast<long long>(val.number));
+        else
+            snprintf(buf, sizeof(buf), "%.17g", val.number);
+        out += buf;
+        break;
+    }
+    case value::kind::string:
+        append_quoted(out, val.string);
+        break;
+    case value::kind::array:
+        out.push_back('[');
+        for (size_t i = 0; i < val.items.size(); ++i)
+        {
+            if (i)
+                out.push_back(',');
+            append(out, val.items[i]);
+        }
+        out.push_back(']');
+        break;
+    case value::kind::object:
+        out.push_back('{');
+        for (size_t i = 0; i < val.members.size(); ++i)
+        {
+            if (i)
+                out.push_back(',');
+            append_quoted(out, val.members[i].first);
+            out.push_back(':');
+            append(out, val.members[i].second);
+        }
+        out.push_back('}');
+        break;
+    }
+}
+}  // namespace json
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <stdio.h>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace json
+{
+// append str as a quoted json string
+inline void append_quoted(std::string& out, std::string_view str)
+{
+    out.push_back('"');
+    for (auto ch : str)
+    {
+        switch (ch)
+        {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\r':
+            out += "\\r";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(ch) < 0x20)
+            {
+                char buf[8];
+                snprintf(buf, sizeof(buf), "\\u%04x", ch);
+                out += buf;
+            }
+            else
+                out.push_back(ch);
+        }
+    }
+    out.push_back('"');
+}
+
+inline std::string quoted(std::string_view str)
+{
+    std::string out;
+    out.reserve(str.size() + 2);
+    append_quoted(out, str);
+    return out;
+}
+
+// a parsed json document, numbers are double, the members of object keep their order
+struct value
+{
+    enum class kind
+    {
+        null,
+        boolean,
+        number,
+        string,
+        array,
+        object,
+    };
+
+    kind type     = kind::null;
+    bool boolean  = false;
+    double number = 0;
+    std::string string;
+    std::vector<value> items;
+    std::vector<std::pair<std::string, value>> members;
+
+    bool is_null() const { return type == kind::null; }
+    bool is_string() const { return type == kind::string; }
+    bool is_number() const { return type == kind::number; }
+    bool is_array() const { return type == kind::array; }
+    bool is_object() const { return type == kind::object; }
+
+    // the member of object, nullptr if not found or not object
+    const value* find(std::string_view key) const;
+
+    std::string_view get_string(std::string_view key, std::string_view default_value = {}) const;
+    double get_number(std::string_view key, double default_value = 0) const;
+    bool get_bool(std::string_view key, bool default_value = false) const;
+};
+
+// parse the whole text as one json value, returns false if it isn't valid json
+bool parse(std::string_view text, value& out);
+
+// append the value as compact json
+void append(std::string& out, const value& val);
+}  // namespace json
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <regex>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <optional>
+
+namespace axstd
+{
+/*
+ * A regex compiled on first use, the constexpr constructor makes namespace scope
+ * instances constant initialized, so no pattern is compiled at process start.
+ */
+class lazy_regex
+{
+public:
+    constexpr lazy_regex(const char* pattern,
+                         std::regex_constants::syntax_option_type flags = std::regex_constants::ECMAScript)
+        : _pattern(pattern), _flags(flags)
+    {}
+
+    const std::regex& get() const
+    {
+        std::call_once(_once, [this] {
+            auto start = std::chrono::steady_clock::now();
+            _re.emplace(_pattern, _flags);
+            auto cost  = std::chrono::steady_clock::now() - start;
+            compile_nanos.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(cost).count(),
+                                    std::memory_order_relaxed);
+            compiled_count.fetch_add(1, std::memory_order_relaxed);
+        });
+        return *_re;
+    }
+
+    const std::regex& operator*() const { return get(); }
+
+    // stats of all lazy regexes, for startup report
+    static inline std::atomic<int> compiled_count{0};
+    static inline std::atomic<int64_t> compile_nanos{0};
+
+private:
+    const char* _pattern;
+    std::regex_constants::syntax_option_type _flags;
+    mutable std::once_flag _once;
+    mutable std::optional<std::regex> _re;
+};
+
+// std::regex of libstdc++ and msvc recurses once per repeated char, a longer subject may overflow
+// the stack (~300 bytes per char), lines longer than this are minified or generated code, skip them
+inline constexpr size_t regex_max_subject = 2048;
+}  // namespace axstd
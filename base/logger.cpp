@@ -0,0 +1,212 @@
+#include "logger.h"
+
+#include <stdio.h>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace logger
+{
+level g_level = level::info;
+
+namespace
+{
+constexpr size_t unordered = static_cast<size_t>(-1);
+constexpr size_t reset_seq = static_cast<size_t>(-2);
+
+struct segment
+{
+    bool is_error;
+    std::string text;
+};
+
+struct entry
+{
+    size_t seq;
+    std::vector<segment> segments;
+};
+
+std::mutex s_mutex;
+std::condition_variable s_cv;       // notify writer
+std::condition_variable s_idle_cv;  // notify flush
+std::deque<entry> s_queue;
+std::thread s_writer;
+bool s_running = false;
+bool s_writing = false;
+FILE* s_out    = stdout;
+
+// accessed by writer thread, or under s_mutex when not started
+std::map<size_t, std::vector<segment>> s_held;  // items finished before the preceding ones
+size_t s_next_seq = 0;
+
+// messages of the item_scope on calling thread
+thread_local bool t_in_item = false;
+thread_local std::vector<segment> t_item;
+thread_local size_t t_item_seq = 0;
+
+void output(const std::vector<segment>& segments)
+{
+    for (auto& seg : segments)
+        fwrite(seg.text.data(), seg.text.size(), 1, seg.is_error ? stderr : s_out);
+}
+
+void dispatch(entry& ent)
+{
+    if (ent.seq == unordered)
+        output(ent.segments);
+    else if (ent.seq == reset_seq)
+    {
+        for (auto& item : s_held)  // unterminated items, shouldn't happen
+            output(item.second);
+        s_held.clear();
+        s_next_seq = 0;
+    }
+    else if (ent.seq == s_next_seq)
+    {
+        output(ent.segments);
+        ++s_next_seq;
+        for (auto it = s_held.begin(); it != s_held.end() && it->first == s_next_seq; it = s_held.erase(it))
+        {
+            output(it->second);
+            ++s_next_seq;
+        }
+    }
+    else
+        s_held.emplace(ent.seq, std::move(ent.segments));
+}
+
+void submit(entry&& ent)
+{
+    std::unique_lock<std::mutex> lck(s_mutex);
+    if (s_running)
+    {
+        s_queue.push_back(std::move(ent));
+        lck.unlock();
+        s_cv.notify_one();
+    }
+    else
+        dispatch(ent);
+}
+
+void run()
+{
+    std::deque<entry> batch;
+    std::unique_lock<std::mutex> lck(s_mutex);
+    for (;;)
+    {
+        s_cv.wait(lck, [] { return !s_queue.empty() || !s_running; });
+        if (s_queue.empty())
+            break;
+        batch.swap(s_queue);
+        s_writing = true;
+        lck.unlock();
+
+        for (auto& ent : batch)
+            dispatch(ent);
+        batch.clear();
+
+        lck.lock();
+        if (s_queue.empty())
+        {
+            // flush only when idle, a burst of messages costs one write
+            fflush(s_out);
+            fflush(stderr);
+        }
+        s_writing = false;
+        s_idle_cv.notify_all();
+    }
+    fflush(s_out);
+    fflush(stderr);
+}
+}  // namespace
+
+void set_output(FILE* out)
+{
+    std::lock_guard<std::mutex> lck(s_mutex);
+    s_out = out;
+}
+
+void start()
+{
+    std::lock_guard<std::mutex> lck(s_mutex);
+    if (s_running)
+        return;
+    setvbuf(stdout, nullptr, _IOFBF, 64 * 1024);
+    s_running = true;
+    s_writer  = std::thread(run);
+}
+
+void stop()
+{
+    {
+        std::lock_guard<std::mutex> lck(s_mutex);
+        if (!s_running)
+            return;
+        s_running = false;
+    }
+    s_cv.notify_one();
+    s_writer.join();
+}
+
+void flush()
+{
+    std::unique_lock<std::mutex> lck(s_mutex);
+    if (s_running)
+        s_idle_cv.wait(lck, [] { return s_queue.empty() && !s_writing; });
+    else
+    {
+        fflush(s_out);
+        fflush(stderr);
+    }
+}
+
+void write(level lvl, std::string_view msg)
+{
+    segment seg{lvl == level::error, std::string{msg}};
+    seg.text.push_back('\n');
+    if (t_in_item)
+    {
+        if (!t_item.empty() && t_item.back().is_error == seg.is_error)
+            t_item.back().text += seg.text;
+        else
+            t_item.push_back(std::move(seg));
+    }
+    else
+    {
+        entry ent{unordered, {}};
+        ent.segments.push_back(std::move(seg));
+        submit(std::move(ent));
+    }
+}
+
+void begin_items()
+{
+    submit(entry{reset_seq, {}});
+}
+
+void begin_item(size_t seq)
+{
+    t_in_item  = true;
+    t_item_seq = seq;
+}
+
+void end_item()
+{
+    t_in_item = false;
+    submit(entry{t_item_seq, std::move(t_item)});  // submit empty items too, the next ones wait for it
+    t_item.clear();
+}
+
+item_scope::item_scope(size_t seq)
+{
+    begin_item(seq);
+}
+
+item_scope::~item_scope()
+{
+    end_item();
+}
+}  // namespace logger
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string>
+#include <string_view>
+#include "fmt/format.h"
+
+/*
+ * Buffered logger, messages are written by a background thread so that
+ * terminal output doesn't stall migrating, errors go to stderr, others to stdout.
+ *
+ * Messages logged inside an item_scope are held until the item ends and
+ * written in the order of item sequence, so parallel runs print the same
+ * output as serial runs:
+ *
+ *   logger::begin_items();
+ *   parallel: { logger::item_scope _li(index); logger::info("..."); }
+ */
+namespace logger
+{
+enum class level
+{
+    error,
+    warn,
+    info,
+    verbose,
+};
+
+extern level g_level;
+
+inline bool enabled(level lvl)
+{
+    return lvl <= g_level;
+}
+
+inline void set_level(level lvl)
+{
+    g_level = lvl;
+}
+
+// the non-error messages are written to stdout by default, i.e. stderr when stdout carries a protocol, set before logging
+void set_output(FILE* out);
+
+// start the writer thread, messages are written synchronously when not started
+void start();
+
+// write all pending messages and join the writer thread
+void stop();
+
+// wait until all messages logged before are written
+void flush();
+
+void write(level lvl, std::string_view msg);
+
+// the next item_scope sequence is 0
+void begin_items();
+
+// the messages logged on calling thread until end_item belong to item seq, for callbacks which can't use item_scope
+void begin_item(size_t seq);
+void end_item();
+
+struct item_scope
+{
+    explicit item_scope(size_t seq);
+    ~item_scope();
+
+    item_scope(const item_scope&)            = delete;
+    item_scope& operator=(const item_scope&) = delete;
+};
+
+template <typename... _Args>
+inline void log(level lvl, fmt::format_string<_Args...> format, _Args&&... args)
+{
+    if (enabled(lvl))
+        write(lvl, fmt::format(format, std::forward<_Args>(args)...));
+}
+
+template <typename... _Args>
+inline void error(fmt::format_string<_Args...> format, _Args&&... args)
+{
+    log(level::error, format, std::forward<_Args>(args)...);
+}
+
+template <typename... _Args>
+inline void warn(fmt::format_string<_Args...> format, _Args&&... args)
+{
+    log(level::warn, format, std::forward<_Args>(args)...);
+}
+
+template <typename... _Args>
+inline void info(fmt::format_string<_Args...> format, _Args&&... args)
+{
+    log(level::info, format, std::forward<_Args>(args)...);
+}
+
+template <typename... _Args>
+inline void verbose(fmt::format_string<_Args...> format, _Args&&... args)
+{
+    log(level::verbose, format, std::forward<_Args>(args)...);
+}
+}  // namespace logger
@@ -0,0 +1,174 @@
+#include "manifest.h"
+#include "xxhash/xxhash.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <filesystem>
+#include <system_error>
+
+namespace stdfs = std::filesystem;
+
+namespace manifest
+{
+namespace
+{
+constexpr const char* header = "# axmol-migrate manifest 1\n";
+
+bool stat_file(std::string_view path, int64_t& size, int64_t& mtime)
+{
+    std::error_code ec;
+    stdfs::path fspath{path};
+    auto fsize = stdfs::file_size(fspath, ec);
+    if (ec)
+        return false;
+    auto ftime = stdfs::last_write_time(fspath, ec);
+    if (ec)
+        return false;
+    size  = static_cast<int64_t>(fsize);
+    mtime = static_cast<int64_t>(ftime.time_since_epoch().count());
+    return true;
+}
+}  // namespace
+
+uint64_t hash_of(std::string_view content)
+{
+    return XXH3_64bits(content.data(), content.size());
+}
+
+uint64_t hash_of(const std::vector<std::string_view>& chunks)
+{
+    auto state = XXH3_createState();
+    XXH3_64bits_reset(state);
+    for (auto& chunk : chunks)
+        XXH3_64bits_update(state, chunk.data(), chunk.size());
+    auto hash = XXH3_64bits_digest(state);
+    XXH3_freeState(state);
+    return hash;
+}
+
+void table::set_root(std::string_view dir)
+{
+    _root.clear();
+    if (dir.empty())
+        return;
+    std::error_code ec;
+    _root = stdfs::absolute(stdfs::path{dir}, ec).lexically_normal().generic_string();
+    if (_root.empty() || _root.back() != '/')
+        _root.push_back('/');
+}
+
+std::string table::key_of(std::string_view path) const
+{
+    if (_root.empty())
+        return std::string{path};
+    std::error_code ec;
+    auto abspath = stdfs::absolute(stdfs::path{path}, ec).lexically_normal().generic_string();
+    if (abspath.compare(0, _root.size(), _root) != 0)
+        return abspath;  // out of the tree
+    return abspath.substr(_root.size());
+}
+
+bool table::unchanged_stat(std::string_view path, int flags) const
+{
+    int64_t size = 0, mtime = 0;
+    if (!stat_file(path, size, mtime))
+        return false;
+    auto key = key_of(path);
+    std::lock_guard<std::mutex> lck(_mutex);
+    auto it = _entries.find(key);
+    return it != _entries.end() && it->second.flags == flags && it->second.size == size && it->second.mtime == mtime;
+}
+
+bool table::unchanged(std::string_view path, uint64_t hash, int flags) const
+{
+    auto key = key_of(path);
+    std::lock_guard<std::mutex> lck(_mutex);
+    auto it = _entries.find(key);
+    return it != _entries.end() && it->second.flags == flags && it->second.hash == hash;
+}
+
+void table::record(std::string_view path, uint64_t hash, int flags)
+{
+    entry ent{hash, -1, 0, flags};
+    if (!stat_file(path, ent.size, ent.mtime))
+        ent.size = -1;  // compared by hash only
+    auto key = key_of(path);
+    std::lock_guard<std::mutex> lck(_mutex);
+    _entries[std::move(key)] = ent;
+}
+
+void table::erase(std::string_view path)
+{
+    auto key = key_of(path);
+    std::lock_guard<std::mutex> lck(_mutex);
+    auto it = _entries.find(key);
+    if (it != _entries.end())
+        _entries.erase(it);
+}
+
+void table::merge(const table& other)
+{
+    if (&other == this)
+        return;
+    std::scoped_lock lck(_mutex, other._mutex);
+    for (auto& item : other._entries)
+        _entries[item.first] = item.second;
+}
+
+bool table::load(const std::string& path)
+{
+    auto fp = fopen(path.c_str(), "rb");
+    if (!fp)
+        return true;
+
+    std::map<std::string, entry, std::less<>> entries;
+    char line[4096];
+    bool valid = fgets(line, sizeof(line), fp) && strcmp(line, header) == 0;
+    while (valid && fgets(line, sizeof(line), fp))
+    {
+        entry ent;
+        int path_offset = 0;
+        if (sscanf(line, "%" SCNx64 " %" SCNd64 " %" SCNd64 " %d %n", &ent.hash, &ent.size, &ent.mtime, &ent.flags,
+                   &path_offset) < 4 ||
+            path_offset == 0)
+        {
+            valid = false;
+            break;
+        }
+        std::string_view file_path{line + path_offset};
+        while (!file_path.empty() && (file_path.back() == '\n' || file_path.back() == '\r'))
+            file_path.remove_suffix(1);
+        if (!file_path.empty())
+            entries[std::string{file_path}] = ent;
+    }
+    fclose(fp);
+    if (!valid)
+        return false;
+
+    std::lock_guard<std::mutex> lck(_mutex);
+    _entries = std::move(entries);
+    return true;
+}
+
+bool table::save(const std::string& path) const
+{
+    auto fp = fopen(path.c_str(), "wb");
+    if (!fp)
+        return false;
+    fputs(header, fp);
+    {
+        std::lock_guard<std::mutex> lck(_mutex);
+        for (auto& item : _entries)
+            fprintf(fp, "%016" PRIx64 " %" PRId64 " %" PRId64 " %d %s\n", item.second.hash, item.second.size,
+                    item.second.mtime, item.second.flags, item.first.c_str());
+    }
+    return fclose(fp) == 0;
+}
+
+size_t table::size() const
+{
+    std::lock_guard<std::mutex> lck(_mutex);
+    return _entries.size();
+}
+}  // namespace manifest
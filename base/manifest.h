@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdint.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * Incremental manifest: the content hash of each file after it was migrated.
+ * A file whose content still matches its entry is migrated already and skipped
+ * without running the patterns, the size and mtime are compared first so
+ * unchanged files are not even read. All functions are thread safe.
+ *
+ * Saved as text, one entry per line: <xxh3 hex> <size> <mtime> <flags> <path>
+ *
+ * With a root set, the files under it are keyed by the path relative to it, so
+ * the manifests of checkouts at other paths, i.e. of build agents, match.
+ */
+namespace manifest
+{
+struct entry
+{
+    uint64_t hash = 0;
+    int64_t size  = -1;
+    int64_t mtime = 0;  // file_time_type ticks, only meaningful on the machine which recorded it
+    int flags     = 0;  // the options which affect the output, an entry of other options doesn't match
+};
+
+uint64_t hash_of(std::string_view content);
+
+// the hash of the chunks joined
+uint64_t hash_of(const std::vector<std::string_view>& chunks);
+
+class table
+{
+public:
+    // the directory the paths of entries are relative to, set before the first lookup, empty: the paths as given
+    void set_root(std::string_view dir);
+
+    // whether the size and mtime of the file match the entry of path
+    bool unchanged_stat(std::string_view path, int flags) const;
+
+    // whether the content hash matches the entry of path
+    bool unchanged(std::string_view path, uint64_t hash, int flags) const;
+
+    // record the content hash of path after migrating, the size and mtime are read from the file
+    void record(std::string_view path, uint64_t hash, int flags);
+
+    void erase(std::string_view path);
+
+    // the entries of other replace the ones of same path
+    void merge(const table& other);
+
+    // a missing file loads as empty, returns false if the file isn't a manifest
+    bool load(const std::string& path);
+
+    bool save(const std::string& path) const;
+
+    size_t size() const;
+
+private:
+    std::string key_of(std::string_view path) const;
+
+    std::string _root;  // absolute with trailing '/'
+    mutable std::mutex _mutex;
+    std::map<std::string, entry, std::less<>> _entries;
+};
+}  // namespace manifest
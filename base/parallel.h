@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stddef.h>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace axstd
+{
+// the default of --jobs
+inline int hardware_jobs()
+{
+    auto n = std::thread::hardware_concurrency();
+    return n > 0 ? static_cast<int>(n) : 1;
+}
+
+/*
+ * Calls func(index) for index in [0, count) on jobs threads, the caller thread is one of them.
+ * Indices are claimed in order, the first exception thrown is rethrown on caller thread
+ * after all threads finished, the remaining indices are not processed.
+ */
+template <typename _Fn>
+inline void parallel_for(size_t count, int jobs, _Fn&& func)
+{
+    if (jobs <= 1 || count <= 1)
+    {
+        for (size_t i = 0; i < count; ++i)
+            func(i);
+        return;
+    }
+
+    std::atomic<size_t> next{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+    std::mutex error_mtx;
+    auto worker = [&] {
+        for (size_t i; !failed.load(std::memory_order_relaxed) && (i = next.fetch_add(1)) < count;)
+        {
+            try
+            {
+                func(i);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lck(error_mtx);
+                if (!error)
+                    error = std::current_exception();
+                failed = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    auto num_threads = static_cast<size_t>(jobs) < count ? static_cast<size_t>(jobs) : count;
+    threads.reserve(num_threads - 1);
+    for (size_t i = 1; i < num_threads; ++i)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& t : threads)
+        t.join();
+
+    if (error)
+        std::rethrow_exception(error);
+}
+}  // namespace axstd
@@ -0,0 +1,222 @@
+#include "stats.h"
+#include "trace.h"
+#include "json.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#if defined(_WIN32)
+#    include <windows.h>
+#    include <psapi.h>
+#else
+#    include <sys/resource.h>
+#endif
+
+namespace stats
+{
+bool g_enabled = false;
+
+namespace
+{
+struct file_time
+{
+    std::string path;
+    int64_t nanos;
+};
+
+std::mutex s_mutex;
+std::map<std::string, int64_t, std::less<>> s_counters;
+std::map<std::string, int64_t, std::less<>> s_matches;
+std::vector<file_time> s_slowest;  // min-heap of top N
+int s_top_files = 10;
+
+void add_to(std::map<std::string, int64_t, std::less<>>& dict, std::string_view key, int64_t value)
+{
+    std::lock_guard<std::mutex> lck(s_mutex);
+    auto it = dict.find(key);
+    if (it != dict.end())
+        it->second += value;
+    else
+        dict.emplace(key, value);
+}
+
+bool slower(const file_time& lhs, const file_time& rhs)
+{
+    return lhs.nanos > rhs.nanos;
+}
+
+double to_ms(int64_t nanos)
+{
+    return nanos / 1000000.0;
+}
+}  // namespace
+
+void enable(int top_files)
+{
+    g_enabled   = true;
+    s_top_files = top_files;
+    trace::enable_phase_totals();
+}
+
+void add(std::string_view counter, int64_t value)
+{
+    if (g_enabled)
+        add_to(s_counters, counter, value);
+}
+
+void add_match(std::string_view rule, int64_t value)
+{
+    if (g_enabled)
+        add_to(s_matches, rule, value);
+}
+
+int64_t get(std::string_view counter)
+{
+    std::lock_guard<std::mutex> lck(s_mutex);
+    auto it = s_counters.find(counter);
+    return it != s_counters.end() ? it->second : 0;
+}
+
+void add_file_time(std::string_view path, int64_t nanos)
+{
+    if (!g_enabled || s_top_files <= 0)
+        return;
+    std::lock_guard<std::mutex> lck(s_mutex);
+    if (static_cast<int>(s_slowest.size()) < s_top_files)
+    {
+        s_slowest.push_back(file_time{std::string{path}, nanos});
+        std::push_heap(s_slowest.begin(), s_slowest.end(), slower);
+    }
+    else if (nanos > s_slowest.front().nanos)
+    {
+        std::pop_heap(s_slowest.begin(), s_slowest.end(), slower);
+        s_slowest.back() = file_time{std::string{path}, nanos};
+        std::push_heap(s_slowest.begin(), s_slowest.end(), slower);
+    }
+}
+
+int64_t peak_rss_bytes()
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS pmc{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return static_cast<int64_t>(pmc.PeakWorkingSetSize);
+    return 0;
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#    if defined(__APPLE__)
+    return static_cast<int64_t>(usage.ru_maxrss);  // bytes
+#    else
+    return static_cast<int64_t>(usage.ru_maxrss) * 1024;  // kilobytes
+#    endif
+#endif
+}
+
+int64_t process_cpu_nanos()
+{
+#if defined(_WIN32)
+    FILETIME creation, exit, kernel, user;
+    if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+        return 0;
+    auto to_nanos = [](const FILETIME& ft) {
+        return ((static_cast<int64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime) * 100;
+    };
+    return to_nanos(kernel) + to_nanos(user);
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    auto to_nanos = [](const timeval& tv) {
+        return static_cast<int64_t>(tv.tv_sec) * 1000000000 + static_cast<int64_t>(tv.tv_usec) * 1000;
+    };
+    return to_nanos(usage.ru_utime) + to_nanos(usage.ru_stime);
+#endif
+}
+
+void write_json(FILE* fp, std::string_view version, std::string_view command, int64_t wall_nanos)
+{
+    auto phases = trace::phase_totals();
+
+    std::lock_guard<std::mutex> lck(s_mutex);
+    auto slowest = s_slowest;
+    std::sort(slowest.begin(), slowest.end(), slower);
+
+    std::string out;
+    out += "{\n  \"version\": ";
+    json::append_quoted(out, version);
+    out += ",\n  \"command\": ";
+    json::append_quoted(out, command);
+
+    char buf[128];
+    snprintf(buf, sizeof(buf), ",\n  \"wall_ms\": %.3f,\n  \"cpu_ms\": %.3f,\n  \"peak_rss_bytes\": %lld",
+             to_ms(wall_nanos), to_ms(process_cpu_nanos()), static_cast<long long>(peak_rss_bytes()));
+    out += buf;
+
+    auto append_dict = [&](const char* name, const std::map<std::string, int64_t, std::less<>>& dict) {
+        out += ",\n  \"";
+        out += name;
+        out += "\": {";
+        bool first = true;
+        for (auto& item : dict)
+        {
+            out += first ? "\n    " : ",\n    ";
+            json::append_quoted(out, item.first);
+            out += ": ";
+            out += std::to_string(item.second);
+            first = false;
+        }
+        out += first ? "}" : "\n  }";
+    };
+    append_dict("counters", s_counters);
+    append_dict("matches", s_matches);
+
+    out += ",\n  \"phases\": {";
+    bool first = true;
+    for (auto& item : phases)
+    {
+        out += first ? "\n    " : ",\n    ";
+        json::append_quoted(out, item.first);
+        snprintf(buf, sizeof(buf), ": {\"count\": %lld, \"wall_ms\": %.3f, \"cpu_ms\": %.3f}",
+                 static_cast<long long>(item.second.count), to_ms(item.second.wall_nanos),
+                 to_ms(item.second.cpu_nanos));
+        out += buf;
+        first = false;
+    }
+    out += first ? "}" : "\n  }";
+
+    out += ",\n  \"slowest_files\": [";
+    first = true;
+    for (auto& item : slowest)
+    {
+        out += first ? "\n    {\"file\": " : ",\n    {\"file\": ";
+        json::append_quoted(out, item.path);
+        snprintf(buf, sizeof(buf), ", \"wall_ms\": %.3f}", to_ms(item.nanos));
+        out += buf;
+        first = false;
+    }
+    out += first ? "]" : "\n  ]";
+    out += "\n}\n";
+
+    fwrite(out.data(), out.size(), 1, fp);
+}
+
+file_scope::file_scope(std::string_view path)
+{
+    if (g_enabled)
+    {
+        _path  = path;
+        _start = trace::now_nanos();
+    }
+}
+
+file_scope::~file_scope()
+{
+    if (g_enabled)
+        add_file_time(_path, trace::now_nanos() - _start);
+}
+}  // namespace stats
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+
+/*
+ * Run statistics: named counters, matches per rule and the slowest files,
+ * written as json with the phase totals of trace scopes and peak RSS.
+ * All functions are thread safe and no-ops unless enabled.
+ */
+namespace stats
+{
+extern bool g_enabled;
+
+inline bool enabled()
+{
+    return g_enabled;
+}
+
+// also enables trace phase totals
+void enable(int top_files = 10);
+
+void add(std::string_view counter, int64_t value = 1);
+
+void add_match(std::string_view rule, int64_t value = 1);
+
+void add_file_time(std::string_view path, int64_t nanos);
+
+int64_t get(std::string_view counter);
+
+// peak resident set size of the process in bytes, 0 if not supported
+int64_t peak_rss_bytes();
+
+// process cpu time (user + system)
+int64_t process_cpu_nanos();
+
+// write json summary, wall_nanos is the total wall time of the run
+void write_json(FILE* fp, std::string_view version, std::string_view command, int64_t wall_nanos);
+
+// measure the wall time of a file
+struct file_scope
+{
+    explicit file_scope(std::string_view path);
+    ~file_scope();
+
+    file_scope(const file_scope&)            = delete;
+    file_scope& operator=(const file_scope&) = delete;
+
+private:
+    std::string_view _path;
+    int64_t _start = 0;
+};
+}  // namespace stats
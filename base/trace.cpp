@@ -0,0 +1,170 @@
+#include "trace.h"
+#include "json.h"
+
+#include <stdio.h>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_WIN32)
+#    include <windows.h>
+#else
+#    include <time.h>
+#endif
+
+namespace trace
+{
+bool g_enabled      = false;
+bool g_phase_totals = false;
+
+namespace
+{
+struct event
+{
+    const char* name;
+    std::string arg;
+    int64_t start;
+    int64_t end;
+};
+
+struct thread_buffer
+{
+    int tid;
+    std::string name;
+    std::vector<event> events;
+    std::unordered_map<const char*, phase_total> totals;  // keyed by literal address, merged by name later
+};
+
+std::mutex s_mutex;
+std::vector<std::unique_ptr<thread_buffer>> s_buffers;
+std::string s_path;
+std::chrono::steady_clock::time_point s_epoch = std::chrono::steady_clock::now();
+
+thread_buffer& local_buffer()
+{
+    thread_local thread_buffer* buffer = nullptr;
+    if (!buffer)
+    {
+        std::lock_guard<std::mutex> lck(s_mutex);
+        s_buffers.push_back(std::make_unique<thread_buffer>());
+        buffer       = s_buffers.back().get();
+        buffer->tid  = static_cast<int>(s_buffers.size());
+        buffer->name = buffer->tid == 1 ? "main" : "worker-" + std::to_string(buffer->tid - 1);
+    }
+    return *buffer;
+}
+}  // namespace
+
+void start(std::string path)
+{
+    s_path    = std::move(path);
+    s_epoch   = std::chrono::steady_clock::now();
+    g_enabled = true;
+    local_buffer();  // the caller thread is main
+}
+
+void enable_phase_totals()
+{
+    g_phase_totals = true;
+    local_buffer();
+}
+
+std::map<std::string, phase_total> phase_totals()
+{
+    std::map<std::string, phase_total> merged;
+    std::lock_guard<std::mutex> lck(s_mutex);
+    for (auto& buffer : s_buffers)
+    {
+        for (auto& item : buffer->totals)
+        {
+            auto& total = merged[item.first];
+            total.count += item.second.count;
+            total.wall_nanos += item.second.wall_nanos;
+            total.cpu_nanos += item.second.cpu_nanos;
+        }
+    }
+    return merged;
+}
+
+int64_t thread_cpu_nanos()
+{
+#if defined(_WIN32)
+    FILETIME creation, exit, kernel, user;
+    if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+        return 0;
+    auto to_nanos = [](const FILETIME& ft) {
+        return ((static_cast<int64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime) * 100;
+    };
+    return to_nanos(kernel) + to_nanos(user);
+#else
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+int64_t now_nanos()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_epoch).count();
+}
+
+void set_thread_name(std::string_view name)
+{
+    if (enabled())
+        local_buffer().name = name;
+}
+
+void record(const char* name, std::string_view arg, int64_t start_nanos, int64_t end_nanos, int64_t cpu_nanos)
+{
+    auto& buffer = local_buffer();
+    if (g_enabled)
+        buffer.events.push_back(event{name, std::string{arg}, start_nanos, end_nanos});
+    if (g_phase_totals)
+    {
+        auto& total = buffer.totals[name];
+        ++total.count;
+        total.wall_nanos += end_nanos - start_nanos;
+        total.cpu_nanos += cpu_nanos;
+    }
+}
+
+bool stop()
+{
+    if (!g_enabled)
+        return false;
+    g_enabled = false;
+
+    auto fp = fopen(s_path.c_str(), "wb");
+    if (!fp)
+        return false;
+
+    std::lock_guard<std::mutex> lck(s_mutex);
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", fp);
+    bool first = true;
+    for (auto& buffer : s_buffers)
+    {
+        fprintf(fp, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":%s}}",
+                first ? "" : ",\n", buffer->tid, json::quoted(buffer->name).c_str());
+        first = false;
+        for (auto& ev : buffer->events)
+        {
+            fprintf(fp, ",\n{\"name\":\"%s\",\"cat\":\"migrate\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f",
+                    ev.name, buffer->tid, ev.start / 1000.0, (ev.end - ev.start) / 1000.0);
+            if (!ev.arg.empty())
+            {
+                fprintf(fp, ",\"args\":{\"file\":%s}", json::quoted(ev.arg).c_str());
+            }
+            fputc('}', fp);
+        }
+    }
+    fputs("\n]}\n", fp);
+    fclose(fp);
+
+    // the buffers are still referenced by thread_local pointers, only drop the events
+    for (auto& buffer : s_buffers)
+        buffer->events.clear();
+    return true;
+}
+}  // namespace trace
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stdint.h>
+#include <map>
+#include <string>
+#include <string_view>
+
+/*
+ * Scoped spans recorded per thread and written as chrome trace-event json,
+ * the output can be loaded by https://ui.perfetto.dev or chrome://tracing
+ *
+ * usage:
+ *   trace::start("out.json");
+ *   { TRACE_SCOPE("load_file", path); ... }
+ *   trace::stop(); // write file
+ *
+ * The same spans can be accumulated as per phase wall and cpu time totals
+ * without recording events, see enable_phase_totals.
+ */
+namespace trace
+{
+extern bool g_enabled;
+extern bool g_phase_totals;
+
+inline bool enabled()
+{
+    return g_enabled;
+}
+
+// events or phase totals are recording
+inline bool active()
+{
+    return g_enabled || g_phase_totals;
+}
+
+// start recording, the events are written to path when stop
+void start(std::string path);
+
+// write recorded events, all threads which record events must be finished
+bool stop();
+
+// name the track of current thread
+void set_thread_name(std::string_view name);
+
+struct phase_total
+{
+    int64_t count      = 0;
+    int64_t wall_nanos = 0;
+    int64_t cpu_nanos  = 0;
+};
+
+// accumulate spans by name, nested spans are inclusive
+void enable_phase_totals();
+
+// merged totals of all threads, all threads which record spans must be finished
+std::map<std::string, phase_total> phase_totals();
+
+int64_t now_nanos();
+
+// cpu time consumed by calling thread
+int64_t thread_cpu_nanos();
+
+void record(const char* name, std::string_view arg, int64_t start_nanos, int64_t end_nanos, int64_t cpu_nanos);
+
+struct scope
+{
+    scope(const char* name, std::string_view arg = {}) : _name(name)
+    {
+        if (active())
+        {
+            _arg   = arg;
+            _start = now_nanos();
+            if (g_phase_totals)
+                _cpuStart = thread_cpu_nanos();
+        }
+    }
+    ~scope()
+    {
+        if (active())
+            record(_name, _arg, _start, now_nanos(), g_phase_totals ? thread_cpu_nanos() - _cpuStart : 0);
+    }
+
+    scope(const scope&)            = delete;
+    scope& operator=(const scope&) = delete;
+
+private:
+    const char* _name;
+    std::string_view _arg;
+    int64_t _start    = 0;
+    int64_t _cpuStart = 0;
+};
+}  // namespace trace
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+#define TRACE_SCOPE(...) trace::scope TRACE_CONCAT(_trace_scope_, __LINE__)(__VA_ARGS__)
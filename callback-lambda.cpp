@@ -0,0 +1,265 @@
+// rewrite the member callbacks bound by the macros of cocos2d-x or std::bind to lambdas, i.e.
+//   CC_CALLBACK_2(HelloWorld::onTouchBegan, this)
+//   std::bind(&HelloWorld::onTouchBegan, this, std::placeholders::_1, std::placeholders::_2)
+// to
+//   [this](auto&& arg1, auto&& arg2, auto&&...) { return onTouchBegan(std::forward<decltype(arg1)>(arg1), std::forward<decltype(arg2)>(arg2)); }
+// the lambda inlines the call where the bind expression calls through a member pointer, and fits the small buffer of
+// std::function. The target and the bound arguments are evaluated once where bound as before, by init captures.
+#include "migrate-context.h"
+#include "cxx-lexer.h"
+#include "base/trace.h"
+#include "fmt/format.h"
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+	constexpr int max_placeholder = 9;
+
+	struct token_range {
+		size_t first;
+		size_t last; // past the end
+		size_t size() const { return last - first; }
+	};
+
+	// the arity of CC_CALLBACK_N or AX_CALLBACK_N, -1 for anything else
+	int callback_macro_arity(std::string_view ident) {
+		if (ident.size() != 13 || ident.substr(2, 10) != "_CALLBACK_"sv || (ident.substr(0, 2) != "CC"sv && ident.substr(0, 2) != "AX"sv))
+			return -1;
+		auto digit = ident.back();
+		return digit >= '0' && digit <= '3' ? digit - '0' : -1;
+	}
+
+	int placeholder_index(std::string_view ident) {
+		return ident.size() == 2 && ident[0] == '_' && ident[1] >= '1' && ident[1] <= '0' + max_placeholder ? ident[1] - '0' : 0;
+	}
+
+	class callback_rewriter {
+	public:
+		callback_rewriter(const std::string& content) : _content(content), _lexer(content) { _lexer.lex(); }
+
+		int rewrite(std::string& out) {
+			auto& tokens = _lexer.tokens;
+			int hints = 0;
+			size_t copied = 0;
+			for (size_t i = 0; i + 1 < tokens.size(); ++i) {
+				if (tokens[i].kind != CxxToken::Ident || tokens[i + 1].text != "("sv)
+					continue;
+				auto arity = callback_macro_arity(tokens[i].text);
+				auto first = i;
+				if (arity >= 0) {
+					if (_lexer.macros.count(tokens[i].text)) // defined by the file itself
+						continue;
+				}
+				else if (tokens[i].text == "bind"sv && i >= 2 && tokens[i - 1].text == "::"sv && tokens[i - 2].text == "std"sv) {
+					first = i >= 3 && tokens[i - 3].text == "::"sv ? i - 3 : i - 2;
+				}
+				else
+					continue;
+
+				std::vector<token_range> args;
+				size_t close = 0;
+				if (!split_args(i + 1, args, close))
+					continue;
+				std::string lambda;
+				if (to_lambda(arity, args, lambda)) {
+					out.append(_content, copied, offset_of(first) - copied);
+					out += lambda;
+					copied = end_of(close);
+					++hints;
+				}
+				i = close; // a callback bound within another one is left as is with it
+			}
+			if (hints)
+				out.append(_content, copied);
+			return hints;
+		}
+
+	private:
+		size_t offset_of(size_t index) const { return _lexer.tokens[index].text.data() - _content.data(); }
+		size_t end_of(size_t index) const { return offset_of(index) + _lexer.tokens[index].text.size(); }
+
+		std::string_view text_of(const token_range& range) const {
+			return std::string_view{_content}.substr(offset_of(range.first), end_of(range.last - 1) - offset_of(range.first));
+		}
+
+		// the arguments of the call whose '(' is at open, false if unbalanced or a top level '<' makes the commas
+		// ambiguous
+		bool split_args(size_t open, std::vector<token_range>& args, size_t& close) const {
+			auto& tokens = _lexer.tokens;
+			int depth = 0;
+			size_t first = open + 1;
+			for (size_t i = open; i < tokens.size(); ++i) {
+				auto& tok = tokens[i];
+				if (tok.kind != CxxToken::Punct)
+					continue;
+				auto ch = tok.text[0];
+				if (tok.text.size() != 1)
+					continue;
+				if (ch == '(' || ch == '[' || ch == '{')
+					++depth;
+				else if (ch == ')' || ch == ']' || ch == '}') {
+					if (--depth == 0) {
+						if (i > first)
+							args.push_back({first, i});
+						else if (!args.empty())
+							return false; // trailing comma
+						close = i;
+						return true;
+					}
+				}
+				else if (depth == 1 && ch == ',') {
+					if (i == first)
+						return false;
+					args.push_back({first, i});
+					first = i + 1;
+				}
+				else if (depth == 1 && ch == '<')
+					return false;
+			}
+			return false;
+		}
+
+		// Class::method, or &Class::method of std::bind
+		bool member_of(const token_range& range, bool address, std::string_view& method) const {
+			auto& tokens = _lexer.tokens;
+			auto i = range.first;
+			if (address && (i == range.last || tokens[i++].text != "&"sv))
+				return false;
+			if (range.last - i < 3 || (range.last - i) % 2 == 0)
+				return false;
+			for (; i < range.last; i += 2) {
+				if (tokens[i].kind != CxxToken::Ident || (i + 1 < range.last && tokens[i + 1].text != "::"sv))
+					return false;
+			}
+			method = tokens[range.last - 1].text;
+			return true;
+		}
+
+		// the index of std::placeholders::_N, _N or placeholders::_N, 0 if not one, -1 if a placeholder is in it
+		int placeholder_of(const token_range& range) const {
+			auto& tokens = _lexer.tokens;
+			auto index = placeholder_index(tokens[range.last - 1].text);
+			if (index && (range.size() == 1 || (range.size() == 3 && tokens[range.first].text == "placeholders"sv && tokens[range.first + 1].text == "::"sv) ||
+					(range.size() == 5 && tokens[range.first].text == "std"sv && tokens[range.first + 1].text == "::"sv &&
+						tokens[range.first + 2].text == "placeholders"sv && tokens[range.first + 3].text == "::"sv)))
+				return index;
+			for (auto i = range.first; i < range.last; ++i) {
+				auto& tok = tokens[i];
+				if (tok.kind == CxxToken::Ident && (placeholder_index(tok.text) || tok.text == "bind"sv || callback_macro_arity(tok.text) >= 0))
+					return -1;
+			}
+			return 0;
+		}
+
+		bool is_literal(const token_range& range) const {
+			auto& tokens = _lexer.tokens;
+			auto first = range.first;
+			if (range.size() == 2 && tokens[first].text == "-"sv)
+				++first;
+			if (range.last - first != 1)
+				return false;
+			auto& tok = tokens[first];
+			return tok.kind == CxxToken::Number || tok.kind == CxxToken::String || tok.kind == CxxToken::Char ||
+				(first == range.first && (tok.text == "true"sv || tok.text == "false"sv || tok.text == "nullptr"sv));
+		}
+
+		// the capture of an argument evaluated where bound, also a single identifier is captured by name, as it may be a
+		// macro of the file or of a header
+		std::string capture(const token_range& range, const std::string& name, std::vector<std::string>& captures) const {
+			captures.push_back(fmt::format("{} = {}", name, text_of(range)));
+			return name;
+		}
+
+		bool to_lambda(int arity, const std::vector<token_range>& args, std::string& lambda) const {
+			std::string_view method;
+			if (args.size() < 2 || !member_of(args[0], arity < 0, method) || placeholder_of(args[1]) != 0)
+				return false;
+
+			std::vector<std::string> captures;
+			std::string callee;
+			if (args[1].size() == 1 && _lexer.tokens[args[1].first].text == "this"sv) {
+				captures.push_back("this");
+				callee = method;
+			}
+			else
+				callee = fmt::format("{}->{}", capture(args[1], "target", captures), method);
+
+			// the parameter of each argument of the call, 0 for a bound one
+			std::vector<int> params;
+			std::vector<std::string> values;
+			int nparams = (std::max)(arity, 0);
+			int uses[max_placeholder + 1] = {};
+			for (int index = 1; index <= arity; ++index) {
+				params.push_back(index);
+				values.emplace_back();
+				++uses[index];
+			}
+			bool bound = false;
+			int nbound = 0;
+			for (size_t k = 2; k < args.size(); ++k) {
+				auto index = arity < 0 ? placeholder_of(args[k]) : (placeholder_of(args[k]) != 0 ? -1 : 0);
+				if (index < 0)
+					return false;
+				params.push_back(index);
+				if (index) {
+					values.emplace_back();
+					nparams = (std::max)(nparams, index);
+					++uses[index];
+				}
+				else if (is_literal(args[k]))
+					values.emplace_back(text_of(args[k]));
+				else {
+					values.push_back(capture(args[k], fmt::format("bound{}", ++nbound), captures));
+					bound = true;
+				}
+			}
+			std::vector<std::string_view> names;
+			for (auto& entry : captures) {
+				auto name = std::string_view{entry}.substr(0, entry.find(' '));
+				if (std::find(names.begin(), names.end(), name) != names.end() ||
+					(name.size() > 3 && name.substr(0, 3) == "arg"sv && name.find_first_not_of("0123456789", 3) == std::string_view::npos))
+					return false; // the same name twice or hidden by a parameter
+				names.push_back(name);
+			}
+
+			lambda = '[';
+			for (size_t k = 0; k < captures.size(); ++k) {
+				if (k)
+					lambda += ", ";
+				lambda += captures[k];
+			}
+			lambda += "](";
+			for (int index = 1; index <= nparams; ++index)
+				fmt::format_to(std::back_inserter(lambda), "auto&& arg{}, ", index);
+			// the arguments beyond the placeholders, which the bind dropped
+			lambda += "auto&&...";
+			lambda += bound ? ") mutable { return " : ") { return ";
+			lambda += callee;
+			lambda += '(';
+			for (size_t k = 0; k < params.size(); ++k) {
+				if (k)
+					lambda += ", ";
+				auto index = params[k];
+				if (!index)
+					lambda += values[k];
+				else if (uses[index] == 1) // a parameter passed twice is not moved from
+					fmt::format_to(std::back_inserter(lambda), "std::forward<decltype(arg{0})>(arg{0})", index);
+				else
+					fmt::format_to(std::back_inserter(lambda), "arg{}", index);
+			}
+			lambda += "); }";
+			return true;
+		}
+
+		const std::string& _content;
+		CxxLexer _lexer;
+	};
+}
+
+int rewrite_callbacks(const std::string& content, std::string& out) {
+	TRACE_SCOPE("callbacks");
+	out.clear();
+	return callback_rewriter{content}.rewrite(out);
+}
@@ -0,0 +1,351 @@
+#include "clang-api.h"
+#include "base/logger.h"
+#include "yasio/string_view.hpp"
+#include "fmt/format.h"
+#include <stdlib.h>
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <string_view>
+
+#if defined(_WIN32)
+#	include <Windows.h>
+#	define GET_CLANG_FUNC(func) func = (decltype(&clang_##func))GetProcAddress((HMODULE)hLibClang, "clang_" #func)
+#else
+#	include <dlfcn.h>
+#	define GET_CLANG_FUNC(func) func = (decltype(&clang_##func))dlsym(hLibClang, "clang_" #func)
+#endif
+#define DEFINE_CLANG_FUNC(func) decltype(&clang_##func) func
+
+namespace stdfs = std::filesystem;
+
+using namespace std::string_view_literals;
+
+void* hLibClang = nullptr;
+
+namespace clang {
+	DEFINE_CLANG_FUNC(createIndex);
+	DEFINE_CLANG_FUNC(parseTranslationUnit);
+	DEFINE_CLANG_FUNC(parseTranslationUnit2);
+	DEFINE_CLANG_FUNC(getTranslationUnitCursor);
+	DEFINE_CLANG_FUNC(visitChildren);
+	DEFINE_CLANG_FUNC(getCursorSpelling);
+	DEFINE_CLANG_FUNC(getCursorKindSpelling);
+	DEFINE_CLANG_FUNC(getCursorKind);
+	DEFINE_CLANG_FUNC(disposeTranslationUnit);
+	DEFINE_CLANG_FUNC(disposeIndex);
+	DEFINE_CLANG_FUNC(getCString);
+	DEFINE_CLANG_FUNC(disposeString);
+	DEFINE_CLANG_FUNC(getCursorLocation);
+	DEFINE_CLANG_FUNC(getExpansionLocation);
+	DEFINE_CLANG_FUNC(getFileName);
+	DEFINE_CLANG_FUNC(getCursorPrintingPolicy);
+	DEFINE_CLANG_FUNC(PrintingPolicy_setProperty);
+	DEFINE_CLANG_FUNC(PrintingPolicy_dispose);
+	DEFINE_CLANG_FUNC(getCursorPrettyPrinted);
+	DEFINE_CLANG_FUNC(PrintingPolicy_getProperty);
+	DEFINE_CLANG_FUNC(getFile);
+	DEFINE_CLANG_FUNC(getLocationForOffset);
+	DEFINE_CLANG_FUNC(getRange);
+	DEFINE_CLANG_FUNC(getCursor);
+	DEFINE_CLANG_FUNC(tokenize);
+	DEFINE_CLANG_FUNC(disposeTokens);
+	DEFINE_CLANG_FUNC(getTokenKind);
+	DEFINE_CLANG_FUNC(getTokenSpelling);
+	DEFINE_CLANG_FUNC(getTokenLocation);
+	DEFINE_CLANG_FUNC(getCursorReferenced);
+	DEFINE_CLANG_FUNC(getCursorSemanticParent);
+	DEFINE_CLANG_FUNC(getCursorDefinition);
+	DEFINE_CLANG_FUNC(getCanonicalCursor);
+	DEFINE_CLANG_FUNC(Cursor_isNull);
+	DEFINE_CLANG_FUNC(equalCursors);
+	DEFINE_CLANG_FUNC(getCursorExtent);
+	DEFINE_CLANG_FUNC(getRangeStart);
+	DEFINE_CLANG_FUNC(getRangeEnd);
+	DEFINE_CLANG_FUNC(getSpellingLocation);
+	DEFINE_CLANG_FUNC(Location_isFromMainFile);
+	DEFINE_CLANG_FUNC(getIncludedFile);
+	DEFINE_CLANG_FUNC(getInclusions);
+	DEFINE_CLANG_FUNC(File_tryGetRealPathName);
+	DEFINE_CLANG_FUNC(getNumDiagnostics);
+	DEFINE_CLANG_FUNC(getDiagnostic);
+	DEFINE_CLANG_FUNC(getDiagnosticSeverity);
+	DEFINE_CLANG_FUNC(disposeDiagnostic);
+	DEFINE_CLANG_FUNC(formatDiagnostic);
+	DEFINE_CLANG_FUNC(defaultDiagnosticDisplayOptions);
+	DEFINE_CLANG_FUNC(CompilationDatabase_fromDirectory);
+	DEFINE_CLANG_FUNC(CompilationDatabase_getCompileCommands);
+	DEFINE_CLANG_FUNC(CompilationDatabase_dispose);
+	DEFINE_CLANG_FUNC(CompileCommands_getSize);
+	DEFINE_CLANG_FUNC(CompileCommands_getCommand);
+	DEFINE_CLANG_FUNC(CompileCommands_dispose);
+	DEFINE_CLANG_FUNC(CompileCommand_getDirectory);
+	DEFINE_CLANG_FUNC(CompileCommand_getNumArgs);
+	DEFINE_CLANG_FUNC(CompileCommand_getArg);
+	DEFINE_CLANG_FUNC(getOverriddenCursors);
+	DEFINE_CLANG_FUNC(disposeOverriddenCursors);
+	DEFINE_CLANG_FUNC(Cursor_getNumArguments);
+	DEFINE_CLANG_FUNC(Cursor_getArgument);
+	DEFINE_CLANG_FUNC(getCursorType);
+	DEFINE_CLANG_FUNC(getCanonicalType);
+	DEFINE_CLANG_FUNC(getTypeSpelling);
+	DEFINE_CLANG_FUNC(saveTranslationUnit);
+	DEFINE_CLANG_FUNC(defaultSaveOptions);
+	DEFINE_CLANG_FUNC(CXRewriter_create);
+	DEFINE_CLANG_FUNC(CXRewriter_replaceText);
+	DEFINE_CLANG_FUNC(CXRewriter_overwriteChangedFiles);
+	DEFINE_CLANG_FUNC(CXRewriter_dispose);
+	DEFINE_CLANG_FUNC(getCursorUSR);
+	DEFINE_CLANG_FUNC(getCursorResultType);
+	DEFINE_CLANG_FUNC(getPointeeType);
+	DEFINE_CLANG_FUNC(getTypeDeclaration);
+	DEFINE_CLANG_FUNC(getNullCursor);
+	DEFINE_CLANG_FUNC(CXXMethod_isConst);
+	DEFINE_CLANG_FUNC(CXXMethod_isStatic);
+	DEFINE_CLANG_FUNC(getCXXAccessSpecifier);
+
+	std::string exe_path; // argv[0], libclang is searched next to the executable
+	int64_t load_nanos = -1; // cost of loading, -1: not loaded
+
+	static void load_lib() {
+		if (hLibClang) return;
+
+		auto start = std::chrono::steady_clock::now();
+		struct load_timer {
+			~load_timer() { load_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count(); }
+			std::chrono::steady_clock::time_point start;
+		} _t { start };
+
+		// load libclang
+#if defined(_WIN32)
+		hLibClang = LoadLibrary("libclang.dll");
+#else
+		std::string exePath = exe_path;
+		std::string_view exePathSV{exePath};
+		auto slash = exePath.find_last_of('/');
+		std::string libclang_file{slash != std::string::npos ? exePathSV.substr(0, slash + 1) : "."sv};
+#if defined(__linux__)
+		libclang_file += "/libclang.so";
+#elif defined(__APPLE__)
+		libclang_file += "/libclang.dylib";
+#endif
+		if (stdfs::is_regular_file(libclang_file)) {
+			logger::verbose("Loading libclang: {}", libclang_file);
+			hLibClang = dlopen(libclang_file.c_str(), RTLD_LAZY | RTLD_LOCAL);
+	    }
+#endif
+		if (!hLibClang) {
+			logger::warn("load libclang fail.");
+			return; // can't load libclang
+		}
+		GET_CLANG_FUNC(createIndex);
+		GET_CLANG_FUNC(parseTranslationUnit);
+		GET_CLANG_FUNC(parseTranslationUnit2);
+		GET_CLANG_FUNC(getTranslationUnitCursor);
+		GET_CLANG_FUNC(visitChildren);
+		GET_CLANG_FUNC(getCursorSpelling);
+		GET_CLANG_FUNC(getCursorKindSpelling);
+		GET_CLANG_FUNC(getCursorKind);
+		GET_CLANG_FUNC(disposeTranslationUnit);
+		GET_CLANG_FUNC(disposeIndex);
+		GET_CLANG_FUNC(getCString);
+		GET_CLANG_FUNC(disposeString);
+		GET_CLANG_FUNC(getCursorLocation);
+		GET_CLANG_FUNC(getExpansionLocation);
+		GET_CLANG_FUNC(getFileName);
+		GET_CLANG_FUNC(getCursorPrintingPolicy);
+		GET_CLANG_FUNC(PrintingPolicy_setProperty);
+		GET_CLANG_FUNC(PrintingPolicy_dispose);
+		GET_CLANG_FUNC(getCursorPrettyPrinted);
+		GET_CLANG_FUNC(PrintingPolicy_getProperty);
+		GET_CLANG_FUNC(getFile);
+		GET_CLANG_FUNC(getLocationForOffset);
+		GET_CLANG_FUNC(getRange);
+		GET_CLANG_FUNC(getCursor);
+		GET_CLANG_FUNC(tokenize);
+		GET_CLANG_FUNC(disposeTokens);
+		GET_CLANG_FUNC(getTokenKind);
+		GET_CLANG_FUNC(getTokenSpelling);
+		GET_CLANG_FUNC(getTokenLocation);
+		GET_CLANG_FUNC(getCursorReferenced);
+		GET_CLANG_FUNC(getCursorSemanticParent);
+		GET_CLANG_FUNC(getCursorDefinition);
+		GET_CLANG_FUNC(getCanonicalCursor);
+		GET_CLANG_FUNC(Cursor_isNull);
+		GET_CLANG_FUNC(equalCursors);
+		GET_CLANG_FUNC(getCursorExtent);
+		GET_CLANG_FUNC(getRangeStart);
+		GET_CLANG_FUNC(getRangeEnd);
+		GET_CLANG_FUNC(getSpellingLocation);
+		GET_CLANG_FUNC(Location_isFromMainFile);
+		GET_CLANG_FUNC(getIncludedFile);
+		GET_CLANG_FUNC(getInclusions);
+		GET_CLANG_FUNC(File_tryGetRealPathName);
+		GET_CLANG_FUNC(getNumDiagnostics);
+		GET_CLANG_FUNC(getDiagnostic);
+		GET_CLANG_FUNC(getDiagnosticSeverity);
+		GET_CLANG_FUNC(disposeDiagnostic);
+		GET_CLANG_FUNC(formatDiagnostic);
+		GET_CLANG_FUNC(defaultDiagnosticDisplayOptions);
+		GET_CLANG_FUNC(CompilationDatabase_fromDirectory);
+		GET_CLANG_FUNC(CompilationDatabase_getCompileCommands);
+		GET_CLANG_FUNC(CompilationDatabase_dispose);
+		GET_CLANG_FUNC(CompileCommands_getSize);
+		GET_CLANG_FUNC(CompileCommands_getCommand);
+		GET_CLANG_FUNC(CompileCommands_dispose);
+		GET_CLANG_FUNC(CompileCommand_getDirectory);
+		GET_CLANG_FUNC(CompileCommand_getNumArgs);
+		GET_CLANG_FUNC(CompileCommand_getArg);
+		GET_CLANG_FUNC(getOverriddenCursors);
+		GET_CLANG_FUNC(disposeOverriddenCursors);
+		GET_CLANG_FUNC(Cursor_getNumArguments);
+		GET_CLANG_FUNC(Cursor_getArgument);
+		GET_CLANG_FUNC(getCursorType);
+		GET_CLANG_FUNC(getCanonicalType);
+		GET_CLANG_FUNC(getTypeSpelling);
+		GET_CLANG_FUNC(saveTranslationUnit);
+		GET_CLANG_FUNC(defaultSaveOptions);
+		GET_CLANG_FUNC(CXRewriter_create);
+		GET_CLANG_FUNC(CXRewriter_replaceText);
+		GET_CLANG_FUNC(CXRewriter_overwriteChangedFiles);
+		GET_CLANG_FUNC(CXRewriter_dispose);
+		GET_CLANG_FUNC(getCursorUSR);
+		GET_CLANG_FUNC(getCursorResultType);
+		GET_CLANG_FUNC(getPointeeType);
+		GET_CLANG_FUNC(getTypeDeclaration);
+		GET_CLANG_FUNC(getNullCursor);
+		GET_CLANG_FUNC(CXXMethod_isConst);
+		GET_CLANG_FUNC(CXXMethod_isStatic);
+		GET_CLANG_FUNC(getCXXAccessSpecifier);
+	}
+
+	// load libclang on first use, runs which never need it don't pay for the dlopen
+	bool ensure_lib() {
+		static std::once_flag once;
+		std::call_once(once, load_lib);
+		return hLibClang != nullptr;
+	}
+
+	std::string to_string(CXString str) {
+		std::string ret = getCString(str);
+		disposeString(str);
+		return ret;
+	}
+
+	// creating an index is expensive, reuse one per thread for all parses
+	CXIndex thread_index() {
+		struct index_holder {
+			~index_holder() { if (index) disposeIndex(index); }
+			CXIndex index = nullptr;
+		};
+		thread_local index_holder holder;
+		if (!holder.index)
+			holder.index = createIndex(0, 0);
+		return holder.index;
+	}
+
+	compile_commands::~compile_commands() {
+		if (_db)
+			CompilationDatabase_dispose(_db);
+	}
+
+	bool compile_commands::load(const std::string& build_dir) {
+		if (!ensure_lib())
+			return false;
+		CXCompilationDatabase_Error err = CXCompilationDatabase_NoError;
+		auto db = CompilationDatabase_fromDirectory(build_dir.c_str(), &err);
+		if (err != CXCompilationDatabase_NoError || !db)
+			return false;
+		std::lock_guard<std::mutex> lck(_mutex);
+		if (_db)
+			CompilationDatabase_dispose(_db);
+		_db = db;
+		return true;
+	}
+
+	std::vector<std::string> compile_commands::args_of(const std::string& path) const {
+		std::vector<std::string> args;
+		std::lock_guard<std::mutex> lck(_mutex);
+		if (!_db)
+			return args;
+		std::error_code ec;
+		auto abspath = stdfs::absolute(path, ec).lexically_normal();
+		auto commands = CompilationDatabase_getCompileCommands(_db, abspath.string().c_str());
+		if (!commands)
+			return args;
+		if (CompileCommands_getSize(commands) > 0) {
+			auto command = CompileCommands_getCommand(commands, 0);
+			auto fileName = abspath.filename().string();
+			unsigned num = CompileCommand_getNumArgs(command);
+			for (unsigned i = 1; i < num; ++i) { // 0 is the compiler
+				auto arg = to_string(CompileCommand_getArg(command, i));
+				if (arg == "-c" || arg == "--")
+					continue;
+				if (arg == "-o" || arg == "-MF" || arg == "-MT" || arg == "-MQ") {
+					++i; // and its value
+					continue;
+				}
+				if (arg == path || stdfs::path{arg}.filename().string() == fileName)
+					continue; // the source, passed to parse_file
+				args.push_back(std::move(arg));
+			}
+			// relative include paths are resolved from the directory of the command
+			args.push_back("-working-directory");
+			args.push_back(to_string(CompileCommand_getDirectory(command)));
+		}
+		CompileCommands_dispose(commands);
+		return args;
+	}
+
+	static std::string absolute_path(const std::string& path) {
+		std::error_code ec;
+		return stdfs::absolute(path, ec).lexically_normal().string();
+	}
+
+	CXTranslationUnit parse_file(const std::string& path, const std::vector<std::string>& args, unsigned options, std::string& error, const std::vector<unsaved_file>& unsaved) {
+		std::vector<const char*> argv;
+		argv.reserve(args.size());
+		for (auto& arg : args)
+			argv.push_back(arg.c_str());
+		std::vector<std::string> unsavedPaths;
+		std::vector<CXUnsavedFile> unsavedFiles;
+		unsavedPaths.reserve(unsaved.size());
+		for (auto& file : unsaved) {
+			unsavedPaths.push_back(absolute_path(file.path));
+			unsavedFiles.push_back(CXUnsavedFile{unsavedPaths.back().c_str(), file.content.data(), static_cast<unsigned long>(file.content.size())});
+		}
+		// absolute, a -working-directory of the compile command doesn't move the source
+		auto abspath = absolute_path(path);
+		CXTranslationUnit unit = nullptr;
+		auto ret = parseTranslationUnit2(thread_index(), abspath.c_str(), argv.data(), static_cast<int>(argv.size()), unsavedFiles.data(), static_cast<unsigned>(unsavedFiles.size()), options, &unit);
+		if (ret != CXError_Success || !unit) {
+			error = "parse fail";
+			return nullptr;
+		}
+		unsigned count = getNumDiagnostics(unit);
+		for (unsigned i = 0; i < count && error.empty(); ++i) {
+			auto diag = getDiagnostic(unit, i);
+			if (getDiagnosticSeverity(diag) >= CXDiagnostic_Error)
+				error = to_string(formatDiagnostic(diag, defaultDiagnosticDisplayOptions()));
+			disposeDiagnostic(diag);
+		}
+		return unit;
+	}
+
+	CXTranslationUnit parse_file(const std::string& path, const std::vector<std::string>& args, unsigned options, std::string& error) {
+		return parse_file(path, args, options, error, {});
+	}
+
+	CXTranslationUnit parse_source(const std::string& path, std::string_view source, const std::vector<std::string>& args, unsigned options, std::string& error) {
+		return parse_file(path, args, options, error, {unsaved_file{path, source}});
+	}
+
+	std::vector<std::string> default_args(const std::string& path, const std::string& root) {
+		std::vector<std::string> args{cxx20::ic::ends_with(path, ".mm") ? "-xobjective-c++" : "-xc++", "--std=c++17", "-I" + root};
+		if (auto axroot = getenv("AX_ROOT")) {
+			for (auto subdir : {"/core", "/extensions", "/thirdparty"})
+				args.push_back(fmt::format("-I{}{}", axroot, subdir));
+		}
+		return args;
+	}
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+// libclang is loaded on first use by ensure_lib, its functions are called through the pointers of namespace clang,
+// i.e. clang::parseTranslationUnit, so the tool runs without libclang until a pass needs it.
+// llvm-15.0.7
+#include "clang-c/Index.h"
+#include "clang-c/CXCompilationDatabase.h"
+#include "clang-c/Rewrite.h"
+#include <stdint.h>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+extern void* hLibClang;
+
+#define DECLARE_CLANG_FUNC(func) extern decltype(&clang_##func) func
+namespace clang {
+	DECLARE_CLANG_FUNC(createIndex);
+	DECLARE_CLANG_FUNC(parseTranslationUnit);
+	DECLARE_CLANG_FUNC(parseTranslationUnit2);
+	DECLARE_CLANG_FUNC(getTranslationUnitCursor);
+	DECLARE_CLANG_FUNC(visitChildren);
+	DECLARE_CLANG_FUNC(getCursorSpelling);
+	DECLARE_CLANG_FUNC(getCursorKindSpelling);
+	DECLARE_CLANG_FUNC(getCursorKind);
+	DECLARE_CLANG_FUNC(disposeTranslationUnit);
+	DECLARE_CLANG_FUNC(disposeIndex);
+	DECLARE_CLANG_FUNC(getCString);
+	DECLARE_CLANG_FUNC(disposeString);
+	DECLARE_CLANG_FUNC(getCursorLocation);
+	DECLARE_CLANG_FUNC(getExpansionLocation);
+	DECLARE_CLANG_FUNC(getFileName);
+	DECLARE_CLANG_FUNC(getCursorPrintingPolicy);
+	DECLARE_CLANG_FUNC(PrintingPolicy_setProperty);
+	DECLARE_CLANG_FUNC(PrintingPolicy_dispose);
+	DECLARE_CLANG_FUNC(getCursorPrettyPrinted);
+	DECLARE_CLANG_FUNC(PrintingPolicy_getProperty);
+	DECLARE_CLANG_FUNC(getFile);
+	DECLARE_CLANG_FUNC(getLocationForOffset);
+	DECLARE_CLANG_FUNC(getRange);
+	DECLARE_CLANG_FUNC(getCursor);
+	DECLARE_CLANG_FUNC(tokenize);
+	DECLARE_CLANG_FUNC(disposeTokens);
+	DECLARE_CLANG_FUNC(getTokenKind);
+	DECLARE_CLANG_FUNC(getTokenSpelling);
+	DECLARE_CLANG_FUNC(getTokenLocation);
+	DECLARE_CLANG_FUNC(getCursorReferenced);
+	DECLARE_CLANG_FUNC(getCursorSemanticParent);
+	DECLARE_CLANG_FUNC(getCursorDefinition);
+	DECLARE_CLANG_FUNC(getCanonicalCursor);
+	DECLARE_CLANG_FUNC(Cursor_isNull);
+	DECLARE_CLANG_FUNC(equalCursors);
+	DECLARE_CLANG_FUNC(getCursorExtent);
+	DECLARE_CLANG_FUNC(getRangeStart);
+	DECLARE_CLANG_FUNC(getRangeEnd);
+	DECLARE_CLANG_FUNC(getSpellingLocation);
+	DECLARE_CLANG_FUNC(Location_isFromMainFile);
+	DECLARE_CLANG_FUNC(getIncludedFile);
+	DECLARE_CLANG_FUNC(getInclusions);
+	DECLARE_CLANG_FUNC(File_tryGetRealPathName);
+	DECLARE_CLANG_FUNC(getNumDiagnostics);
+	DECLARE_CLANG_FUNC(getDiagnostic);
+	DECLARE_CLANG_FUNC(getDiagnosticSeverity);
+	DECLARE_CLANG_FUNC(disposeDiagnostic);
+	DECLARE_CLANG_FUNC(formatDiagnostic);
+	DECLARE_CLANG_FUNC(defaultDiagnosticDisplayOptions);
+	DECLARE_CLANG_FUNC(CompilationDatabase_fromDirectory);
+	DECLARE_CLANG_FUNC(CompilationDatabase_getCompileCommands);
+	DECLARE_CLANG_FUNC(CompilationDatabase_dispose);
+	DECLARE_CLANG_FUNC(CompileCommands_getSize);
+	DECLARE_CLANG_FUNC(CompileCommands_getCommand);
+	DECLARE_CLANG_FUNC(CompileCommands_dispose);
+	DECLARE_CLANG_FUNC(CompileCommand_getDirectory);
+	DECLARE_CLANG_FUNC(CompileCommand_getNumArgs);
+	DECLARE_CLANG_FUNC(CompileCommand_getArg);
+	DECLARE_CLANG_FUNC(getOverriddenCursors);
+	DECLARE_CLANG_FUNC(disposeOverriddenCursors);
+	DECLARE_CLANG_FUNC(Cursor_getNumArguments);
+	DECLARE_CLANG_FUNC(Cursor_getArgument);
+	DECLARE_CLANG_FUNC(getCursorType);
+	DECLARE_CLANG_FUNC(getCanonicalType);
+	DECLARE_CLANG_FUNC(getTypeSpelling);
+	DECLARE_CLANG_FUNC(saveTranslationUnit);
+	DECLARE_CLANG_FUNC(defaultSaveOptions);
+	DECLARE_CLANG_FUNC(CXRewriter_create);
+	DECLARE_CLANG_FUNC(CXRewriter_replaceText);
+	DECLARE_CLANG_FUNC(CXRewriter_overwriteChangedFiles);
+	DECLARE_CLANG_FUNC(CXRewriter_dispose);
+	DECLARE_CLANG_FUNC(getCursorUSR);
+	DECLARE_CLANG_FUNC(getCursorResultType);
+	DECLARE_CLANG_FUNC(getPointeeType);
+	DECLARE_CLANG_FUNC(getTypeDeclaration);
+	DECLARE_CLANG_FUNC(getNullCursor);
+	DECLARE_CLANG_FUNC(CXXMethod_isConst);
+	DECLARE_CLANG_FUNC(CXXMethod_isStatic);
+	DECLARE_CLANG_FUNC(getCXXAccessSpecifier);
+
+	extern std::string exe_path; // argv[0], libclang is searched next to the executable
+	extern int64_t load_nanos; // cost of loading, -1: not loaded
+
+	// load libclang on first use, runs which never need it don't pay for the dlopen
+	bool ensure_lib();
+
+	std::string to_string(CXString str);
+
+	// creating an index is expensive, reuse one per thread for all parses
+	CXIndex thread_index();
+
+	// the compile commands of compile_commands.json in a build directory, thread safe
+	class compile_commands {
+	public:
+		~compile_commands();
+
+		// false if the directory has no compile_commands.json
+		bool load(const std::string& build_dir);
+
+		// the arguments of a source file for parse_file, without the compiler, the output and the file itself,
+		// empty if the database has no command of it
+		std::vector<std::string> args_of(const std::string& path) const;
+
+	private:
+		mutable std::mutex _mutex;
+		CXCompilationDatabase _db = nullptr;
+	};
+
+	// parses a translation unit by the index of calling thread, returns nullptr if fails, error receives the first
+	// error reported, the references of a unit with errors are incomplete
+	CXTranslationUnit parse_file(const std::string& path, const std::vector<std::string>& args, unsigned options, std::string& error);
+
+	// parses source as the content of path, which needn't exist, i.e. a probe including a header
+	CXTranslationUnit parse_source(const std::string& path, std::string_view source, const std::vector<std::string>& args, unsigned options, std::string& error);
+
+	// the content of a file replaced for a parse, i.e. an edit tried before written
+	struct unsaved_file {
+		std::string path;
+		std::string_view content;
+	};
+
+	CXTranslationUnit parse_file(const std::string& path, const std::vector<std::string>& args, unsigned options, std::string& error, const std::vector<unsaved_file>& unsaved);
+
+	// the arguments of a file without compile command: c++17, the project root and the dirs of the engine at AX_ROOT
+	std::vector<std::string> default_args(const std::string& path, const std::string& root);
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+// a c++ lexer without libclang for the passes working on tokens: comments and preprocessor directives are skipped,
+// the names #define'd are recorded, the tokens refer to the source
+#include <string.h>
+#include <algorithm>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::string_view_literals;
+
+struct CxxToken {
+	enum Kind {
+		Ident,
+		String,
+		Char,
+		Number,
+		Punct,
+	};
+	Kind kind;
+	std::string_view text;
+};
+
+struct CxxLexer {
+	static bool is_ident_start(char ch) {
+		return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || ch == '_' || (unsigned char)ch >= 0x80;
+	}
+	static bool is_ident_char(char ch) {
+		return is_ident_start(ch) || (ch >= '0' && ch <= '9');
+	}
+	static bool is_space(char ch) {
+		return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n' || ch == '\v' || ch == '\f';
+	}
+
+	const char* _ptr;
+	const char* _end;
+	bool _lineStart = true;
+
+	std::vector<CxxToken> tokens;
+	std::set<std::string_view> macros; // names #define'd in this file
+
+	CxxLexer(std::string_view source) : _ptr(source.data()), _end(source.data() + source.size()) {}
+
+	// skip a backslash-newline splice at ptr, returns true if skipped
+	bool skipSplice(const char*& ptr) const {
+		if (*ptr != '\\')
+			return false;
+		auto p = ptr + 1;
+		if (p < _end && *p == '\r') ++p;
+		if (p < _end && *p == '\n') {
+			ptr = p + 1;
+			return true;
+		}
+		return false;
+	}
+
+	void skipLine() {
+		while (_ptr < _end && *_ptr != '\n') {
+			if (!skipSplice(_ptr))
+				++_ptr;
+		}
+	}
+
+	void skipBlockComment() {
+		_ptr += 2;
+		while (_ptr + 1 < _end && !(_ptr[0] == '*' && _ptr[1] == '/'))
+			++_ptr;
+		_ptr = (std::min)(_ptr + 2, _end);
+	}
+
+	void lexDirective() {
+		++_ptr; // '#'
+		while (_ptr < _end && (*_ptr == ' ' || *_ptr == '\t'))
+			++_ptr;
+		auto first = _ptr;
+		while (_ptr < _end && is_ident_char(*_ptr))
+			++_ptr;
+		if (std::string_view{first, static_cast<size_t>(_ptr - first)} == "define"sv) {
+			while (_ptr < _end && (*_ptr == ' ' || *_ptr == '\t'))
+				++_ptr;
+			first = _ptr;
+			while (_ptr < _end && is_ident_char(*_ptr))
+				++_ptr;
+			if (_ptr > first)
+				macros.emplace(first, static_cast<size_t>(_ptr - first));
+		}
+		skipLine();
+	}
+
+	// ptr points to the opening quote
+	const char* scanQuoted(const char* ptr, char quote) {
+		++ptr;
+		while (ptr < _end && *ptr != quote && *ptr != '\n') {
+			if (*ptr == '\\' && ptr + 1 < _end) {
+				++ptr;
+				if (*ptr == '\r' && ptr + 1 < _end && ptr[1] == '\n') // CRLF line splice
+					++ptr;
+			}
+			++ptr;
+		}
+		return ptr < _end && *ptr == quote ? ptr + 1 : ptr;
+	}
+
+	// ptr points to the opening quote of R"delim(...)delim"
+	const char* scanRaw(const char* ptr) {
+		auto delimFirst = ++ptr;
+		while (ptr < _end && *ptr != '(')
+			++ptr;
+		std::string closing{")"};
+		closing.append(delimFirst, ptr);
+		closing.push_back('"');
+		std::string_view rest{ptr, static_cast<size_t>(_end - ptr)};
+		auto pos = rest.find(closing);
+		return pos != std::string_view::npos ? ptr + pos + closing.size() : _end;
+	}
+
+	void lex() {
+		while (_ptr < _end) {
+			char ch = *_ptr;
+			if (ch == '\n') {
+				_lineStart = true;
+				++_ptr;
+				continue;
+			}
+			if (is_space(ch) || skipSplice(_ptr)) {
+				if (is_space(ch))
+					++_ptr;
+				continue;
+			}
+			if (ch == '/' && _ptr + 1 < _end && _ptr[1] == '/') {
+				skipLine();
+				continue;
+			}
+			if (ch == '/' && _ptr + 1 < _end && _ptr[1] == '*') {
+				skipBlockComment();
+				continue;
+			}
+			if (ch == '#' && _lineStart) {
+				lexDirective();
+				continue;
+			}
+			_lineStart = false;
+
+			auto first = _ptr;
+			if (is_ident_start(ch)) {
+				while (_ptr < _end && is_ident_char(*_ptr))
+					++_ptr;
+				// encoding prefix or raw string: u8"", L"", R"()", u8R"()" ...
+				if (_ptr < _end && (*_ptr == '"' || *_ptr == '\'')) {
+					std::string_view prefix{first, static_cast<size_t>(_ptr - first)};
+					if (prefix == "R"sv || prefix == "u8R"sv || prefix == "uR"sv || prefix == "UR"sv || prefix == "LR"sv) {
+						if (*_ptr == '"') {
+							_ptr = scanRaw(_ptr);
+							pushLiteral(CxxToken::String, first);
+							continue;
+						}
+					}
+					else if (prefix == "u8"sv || prefix == "u"sv || prefix == "U"sv || prefix == "L"sv) {
+						auto quote = *_ptr;
+						_ptr = scanQuoted(_ptr, quote);
+						pushLiteral(quote == '"' ? CxxToken::String : CxxToken::Char, first);
+						continue;
+					}
+				}
+				tokens.push_back(CxxToken{CxxToken::Ident, {first, static_cast<size_t>(_ptr - first)}});
+			}
+			else if (ch == '"' || ch == '\'') {
+				_ptr = scanQuoted(_ptr, ch);
+				pushLiteral(ch == '"' ? CxxToken::String : CxxToken::Char, first);
+			}
+			else if (ch >= '0' && ch <= '9') {
+				while (_ptr < _end && (is_ident_char(*_ptr) || *_ptr == '.' || *_ptr == '\''))
+					++_ptr;
+				tokens.push_back(CxxToken{CxxToken::Number, {first, static_cast<size_t>(_ptr - first)}});
+			}
+			else {
+				++_ptr;
+				// keep compound assignment, comparison and scope operators as one token
+				if (_ptr < _end && ((*_ptr == '=' && strchr("=!<>+-*/%&|^", ch)) || (ch == ':' && *_ptr == ':')))
+					++_ptr;
+				tokens.push_back(CxxToken{CxxToken::Punct, {first, static_cast<size_t>(_ptr - first)}});
+			}
+		}
+	}
+
+	void pushLiteral(CxxToken::Kind kind, const char* first) {
+		// user defined literal suffix, i.e. "..."sv
+		while (_ptr < _end && is_ident_char(*_ptr))
+			++_ptr;
+		tokens.push_back(CxxToken{kind, {first, static_cast<size_t>(_ptr - first)}});
+	}
+};
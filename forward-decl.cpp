@@ -0,0 +1,472 @@
+// ---------------------------------------- forward declarations
+// Many headers include a header only to declare pointers, references or return types of its classes. Each project
+// header is parsed by libclang, an include is a candidate when the header refers to nothing it brings in except the
+// classes defined in the included header itself, by their type names, and nothing of those is brought in by the other
+// includes. The include is replaced by the forward declarations of the classes, i.e. namespace ax { class Sprite; },
+// and moved to the source of the header, the .cpp of the same name beside it.
+//
+// The cursors can't tell reliably whether a type is complete where it's used, i.e. a base class or a member by value,
+// so each candidate is tried: the header and every translation unit reaching it are parsed with the edit in memory,
+// it's kept only if all of them still parse without errors. The headers are done one by one, each sees the edits of
+// the ones before.
+#include "migrate-context.h"
+#include "clang-api.h"
+#include "include-graph.h"
+#include "base/trace.h"
+#include "base/logger.h"
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace stdfs = std::filesystem;
+
+namespace {
+	struct forward_class {
+		std::vector<std::string> namespaces; // outermost first
+		std::string name;
+		bool is_struct = false;
+
+		bool operator<(const forward_class& rhs) const {
+			return namespaces != rhs.namespaces ? namespaces < rhs.namespaces : name < rhs.name;
+		}
+	};
+
+	struct include_line {
+		unsigned line = 0;
+		std::string path; // the header included
+		std::string directive; // as spelled, i.e. "2d/Sprite.h"
+	};
+
+	struct reference {
+		std::string file; // declaring the entity referenced
+		bool declarable = false; // a class referenced by its type name, which can be forward declared
+		forward_class decl;
+	};
+
+	// a candidate include and the classes to declare instead
+	struct candidate {
+		const include_line* include = nullptr;
+		std::set<forward_class> classes;
+		uint64_t bytes = 0; // of the files brought in by it only
+	};
+
+	// a project header parsed as the main file
+	struct header_state {
+		std::string main;
+		std::vector<std::string> lines; // with the EOL
+		std::unordered_map<CXFile, std::string> paths;
+		std::vector<include_line> includes; // of the header
+		std::unordered_map<std::string, std::vector<std::string>> edges; // includer -> included
+		std::vector<reference> references; // from the header
+
+		const std::string& path_of(CXFile file) {
+			auto it = paths.find(file);
+			if (it != paths.end())
+				return it->second;
+			auto path = clang::to_string(clang::File_tryGetRealPathName(file));
+			if (path.empty())
+				path = clang::to_string(clang::getFileName(file));
+			return paths.emplace(file, stdfs::path{path}.lexically_normal().generic_string()).first->second;
+		}
+
+		std::unordered_set<std::string> closure_of(const std::string& file) const {
+			std::unordered_set<std::string> closure{file};
+			std::vector<std::string> pending{file};
+			while (!pending.empty()) {
+				auto cur = std::move(pending.back());
+				pending.pop_back();
+				auto edge = edges.find(cur);
+				if (edge == edges.end())
+					continue;
+				for (auto& included : edge->second)
+					if (closure.insert(included).second)
+						pending.push_back(included);
+			}
+			return closure;
+		}
+	};
+
+	std::vector<std::string> split_lines(std::string_view content) {
+		std::vector<std::string> lines;
+		while (!content.empty()) {
+			auto eol = content.find('\n');
+			auto len = eol != std::string_view::npos ? eol + 1 : content.size();
+			lines.emplace_back(content.substr(0, len));
+			content.remove_prefix(len);
+		}
+		return lines;
+	}
+
+	std::string_view eol_of(const std::vector<std::string>& lines) {
+		return !lines.empty() && cxx20::ends_with(lines.front(), "\r\n") ? "\r\n" : "\n";
+	}
+
+	// the class declared by cursor if it can be forward declared: a class or struct of namespaces only, not a template
+	bool to_forward_class(CXCursor decl, forward_class& out) {
+		auto kind = clang::getCursorKind(decl);
+		if (kind != CXCursor_ClassDecl && kind != CXCursor_StructDecl)
+			return false;
+		out.name = clang::to_string(clang::getCursorSpelling(decl));
+		out.is_struct = kind == CXCursor_StructDecl;
+		if (out.name.empty())
+			return false;
+		for (auto parent = clang::getCursorSemanticParent(decl); clang::getCursorKind(parent) != CXCursor_TranslationUnit;
+			 parent = clang::getCursorSemanticParent(parent)) {
+			if (clang::Cursor_isNull(parent) || clang::getCursorKind(parent) != CXCursor_Namespace)
+				return false; // nested in a class or function
+			auto name = clang::to_string(clang::getCursorSpelling(parent));
+			if (name.empty())
+				return false; // anonymous
+			out.namespaces.insert(out.namespaces.begin(), std::move(name));
+		}
+		return true;
+	}
+
+	void collect_header(CXTranslationUnit unit, header_state& state) {
+		clang::visitChildren(clang::getTranslationUnitCursor(unit), [](CXCursor cursor, CXCursor, CXClientData data) {
+			auto& state = *static_cast<header_state*>(data);
+			auto kind = clang::getCursorKind(cursor);
+			CXFile file = nullptr;
+			unsigned line = 0;
+			clang::getSpellingLocation(clang::getCursorLocation(cursor), &file, &line, nullptr, nullptr);
+			if (!file)
+				return CXChildVisit_Continue;
+			if (kind == CXCursor_InclusionDirective) {
+				auto included = clang::getIncludedFile(cursor);
+				if (!included)
+					return CXChildVisit_Continue;
+				auto& includer = state.path_of(file);
+				auto& path = state.path_of(included);
+				state.edges[includer].push_back(path);
+				if (includer == state.main && line > 0 && line <= state.lines.size())
+					state.includes.push_back(include_line{line, path, std::string{include_directive_of(state.lines[line - 1])}});
+				return CXChildVisit_Continue;
+			}
+			if (state.path_of(file) != state.main)
+				return CXChildVisit_Continue; // the declarations of the headers included
+
+			auto referenced = clang::getCursorReferenced(cursor);
+			if (clang::Cursor_isNull(referenced) || clang::getCursorKind(referenced) == CXCursor_Namespace)
+				return CXChildVisit_Recurse;
+			auto definition = clang::getCursorDefinition(referenced);
+			if (!clang::Cursor_isNull(definition))
+				referenced = definition;
+			CXFile declFile = nullptr;
+			clang::getSpellingLocation(clang::getCursorLocation(referenced), &declFile, nullptr, nullptr, nullptr);
+			if (!declFile)
+				return CXChildVisit_Recurse;
+			auto& declPath = state.path_of(declFile);
+			if (declPath == state.main)
+				return CXChildVisit_Recurse;
+			reference ref;
+			ref.file = declPath;
+			ref.declarable = kind == CXCursor_TypeRef && to_forward_class(referenced, ref.decl);
+			state.references.push_back(std::move(ref));
+			return CXChildVisit_Recurse;
+		}, &state);
+	}
+
+	// the includes referred to for the classes defined in them only
+	std::vector<candidate> find_candidates(const header_state& state) {
+		std::vector<candidate> candidates;
+		for (auto& include : state.includes) {
+			if (include.directive.empty() || include.directive.front() != '"')
+				continue; // the system headers are kept
+			auto closure = state.closure_of(include.path);
+			std::unordered_set<std::string> others;
+			for (auto& other : state.includes)
+				if (&other != &include && other.path != include.path)
+					for (auto& file : state.closure_of(other.path))
+						others.insert(file);
+			candidate cand;
+			cand.include = &include;
+			bool blocked = false;
+			for (auto& ref : state.references) {
+				if (!closure.count(ref.file) || others.count(ref.file))
+					continue;
+				if (ref.file != include.path || !ref.declarable) {
+					blocked = true;
+					break;
+				}
+				cand.classes.insert(ref.decl);
+			}
+			if (blocked || cand.classes.empty())
+				continue;
+			std::error_code ec;
+			for (auto& file : closure) {
+				if (others.count(file))
+					continue;
+				auto size = stdfs::file_size(file, ec);
+				if (!ec)
+					cand.bytes += size;
+			}
+			candidates.push_back(std::move(cand));
+		}
+		return candidates;
+	}
+
+	// namespace ax { class Sprite; class Node; }, a line per namespace
+	std::string forward_declarations(const std::set<forward_class>& classes, std::string_view eol) {
+		std::string text;
+		const std::vector<std::string>* namespaces = nullptr;
+		auto close = [&] {
+			for (size_t i = 0; i < namespaces->size(); ++i)
+				text += " }";
+			text += eol;
+		};
+		for (auto& decl : classes) {
+			if (!namespaces || *namespaces != decl.namespaces) {
+				if (namespaces)
+					close();
+				namespaces = &decl.namespaces;
+				for (auto& ns : decl.namespaces)
+					text += fmt::format("namespace {} {{ ", ns);
+			}
+			else
+				text.push_back(' ');
+			text += fmt::format("{} {};", decl.is_struct ? "struct" : "class", decl.name);
+		}
+		if (namespaces)
+			close();
+		return text;
+	}
+
+	class forward_decl_pass {
+	public:
+		forward_decl_pass(migrate_context& ctx, std::string root) : _ctx(ctx), _root(std::move(root)) {
+			if (!_ctx.compile_commands.empty() && !_db.load(_ctx.compile_commands))
+				throw std::runtime_error(fmt::format("No compile_commands.json in {}", _ctx.compile_commands));
+		}
+
+		// the include graph of the project, to find the units reaching a header
+		void scan(std::string_view dir, std::vector<std::string>& headers) {
+			auto paths = scan_tree(dir, [](std::string_view name) { return is_header(name) || is_translation_unit(name); });
+			for (auto& path : paths)
+				if (is_header(stdfs::path{path}.filename().generic_string()))
+					headers.push_back(path);
+			// the directives of the index of the same tree aren't read again
+			if (_ctx.index && _ctx.index->root() == _root) {
+				_ctx.index->fill(_graph);
+				stats::add("files_indexed", static_cast<int64_t>(_ctx.index->size()));
+			}
+			else {
+				for (auto& path : paths)
+					_graph.set(path, include_directives_of(load_file(path)));
+			}
+		}
+
+		void process(const std::string& header, int index) {
+			TRACE_SCOPE("forward_decl_header", header);
+			file_events _fe(_ctx, header.c_str(), index);
+			auto units = units_reaching(header);
+			if (units.empty())
+				return; // no unit to verify an edit by
+
+			header_state state;
+			state.main = header;
+			state.lines = split_lines(load_file(header));
+			std::string error;
+			auto unit = clang::parse_file(header, header_args(units.front()), CXTranslationUnit_DetailedPreprocessingRecord, error);
+			if (unit) {
+				if (error.empty())
+					collect_header(unit, state);
+				clang::disposeTranslationUnit(unit);
+			}
+			if (!unit || !error.empty()) {
+				_ctx.emit(AX_MIGRATE_EVENT_WARNING, header.c_str(), index, 0, 0, error.empty() ? "parse fail" : error.c_str());
+				return;
+			}
+			auto candidates = find_candidates(state);
+			if (candidates.empty()) {
+				_ctx.emit(AX_MIGRATE_EVENT_SKIPPED, header.c_str(), index);
+				return;
+			}
+			if (!units_parse(units, {})) {
+				_ctx.emit(AX_MIGRATE_EVENT_WARNING, header.c_str(), index, 0, 0, "a translation unit including it can't be parsed");
+				return;
+			}
+
+			// the source of the header, the edits of it are tried with the header
+			auto source = paired_source(header);
+			std::vector<std::string> sourceLines = source ? split_lines(load_file(*source)) : std::vector<std::string>{};
+			std::vector<const candidate*> accepted;
+			std::string headerText, sourceText;
+			for (auto& cand : candidates) {
+				accepted.push_back(&cand);
+				headerText = edit_header(state.lines, accepted);
+				if (source)
+					sourceText = edit_source(sourceLines, header, accepted);
+				std::vector<clang::unsaved_file> unsaved{{header, headerText}};
+				if (source)
+					unsaved.push_back({*source, sourceText});
+				if (!header_parses(header, units.front(), unsaved) || !units_parse(units, unsaved)) {
+					logger::verbose("Keep include {} of {}, a complete type is required", cand.include->directive, header);
+					accepted.pop_back();
+				}
+			}
+			if (accepted.empty()) {
+				_ctx.emit(AX_MIGRATE_EVENT_SKIPPED, header.c_str(), index);
+				return;
+			}
+
+			headerText = edit_header(state.lines, accepted);
+			write(header, state.lines, headerText);
+			if (source)
+				write(*source, sourceLines, edit_source(sourceLines, header, accepted));
+
+			// the units including the header don't preprocess the files brought in by the includes replaced,
+			// except the source of the header which includes them now
+			auto saving_units = units.size() - (source && std::find(units.begin(), units.end(), *source) != units.end() ? 1 : 0);
+			uint64_t bytes = 0;
+			for (auto cand : accepted)
+				bytes += cand->bytes * saving_units;
+			_saved_bytes += bytes;
+			_replaced += static_cast<int>(accepted.size());
+			++_ctx.hints;
+			stats::add("forward_decl_includes_replaced", static_cast<int64_t>(accepted.size()));
+			stats::add("forward_decl_saved_bytes", static_cast<int64_t>(bytes));
+			_ctx.emit(AX_MIGRATE_EVENT_REPLACED, header.c_str(), index, headerText.size(), static_cast<int>(accepted.size()), "forward-decl");
+		}
+
+		int replaced() const { return _replaced; }
+		uint64_t saved_bytes() const { return _saved_bytes; }
+
+	private:
+		std::vector<std::string> units_reaching(const std::string& header) const {
+			std::vector<std::string> units;
+			for (auto& file : _graph.files()) {
+				if (!is_translation_unit(file.first))
+					continue;
+				std::unordered_set<const std::string*> reached;
+				_graph.reach(file.first, reached, nullptr);
+				if (std::any_of(reached.begin(), reached.end(), [&](const std::string* path) { return *path == header; }))
+					units.push_back(file.first);
+			}
+			return units;
+		}
+
+		// the .cpp of the same name beside the header
+		const std::string* paired_source(const std::string& header) const {
+			auto stem = header.substr(0, header.find_last_of('.'));
+			for (auto& file : _graph.files()) {
+				auto& path = file.first;
+				if (cxx20::starts_with(path, stem) && path.find_last_of('.') == stem.size() && is_translation_unit(path))
+					return &path;
+			}
+			return nullptr;
+		}
+
+		std::vector<std::string> unit_args(const std::string& unit) const {
+			auto args = _db.args_of(unit);
+			return !args.empty() ? args : clang::default_args(unit, _root);
+		}
+
+		// a header is parsed by the command of a unit including it, as the language of the unit
+		std::vector<std::string> header_args(const std::string& unit) const {
+			auto args = unit_args(unit);
+			args.push_back(cxx20::ic::ends_with(unit, ".mm") ? "-xobjective-c++" : "-xc++");
+			return args;
+		}
+
+		bool header_parses(const std::string& header, const std::string& unit, const std::vector<clang::unsaved_file>& unsaved) const {
+			std::string error;
+			auto tu = clang::parse_file(header, header_args(unit), CXTranslationUnit_None, error, unsaved);
+			if (tu)
+				clang::disposeTranslationUnit(tu);
+			return tu && error.empty();
+		}
+
+		bool units_parse(const std::vector<std::string>& units, const std::vector<clang::unsaved_file>& unsaved) const {
+			std::atomic<bool> ok{true};
+			axstd::parallel_for(units.size(), _ctx.jobs, [&](size_t index) {
+				if (!ok.load(std::memory_order_relaxed))
+					return;
+				std::string error;
+				auto tu = clang::parse_file(units[index], unit_args(units[index]), CXTranslationUnit_None, error, unsaved);
+				if (tu)
+					clang::disposeTranslationUnit(tu);
+				if (!tu || !error.empty())
+					ok = false;
+			});
+			return ok.load();
+		}
+
+		static std::string edit_header(const std::vector<std::string>& lines, const std::vector<const candidate*>& accepted) {
+			auto eol = eol_of(lines);
+			std::string text;
+			for (size_t i = 0; i < lines.size(); ++i) {
+				auto cand = std::find_if(accepted.begin(), accepted.end(), [&](const candidate* elem) { return elem->include->line == i + 1; });
+				if (cand != accepted.end())
+					text += forward_declarations((*cand)->classes, eol);
+				else
+					text += lines[i];
+			}
+			return text;
+		}
+
+		// the includes moved after the include of the header, or the last include
+		static std::string edit_source(const std::vector<std::string>& lines, const std::string& header, const std::vector<const candidate*>& accepted) {
+			auto eol = eol_of(lines);
+			auto headerName = std::string_view{header}.substr(header.find_last_of('/') + 1);
+			size_t after = 0; // the line index + 1 to insert after, 0: at the top
+			for (size_t i = 0; i < lines.size(); ++i) {
+				auto directive = include_directive_of(lines[i]);
+				if (directive.empty())
+					continue;
+				auto name = directive.substr(1, directive.size() - 2);
+				auto slash = name.find_last_of('/');
+				if ((slash != std::string_view::npos ? name.substr(slash + 1) : name) == headerName) {
+					after = i + 1;
+					break;
+				}
+				after = i + 1;
+			}
+			std::string text;
+			for (size_t i = 0; i < after; ++i)
+				text += lines[i];
+			if (after > 0 && !cxx20::ends_with(lines[after - 1], "\n"))
+				text += eol;
+			for (auto cand : accepted)
+				text += fmt::format("#include {}{}", cand->include->directive, eol);
+			for (size_t i = after; i < lines.size(); ++i)
+				text += lines[i];
+			return text;
+		}
+
+		void write(const std::string& path, const std::vector<std::string>& lines, const std::string& text) const {
+			if (_ctx.dry_run)
+				return;
+			std::string original;
+			for (auto& line : lines)
+				original += line;
+			auto id = _ctx.plan_write(path, original);
+			save_file(path, {text});
+			_ctx.commit(id);
+		}
+
+		migrate_context& _ctx;
+		std::string _root; // with trailing '/'
+		clang::compile_commands _db;
+		include_graph _graph;
+		int _replaced = 0;
+		uint64_t _saved_bytes = 0;
+	};
+}
+
+void forward_declare_in_dir(migrate_context& ctx, std::string_view dir) {
+	if (!clang::ensure_lib())
+		throw std::runtime_error("libclang is required to forward declare the classes of the includes");
+	forward_decl_pass pass(ctx, root_of(dir));
+	std::vector<std::string> headers;
+	pass.scan(dir, headers);
+	ctx.total = static_cast<int>(headers.size());
+	// one by one, a header is verified by the units with the edits of the headers before
+	for (size_t index = 0; index < headers.size(); ++index)
+		pass.process(headers[index], static_cast<int>(index));
+	if (pass.replaced() > 0)
+		logger::info("Forward declared {} includes, estimated preprocessing saved: {:.1f}(MB) over the units including them", pass.replaced(),
+			pass.saved_bytes() / (1024.0 * 1024.0));
+}
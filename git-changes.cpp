@@ -0,0 +1,109 @@
+// --since <rev>: the files changed in the working tree since a revision and the untracked ones, by the local git binary.
+// Only the local repository is queried, the revision must resolve to a local commit, nothing is fetched.
+#include "base/logger.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(_WIN32)
+#	define popen _popen
+#	define pclose _pclose
+#endif
+
+namespace {
+	std::string quote_arg(std::string_view arg) {
+#if defined(_WIN32)
+		std::string quoted{'"'};
+		for (auto ch : arg) {
+			if (ch == '"')
+				quoted.push_back('\\');
+			quoted.push_back(ch);
+		}
+		quoted.push_back('"');
+#else
+		std::string quoted{'\''};
+		for (auto ch : arg) {
+			if (ch == '\'')
+				quoted += "'\\''";
+			else
+				quoted.push_back(ch);
+		}
+		quoted.push_back('\'');
+#endif
+		return quoted;
+	}
+
+	// a revision or ref expression, never an option or a remote url
+	bool is_valid_rev(std::string_view rev) {
+		if (rev.empty() || rev.front() == '-' || rev.find("://") != std::string_view::npos)
+			return false;
+		for (auto ch : rev)
+			if (!(isalnum(static_cast<unsigned char>(ch)) || strchr("._/~^@{}:-", ch)))
+				return false;
+		return true;
+	}
+
+	// runs git in dir, the NUL separated paths of stdout are appended to paths
+	bool run_git(const std::string& dir, const std::string& args, std::vector<std::string>* paths) {
+		auto command = "git --no-pager -C " + quote_arg(dir) + ' ' + args;
+#if defined(_WIN32)
+		command += " 2>NUL";
+#else
+		command += " 2>/dev/null";
+#endif
+		auto fp = popen(command.c_str(), "r");
+		if (!fp)
+			return false;
+		std::string output;
+		char buf[4096];
+		size_t n;
+		while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+			output.append(buf, n);
+		if (pclose(fp) != 0)
+			return false;
+		if (paths) {
+			std::string_view rest{output};
+			while (!rest.empty()) {
+				auto end = rest.find('\0');
+				auto path = rest.substr(0, end);
+				if (!path.empty())
+					paths->emplace_back(path);
+				rest.remove_prefix(end == std::string_view::npos ? rest.size() : end + 1);
+			}
+		}
+		return true;
+	}
+}
+
+// the paths are joined to dir, the deleted files and the ones of /DragonBones/ are not included
+bool git_changed_files(const char* dir, const char* rev, std::vector<std::string>& files) {
+	if (!is_valid_rev(rev)) {
+		logger::error("Invalid revision: {}", rev);
+		return false;
+	}
+	std::string root{dir};
+	while (root.size() > 1 && (root.back() == '/' || root.back() == '\\'))
+		root.pop_back();
+	auto quotedRev = quote_arg(std::string{rev} + "^{commit}");
+	if (!run_git(root, "rev-parse --verify --quiet " + quotedRev, nullptr)) {
+		logger::error("{} is not a commit of the local git repository of {}", rev, root);
+		return false;
+	}
+
+	// paths are relative to dir by --relative and ls-files
+	std::vector<std::string> paths;
+	if (!run_git(root, "diff --no-ext-diff --name-only --relative --diff-filter=d -z " + quotedRev + " --", &paths) ||
+		!run_git(root, "ls-files --others --exclude-standard -z", &paths)) {
+		logger::error("git diff of {} since {} fail", root, rev);
+		return false;
+	}
+	for (auto& path : paths) {
+		auto file = root + '/' + path;
+		if (file.find("/DragonBones/") == std::string::npos)
+			files.push_back(std::move(file));
+	}
+	return true;
+}
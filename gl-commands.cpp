@@ -0,0 +1,870 @@
+// ---------------------------------------- gl commands
+// The raw GL of the CustomCommand callbacks of cocos2d-x 3, which the renderer of axmol can neither batch nor sort by
+// state, rewritten to the backend: the callback is the lambda or method a `func` of a CustomCommand is assigned, by
+// CC_CALLBACK_0 or std::bind, and its statements are converted to the pipeline of that command when draw() runs:
+//   getGLProgram()->use()                  the program state of the node as the one of the pipeline
+//   setUniformsForBuiltins(transform)      the u_MVPMatrix uniform of it
+//   GL::bindTexture2D(texture)             the texture of it
+//   GL::blendFunc(src, dst), glBlendFunc   the blend descriptor of the pipeline
+//   glVertexAttribPointer, glDrawArrays    the vertex layout, a vertex buffer updated from the client array and
+//                                          the draw info of the command, the attributes interleaved in one array
+// the GL calls which only set up the state above, enabling the attributes and unbinding the buffers, and the
+// CHECK_GL_ERROR_DEBUG and CC_INCREMENT_GL_DRAWN_* statements are removed. Then the assignment of `func` calls the
+// callback directly. A callback with any other GL call, or with a form of the above it can't follow, is left as is
+// and each of its GL calls is reported as a warning.
+//
+// The units are parsed in parallel by unit_parser, the edits are applied like `semantic`, a header by the lowest unit
+// index having edits of it.
+#include "migrate-context.h"
+#include "clang-api.h"
+#include "include-graph.h"
+#include "unit-parser.h"
+#include "base/trace.h"
+#include "base/logger.h"
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <set>
+
+using namespace std::string_view_literals;
+
+namespace {
+	// the statements of the state the backend sets up by itself
+	const std::string_view removed_calls[] = {
+		"GL::enableVertexAttribs",
+		"GL::bindVAO",
+		"glEnableVertexAttribArray",
+		"glDisableVertexAttribArray",
+		"glActiveTexture",
+	};
+
+	const std::string_view removed_macros[] = {
+		"CHECK_GL_ERROR_DEBUG",
+		"CC_INCREMENT_GL_DRAWN_BATCHES_AND_VERTICES",
+		"CC_INCREMENT_GL_DRAWS",
+		"CC_INCREMENT_GL_VERTICES",
+	};
+
+	const std::pair<std::string_view, std::string_view> primitive_types[] = {
+		{"GL_TRIANGLES", "TRIANGLE"},
+		{"GL_TRIANGLE_STRIP", "TRIANGLE_STRIP"},
+		{"GL_LINES", "LINE"},
+		{"GL_LINE_STRIP", "LINE_STRIP"},
+		{"GL_POINTS", "POINT"},
+	};
+
+	template <size_t N>
+	bool is_one_of(std::string_view name, const std::string_view (&names)[N]) {
+		return std::find(std::begin(names), std::end(names), name) != std::end(names);
+	}
+
+	std::string_view trim(std::string_view text) {
+		while (!text.empty() && is_space(text.front()))
+			text.remove_prefix(1);
+		while (!text.empty() && is_space(text.back()))
+			text.remove_suffix(1);
+		return text;
+	}
+
+	std::string canonical_type(CXType type) {
+		return clang::to_string(clang::getTypeSpelling(clang::getCanonicalType(type)));
+	}
+
+	CXCursor strip(CXCursor expr) {
+		while (clang::getCursorKind(expr) == CXCursor_UnexposedExpr || clang::getCursorKind(expr) == CXCursor_ParenExpr) {
+			auto children = children_of(expr);
+			if (children.size() != 1)
+				break;
+			expr = children.front();
+		}
+		return expr;
+	}
+
+	// the arguments of a call spelled as text, from its '(' on, empty if unbalanced
+	std::vector<std::string_view> split_args(std::string_view call) {
+		std::vector<std::string_view> args;
+		auto open = call.find('(');
+		if (open == std::string_view::npos)
+			return args;
+		int depth = 0;
+		size_t first = open + 1;
+		for (size_t pos = open; pos < call.size(); ++pos) {
+			auto ch = call[pos];
+			if (ch == '"' || ch == '\'') {
+				while (++pos < call.size() && call[pos] != ch)
+					if (call[pos] == '\\')
+						++pos;
+			}
+			else if (ch == '(' || ch == '[' || ch == '{')
+				++depth;
+			else if (ch == ')' || ch == ']' || ch == '}') {
+				if (--depth == 0) {
+					if (!trim(call.substr(first, pos - first)).empty())
+						args.push_back(trim(call.substr(first, pos - first)));
+					return args;
+				}
+			}
+			else if (ch == ',' && depth == 1) {
+				args.push_back(trim(call.substr(first, pos - first)));
+				first = pos + 1;
+			}
+		}
+		return {};
+	}
+
+	// the offset of the parenthesis closing the one at open, npos if unbalanced
+	size_t closing_of(std::string_view text, size_t open) {
+		int depth = 0;
+		for (auto pos = open; pos < text.size(); ++pos) {
+			if (text[pos] == '(')
+				++depth;
+			else if (text[pos] == ')' && --depth == 0)
+				return pos;
+		}
+		return std::string_view::npos;
+	}
+
+	// the pointer of glVertexAttribPointer without the casts: (GLvoid*)(offset + offsetof(V3F_C4B_T2F, colors))
+	std::string_view strip_casts(std::string_view text) {
+		for (;;) {
+			text = trim(text);
+			if (text.empty() || text.front() != '(')
+				return text;
+			auto close = closing_of(text, 0);
+			if (close == std::string_view::npos)
+				return text;
+			auto inner = trim(text.substr(1, close - 1));
+			if (close + 1 == text.size()) { // parenthesized
+				text = inner;
+				continue;
+			}
+			// a c style cast of a type: (void*), (const GLvoid*), (size_t), (char*)
+			if (inner.find_first_of("()+-,") != std::string_view::npos)
+				return text;
+			text.remove_prefix(close + 1);
+		}
+	}
+
+	// the arguments of the call a statement ends with, getGLProgram()->setUniformsForBuiltins(transform);
+	std::vector<std::string_view> call_args(std::string_view statement) {
+		statement = trim(statement);
+		if (!statement.empty() && statement.back() == ';')
+			statement = trim(statement.substr(0, statement.size() - 1));
+		int depth = 0;
+		for (auto pos = statement.size(); pos-- > 0;) {
+			if (statement[pos] == ')')
+				++depth;
+			else if (statement[pos] == '(' && --depth == 0)
+				return split_args(statement.substr(pos));
+		}
+		return {};
+	}
+
+	// a vertex attribute of glVertexAttribPointer
+	struct vertex_attrib {
+		std::string name;   // of the attribute of the program
+		std::string format; // backend::VertexFormat
+		std::string offset;
+		bool normalized = false;
+	};
+
+	class unit_converter;
+
+	// the statements of a callback converted, or the GL calls it can't convert
+	class callback_converter {
+	public:
+		callback_converter(unit_converter& unit, std::string command) : _unit(unit), _command(std::move(command)) {}
+
+		// the edits of the statements of the body, false if any is left as is, with the calls reported
+		bool convert(CXCursor body, file_text& file);
+
+		std::vector<text_edit> edits;
+		std::vector<std::pair<CXCursor, std::string>> flagged;
+
+	private:
+		bool convert_statement(CXCursor statement, unsigned begin, unsigned end);
+		bool convert_call(CXCursor call, const std::string& name, const std::vector<std::string_view>& args, std::string& text);
+		bool convert_attrib(const std::vector<std::string_view>& args);
+		bool convert_draw(const std::vector<std::string_view>& args, std::string& text);
+		std::string program_state();
+		void gl_calls_of(CXCursor cursor, std::vector<CXCursor>& calls);
+
+		unit_converter& _unit;
+		std::string _command;
+		file_text* _file = nullptr;
+		std::string _indent;
+		std::vector<vertex_attrib> _attribs;
+		std::string _base;   // the client array the attributes point into
+		std::string _stride;
+		std::string_view _body;
+		CXCursor _call{}; // of the statement converted
+		// the locals declared by the callback, by name, for a pointer of the attributes cast to an integer
+		std::map<std::string, std::pair<std::string, text_edit>, std::less<>> _locals;
+		bool _program = false;
+		bool _blend = false;
+		bool _drawn = false;
+	};
+
+	class unit_converter {
+	public:
+		explicit unit_converter(const unit_parser& parser) : _parser(parser), _files(parser) {}
+
+		void visit(CXTranslationUnit unit) { clang::visitChildren(clang::getTranslationUnitCursor(unit), visit_child, this); }
+
+		// the edits by file, sorted
+		std::map<std::string, std::vector<text_edit>> take_edits() {
+			std::map<std::string, std::vector<text_edit>> edits;
+			for (auto& file : _edits) {
+				std::sort(file.second.begin(), file.second.end(), [](const text_edit& lhs, const text_edit& rhs) { return lhs.begin < rhs.begin; });
+				edits.emplace(file.first, std::move(file.second));
+			}
+			return edits;
+		}
+
+		// the GL calls left as is, by file, line and column
+		std::vector<std::string> flagged;
+		int converted = 0;
+
+		file_text& file_of(CXFile file) { return _files.file_of(file); }
+
+		// the range of a cursor where it's expanded, a macro invocation at its end, CHECK_GL_ERROR_DEBUG(), to the closing
+		// parenthesis of it
+		file_text* extent_of(CXCursor cursor, unsigned& begin, unsigned& end) {
+			auto extent = clang::getCursorExtent(cursor);
+			CXFile first = nullptr, last = nullptr, spelling = nullptr;
+			unsigned spellingEnd = 0;
+			clang::getExpansionLocation(clang::getRangeStart(extent), &first, nullptr, nullptr, &begin);
+			clang::getExpansionLocation(clang::getRangeEnd(extent), &last, nullptr, nullptr, &end);
+			clang::getSpellingLocation(clang::getRangeEnd(extent), &spelling, nullptr, nullptr, &spellingEnd);
+			if (!first || first != last)
+				return nullptr;
+			auto& file = file_of(first);
+			if (!file.project || end > file.content.size())
+				return nullptr;
+			if (spelling != last || spellingEnd != end) {
+				auto& content = file.content;
+				while (end < content.size() && is_ident(content[end]))
+					++end;
+				auto open = content.find_first_not_of(" \t", end);
+				if (open != std::string::npos && content[open] == '(') {
+					int depth = 0;
+					for (auto pos = open; pos < content.size(); ++pos) {
+						if (content[pos] == '(')
+							++depth;
+						else if (content[pos] == ')' && --depth == 0) {
+							end = static_cast<unsigned>(pos + 1);
+							break;
+						}
+					}
+				}
+			}
+			return begin < end ? &file : nullptr;
+		}
+
+		// the name of a GL function, or of an engine function of GL, empty if the call is neither
+		static std::string gl_name(CXCursor callee) {
+			auto name = engine_name(callee);
+			if (cxx20::starts_with(name, "GL::"sv) || cxx20::starts_with(name, "GLProgram::"sv) || cxx20::starts_with(name, "GLProgramState::"sv))
+				return name;
+			auto kind = clang::getCursorKind(callee);
+			if (kind != CXCursor_FunctionDecl && kind != CXCursor_VarDecl) // glad calls by function pointers
+				return {};
+			name = clang::to_string(clang::getCursorSpelling(callee));
+			if (cxx20::starts_with(name, "glad_"sv))
+				name.erase(0, 5);
+			return name.size() > 2 && name[0] == 'g' && name[1] == 'l' && name[2] >= 'A' && name[2] <= 'Z' ? name : std::string{};
+		}
+
+	private:
+		static CXChildVisitResult visit_child(CXCursor cursor, CXCursor, CXClientData data) {
+			auto self = static_cast<unit_converter*>(data);
+			CXFile file = nullptr;
+			clang::getSpellingLocation(clang::getCursorLocation(cursor), &file, nullptr, nullptr, nullptr);
+			if (!file || !self->file_of(file).project)
+				return CXChildVisit_Continue; // the engine and system headers
+			auto kind = clang::getCursorKind(cursor);
+			if (kind == CXCursor_FunctionDecl || kind == CXCursor_CXXMethod || kind == CXCursor_Constructor || kind == CXCursor_Destructor)
+				self->_function = cursor; // the definitions visited depth first, a lambda is within its function
+			else if (kind == CXCursor_CallExpr && clang::to_string(clang::getCursorSpelling(cursor)) == "operator=")
+				self->inspect_assignment(cursor);
+			return CXChildVisit_Recurse;
+		}
+
+		// command.func = callback
+		void inspect_assignment(CXCursor call) {
+			auto children = children_of(call);
+			if (children.size() < 2)
+				return;
+			auto target = strip(children.front());
+			if (clang::getCursorKind(target) != CXCursor_MemberRefExpr || engine_name(clang::getCursorReferenced(target)) != "CustomCommand::func")
+				return;
+			unsigned begin = 0, end = 0, commandBegin = 0, commandEnd = 0;
+			auto file = extent_of(call, begin, end);
+			auto command = children_of(target);
+			if (!file || command.empty() || extent_of(command.front(), commandBegin, commandEnd) != file)
+				return;
+			auto commandText = file->content.substr(commandBegin, commandEnd - commandBegin);
+			auto rhs = std::string_view{file->content}.substr(begin, end - begin);
+			auto assign = rhs.find('=', commandEnd - begin);
+			if (assign == std::string_view::npos)
+				return;
+			rhs = trim(rhs.substr(assign + 1));
+
+			// the lambda, or the method it calls, CC_CALLBACK_0(Class::method, this, args...) or
+			// std::bind(&Class::method, this, args...) bound
+			auto callback = strip(children.back());
+			CXCursor lambda = clang::getNullCursor(), method = clang::getNullCursor();
+			std::string direct;
+			if (clang::getCursorKind(callback) == CXCursor_LambdaExpr) {
+				for (auto& child : children_of(callback))
+					if (clang::getCursorKind(child) == CXCursor_CompoundStmt)
+						lambda = child;
+				if (clang::Cursor_isNull(lambda))
+					return;
+				auto statements = children_of(lambda);
+				unsigned callBegin = 0, callEnd = 0;
+				if (statements.size() == 1 && clang::getCursorKind(strip(statements.front())) == CXCursor_CallExpr &&
+					extent_of(strip(statements.front()), callBegin, callEnd) == file) {
+					method = callback_method(strip(statements.front()));
+					direct = file->content.substr(callBegin, callEnd - callBegin);
+					if (cxx20::starts_with(direct, "this->"sv))
+						direct.erase(0, 6);
+					if (!clang::Cursor_isNull(method) && !cxx20::starts_with(direct, clang::to_string(clang::getCursorSpelling(method)) + "("))
+						return; // a method of another object
+				}
+			}
+			else {
+				method = callback_method(callback);
+				auto args = split_args(rhs);
+				if (clang::Cursor_isNull(method) || args.size() < 2)
+					return;
+				if (args[1] != "this"sv) {
+					if (has_gl_calls(method_body(method)))
+						flag(call, "a callback bound to another object than this");
+					return;
+				}
+				direct = clang::to_string(clang::getCursorSpelling(method)) + "(";
+				for (size_t i = 2; i < args.size(); ++i)
+					direct += fmt::format("{}{}", i > 2 ? ", " : "", args[i]);
+				direct += ')';
+			}
+			auto body = clang::Cursor_isNull(method) ? lambda : method_body(method);
+			if (!has_gl_calls(body))
+				return;
+
+			// the program state of the pipeline is the one of this node
+			if (clang::getCursorKind(_function) != CXCursor_CXXMethod || clang::CXXMethod_isStatic(_function)) {
+				flag(call, "a callback assigned outside of a method of the node");
+				return;
+			}
+			if (clang::Cursor_isNull(method))
+				convert_lambda(lambda, commandText, *file, begin, end);
+			else if (clang::getCursorKind(clang::getCursorReferenced(strip(command.front()))) != CXCursor_FieldDecl)
+				flag(call, "the command is a local of the caller, not a field the callback can reach");
+			else
+				convert_method(body, commandText, *file, begin, end, direct);
+		}
+
+		static CXCursor method_body(CXCursor method) {
+			auto definition = clang::getCursorDefinition(method);
+			if (!clang::Cursor_isNull(definition))
+				for (auto& child : children_of(definition))
+					if (clang::getCursorKind(child) == CXCursor_CompoundStmt)
+						return child;
+			return clang::getNullCursor();
+		}
+
+		static bool has_gl_calls(CXCursor cursor) {
+			bool found = false;
+			if (!clang::Cursor_isNull(cursor))
+				clang::visitChildren(cursor, [](CXCursor child, CXCursor, CXClientData data) {
+					if (clang::getCursorKind(child) == CXCursor_CallExpr && !gl_name(clang::getCursorReferenced(child)).empty()) {
+						*static_cast<bool*>(data) = true;
+						return CXChildVisit_Break;
+					}
+					return CXChildVisit_Recurse;
+				}, &found);
+			return found;
+		}
+
+		// the project method of this called or bound by a callback
+		CXCursor callback_method(CXCursor callback) {
+			struct search {
+				unit_converter* self;
+				CXCursor method;
+			} state{this, clang::getNullCursor()};
+			auto visit = [](CXCursor cursor, CXCursor, CXClientData data) {
+				auto state = static_cast<search*>(data);
+				auto kind = clang::getCursorKind(cursor);
+				if (kind == CXCursor_DeclRefExpr || kind == CXCursor_MemberRefExpr) {
+					auto referenced = clang::getCursorReferenced(cursor);
+					if (clang::getCursorKind(referenced) == CXCursor_CXXMethod && engine_name(referenced).empty()) {
+						state->method = referenced;
+						return CXChildVisit_Break;
+					}
+				}
+				return CXChildVisit_Recurse;
+			};
+			if (clang::getCursorKind(callback) == CXCursor_CallExpr && clang::getCursorKind(clang::getCursorReferenced(callback)) == CXCursor_CXXMethod &&
+				engine_name(clang::getCursorReferenced(callback)).empty())
+				return clang::getCursorReferenced(callback);
+			clang::visitChildren(callback, visit, &state);
+			return state.method;
+		}
+
+		void convert_method(CXCursor body, const std::string& command, file_text& file, unsigned begin, unsigned end, std::string_view direct) {
+			unsigned bodyBegin = 0, bodyEnd = 0;
+			auto bodyFile = extent_of(body, bodyBegin, bodyEnd);
+			if (!bodyFile)
+				return; // not in the project
+			// a method bound by two assignments is converted once, for one command
+			auto bound = _methods.emplace(std::make_pair(bodyFile->path, bodyBegin), command);
+			if (!bound.second) {
+				if (bound.first->second != command)
+					flag(body, fmt::format("the callback of both {} and {}", bound.first->second, command));
+				else
+					_edits[file.path].push_back(text_edit{begin, end, std::string{direct}});
+				return;
+			}
+			callback_converter converter(*this, command);
+			if (!converter.convert(body, *bodyFile)) {
+				report(converter);
+				return;
+			}
+			auto& edits = _edits[bodyFile->path];
+			edits.insert(edits.end(), converter.edits.begin(), converter.edits.end());
+			_edits[file.path].push_back(text_edit{begin, end, std::string{direct}});
+			++converted;
+		}
+
+		// the statement of the assignment replaced by the statements of the lambda
+		void convert_lambda(CXCursor body, const std::string& command, file_text& file, unsigned begin, unsigned end) {
+			unsigned bodyBegin = 0, bodyEnd = 0;
+			if (extent_of(body, bodyBegin, bodyEnd) != &file)
+				return;
+			// [this, transform], the captures are the names of the scope as is, unless initialized
+			auto captures = std::string_view{file.content}.substr(begin, bodyBegin - begin);
+			auto open = captures.find('[', captures.find('=') + 1), close = captures.find(']', open);
+			if (open == std::string_view::npos || close == std::string_view::npos)
+				return;
+			for (auto list = captures.substr(open + 1, close - open - 1); !list.empty();) {
+				auto comma = list.find(',');
+				auto capture = trim(list.substr(0, comma));
+				if (capture != "="sv && capture.find('=') != std::string_view::npos) {
+					flag(body, "a lambda with init captures");
+					return;
+				}
+				list = comma == std::string_view::npos ? std::string_view{} : list.substr(comma + 1);
+			}
+			auto semicolon = file.content.find_first_not_of(" \t", end);
+			if (semicolon == std::string::npos || file.content[semicolon] != ';')
+				return;
+			callback_converter converter(*this, command);
+			if (!converter.convert(body, file)) {
+				report(converter);
+				return;
+			}
+			// the lambda to a block of its statements, so the locals of two callbacks can't clash
+			auto& edits = _edits[file.path];
+			edits.push_back(text_edit{begin, bodyBegin + 1, "{"});
+			edits.insert(edits.end(), converter.edits.begin(), converter.edits.end());
+			edits.push_back(text_edit{bodyEnd - 1, static_cast<unsigned>(semicolon + 1), "}"});
+			++converted;
+		}
+
+	public:
+		static std::string indent_at(const std::string& content, unsigned offset) {
+			auto line = content.rfind('\n', offset == 0 ? 0 : offset - 1);
+			line = line == std::string::npos ? 0 : line + 1;
+			auto last = line;
+			while (last < offset && (content[last] == ' ' || content[last] == '\t'))
+				++last;
+			return content.substr(line, last - line);
+		}
+
+		void flag(CXCursor cursor, std::string_view reason) {
+			CXFile file = nullptr;
+			unsigned line = 0, column = 0;
+			clang::getExpansionLocation(clang::getCursorLocation(cursor), &file, &line, &column, nullptr);
+			if (file)
+				flagged.push_back(fmt::format("{}:{}:{}: {}", file_of(file).path.substr(_parser.root().size()), line, column, reason));
+		}
+
+	private:
+		void report(const callback_converter& converter) {
+			for (auto& item : converter.flagged)
+				flag(item.first, item.second);
+		}
+
+		const unit_parser& _parser;
+		CXCursor _function{}; // the function visited
+		std::map<std::pair<std::string, unsigned>, std::string> _methods; // the command of each method converted, by its body
+		unit_files _files;
+		std::map<std::string, std::vector<text_edit>> _edits;
+	};
+
+	bool callback_converter::convert(CXCursor body, file_text& file) {
+		_file = &file;
+		unsigned bodyBegin = 0, bodyEnd = 0;
+		_unit.extent_of(body, bodyBegin, bodyEnd);
+		_body = std::string_view{file.content}.substr(bodyBegin, bodyEnd - bodyBegin);
+		bool ok = true;
+		for (auto& statement : children_of(body)) {
+			unsigned begin = 0, end = 0;
+			if (_unit.extent_of(statement, begin, end) != &file) {
+				std::vector<CXCursor> calls;
+				gl_calls_of(statement, calls);
+				for (auto& call : calls)
+					flagged.emplace_back(call, fmt::format("{} within a macro", unit_converter::gl_name(clang::getCursorReferenced(call))));
+				ok = ok && calls.empty();
+				continue;
+			}
+			ok = convert_statement(statement, begin, end) && ok;
+		}
+		if (ok && !_drawn && !_attribs.empty())
+			flagged.emplace_back(body, "the vertex attributes are never drawn"), ok = false;
+		return ok;
+	}
+
+	void callback_converter::gl_calls_of(CXCursor cursor, std::vector<CXCursor>& calls) {
+		if (clang::getCursorKind(cursor) == CXCursor_CallExpr && !unit_converter::gl_name(clang::getCursorReferenced(cursor)).empty())
+			calls.push_back(cursor);
+		struct state {
+			callback_converter* self;
+			std::vector<CXCursor>* calls;
+		} data{this, &calls};
+		clang::visitChildren(cursor, [](CXCursor child, CXCursor, CXClientData data) {
+			auto state = static_cast<struct state*>(data);
+			if (clang::getCursorKind(child) == CXCursor_CallExpr && !unit_converter::gl_name(clang::getCursorReferenced(child)).empty())
+				state->calls->push_back(child);
+			return CXChildVisit_Recurse;
+		}, &data);
+	}
+
+	bool callback_converter::convert_statement(CXCursor statement, unsigned begin, unsigned end) {
+		auto& content = _file->content;
+		// the statement with its semicolon, or the lines of it if nothing else is on them
+		auto stop = content.find_first_not_of(" \t", end);
+		if (stop != std::string::npos && content[stop] == ';')
+			end = static_cast<unsigned>(stop + 1);
+		_indent = unit_converter::indent_at(content, begin);
+		auto removal = [&] {
+			auto first = begin - static_cast<unsigned>(_indent.size());
+			auto last = content.find_first_not_of(" \t\r", end);
+			if (content.compare(first, _indent.size(), _indent) == 0 && (first == 0 || content[first - 1] == '\n') && last != std::string::npos && content[last] == '\n')
+				return text_edit{first, static_cast<unsigned>(last + 1), {}};
+			return text_edit{begin, end, {}};
+		};
+
+		std::string_view text{content.data() + begin, end - begin};
+		size_t nameEnd = 0;
+		while (nameEnd < text.size() && is_ident(text[nameEnd]))
+			++nameEnd;
+		if (is_one_of(text.substr(0, nameEnd), removed_macros)) {
+			edits.push_back(removal());
+			return true;
+		}
+
+		std::vector<CXCursor> calls;
+		gl_calls_of(statement, calls);
+		if (calls.empty()) {
+			// size_t offset = (size_t)_quad;
+			auto decls = children_of(statement);
+			if (clang::getCursorKind(statement) == CXCursor_DeclStmt && decls.size() == 1 && clang::getCursorKind(decls.front()) == CXCursor_VarDecl) {
+				auto init = text.find('=');
+				auto value = init != std::string_view::npos ? trim(text.substr(init + 1)) : std::string_view{};
+				if (!value.empty() && value.back() == ';')
+					value.remove_suffix(1);
+				if (!value.empty())
+					_locals[clang::to_string(clang::getCursorSpelling(decls.front()))] = {std::string{strip_casts(value)}, removal()};
+			}
+			return true;
+		}
+		auto call = strip(statement);
+		if (clang::getCursorKind(call) != CXCursor_CallExpr || calls.size() != 1 || !clang::equalCursors(call, calls.front())) {
+			for (auto& nested : calls)
+				flagged.emplace_back(nested, fmt::format("{} within a statement", unit_converter::gl_name(clang::getCursorReferenced(nested))));
+			return false;
+		}
+		auto name = unit_converter::gl_name(clang::getCursorReferenced(call));
+		auto args = call_args(text);
+		_call = call;
+		std::string converted;
+		if (!convert_call(call, name, args, converted)) {
+			if (flagged.empty() || !clang::equalCursors(flagged.back().first, call))
+				flagged.emplace_back(call, fmt::format("{} has no backend conversion", name));
+			return false;
+		}
+		if (converted.empty())
+			edits.push_back(removal());
+		else
+			edits.push_back(text_edit{begin, end, std::move(converted)});
+		return true;
+	}
+
+	std::string callback_converter::program_state() {
+		if (_program)
+			return {};
+		_program = true;
+		return fmt::format("{}.getPipelineDescriptor().programState = getProgramState();", _command);
+	}
+
+	bool callback_converter::convert_call(CXCursor call, const std::string& name, const std::vector<std::string_view>& args, std::string& text) {
+		auto line = [&](std::string_view statement) {
+			if (statement.empty())
+				return;
+			if (!text.empty())
+				text += '\n' + _indent;
+			text += statement;
+		};
+		if (is_one_of(name, removed_calls) || ((name == "glBindBuffer"sv || name == "glBindVertexArray"sv) && !args.empty() && args.back() == "0"sv))
+			return true;
+		if (name == "GLProgram::use"sv || name == "GL::useProgram"sv) {
+			line(program_state());
+			return true;
+		}
+		if (name == "GLProgram::setUniformsForBuiltins"sv || name == "GLProgramState::apply"sv) {
+			auto transform = args.empty() ? std::string_view{"_modelViewTransform"} : args.front();
+			line(program_state());
+			line(fmt::format("getProgramState()->setUniform(getProgramState()->getUniformLocation(\"u_MVPMatrix\"), "
+							 "(Director::getInstance()->getMatrix(MATRIX_STACK_TYPE::MATRIX_STACK_PROJECTION) * {}).m, sizeof(Mat4::m));",
+				transform));
+			return true;
+		}
+		if (name == "GL::bindTexture2D"sv || name == "GL::bindTexture2DN"sv || name == "glBindTexture"sv) {
+			if (args.size() != 2 && !(name == "GL::bindTexture2D"sv && args.size() == 1))
+				return false;
+			if ((name == "GL::bindTexture2DN"sv && args.front() != "0"sv) || (name == "glBindTexture"sv && args.front() != "GL_TEXTURE_2D"sv))
+				return false;
+			// a Texture2D, or the GL name of one
+			auto arg = strip(clang::Cursor_getArgument(call, clang::Cursor_getNumArguments(call) - 1));
+			auto texture = std::string{args.back()};
+			if (clang::getCursorKind(arg) == CXCursor_CallExpr && engine_name(clang::getCursorReferenced(arg)) == "Texture2D::getName") {
+				auto ref = children_of(arg);
+				auto getter = texture.rfind("getName");
+				if (getter == std::string::npos || getter < 2)
+					return false;
+				texture.erase(getter);
+				while (!texture.empty() && (texture.back() == '>' || texture.back() == '-' || texture.back() == '.' || is_space(texture.back())))
+					texture.pop_back();
+				if (ref.empty() || canonical_type(clang::getCursorType(strip(children_of(ref.front()).empty() ? ref.front() : children_of(ref.front()).front()))).back() != '*')
+					texture = "(&" + texture + ")";
+			}
+			else if (canonical_type(clang::getCursorType(arg)).find("Texture2D *") == std::string::npos)
+				return false;
+			line(program_state());
+			line(fmt::format("getProgramState()->setTexture({}->getBackendTexture());", texture));
+			return true;
+		}
+		if (name == "GL::blendFunc"sv || name == "glBlendFunc"sv) {
+			if (args.size() != 2 || _blend)
+				return false;
+			_blend = true;
+			line(fmt::format("auto& blendDescriptor = {}.getPipelineDescriptor().blendDescriptor;", _command));
+			line("blendDescriptor.blendEnabled = true;");
+			line(fmt::format("blendDescriptor.sourceRGBBlendFactor = blendDescriptor.sourceAlphaBlendFactor = utils::toBackendBlendFactor({});", args[0]));
+			line(fmt::format("blendDescriptor.destinationRGBBlendFactor = blendDescriptor.destinationAlphaBlendFactor = utils::toBackendBlendFactor({});", args[1]));
+			return true;
+		}
+		if ((name == "glEnable"sv || name == "glDisable"sv) && args.size() == 1 && args.front() == "GL_BLEND"sv) {
+			line(fmt::format("{}.getPipelineDescriptor().blendDescriptor.blendEnabled = {};", _command, name == "glEnable"sv ? "true" : "false"));
+			return true;
+		}
+		if (name == "glVertexAttribPointer"sv)
+			return convert_attrib(args);
+		if (name == "glDrawArrays"sv) {
+			if (!convert_draw(args, text))
+				return false;
+			return true;
+		}
+		return false;
+	}
+
+	// glVertexAttribPointer(GLProgram::VERTEX_ATTRIB_POSITION, 3, GL_FLOAT, GL_FALSE, stride, pointer)
+	bool callback_converter::convert_attrib(const std::vector<std::string_view>& args) {
+		if (args.size() != 6)
+			return false;
+		vertex_attrib attrib;
+		auto index = args[0];
+		if (index.find("POSITION") != std::string_view::npos || index.find("Position") != std::string_view::npos)
+			attrib.name = "a_position";
+		else if (index.find("TEX_COORD") != std::string_view::npos || index.find("TexCoord") != std::string_view::npos)
+			attrib.name = "a_texCoord";
+		else if (index.find("COLOR") != std::string_view::npos || index.find("Color") != std::string_view::npos)
+			attrib.name = "a_color";
+		else
+			return false;
+		if (args[2] == "GL_FLOAT"sv && args[1].size() == 1 && args[1][0] >= '1' && args[1][0] <= '4')
+			attrib.format = args[1] == "1"sv ? "FLOAT" : fmt::format("FLOAT{}", args[1]);
+		else if (args[2] == "GL_UNSIGNED_BYTE"sv && args[1] == "4"sv)
+			attrib.format = "UBYTE4";
+		else
+			return false;
+		attrib.normalized = args[3] == "GL_TRUE"sv || args[3] == "true"sv;
+
+		// the client array, with the offset of the attribute in its vertex
+		auto pointer = strip_casts(args[5]);
+		std::string_view base = pointer, offset = "0";
+		auto plus = pointer.find('+');
+		if (plus != std::string_view::npos) {
+			base = strip_casts(pointer.substr(0, plus));
+			offset = strip_casts(pointer.substr(plus + 1));
+		}
+		if (base.empty() || offset.empty() || base.find_first_of("+-") != std::string_view::npos)
+			return false;
+		std::string stride{args[4]};
+		if (stride == "0") {
+			if (!_attribs.empty())
+				return false; // tightly packed arrays of their own
+			stride = fmt::format("sizeof({}) * {}", args[2] == "GL_FLOAT"sv ? "float" : "uint8_t", args[1]);
+		}
+		if (!_attribs.empty() && (_base != base || _stride != stride))
+			return false; // not interleaved in one array
+		_base = base;
+		_stride = std::move(stride);
+		attrib.offset = offset;
+		_attribs.push_back(std::move(attrib));
+		return true;
+	}
+
+	// glDrawArrays(mode, first, count) of the attributes
+	bool callback_converter::convert_draw(const std::vector<std::string_view>& args, std::string& text) {
+		if (args.size() != 3 || _attribs.empty() || _drawn) {
+			flagged.emplace_back(_call, _drawn ? "a second glDrawArrays of the callback" : "glDrawArrays without the vertex attributes it can follow");
+			return false;
+		}
+		auto primitive = std::find_if(std::begin(primitive_types), std::end(primitive_types), [&](const auto& type) { return type.first == args[0]; });
+		if (primitive == std::end(primitive_types)) {
+			flagged.emplace_back(_call, fmt::format("{} has no primitive type of the backend", args[0]));
+			return false;
+		}
+		_drawn = true;
+		// the array of a local, removed when the attributes were all its uses
+		if (auto local = _locals.find(_base); local != _locals.end() && !local->second.first.empty()) {
+			size_t uses = 0;
+			for (auto pos = _body.find(local->first); pos != std::string_view::npos; pos = _body.find(local->first, pos + 1))
+				if ((pos == 0 || !is_ident(_body[pos - 1])) && (pos + local->first.size() == _body.size() || !is_ident(_body[pos + local->first.size()])))
+					++uses;
+			_base = local->second.first;
+			if (uses == _attribs.size() + 1)
+				edits.push_back(local->second.second);
+		}
+		auto line = [&](std::string_view statement) {
+			if (statement.empty())
+				return;
+			if (!text.empty())
+				text += '\n' + _indent;
+			text += statement;
+		};
+		auto simple = [](std::string_view expr) { return std::all_of(expr.begin(), expr.end(), [](char ch) { return is_ident(ch) || ch == '.' || ch == '>' || ch == '-'; }); };
+		auto count = simple(args[2]) ? std::string{args[2]} : fmt::format("({})", args[2]);
+		auto vertices = args[1] == "0"sv ? count : fmt::format("{} + {}", args[1], count);
+		auto capacity = args[1] == "0"sv ? count : fmt::format("({})", vertices);
+		line(program_state());
+		line("auto vertexLayout = getProgramState()->getVertexLayout();");
+		for (auto& attrib : _attribs)
+			line(fmt::format("vertexLayout->setAttribute(\"{0}\", getProgramState()->getAttributeLocation(\"{0}\"), backend::VertexFormat::{1}, {2}, {3});",
+				attrib.name, attrib.format, attrib.offset, attrib.normalized ? "true" : "false"));
+		line(fmt::format("vertexLayout->setLayout({});", _stride));
+		line(fmt::format("if ({}.getVertexCapacity() < {})", _command, vertices));
+		text += fmt::format("\n{}    {}.createVertexBuffer({}, {}, CustomCommand::BufferUsage::DYNAMIC);", _indent, _command, _stride, vertices);
+		line(fmt::format("{}.updateVertexBuffer({}, {} * {});", _command, _base, _stride, capacity));
+		line(fmt::format("{}.setPrimitiveType(CustomCommand::PrimitiveType::{});", _command, primitive->second));
+		line(fmt::format("{}.setDrawType(CustomCommand::DrawType::ARRAY);", _command));
+		line(fmt::format("{}.setVertexDrawInfo({}, {});", _command, args[1], args[2]));
+		return true;
+	}
+
+	class gl_pass {
+	public:
+		gl_pass(migrate_context& ctx, std::string root) : _ctx(ctx), _parser(ctx, std::move(root)) {}
+
+		void prepare(const std::vector<std::string>& units) { _parser.prepare(units); }
+
+		void convert_unit(const std::string& path, int index) {
+			TRACE_SCOPE("gl_unit", path);
+			file_events _fe(_ctx, path.c_str(), index);
+			std::string error;
+			auto unit = _parser.parse(index, error);
+			if (!unit) {
+				_ctx.emit(AX_MIGRATE_EVENT_WARNING, path.c_str(), index, 0, 0, error.empty() ? "parse fail" : error.c_str());
+				return;
+			}
+			unit_converter converter(_parser);
+			converter.visit(unit);
+			clang::disposeTranslationUnit(unit);
+			stats::add("gl_callbacks_converted", converter.converted);
+
+			// a header is rewritten by the edits of the lowest unit index having any, whichever unit is parsed first, a call
+			// is flagged once
+			auto edits = converter.take_edits();
+			std::lock_guard<std::mutex> lck(_mutex);
+			for (auto& file : edits) {
+				auto owner = file.first == path ? -1 : index;
+				auto it = _edits.find(file.first);
+				if (it == _edits.end())
+					_edits.emplace(file.first, file_edits{owner, std::move(file.second)});
+				else if (owner < it->second.owner)
+					it->second = file_edits{owner, std::move(file.second)};
+			}
+			for (auto& item : converter.flagged) {
+				if (!_flagged.insert(item).second)
+					continue;
+				stats::add("gl_calls_flagged");
+				_ctx.emit(AX_MIGRATE_EVENT_WARNING, path.c_str(), index, 0, 0, fmt::format("{}, the callback is left as is", item).c_str());
+			}
+		}
+
+		// the edits applied by CXRewriter, on a parse of the file alone, the files are numbered after the units
+		void rewrite_all(int units) {
+			TRACE_SCOPE("gl_rewrite");
+			std::vector<const std::pair<const std::string, file_edits>*> files;
+			for (auto& file : _edits)
+				files.push_back(&file);
+			_ctx.total = units + static_cast<int>(files.size());
+			axstd::parallel_for(files.size(), _ctx.jobs, [&](size_t index) {
+				auto& path = files[index]->first;
+				auto& edits = files[index]->second.edits;
+				TRACE_SCOPE("gl_rewrite_file", path);
+				file_events _fe(_ctx, path.c_str(), units + static_cast<int>(index));
+				if (!rewrite_file(_ctx, path, edits, units + static_cast<int>(index)))
+					return;
+				++_ctx.hints;
+				_ctx.emit(AX_MIGRATE_EVENT_REPLACED, path.c_str(), units + static_cast<int>(index), 0, static_cast<int>(edits.size()), "gl-commands");
+			});
+		}
+
+	private:
+		struct file_edits {
+			int owner; // the unit index, -1 by the unit of the file itself
+			std::vector<text_edit> edits;
+		};
+
+		migrate_context& _ctx;
+		unit_parser _parser;
+		std::mutex _mutex;
+		std::map<std::string, file_edits> _edits; // by file
+		std::set<std::string> _flagged;
+	};
+
+	void convert_units(migrate_context& ctx, const std::string& root, const std::vector<std::string>& units) {
+		if (!clang::ensure_lib())
+			throw std::runtime_error("libclang is required to convert the GL commands");
+		if (!clang::CXRewriter_create)
+			throw std::runtime_error("the libclang loaded has no CXRewriter, libclang 11 or later is required");
+		gl_pass pass(ctx, root);
+		pass.prepare(units);
+		ctx.total = static_cast<int>(units.size());
+		axstd::parallel_for(units.size(), ctx.jobs, [&](size_t index) { pass.convert_unit(units[index], static_cast<int>(index)); });
+		pass.rewrite_all(static_cast<int>(units.size()));
+	}
+}
+
+void convert_gl_commands_in_dir(migrate_context& ctx, std::string_view dir) {
+	auto units = scan_tree(dir, is_translation_unit);
+	convert_units(ctx, root_of(dir), units);
+}
+
+void convert_gl_commands_files(migrate_context& ctx, const std::vector<std::string>& paths) {
+	convert_units(ctx, root_of_files(), translation_units_of(paths));
+}
@@ -0,0 +1,419 @@
+// ---------------------------------------- hoist lookups
+// The string keyed lookups repeated by the per frame methods, update, draw and onDraw, of the project classes: the
+// uniform locations of a ProgramState and the children of the node by name, keyed by a string literal. Each one is
+// cached by a member field of the class, looked up by the first frame and reused by the next ones:
+//   auto loc = _programState->getUniformLocation("u_time");
+//   auto loc = (_uTimeLocation ? _uTimeLocation : (_uTimeLocation = _programState->getUniformLocation("u_time")));
+// a child is retained by a RefPtr and looked up again once it's removed from the node:
+//   auto hud = (_hudChild && _hudChild->getParent() == this ? _hudChild.get() : (_hudChild = getChildByName("hud")).get());
+// The program state must be a field of the class or a getter of it, so the location is of the same program every frame.
+//
+// The units are parsed in parallel by unit_parser, the lookups of a method in a header are found by each unit reaching
+// it, the fields are named when all units are parsed, so the units agree on them, and declared at the end of the class.
+#include "migrate-context.h"
+#include "clang-api.h"
+#include "include-graph.h"
+#include "unit-parser.h"
+#include "base/trace.h"
+#include "base/logger.h"
+#include <map>
+#include <mutex>
+#include <set>
+#include <tuple>
+
+namespace {
+	const std::string_view per_frame_methods[] = {"update", "draw", "onDraw"};
+
+	enum class lookup_kind {
+		uniform,
+		child,
+	};
+
+	// a lookup to cache, the call replaced
+	struct lookup {
+		std::string file;
+		unsigned begin = 0;
+		unsigned end = 0;
+		std::string call;
+		std::string receiver; // the text of the program state, empty for this
+		std::string class_usr;
+		lookup_kind kind = lookup_kind::uniform;
+		std::string key;  // the literal, unquoted
+		std::string type; // of the field
+	};
+
+	// where the fields of a class are declared, at the line of its closing brace
+	struct class_decl {
+		std::string file;
+		unsigned insert = 0;
+		std::string indent;      // of its members
+		std::string brace_indent;
+		bool private_last = false; // the members at the end are private already
+		std::set<std::string> members;
+	};
+
+	std::string canonical_type(CXType type) {
+		return clang::to_string(clang::getTypeSpelling(clang::getCanonicalType(type)));
+	}
+
+	// the expression under the implicit conversions and the constructions of a std::string or std::string_view
+	CXCursor strip(CXCursor expr) {
+		for (;;) {
+			auto kind = clang::getCursorKind(expr);
+			auto referenced = kind == CXCursor_CallExpr ? clang::getCursorKind(clang::getCursorReferenced(expr)) : CXCursor_NoDeclFound;
+			if (kind != CXCursor_UnexposedExpr && referenced != CXCursor_Constructor)
+				return expr;
+			auto children = children_of(expr);
+			auto first = std::find_if(children.begin(), children.end(), [](CXCursor child) {
+				auto kind = clang::getCursorKind(child);
+				return kind >= CXCursor_FirstExpr && kind <= CXCursor_LastExpr;
+			});
+			if (first == children.end())
+				return expr;
+			expr = *first;
+		}
+	}
+
+	// the object of a member call or member reference, a null cursor for the implicit this
+	CXCursor object_of(CXCursor member_ref) {
+		for (auto& child : children_of(member_ref))
+			if (clang::getCursorKind(child) != CXCursor_TypeRef && clang::getCursorKind(child) != CXCursor_NamespaceRef)
+				return strip(child);
+		return clang::getNullCursor();
+	}
+
+	bool is_this(CXCursor object) {
+		return clang::Cursor_isNull(object) || clang::getCursorKind(object) == CXCursor_CXXThisExpr;
+	}
+
+	CXCursor member_ref_of(CXCursor call) {
+		for (auto& child : children_of(call))
+			if (clang::getCursorKind(child) == CXCursor_MemberRefExpr)
+				return child;
+		return clang::getNullCursor();
+	}
+
+	// a field of this or a getter of this without arguments, the same object every frame
+	bool is_stable(CXCursor object) {
+		auto kind = clang::getCursorKind(object);
+		if (kind == CXCursor_MemberRefExpr)
+			return clang::getCursorKind(clang::getCursorReferenced(object)) == CXCursor_FieldDecl && is_this(object_of(object));
+		if (kind == CXCursor_CallExpr && clang::Cursor_getNumArguments(object) == 0 &&
+			clang::getCursorKind(clang::getCursorReferenced(object)) == CXCursor_CXXMethod) {
+			auto ref = member_ref_of(object);
+			return !clang::Cursor_isNull(ref) && is_this(object_of(ref));
+		}
+		return false;
+	}
+
+	// u_time to uTime, CC_Texture0 to ccTexture0
+	std::string camel_case(std::string_view key) {
+		std::string name;
+		size_t pos = 0;
+		while (pos < key.size()) {
+			while (pos < key.size() && (!is_ident(key[pos]) || key[pos] == '_'))
+				++pos;
+			auto first = pos;
+			while (pos < key.size() && is_ident(key[pos]) && key[pos] != '_')
+				++pos;
+			if (pos == first)
+				continue;
+			std::string part{key.substr(first, pos - first)};
+			bool upper = std::all_of(part.begin(), part.end(), [](char ch) { return !(ch >= 'a' && ch <= 'z'); });
+			for (size_t i = 0; i < part.size(); ++i) {
+				if (i == 0)
+					part[i] = name.empty() ? static_cast<char>(tolower(part[i])) : static_cast<char>(toupper(part[i]));
+				else if (upper)
+					part[i] = static_cast<char>(tolower(part[i]));
+			}
+			name += part;
+		}
+		if (name.empty() || (name[0] >= '0' && name[0] <= '9'))
+			name.insert(0, "key");
+		return name;
+	}
+
+	class unit_scanner {
+	public:
+		explicit unit_scanner(const unit_parser& parser) : _files(parser) {}
+
+		void visit(CXTranslationUnit unit) { clang::visitChildren(clang::getTranslationUnitCursor(unit), visit_child, this); }
+
+		std::vector<lookup> lookups;
+		std::map<std::string, class_decl> classes; // by usr
+
+	private:
+		static CXChildVisitResult visit_child(CXCursor cursor, CXCursor, CXClientData data) {
+			auto self = static_cast<unit_scanner*>(data);
+			CXFile file = nullptr;
+			clang::getSpellingLocation(clang::getCursorLocation(cursor), &file, nullptr, nullptr, nullptr);
+			if (!file || !self->_files.file_of(file).project)
+				return CXChildVisit_Continue; // the engine and system headers
+			if (clang::getCursorKind(cursor) != CXCursor_CXXMethod)
+				return CXChildVisit_Recurse;
+			auto name = clang::to_string(clang::getCursorSpelling(cursor));
+			if (std::find(std::begin(per_frame_methods), std::end(per_frame_methods), name) == std::end(per_frame_methods) || clang::CXXMethod_isConst(cursor))
+				return CXChildVisit_Continue;
+			auto children = children_of(cursor);
+			auto body = std::find_if(children.begin(), children.end(), [](CXCursor child) { return clang::getCursorKind(child) == CXCursor_CompoundStmt; });
+			if (body == children.end())
+				return CXChildVisit_Continue; // a declaration
+			auto classUsr = self->class_of(cursor);
+			if (classUsr.empty())
+				return CXChildVisit_Continue;
+			self->_class_usr = classUsr;
+			clang::visitChildren(*body, visit_body, data);
+			return CXChildVisit_Continue;
+		}
+
+		static CXChildVisitResult visit_body(CXCursor cursor, CXCursor, CXClientData data) {
+			if (clang::getCursorKind(cursor) == CXCursor_CallExpr)
+				static_cast<unit_scanner*>(data)->inspect_call(cursor);
+			return CXChildVisit_Recurse;
+		}
+
+		file_text* spelled_at(CXSourceLocation loc, unsigned& offset) { return _files.spelled_at(loc, offset); }
+
+		file_text* extent_of(CXCursor cursor, unsigned& begin, unsigned& end) { return _files.extent_of(cursor, begin, end); }
+
+		// the usr of the project class of a method, recording where its fields go, empty if they can't be declared
+		std::string class_of(CXCursor method) {
+			auto parent = clang::getCursorDefinition(clang::getCursorSemanticParent(method));
+			auto kind = clang::getCursorKind(parent);
+			if (kind != CXCursor_ClassDecl && kind != CXCursor_StructDecl)
+				return {};
+			auto usr = clang::to_string(clang::getCursorUSR(parent));
+			if (classes.count(usr) || _unhoistable.count(usr))
+				return classes.count(usr) ? usr : std::string{};
+			class_decl decl;
+			unsigned begin = 0, end = 0, member = 0;
+			auto file = extent_of(parent, begin, end);
+			auto declaration = clang::getCanonicalCursor(method);
+			if (!file || file->content[end - 1] != '}' || spelled_at(clang::getCursorLocation(declaration), member) != file) {
+				_unhoistable.insert(usr);
+				return {};
+			}
+			// the closing brace on a line of its own
+			auto& content = file->content;
+			auto line = content.rfind('\n', end - 1);
+			line = line == std::string::npos ? 0 : line + 1;
+			if (!std::all_of(content.begin() + line, content.begin() + end - 1, is_space)) {
+				_unhoistable.insert(usr);
+				return {};
+			}
+			decl.file = file->path;
+			decl.insert = static_cast<unsigned>(line);
+			decl.brace_indent = content.substr(line, end - 1 - line);
+			auto memberLine = content.rfind('\n', member);
+			memberLine = memberLine == std::string::npos ? 0 : memberLine + 1;
+			auto indentEnd = memberLine;
+			while (indentEnd < content.size() && (content[indentEnd] == ' ' || content[indentEnd] == '\t'))
+				++indentEnd;
+			decl.indent = content.substr(memberLine, indentEnd - memberLine);
+			decl.private_last = kind == CXCursor_ClassDecl;
+			for (auto& child : children_of(parent)) {
+				if (clang::getCursorKind(child) == CXCursor_CXXAccessSpecifier)
+					decl.private_last = clang::getCXXAccessSpecifier(child) == CX_CXXPrivate;
+				else
+					decl.members.insert(clang::to_string(clang::getCursorSpelling(child)));
+			}
+			classes.emplace(usr, std::move(decl));
+			return usr;
+		}
+
+		void inspect_call(CXCursor call) {
+			auto callee = clang::getCursorReferenced(call);
+			if (clang::getCursorKind(callee) != CXCursor_CXXMethod || clang::Cursor_getNumArguments(call) != 1)
+				return;
+			auto name = engine_name(callee);
+			lookup item;
+			if (name == "backend::ProgramState::getUniformLocation" || name == "ProgramState::getUniformLocation")
+				item.kind = lookup_kind::uniform;
+			else if (name == "Node::getChildByName")
+				item.kind = lookup_kind::child;
+			else
+				return;
+			auto literal = strip(clang::Cursor_getArgument(call, 0));
+			auto quoted = clang::to_string(clang::getCursorSpelling(literal));
+			if (clang::getCursorKind(literal) != CXCursor_StringLiteral || quoted.size() < 2 || quoted.front() != '"' || quoted.find('\\') != std::string::npos)
+				return;
+			auto ref = member_ref_of(call);
+			if (clang::Cursor_isNull(ref))
+				return;
+			auto object = object_of(ref);
+			if (item.kind == lookup_kind::child ? !is_this(object) : !is_stable(object)) {
+				stats::add("hoist_lookups_unstable");
+				return;
+			}
+			auto file = extent_of(call, item.begin, item.end);
+			if (!file)
+				return;
+			item.call = file->content.substr(item.begin, item.end - item.begin);
+			unsigned objectBegin = 0, objectEnd = 0;
+			if (!is_this(object) && extent_of(object, objectBegin, objectEnd) == file)
+				item.receiver = file->content.substr(objectBegin, objectEnd - objectBegin);
+			if (is_cached(file->content, item.begin, classes[_class_usr]))
+				return;
+			item.file = file->path;
+			item.class_usr = _class_usr;
+			item.key = quoted.substr(1, quoted.size() - 2);
+			auto type = canonical_type(clang::getCursorResultType(callee));
+			if (item.kind == lookup_kind::child) {
+				auto ns = type.substr(0, type.find("::"));
+				item.type = fmt::format("{0}::RefPtr<{0}::Node>", ns);
+			}
+			else
+				item.type = std::move(type);
+			lookups.push_back(std::move(item));
+		}
+
+		// the call assigns a field already, as hoisted by a previous run: (_field = call
+		static bool is_cached(const std::string& content, unsigned begin, const class_decl& decl) {
+			auto pos = static_cast<size_t>(begin);
+			while (pos > 0 && is_space(content[pos - 1]))
+				--pos;
+			if (pos == 0 || content[--pos] != '=')
+				return false;
+			while (pos > 0 && is_space(content[pos - 1]))
+				--pos;
+			auto last = pos;
+			while (pos > 0 && is_ident(content[pos - 1]))
+				--pos;
+			return pos < last && decl.members.count(content.substr(pos, last - pos));
+		}
+
+		unit_files _files;
+		std::set<std::string> _unhoistable;
+		std::string _class_usr; // of the method visited
+	};
+
+	class hoist_pass {
+	public:
+		hoist_pass(migrate_context& ctx, std::string root) : _ctx(ctx), _parser(ctx, std::move(root)) {}
+
+		void prepare(const std::vector<std::string>& units) { _parser.prepare(units); }
+
+		void scan_unit(const std::string& path, int index) {
+			TRACE_SCOPE("hoist_unit", path);
+			file_events _fe(_ctx, path.c_str(), index);
+			std::string error;
+			auto unit = _parser.parse(index, error);
+			if (!unit) {
+				_ctx.emit(AX_MIGRATE_EVENT_WARNING, path.c_str(), index, 0, 0, error.empty() ? "parse fail" : error.c_str());
+				return;
+			}
+			unit_scanner scanner(_parser);
+			scanner.visit(unit);
+			clang::disposeTranslationUnit(unit);
+
+			// a method of a header is scanned by each unit reaching it
+			std::lock_guard<std::mutex> lck(_mutex);
+			for (auto& item : scanner.lookups)
+				_lookups.emplace(std::make_tuple(item.file, item.begin), std::move(item));
+			for (auto& decl : scanner.classes)
+				_classes.emplace(decl.first, std::move(decl.second));
+		}
+
+		// names the fields, the same call of a class shares one, then applies the edits, numbered after the units
+		void hoist_all(int units) {
+			TRACE_SCOPE("hoist_rewrite");
+			std::map<std::string, std::vector<text_edit>> edits;
+			std::map<std::string, std::map<std::string, std::string>> fields; // by class, the field by the lookup
+			std::map<std::string, std::string> declarations;                  // by class
+			std::map<std::string, std::string> retaining;                     // the engine namespace of the RefPtr fields by class
+			for (auto& entry : _lookups) {
+				auto& item = entry.second;
+				auto& decl = _classes.at(item.class_usr);
+				// the same lookup spelled alike, this-> aside
+				auto receiver = item.receiver;
+				std::erase_if(receiver, is_space);
+				for (auto pos = receiver.find("this->"); pos != std::string::npos; pos = receiver.find("this->"))
+					receiver.erase(pos, 6);
+				auto key = fmt::format("{}\n{}\n{}", static_cast<int>(item.kind), receiver, item.key);
+				auto& field = fields[item.class_usr][key];
+				if (field.empty()) {
+					auto base = fmt::format("_{}{}", camel_case(item.key), item.kind == lookup_kind::uniform ? "Location" : "Child");
+					field = base;
+					for (int suffix = 2; decl.members.count(field); ++suffix)
+						field = fmt::format("{}{}", base, suffix);
+					decl.members.insert(field);
+					fmt::format_to(std::back_inserter(declarations[item.class_usr]), "{}{} {};\n", decl.indent, item.type, field);
+					if (item.kind == lookup_kind::child)
+						retaining[item.class_usr] = item.type.substr(0, item.type.find("::"));
+				}
+				auto text = item.kind == lookup_kind::uniform
+								? fmt::format("({0} ? {0} : ({0} = {1}))", field, item.call)
+								: fmt::format("({0} && {0}->getParent() == this ? {0}.get() : ({0} = {1}).get())", field, item.call);
+				edits[item.file].push_back(text_edit{item.begin, item.end, std::move(text)});
+				stats::add(item.kind == lookup_kind::uniform ? "hoisted_uniform_lookups" : "hoisted_child_lookups");
+			}
+			for (auto& declaration : declarations) {
+				auto& decl = _classes.at(declaration.first);
+				auto text = decl.private_last ? declaration.second : fmt::format("{}private:\n{}", decl.brace_indent, declaration.second);
+				edits[decl.file].push_back(text_edit{decl.insert, decl.insert, std::move(text)});
+				auto ns = retaining.find(declaration.first);
+				if (ns != retaining.end())
+					include_ref_ptr(decl.file, ns->second, edits[decl.file]);
+			}
+
+			std::vector<std::pair<const std::string, std::vector<text_edit>>*> files;
+			for (auto& file : edits) {
+				std::sort(file.second.begin(), file.second.end(), [](const text_edit& lhs, const text_edit& rhs) { return lhs.begin < rhs.begin; });
+				files.push_back(&file);
+			}
+			_ctx.total = units + static_cast<int>(files.size());
+			axstd::parallel_for(files.size(), _ctx.jobs, [&](size_t index) {
+				rewrite(files[index]->first, files[index]->second, units + static_cast<int>(index));
+			});
+		}
+
+	private:
+		// the header of RefPtr after the last include of the file declaring the fields, unless it's included
+		static void include_ref_ptr(const std::string& path, std::string_view ns, std::vector<text_edit>& edits) {
+			auto content = load_file(path);
+			if (content.find("RefPtr.h") != std::string::npos)
+				return;
+			size_t insert = 0;
+			for (size_t pos = 0; pos < content.size();) {
+				auto eol = content.find('\n', pos);
+				auto next = eol == std::string::npos ? content.size() : eol + 1;
+				if (!include_directive_of(std::string_view{content}.substr(pos, next - pos)).empty())
+					insert = next;
+				pos = next;
+			}
+			if (insert == 0 || content[insert - 1] != '\n')
+				return; // no include line to follow, the RefPtr header must be included by hand
+			edits.push_back(text_edit{static_cast<unsigned>(insert), static_cast<unsigned>(insert),
+				ns == "cocos2d" ? "#include \"base/CCRefPtr.h\"\n" : "#include \"base/RefPtr.h\"\n"});
+		}
+
+		void rewrite(const std::string& path, const std::vector<text_edit>& edits, int index) {
+			TRACE_SCOPE("hoist_rewrite_file", path);
+			file_events _fe(_ctx, path.c_str(), index);
+			if (!rewrite_file(_ctx, path, edits, index))
+				return;
+			++_ctx.hints;
+			_ctx.emit(AX_MIGRATE_EVENT_REPLACED, path.c_str(), index, 0, static_cast<int>(edits.size()), "hoist");
+		}
+
+		migrate_context& _ctx;
+		unit_parser _parser;
+		std::mutex _mutex;
+		std::map<std::tuple<std::string, unsigned>, lookup> _lookups; // by place
+		std::map<std::string, class_decl> _classes;                   // by usr
+	};
+}
+
+void hoist_lookups_in_dir(migrate_context& ctx, std::string_view dir) {
+	if (!clang::ensure_lib())
+		throw std::runtime_error("libclang is required to hoist the lookups");
+	if (!clang::CXRewriter_create)
+		throw std::runtime_error("the libclang loaded has no CXRewriter, libclang 11 or later is required");
+	auto units = scan_tree(dir, is_translation_unit);
+
+	hoist_pass pass(ctx, root_of(dir));
+	pass.prepare(units);
+	ctx.total = static_cast<int>(units.size());
+	axstd::parallel_for(units.size(), ctx.jobs, [&](size_t index) { pass.scan_unit(units[index], static_cast<int>(index)); });
+	pass.hoist_all(static_cast<int>(units.size()));
+}
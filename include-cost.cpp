@@ -0,0 +1,389 @@
+// ---------------------------------------- include cost profiler
+// Each header included by the project, its own or external, is parsed by libclang in a unit including just it, which
+// gives its parse time, the headers it includes transitively and the bytes it preprocesses. Every translation unit
+// reaching an include line pays the cost of its header, so the cost attributed to an include edge is the cost of the
+// header times the units reaching the includer, the edges are ranked by it.
+//
+// The include graph and the costs are cached, the content hashes of the project files and the headers measured are
+// kept by a manifest, a rerun reads the directives of the changed files only and measures the headers whose own
+// content or any of their includes changed only.
+#include "migrate-context.h"
+#include "clang-api.h"
+#include "include-graph.h"
+#include "base/trace.h"
+#include "base/logger.h"
+#include "base/json.h"
+#include <inttypes.h>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace stdfs = std::filesystem;
+
+namespace {
+	constexpr int cache_version = 1;
+
+	std::string hex_of(uint64_t hash) {
+		return fmt::format("{:016x}", hash);
+	}
+
+	// a header included by the project, measured or loaded from the cache
+	struct header_entry {
+		std::string directive; // probed, an absolute "path" for the headers of the project
+		const std::string* unit = nullptr; // a unit reaching an includer, for the compile command
+		std::string args_hash; // of the arguments measured by, the cache of other arguments doesn't match
+		header_cost cost;
+		bool ok = false;
+	};
+
+	struct edge {
+		const std::string* includer;
+		std::string directive;
+		const header_entry* header;
+		int units; // reaching the includer
+		double cost_ms() const { return header->cost.parse_ms * units; }
+	};
+
+	class include_profiler {
+	public:
+		include_profiler(migrate_context& ctx, std::string root, std::string cache_dir)
+			: _ctx(ctx), _root(std::move(root)), _cache_dir(std::move(cache_dir)) {
+			if (!_ctx.compile_commands.empty() && !_db.load(_ctx.compile_commands))
+				throw std::runtime_error(fmt::format("No compile_commands.json in {}", _ctx.compile_commands));
+			if (!_cache_dir.empty())
+				load_cache();
+		}
+
+		// the directives of the project files, the ones unchanged since the cache aren't read
+		void scan(std::string_view dir) {
+			auto paths = scan_tree(dir, is_cpp_file);
+			std::mutex mutex;
+			axstd::parallel_for(paths.size(), _ctx.jobs, [&](size_t index) {
+				auto& path = paths[index];
+				auto cached = _cached_directives.find(path);
+				if (unchanged(path) && cached != _cached_directives.end()) {
+					stats::add("files_unchanged");
+					std::lock_guard<std::mutex> lck(mutex);
+					_graph.set(path, cached->second);
+					return;
+				}
+				auto content = load_file(path);
+				auto directives = include_directives_of(content);
+				std::lock_guard<std::mutex> lck(mutex);
+				_graph.set(path, std::move(directives));
+			});
+		}
+
+		// the units reaching each project file, and the headers of the include lines
+		void collect() {
+			TRACE_SCOPE("include_cost_collect");
+			for (auto& file : _graph.files()) {
+				if (!is_translation_unit(file.first))
+					continue;
+				++_units;
+				std::unordered_set<const std::string*> reached;
+				_graph.reach(file.first, reached, nullptr);
+				for (auto path : reached) {
+					auto& state = _reached[path];
+					if (!state.second)
+						state.second = &file.first;
+					++state.first;
+				}
+			}
+			for (auto& file : _graph.files()) {
+				auto reached = _reached.find(&file.first);
+				auto units = reached != _reached.end() ? reached->second.first : 0;
+				auto unit = reached != _reached.end() ? reached->second.second : nullptr;
+				for (auto& directive : file.second) {
+					auto project = _graph.resolve(file.first, directive);
+					auto key = project ? fmt::format("\"{}\"", *project) : directive;
+					auto& header = _headers[key];
+					if (header.directive.empty())
+						header.directive = key;
+					if (!header.unit)
+						header.unit = unit;
+					_edges.push_back(edge{&file.first, directive, &header, units});
+				}
+			}
+		}
+
+		// the headers not cached or changed since are parsed
+		void measure() {
+			std::vector<header_entry*> pending;
+			for (auto& item : _headers) {
+				auto& header = item.second;
+				auto args = args_of(header);
+				std::string joined;
+				for (auto& arg : args)
+					joined.append(arg).push_back('\n');
+				header.args_hash = hex_of(manifest::hash_of(joined));
+				if (cached(header))
+					stats::add("headers_cached");
+				else
+					pending.push_back(&header);
+			}
+			stats::add("headers_measured", static_cast<int64_t>(pending.size()));
+			_ctx.total = static_cast<int>(pending.size());
+			axstd::parallel_for(pending.size(), _ctx.jobs, [&](size_t index) {
+				auto& header = *pending[index];
+				file_events _fe(_ctx, header.directive.c_str(), static_cast<int>(index));
+				header.cost = header_cost{};
+				header.ok = measure_header(_root + "axmol_include_cost_probe.cpp", header.directive, args_of(header), header.cost);
+				if (!header.ok) {
+					_ctx.emit(AX_MIGRATE_EVENT_WARNING, header.directive.c_str(), static_cast<int>(index), 0, 0, header.cost.error.c_str());
+					return;
+				}
+				// the hashes of the files measured, a rerun measures the header again once any changes
+				unchanged(header.cost.path);
+				for (auto& file : header.cost.includes)
+					unchanged(file);
+			});
+		}
+
+		// ranked by the cost attributed
+		std::vector<edge> ranked_edges() const {
+			std::vector<edge> edges;
+			for (auto& item : _edges)
+				if (item.header->ok)
+					edges.push_back(item);
+			std::stable_sort(edges.begin(), edges.end(), [](const edge& lhs, const edge& rhs) { return lhs.cost_ms() > rhs.cost_ms(); });
+			return edges;
+		}
+
+		int units() const { return _units; }
+
+		std::string relative(const std::string& path) const {
+			return cxx20::starts_with(path, _root) ? path.substr(_root.size()) : path;
+		}
+
+		void save_cache() const {
+			if (_cache_dir.empty())
+				return;
+			TRACE_SCOPE("include_cost_save");
+			std::error_code ec;
+			stdfs::create_directories(_cache_dir, ec);
+			if (!_files.save(_cache_dir + "/include-cost.manifest"))
+				throw std::runtime_error(fmt::format("write {}/include-cost.manifest fail", _cache_dir));
+
+			std::string out = fmt::format("{{\"version\":{},\"files\":{{", cache_version);
+			bool first = true;
+			for (auto& file : _graph.files()) {
+				if (!first)
+					out.push_back(',');
+				first = false;
+				json::append_quoted(out, file.first);
+				out += ":[";
+				for (size_t i = 0; i < file.second.size(); ++i) {
+					if (i)
+						out.push_back(',');
+					json::append_quoted(out, file.second[i]);
+				}
+				out.push_back(']');
+			}
+			out += "},\"headers\":{";
+			first = true;
+			for (auto& item : _headers) {
+				auto& header = item.second;
+				if (!header.ok)
+					continue;
+				if (!first)
+					out.push_back(',');
+				first = false;
+				json::append_quoted(out, item.first);
+				out += ":{\"path\":";
+				json::append_quoted(out, header.cost.path);
+				out += fmt::format(",\"args\":\"{}\",\"parseMs\":{:.3f},\"bytes\":{},\"includes\":[", header.args_hash, header.cost.parse_ms, header.cost.bytes);
+				for (size_t i = 0; i < header.cost.includes.size(); ++i) {
+					if (i)
+						out.push_back(',');
+					json::append_quoted(out, header.cost.includes[i]);
+				}
+				out += "]}";
+			}
+			out += "}}\n";
+			write_file(_cache_dir + "/include-cost.json", out);
+		}
+
+	private:
+		std::vector<std::string> args_of(const header_entry& header) const {
+			std::vector<std::string> args;
+			if (header.unit)
+				args = _db.args_of(*header.unit);
+			if (args.empty())
+				args = clang::default_args(header.unit ? *header.unit : _root + "axmol_include_cost_probe.cpp", _root);
+			return args;
+		}
+
+		// whether the content of path matches the manifest, by the size and mtime first, the hash of a changed or new
+		// file is recorded, each file is checked once per run
+		bool unchanged(const std::string& path) {
+			{
+				std::lock_guard<std::mutex> lck(_checked_mutex);
+				auto it = _checked.find(path);
+				if (it != _checked.end())
+					return it->second;
+			}
+			bool same = _files.unchanged_stat(path, 0);
+			if (!same) {
+				std::error_code ec;
+				if (stdfs::is_regular_file(path, ec)) {
+					auto hash = manifest::hash_of(load_file(path));
+					same = _files.unchanged(path, hash, 0);
+					_files.record(path, hash, 0); // the mtime of a touched file too
+				}
+				else
+					_files.erase(path);
+			}
+			std::lock_guard<std::mutex> lck(_checked_mutex);
+			_checked.emplace(path, same);
+			return same;
+		}
+
+		bool cached(header_entry& header) {
+			auto it = _cached_headers.find(header.directive);
+			if (it == _cached_headers.end() || it->second.first != header.args_hash)
+				return false;
+			auto& cost = it->second.second;
+			if (!unchanged(cost.path))
+				return false;
+			for (auto& file : cost.includes)
+				if (!unchanged(file))
+					return false;
+			header.cost = cost;
+			header.ok = true;
+			return true;
+		}
+
+		void load_cache() {
+			TRACE_SCOPE("include_cost_load");
+			if (!_files.load(_cache_dir + "/include-cost.manifest"))
+				return; // not a cache, measured again
+			std::error_code ec;
+			auto path = _cache_dir + "/include-cost.json";
+			if (!stdfs::is_regular_file(path, ec))
+				return;
+			json::value doc;
+			if (!json::parse(load_file(path), doc) || !doc.is_object() || doc.get_number("version") != cache_version) {
+				logger::warn("Invalid include cost cache {}, measure all headers again", path);
+				return;
+			}
+			if (auto files = doc.find("files"); files && files->is_object()) {
+				for (auto& file : files->members) {
+					std::vector<std::string> directives;
+					for (auto& directive : file.second.items)
+						directives.push_back(directive.string);
+					_cached_directives.emplace(file.first, std::move(directives));
+				}
+			}
+			if (auto headers = doc.find("headers"); headers && headers->is_object()) {
+				for (auto& item : headers->members) {
+					auto& value = item.second;
+					header_cost cost;
+					cost.path = value.get_string("path");
+					cost.parse_ms = value.get_number("parseMs");
+					cost.bytes = static_cast<uint64_t>(value.get_number("bytes"));
+					if (auto includes = value.find("includes"); includes && includes->is_array())
+						for (auto& file : includes->items)
+							cost.includes.push_back(file.string);
+					_cached_headers.emplace(item.first, std::make_pair(std::string{value.get_string("args")}, std::move(cost)));
+				}
+			}
+		}
+
+		static void write_file(const std::string& path, std::string_view content) {
+			auto fp = fopen(path.c_str(), "wb");
+			if (!fp)
+				throw std::runtime_error(fmt::format("write {} fail", path));
+			auto written = fwrite(content.data(), 1, content.size(), fp);
+			if (fclose(fp) != 0 || written != content.size())
+				throw std::runtime_error(fmt::format("write {} fail", path));
+		}
+
+		migrate_context& _ctx;
+		std::string _root; // with trailing '/'
+		std::string _cache_dir;
+		clang::compile_commands _db;
+		manifest::table _files; // the content hashes of the project files and the headers measured
+		std::mutex _checked_mutex;
+		std::unordered_map<std::string, bool> _checked;
+		std::unordered_map<std::string, std::vector<std::string>> _cached_directives;
+		std::unordered_map<std::string, std::pair<std::string, header_cost>> _cached_headers; // directive -> args hash, cost
+		include_graph _graph;
+		std::unordered_map<const std::string*, std::pair<int, const std::string*>> _reached; // file -> units, a unit
+		std::map<std::string, header_entry> _headers;
+		std::vector<edge> _edges;
+		int _units = 0;
+	};
+
+	// .csv by the extension, otherwise json
+	void write_report(const include_profiler& profiler, const std::vector<edge>& edges, const std::string& path) {
+		std::string out;
+		if (cxx20::ic::ends_with(path, ".csv")) {
+			out = "includer,include,header,parse_ms,includes,bytes,units,cost_ms\n";
+			auto csv_field = [&](std::string_view field) {
+				out.push_back('"');
+				for (auto ch : field) {
+					if (ch == '"')
+						out.push_back('"');
+					out.push_back(ch);
+				}
+				out += "\",";
+			};
+			for (auto& item : edges) {
+				csv_field(profiler.relative(*item.includer));
+				csv_field(item.directive);
+				csv_field(item.header->cost.path);
+				out += fmt::format("{:.3f},{},{},{},{:.3f}\n", item.header->cost.parse_ms, item.header->cost.includes.size(), item.header->cost.bytes, item.units, item.cost_ms());
+			}
+		}
+		else {
+			out = fmt::format("{{\"units\":{},\"edges\":[", profiler.units());
+			for (size_t i = 0; i < edges.size(); ++i) {
+				auto& item = edges[i];
+				if (i)
+					out.push_back(',');
+				out += "{\"includer\":";
+				json::append_quoted(out, profiler.relative(*item.includer));
+				out += ",\"include\":";
+				json::append_quoted(out, item.directive);
+				out += ",\"header\":";
+				json::append_quoted(out, item.header->cost.path);
+				out += fmt::format(",\"parseMs\":{:.3f},\"includes\":{},\"bytes\":{},\"units\":{},\"costMs\":{:.3f}}}", item.header->cost.parse_ms,
+					item.header->cost.includes.size(), item.header->cost.bytes, item.units, item.cost_ms());
+			}
+			out += "]}\n";
+		}
+		auto fp = fopen(path.c_str(), "wb");
+		if (!fp)
+			throw std::runtime_error(fmt::format("write report {} fail", path));
+		auto written = fwrite(out.data(), 1, out.size(), fp);
+		if (fclose(fp) != 0 || written != out.size())
+			throw std::runtime_error(fmt::format("write report {} fail", path));
+	}
+}
+
+int profile_include_cost(migrate_context& ctx, std::string_view dir, const std::string& cache_dir, const std::string& report, int top) {
+	if (!clang::ensure_lib())
+		throw std::runtime_error("libclang is required to measure the include cost");
+	include_profiler profiler(ctx, root_of(dir), cache_dir);
+	profiler.scan(dir);
+	profiler.collect();
+	profiler.measure();
+	auto edges = profiler.ranked_edges();
+	profiler.save_cache();
+	if (!report.empty())
+		write_report(profiler, edges, report);
+
+	double total = 0;
+	for (auto& item : edges)
+		total += item.cost_ms();
+	logger::info("Include cost attributed over {} units: {:.1f}(ms) by {} include lines, the top ones:", profiler.units(), total, edges.size());
+	for (size_t i = 0; i < edges.size() && i < static_cast<size_t>((std::max)(top, 0)); ++i) {
+		auto& item = edges[i];
+		logger::info("  {:>10.1f}(ms) {} -> {}, parse {:.1f}(ms) x {} units, includes: {}, bytes: {}", item.cost_ms(), profiler.relative(*item.includer),
+			item.directive, item.header->cost.parse_ms, item.units, item.header->cost.includes.size(), item.header->cost.bytes);
+	}
+	return static_cast<int>(edges.size());
+}
@@ -0,0 +1,274 @@
+#include "include-graph.h"
+#include "clang-api.h"
+#include "base/trace.h"
+#include "base/stats.h"
+#include "yasio/string_view.hpp"
+#include "fmt/format.h"
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+
+namespace stdfs = std::filesystem;
+
+namespace {
+	std::string_view name_of(std::string_view path) {
+		auto slash = path.find_last_of('/');
+		return slash != std::string_view::npos ? path.substr(slash + 1) : path;
+	}
+
+	// in a block comment at the end of text, in_comment at its begin, the line comments skipped
+	bool in_block_comment(std::string_view text, bool in_comment) {
+		size_t pos = 0;
+		while (pos < text.size()) {
+			if (in_comment) {
+				auto close = text.find("*/", pos);
+				if (close == std::string_view::npos)
+					return true;
+				in_comment = false;
+				pos = close + 2;
+				continue;
+			}
+			auto slash = text.find('/', pos);
+			if (slash == std::string_view::npos || slash + 1 == text.size())
+				return false;
+			if (text[slash + 1] == '*') {
+				in_comment = true;
+				pos = slash + 2;
+			}
+			else if (text[slash + 1] == '/') {
+				auto eol = text.find('\n', slash);
+				if (eol == std::string_view::npos)
+					return false;
+				pos = eol + 1;
+			}
+			else
+				pos = slash + 1;
+		}
+		return in_comment;
+	}
+}
+
+bool is_space(char ch) {
+	return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n';
+}
+
+bool is_ident(char ch) {
+	return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '_';
+}
+
+std::string_view include_directive_of(std::string_view line) {
+	size_t pos = 0;
+	while (pos < line.size() && is_space(line[pos]))
+		++pos;
+	if (pos == line.size() || line[pos] != '#')
+		return {};
+	++pos;
+	while (pos < line.size() && is_space(line[pos]))
+		++pos;
+	auto rest = line.substr(pos);
+	if (cxx20::starts_with(rest, "include"))
+		rest.remove_prefix(7);
+	else if (cxx20::starts_with(rest, "import"))
+		rest.remove_prefix(6);
+	else
+		return {};
+	while (!rest.empty() && is_space(rest.front()))
+		rest.remove_prefix(1);
+	if (rest.empty() || (rest.front() != '<' && rest.front() != '"'))
+		return {};
+	auto end = rest.find(rest.front() == '<' ? '>' : '"', 1);
+	return end != std::string_view::npos && end > 1 ? rest.substr(0, end + 1) : std::string_view{};
+}
+
+std::vector<std::string> include_directives_of(std::string_view content) {
+	// the lines are skipped to each '#' by memchr, only a line it leads is parsed, unless a block comment is open
+	std::vector<std::string> directives;
+	auto data = content.data();
+	bool in_comment = false;
+	size_t pos = 0;
+	while (pos < content.size()) {
+		auto hash = static_cast<const char*>(memchr(data + pos, '#', content.size() - pos));
+		if (!hash)
+			break;
+		auto offset = static_cast<size_t>(hash - data);
+		auto line = content.rfind('\n', offset);
+		line = line == std::string_view::npos ? 0 : line + 1;
+		auto eol = content.find('\n', offset);
+		eol = eol == std::string_view::npos ? content.size() : eol;
+		if (!in_block_comment(content.substr(pos, offset - pos), in_comment)) {
+			auto directive = include_directive_of(content.substr(line, eol - line));
+			if (!directive.empty() && std::find(directives.begin(), directives.end(), directive) == directives.end())
+				directives.emplace_back(directive);
+		}
+		in_comment = in_block_comment(content.substr(pos, eol - pos), in_comment);
+		pos = eol + 1;
+	}
+	return directives;
+}
+
+bool is_translation_unit(std::string_view name) {
+	for (auto suffix : {".cpp", ".cc", ".cxx", ".mm"})
+		if (cxx20::ic::ends_with(name, suffix))
+			return true;
+	return false;
+}
+
+bool is_header(std::string_view name) {
+	for (auto suffix : {".h", ".hh", ".hpp", ".hxx", ".inl"})
+		if (cxx20::ic::ends_with(name, suffix))
+			return true;
+	return false;
+}
+
+bool is_cpp_file(std::string_view name) {
+	return is_header(name) || is_translation_unit(name) || cxx20::ic::ends_with(name, ".c") || cxx20::ic::ends_with(name, ".m");
+}
+
+bool is_excluded_path(std::string_view path) {
+	return path.find("/DragonBones/") != std::string_view::npos;
+}
+
+std::string normalize_path(std::string_view path) {
+	std::error_code ec;
+	return stdfs::absolute(stdfs::path{path}, ec).lexically_normal().generic_string();
+}
+
+std::string root_of(std::string_view dir) {
+	std::error_code ec;
+	auto root = normalize_path(stdfs::weakly_canonical(stdfs::path{dir}, ec).generic_string());
+	if (root.empty() || root.back() != '/')
+		root.push_back('/');
+	return root;
+}
+
+std::string root_of_files() {
+	return root_of(".");
+}
+
+std::vector<std::string> scan_tree(std::string_view dir, bool (*accept)(std::string_view name)) {
+	TRACE_SCOPE("scan", dir);
+	std::vector<std::string> files;
+	for (const auto& entry : stdfs::recursive_directory_iterator(dir)) {
+		if (!entry.is_regular_file())
+			continue;
+		auto strPath = entry.path().generic_string();
+		stats::add("files_scanned");
+		if (is_excluded_path(strPath))
+			stats::add("files_excluded");
+		else if (accept(entry.path().filename().generic_string()))
+			files.push_back(normalize_path(strPath));
+		else
+			stats::add("files_skipped_by_ext");
+	}
+	std::sort(files.begin(), files.end());
+	return files;
+}
+
+std::vector<std::string> translation_units_of(const std::vector<std::string>& paths) {
+	std::vector<std::string> units;
+	for (auto& path : paths) {
+		if (is_translation_unit(stdfs::path{path}.filename().generic_string()))
+			units.push_back(normalize_path(path));
+		else
+			stats::add("files_skipped_by_ext");
+	}
+	return units;
+}
+
+void include_graph::set(const std::string& path, std::vector<std::string> directives) {
+	auto result = _files.insert_or_assign(path, std::move(directives));
+	if (result.second)
+		_by_name[std::string{name_of(path)}].push_back(&result.first->first);
+}
+
+void include_graph::erase(const std::string& path) {
+	auto it = _files.find(path);
+	if (it == _files.end())
+		return;
+	auto named = _by_name.find(std::string{name_of(path)});
+	if (named != _by_name.end())
+		std::erase(named->second, &it->first);
+	_files.erase(it);
+}
+
+const std::string* include_graph::resolve(const std::string& includer, std::string_view directive) const {
+	if (directive.size() < 3)
+		return nullptr;
+	auto name = directive.substr(1, directive.size() - 2);
+	if (directive.front() == '"') {
+		auto slash = includer.find_last_of('/');
+		auto sibling = stdfs::path{includer.substr(0, slash + 1) + std::string{name}}.lexically_normal().generic_string();
+		auto it = _files.find(sibling);
+		if (it != _files.end())
+			return &it->first;
+	}
+	auto it = _by_name.find(std::string{name_of(name)});
+	if (it == _by_name.end())
+		return nullptr;
+	for (auto path : it->second) {
+		std::string_view candidate{*path};
+		if (cxx20::ends_with(candidate, name) && (candidate.size() == name.size() || candidate[candidate.size() - name.size() - 1] == '/'))
+			return path;
+	}
+	return nullptr;
+}
+
+void include_graph::reach(const std::string& path, std::unordered_set<const std::string*>& files, std::set<std::string>* external) const {
+	auto start = _files.find(path);
+	if (start == _files.end())
+		return;
+	std::vector<const std::string*> pending;
+	if (files.insert(&start->first).second)
+		pending.push_back(&start->first);
+	while (!pending.empty()) {
+		auto cur = pending.back();
+		pending.pop_back();
+		for (auto& directive : _files.find(*cur)->second) {
+			if (auto project = resolve(*cur, directive)) {
+				if (files.insert(project).second)
+					pending.push_back(project);
+			}
+			else if (external)
+				external->insert(directive);
+		}
+	}
+}
+
+bool header_cost::includes_file(const std::string& file) const {
+	return std::binary_search(includes.begin(), includes.end(), file);
+}
+
+bool measure_header(const std::string& probe_path, std::string_view directive, const std::vector<std::string>& args, header_cost& cost) {
+	TRACE_SCOPE("measure_header", directive);
+	auto source = fmt::format("#include {}\n", directive);
+	auto start = std::chrono::steady_clock::now();
+	auto unit = clang::parse_source(probe_path, source, args, CXTranslationUnit_None, cost.error);
+	cost.parse_ms = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() / 1000.0;
+	if (!unit) {
+		if (cost.error.empty())
+			cost.error = "parse fail";
+		return false;
+	}
+	clang::getInclusions(unit, [](CXFile file, CXSourceLocation*, unsigned depth, CXClientData data) {
+		auto cost = static_cast<header_cost*>(data);
+		if (depth == 0)
+			return; // the probe
+		auto path = clang::to_string(clang::File_tryGetRealPathName(file));
+		if (path.empty())
+			path = clang::to_string(clang::getFileName(file));
+		path = stdfs::path{path}.lexically_normal().generic_string();
+		std::error_code ec;
+		auto size = stdfs::file_size(path, ec);
+		if (!ec)
+			cost->bytes += size;
+		if (depth == 1)
+			cost->path = std::move(path);
+		else
+			cost->includes.push_back(std::move(path));
+	}, &cost);
+	clang::disposeTranslationUnit(unit);
+	std::sort(cost.includes.begin(), cost.includes.end());
+	cost.includes.erase(std::unique(cost.includes.begin(), cost.includes.end()), cost.includes.end());
+	return cost.error.empty() && !cost.path.empty();
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+// the include graph of a project for the passes measuring the includes: the include directives of the project files,
+// resolved to the project files by the dir of the includer or a path suffix, the others are external, and the cost of
+// a header measured by libclang
+#include <stdint.h>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// a space of a line or a line end
+bool is_space(char ch);
+
+// a character of an identifier, ascii only
+bool is_ident(char ch);
+
+// <name> or "name" of an #include or #import line, empty if it isn't one
+std::string_view include_directive_of(std::string_view line);
+
+// the include directives of a file in order, without duplicates, the ones in block comments skipped
+std::vector<std::string> include_directives_of(std::string_view content);
+
+// a c++ or objc++ translation unit by its name
+bool is_translation_unit(std::string_view name);
+
+// a c++ header by its name, .inl too
+bool is_header(std::string_view name);
+
+// a c++, c or objc file by its name, the headers and the translation units
+bool is_cpp_file(std::string_view name);
+
+// a file of the trees no pass migrates, the sources of DragonBones, by its path with '/'
+bool is_excluded_path(std::string_view path);
+
+// absolute and normalized with '/'
+std::string normalize_path(std::string_view path);
+
+// the root of the project at dir, canonical with trailing '/'
+std::string root_of(std::string_view dir);
+
+// the root of the project of the files given to a pass: the current directory, as they are relative to it usually
+std::string root_of_files();
+
+// the files of the tree at dir whose names accept takes, normalized and sorted, the others are counted as excluded
+// or skipped by the stats
+std::vector<std::string> scan_tree(std::string_view dir, bool (*accept)(std::string_view name));
+
+// the translation units of the files given, normalized, the others are counted as skipped by the stats
+std::vector<std::string> translation_units_of(const std::vector<std::string>& paths);
+
+class include_graph {
+public:
+	// the directives of the project file path, absolute and normalized, replaces the ones set before
+	void set(const std::string& path, std::vector<std::string> directives);
+
+	void erase(const std::string& path);
+
+	const std::map<std::string, std::vector<std::string>>& files() const { return _files; }
+
+	// the project file which directive of includer resolves to, nullptr if it's external
+	const std::string* resolve(const std::string& includer, std::string_view directive) const;
+
+	// the project files reached from path, itself included, and the external directives reached
+	void reach(const std::string& path, std::unordered_set<const std::string*>& files, std::set<std::string>* external) const;
+
+private:
+	std::map<std::string, std::vector<std::string>> _files;
+	std::unordered_map<std::string, std::vector<const std::string*>> _by_name; // file name -> project files
+};
+
+struct header_cost {
+	std::string path; // the header the directive resolved to
+	double parse_ms = 0; // of the header and its includes
+	uint64_t bytes = 0; // of the header and its includes, the source the preprocessor reads
+	std::vector<std::string> includes; // the headers it includes transitively, sorted
+	std::string error; // empty if parsed without errors
+
+	bool includes_file(const std::string& file) const;
+};
+
+// parses a unit at probe_path including just directive by libclang, false if it fails
+bool measure_header(const std::string& probe_path, std::string_view directive, const std::vector<std::string>& args, header_cost& cost);
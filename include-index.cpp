@@ -0,0 +1,419 @@
+// ---------------------------------------- include index
+// The layout, native byte order, every record at its natural alignment so the mapping is read in place:
+//   file_header
+//   file_record[files]      sorted by key, the xxh3 of the path relative to the root
+//   edge_record[edges]      the directives of each file in order, with the record of the project file it resolves to
+//   uint32_t[includers]     the records of the files including each file
+//   char[strings]           the root, the relative paths and the directives
+// A file of another version or byte order is not an index, the passes rebuild it by scanning the tree.
+#include "include-index.h"
+#include "migrate-context.h"
+#include "base/posix_io.h"
+#include "base/trace.h"
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <unordered_map>
+#if defined(_WIN32)
+#	include <windows.h>
+#else
+#	include <sys/mman.h>
+#endif
+
+namespace stdfs = std::filesystem;
+
+namespace {
+	constexpr char index_magic[8] = {'A', 'X', 'I', 'N', 'D', 'E', 'X', '\0'};
+	constexpr uint32_t index_version = 1;
+	constexpr uint32_t byte_order_mark = 0x01020304;
+	constexpr uint32_t no_file = 0xffffffffu; // the target of an external directive
+
+	uint64_t key_of(std::string_view rel) {
+		return manifest::hash_of(rel);
+	}
+
+	bool stat_file(const std::string& path, int64_t& size, int64_t& mtime) {
+		std::error_code ec;
+		auto fsize = stdfs::file_size(path, ec);
+		if (ec)
+			return false;
+		auto ftime = stdfs::last_write_time(path, ec);
+		if (ec)
+			return false;
+		size = static_cast<int64_t>(fsize);
+		mtime = static_cast<int64_t>(ftime.time_since_epoch().count());
+		return true;
+	}
+
+	template <typename T>
+	void append_pod(std::string& out, const T& value) {
+		out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
+}
+
+struct include_index::file_header {
+	char magic[8];
+	uint32_t version;
+	uint32_t byte_order;
+	uint32_t files;
+	uint32_t edges;
+	uint32_t includers;
+	uint32_t strings; // bytes
+	uint32_t root_offset;
+	uint32_t root_size;
+};
+
+struct include_index::file_record {
+	uint64_t key;
+	uint64_t hash; // of the content
+	int64_t size;
+	int64_t mtime; // file_time_type ticks, only meaningful on the machine which recorded it
+	uint32_t path_offset;
+	uint32_t path_size;
+	uint32_t first_edge;
+	uint32_t edges;
+	uint32_t first_includer;
+	uint32_t includers;
+};
+
+struct include_index::edge_record {
+	uint32_t directive_offset;
+	uint32_t directive_size;
+	uint32_t target;
+};
+
+// a read only mapping of the whole file
+struct include_index::mapping {
+	const char* data = nullptr;
+	size_t size = 0;
+#if defined(_WIN32)
+	HANDLE handle = nullptr;
+#endif
+
+	~mapping() {
+#if defined(_WIN32)
+		if (data)
+			::UnmapViewOfFile(data);
+		if (handle)
+			::CloseHandle(handle);
+#else
+		if (data)
+			::munmap(const_cast<char*>(data), size);
+#endif
+	}
+
+	bool map(const std::string& path) {
+		int fd = posix_open(path.c_str(), O_READ_FLAGS);
+		if (fd == -1)
+			return false;
+		auto end = posix_lseek64(fd, 0, SEEK_END);
+		bool ok = end > 0;
+		if (ok) {
+			size = static_cast<size_t>(end);
+#if defined(_WIN32)
+			handle = ::CreateFileMappingW(posix_fd2fh(fd), nullptr, PAGE_READONLY, 0, 0, nullptr);
+			data = handle ? static_cast<const char*>(::MapViewOfFile(handle, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+#else
+			auto addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+			data = addr != MAP_FAILED ? static_cast<const char*>(addr) : nullptr;
+#endif
+			ok = data != nullptr;
+		}
+		posix_close(fd);
+		return ok;
+	}
+};
+
+include_index::include_index() = default;
+
+include_index::~include_index() = default;
+
+bool include_index::open(const std::string& path) {
+	TRACE_SCOPE("index_open", path);
+	_built.clear();
+	_root.clear();
+	_header = nullptr;
+	_dirty = false;
+	std::error_code ec;
+	if (!stdfs::exists(path, ec)) {
+		_mapping.reset();
+		return true;
+	}
+	auto mapped = std::make_unique<mapping>();
+	if (!mapped->map(path) || !attach(mapped->data, mapped->size))
+		return false;
+	_mapping = std::move(mapped);
+	return true;
+}
+
+bool include_index::attach(const char* data, size_t size) {
+	// the records follow the header without padding
+	static_assert(sizeof(file_header) % alignof(file_record) == 0 && sizeof(file_record) % alignof(edge_record) == 0 && sizeof(edge_record) % alignof(uint32_t) == 0);
+	_header = nullptr;
+	if (size < sizeof(file_header))
+		return false;
+	auto header = reinterpret_cast<const file_header*>(data);
+	if (memcmp(header->magic, index_magic, sizeof(index_magic)) != 0 || header->version != index_version || header->byte_order != byte_order_mark)
+		return false;
+	uint64_t expected = sizeof(file_header) + uint64_t{header->files} * sizeof(file_record) + uint64_t{header->edges} * sizeof(edge_record) +
+		uint64_t{header->includers} * sizeof(uint32_t) + header->strings;
+	if (expected != size || uint64_t{header->root_offset} + header->root_size > header->strings)
+		return false;
+	auto files = reinterpret_cast<const file_record*>(data + sizeof(file_header));
+	auto edges = reinterpret_cast<const edge_record*>(files + header->files);
+	auto includers = reinterpret_cast<const uint32_t*>(edges + header->edges);
+	auto strings = reinterpret_cast<const char*>(includers + header->includers);
+
+	// the records are checked once, the lookups trust them
+	for (uint32_t i = 0; i < header->files; ++i) {
+		auto& file = files[i];
+		if (uint64_t{file.path_offset} + file.path_size > header->strings || uint64_t{file.first_edge} + file.edges > header->edges ||
+			uint64_t{file.first_includer} + file.includers > header->includers || (i > 0 && files[i - 1].key > file.key))
+			return false;
+	}
+	for (uint32_t i = 0; i < header->edges; ++i)
+		if (uint64_t{edges[i].directive_offset} + edges[i].directive_size > header->strings || (edges[i].target != no_file && edges[i].target >= header->files))
+			return false;
+	for (uint32_t i = 0; i < header->includers; ++i)
+		if (includers[i] >= header->files)
+			return false;
+
+	_header = header;
+	_files = files;
+	_edges = edges;
+	_includers = includers;
+	_strings = strings;
+	_root.assign(strings + header->root_offset, header->root_size);
+	return true;
+}
+
+std::string_view include_index::string_at(uint32_t offset, uint32_t size) const {
+	return std::string_view{_strings + offset, size};
+}
+
+size_t include_index::size() const {
+	return _header ? _header->files : 0;
+}
+
+const include_index::file_record* include_index::find(std::string_view rel) const {
+	if (!_header)
+		return nullptr;
+	auto key = key_of(rel);
+	auto last = _files + _header->files;
+	for (auto it = std::lower_bound(_files, last, key, [](const file_record& file, uint64_t key) { return file.key < key; }); it != last && it->key == key; ++it)
+		if (string_at(it->path_offset, it->path_size) == rel)
+			return it;
+	return nullptr;
+}
+
+bool include_index::contains(std::string_view path) const {
+	return !_root.empty() && cxx20::starts_with(path, std::string_view{_root}) && find(path.substr(_root.size()));
+}
+
+void include_index::fill(include_graph& graph) const {
+	for (size_t i = 0; i < size(); ++i) {
+		auto& file = _files[i];
+		std::vector<std::string> directives;
+		directives.reserve(file.edges);
+		for (auto edge = _edges + file.first_edge; edge != _edges + file.first_edge + file.edges; ++edge)
+			directives.emplace_back(string_at(edge->directive_offset, edge->directive_size));
+		graph.set(_root + std::string{string_at(file.path_offset, file.path_size)}, std::move(directives));
+	}
+}
+
+void include_index::includers_of(std::string_view path, bool transitive, std::set<std::string>& includers) const {
+	if (_root.empty() || !cxx20::starts_with(path, std::string_view{_root}))
+		return;
+	auto start = find(path.substr(_root.size()));
+	if (!start)
+		return;
+	std::vector<bool> seen(size());
+	std::vector<const file_record*> pending{start};
+	seen[start - _files] = true;
+	while (!pending.empty()) {
+		auto file = pending.back();
+		pending.pop_back();
+		for (auto includer = _includers + file->first_includer; includer != _includers + file->first_includer + file->includers; ++includer) {
+			if (seen[*includer])
+				continue;
+			seen[*includer] = true;
+			auto& record = _files[*includer];
+			includers.insert(_root + std::string{string_at(record.path_offset, record.path_size)});
+			if (transitive)
+				pending.push_back(&record);
+		}
+	}
+}
+
+int include_index::update(const migrate_context& ctx, std::string_view dir) {
+	TRACE_SCOPE("index_update", dir);
+	std::error_code ec;
+	auto root = normalize_path(stdfs::weakly_canonical(stdfs::path{dir}, ec).generic_string());
+	if (root.empty() || root.back() != '/')
+		root.push_back('/');
+
+	struct entry {
+		std::string path;
+		uint64_t hash = 0;
+		int64_t size = -1;
+		int64_t mtime = 0;
+		std::vector<std::string> directives;
+	};
+	std::vector<entry> entries;
+	for (const auto& item : stdfs::recursive_directory_iterator(root, ec)) {
+		if (!item.is_regular_file())
+			continue;
+		auto strPath = item.path().generic_string();
+		if (!is_excluded_path(strPath) && is_cpp_file(item.path().filename().generic_string()))
+			entries.emplace_back().path = normalize_path(strPath);
+	}
+
+	// the directives of the files unchanged by stat or content are the ones indexed
+	auto same_root = root == _root;
+	std::atomic<int> scanned{0};
+	axstd::parallel_for(entries.size(), ctx.jobs, [&](size_t index) {
+		auto& item = entries[index];
+		auto indexed = same_root ? find(std::string_view{item.path}.substr(root.size())) : nullptr;
+		auto reuse = [&] {
+			for (auto edge = _edges + indexed->first_edge; edge != _edges + indexed->first_edge + indexed->edges; ++edge)
+				item.directives.emplace_back(string_at(edge->directive_offset, edge->directive_size));
+		};
+		if (!stat_file(item.path, item.size, item.mtime))
+			item.size = -1; // compared by hash only
+		if (indexed && item.size >= 0 && indexed->size == item.size && indexed->mtime == item.mtime) {
+			item.hash = indexed->hash;
+			reuse();
+			return;
+		}
+		auto content = load_file(item.path);
+		item.hash = manifest::hash_of(content);
+		if (indexed && indexed->hash == item.hash)
+			reuse();
+		else {
+			item.directives = include_directives_of(content);
+			++scanned;
+		}
+	});
+	stats::add("index_files", static_cast<int64_t>(entries.size()));
+	stats::add("index_files_scanned", scanned.load());
+
+	// the directives resolved to the project files by the include graph
+	include_graph graph;
+	std::unordered_map<std::string_view, const entry*> entry_of;
+	for (auto& item : entries)
+		entry_of.emplace(item.path, &item);
+	for (auto& item : entries)
+		graph.set(item.path, item.directives);
+	std::vector<const std::string*> paths;
+	for (auto& file : graph.files())
+		paths.push_back(&file.first);
+	std::vector<uint64_t> keys;
+	for (auto path : paths)
+		keys.push_back(key_of(std::string_view{*path}.substr(root.size())));
+	std::vector<uint32_t> order(paths.size());
+	for (uint32_t i = 0; i < order.size(); ++i)
+		order[i] = i;
+	std::sort(order.begin(), order.end(), [&](uint32_t lhs, uint32_t rhs) { return keys[lhs] != keys[rhs] ? keys[lhs] < keys[rhs] : *paths[lhs] < *paths[rhs]; });
+	std::unordered_map<const std::string*, uint32_t> record_of;
+	for (uint32_t i = 0; i < order.size(); ++i)
+		record_of.emplace(paths[order[i]], i);
+
+	std::string strings{root};
+	std::vector<file_record> files(order.size());
+	std::vector<edge_record> edges;
+	std::vector<std::vector<uint32_t>> includedBy(order.size());
+	for (uint32_t i = 0; i < order.size(); ++i) {
+		auto& path = *paths[order[i]];
+		auto& item = *entry_of.at(path);
+		auto& file = files[i];
+		file.key = keys[order[i]];
+		file.hash = item.hash;
+		file.size = item.size;
+		file.mtime = item.mtime;
+		file.path_offset = static_cast<uint32_t>(strings.size());
+		file.path_size = static_cast<uint32_t>(path.size() - root.size());
+		strings.append(path, root.size());
+		file.first_edge = static_cast<uint32_t>(edges.size());
+		file.edges = static_cast<uint32_t>(item.directives.size());
+		for (auto& directive : item.directives) {
+			auto target = graph.resolve(path, directive);
+			auto record = target ? record_of.at(target) : no_file;
+			edges.push_back(edge_record{static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(directive.size()), record});
+			strings += directive;
+			if (record != no_file && record != i && (includedBy[record].empty() || includedBy[record].back() != i))
+				includedBy[record].push_back(i);
+		}
+	}
+	uint32_t includers = 0;
+	for (uint32_t i = 0; i < files.size(); ++i) {
+		files[i].first_includer = includers;
+		files[i].includers = static_cast<uint32_t>(includedBy[i].size());
+		includers += files[i].includers;
+	}
+
+	file_header header{};
+	memcpy(header.magic, index_magic, sizeof(index_magic));
+	header.version = index_version;
+	header.byte_order = byte_order_mark;
+	header.files = static_cast<uint32_t>(files.size());
+	header.edges = static_cast<uint32_t>(edges.size());
+	header.includers = includers;
+	header.strings = static_cast<uint32_t>(strings.size());
+	header.root_offset = 0;
+	header.root_size = static_cast<uint32_t>(root.size());
+
+	std::string built;
+	built.reserve(sizeof(header) + files.size() * sizeof(file_record) + edges.size() * sizeof(edge_record) + includers * sizeof(uint32_t) + strings.size());
+	append_pod(built, header);
+	for (auto& file : files)
+		append_pod(built, file);
+	for (auto& edge : edges)
+		append_pod(built, edge);
+	for (auto& list : includedBy)
+		for (auto includer : list)
+			append_pod(built, includer);
+	built += strings;
+
+	// unchanged if the same bytes as mapped
+	_dirty = !_mapping || _mapping->size != built.size() || memcmp(_mapping->data, built.data(), built.size()) != 0;
+	if (_dirty) {
+		_built = std::move(built);
+		attach(_built.data(), _built.size());
+	}
+	return scanned.load();
+}
+
+bool include_index::save(const std::string& path) {
+	if (!_dirty)
+		return true;
+	TRACE_SCOPE("index_save", path);
+	auto temp = path + ".tmp";
+	{
+		int fd = posix_open(temp.c_str(), O_WRITE_FLAGS);
+		if (fd == -1)
+			return false;
+		auto written = posix_write(fd, _built.data(), static_cast<unsigned int>(_built.size()));
+		posix_close(fd);
+		if (written != static_cast<decltype(written)>(_built.size()))
+			return false;
+	}
+	// the mapping of the old file is released first, windows can't replace a mapped file
+	_mapping.reset();
+	std::error_code ec;
+	stdfs::rename(temp, path, ec);
+	if (ec) {
+		stdfs::remove(temp, ec);
+		return false;
+	}
+	auto mapped = std::make_unique<mapping>();
+	if (mapped->map(path) && attach(mapped->data, mapped->size)) {
+		_mapping = std::move(mapped);
+		_built.clear();
+		_built.shrink_to_fit();
+	}
+	else
+		attach(_built.data(), _built.size());
+	_dirty = false;
+	return true;
+}
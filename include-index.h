@@ -0,0 +1,68 @@
+#pragma once
+
+// the include graph of a project persisted between runs: the include directives of every c++ file of the tree with
+// the project file each resolves to and the files including each file, keyed by the xxh3 of the path relative to the
+// tree. Saved as one binary file of fixed size records which is mapped into memory as is when opened, an update stats
+// the files and reads the changed ones only, so the passes find the files affected by a change by a lookup.
+#include "include-graph.h"
+#include <stdint.h>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct migrate_context;
+
+class include_index {
+public:
+	include_index();
+	~include_index();
+
+	include_index(const include_index&) = delete;
+	include_index& operator=(const include_index&) = delete;
+
+	// maps the index saved at path, a missing file opens empty, false if it isn't an index or of another version
+	bool open(const std::string& path);
+
+	// the tree at dir scanned again, the files whose size and mtime changed are read and the ones whose content
+	// changed have their directives scanned, returns the number of files scanned
+	int update(const migrate_context& ctx, std::string_view dir);
+
+	// written to a temporary file and renamed over path, then mapped, a no-op if unchanged since opened
+	bool save(const std::string& path);
+
+	// with trailing '/', empty if never updated
+	const std::string& root() const { return _root; }
+
+	size_t size() const;
+
+	bool contains(std::string_view path) const;
+
+	// the directives of the project files into graph, in place of reading them
+	void fill(include_graph& graph) const;
+
+	// the files including path, absolute, directly or through other project files
+	void includers_of(std::string_view path, bool transitive, std::set<std::string>& includers) const;
+
+private:
+	struct file_header;
+	struct file_record;
+	struct edge_record;
+	struct mapping;
+
+	const file_record* find(std::string_view rel) const;
+	std::string_view string_at(uint32_t offset, uint32_t size) const;
+	bool attach(const char* data, size_t size);
+
+	std::unique_ptr<mapping> _mapping; // of the file opened
+	std::string _built; // the index updated, not saved yet
+	bool _dirty = false;
+
+	std::string _root;
+	const file_header* _header = nullptr;
+	const file_record* _files = nullptr;
+	const edge_record* _edges = nullptr;
+	const uint32_t* _includers = nullptr;
+	const char* _strings = nullptr;
+};
@@ -12,63 +12,51 @@ processing file 4: /home/vmroot/dev/axmol/tests/cpp-tests/Content/hd/extensions/
 // ./tests/**/*.h,./tests/**/*.cpp,./tests/**/*.inl,./tests/**/*.mm,./tests/**/*.m
 // ./templates/**/*.h,./templates/**/*.cpp,./templates/**/*.inl,./templates/**/*.mm,./templates/**/*.m
 
-#include "base/posix_io.h"
-#include "base/axstd.h"
+
+#include "axmigrate.h"
+#include "base/trace.h"
+#include "base/stats.h"
+#include "base/logger.h"
+#include "base/lazy_regex.h"
 #include "yasio/string_view.hpp"
-#include <assert.h>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <filesystem>
-#include <iostream>
 #include <regex>
-#include <stdexcept>
 #include <stdio.h>
 #include <stdlib.h>
-#include <vector>
+#include <string.h>
 #include <fstream>
+#include <memory>
 #include <string>
 #include <vector>
-#include "fmt/compile.h"
-
-#define AX_MIGRATE_VER "1.1.1"
+#include <mutex>
 
 namespace stdfs = std::filesystem;
 
-using namespace std::string_view_literals;
+#if !defined(ARRAYSIZE)
+#define ARRAYSIZE(A) (sizeof(A) / sizeof((A)[0]))
+#endif
 
-bool g_use_fuzzy_pattern;
-bool g_use_ubo = false;
-int totals = 0;
-int replaced_totals = 0;
-std::vector<std::string_view> chunks;
+// loaded by libaxmigrate on first use, reported by --time-startup
+extern void* hLibClang;
+namespace clang {
+	extern int64_t load_nanos;
+}
 
-const std::regex include_re(R"(#(\s)*(include|import)(\s)*"(.)*\b(CC|cc))", std::regex_constants::ECMAScript);
-const std::regex include_re_fuzzy(R"(#(\s)*(include|import)(\s)*("|<)(.)*\b(CC|cc))", std::regex_constants::ECMAScript);
-const std::regex cmake_re(R"(/CC)", std::regex_constants::ECMAScript | std::regex_constants::icase);
+// startup latency, reported by --time-startup
+bool g_time_startup = false;
+std::chrono::steady_clock::time_point g_main_start;
+std::chrono::steady_clock::duration g_first_file_latency{};
 
-std::string load_file(std::string_view path)
-{
-	auto fd = posix_open_cxx(path, O_READ_FLAGS);
-	if (fd != -1) {
-		struct auto_handle {
-			~auto_handle() { close(_fd); }
-			int _fd;
-		} _h { fd };
-		size_t len = lseek(fd, 0, SEEK_END);
-		if (len > 0) {
-			lseek(fd, 0, SEEK_SET);
-			std::string content;
-			content.reserve(len);
-			char buf[512];
-			int nb = -1;
-			while ((nb = read(fd, buf, sizeof(buf))) > 0) {
-				content.append(buf, static_cast<size_t>(nb));
-			}
-			return content;
-		}
-	}
-	return {};
+static void mark_first_file() {
+	static std::once_flag once;
+	std::call_once(once, [] { g_first_file_latency = std::chrono::steady_clock::now() - g_main_start; });
 }
 
+const axstd::lazy_regex shader_varexp(R"([a-zA-Z_]+\w+(vert|frag)\b)");
+
 std::vector<std::string> load_file_lines(std::string_view path) {
 	std::ifstream file;
 	file.open(path.data());
@@ -96,555 +84,131 @@ void save_file_lines(std::string_view path, const std::vector<std::string>& line
 	}
 }
 
-void save_file(std::string_view path, const std::vector<std::string_view>& chunks)
-{
-	auto fp = fopen(path.data(), "wb");
-	if (!fp) {
-		throw std::runtime_error("open file fail");
-	}
-	for (auto& chunk : chunks)
-		fwrite(chunk.data(), chunk.length(), 1, fp);
-	fclose(fp);
-}
-
-bool regex_search_for_replace(const std::string& content, const std::regex& re)
-{
-	// scan line by line, and put to chunks
-	const char* cur_line = content.c_str();
-	const char* ptr = cur_line;
-
-	int line_count = 0; // for stats only
-	int hints = 0;
-
-	chunks.clear();
-
-	for (;;) {
-		++line_count;
-
-		while (*ptr && *ptr != '\n')
-			++ptr;
-
-		auto next_line = *ptr == '\n' ? ptr + 1 : ptr;
-		std::string_view line { cur_line, static_cast<size_t>(next_line - cur_line)}; // ensure line contains '\n' if not '\0'
-
-		if (line.length() > 1) {
-			std::match_results<std::string_view::const_iterator> results;
-			if (std::regex_search(line.begin(), line.end(), results, re)
-				// we don't want replace c standard header, but will match
-				// when use fuzzy pattern
-				&& (!g_use_fuzzy_pattern || line.find("<cctype>") == std::string_view::npos)) {
-				auto& match = results[0];
-				auto first = match.first;
-				auto last = match.second;
-				// assert(first >= line.data() && first <= &line.back());
-				std::string_view word { std::addressof(*first), (size_t) std::distance(first, last)};
-				std::string_view chunk1 { cur_line, (size_t)std::distance(cur_line,  std::addressof(*last) - 2)};
-				chunks.push_back(chunk1);
-				auto chunk2_first = std::addressof(*last);
-				if (chunk2_first < next_line) {
-					std::string_view chunk2 { chunk2_first, (size_t)std::distance(chunk2_first, next_line) };
-					chunks.push_back(chunk2);
-				}
-				++hints;
-			}
-			else {
-				chunks.push_back(line);
-			}
-		}
-		else { // put empty line directly
-			chunks.push_back(line);
-		}
-
-		if (*next_line != '\0') {
-			ptr = cur_line = next_line;
-		}
-		else {
+// the CLI is a client of libaxmigrate, the progress of trees is logged ordered by file as serial run
+struct cli_progress {
+	int file_base = 0; // files of the trees migrated before, for the file numbers
+	std::atomic<int> files{0};
+};
+
+static void on_progress(const ax_migrate_progress* progress, void* user) {
+	auto cli = static_cast<cli_progress*>(user);
+	auto file_no = cli->file_base + progress->index + 1;
+	bool is_cmake = progress->detail && strcmp(progress->detail, "cmake") == 0;
+	switch (progress->event) {
+	case AX_MIGRATE_EVENT_BEGIN:
+		mark_first_file();
+		cli->files.store(progress->total, std::memory_order_relaxed);
+		logger::begin_item(progress->index);
+		break;
+	case AX_MIGRATE_EVENT_REPLACED:
+		if (progress->detail && strcmp(progress->detail, "umbrella") == 0) {
+			logger::info("decomposing umbrella include of file {}: {}, headers={}", file_no, progress->path, progress->lines);
 			break;
 		}
-	}
-
-	return !!hints;
-}
-
-void process_file(std::string_view file_path, std::string_view file_name, bool is_cmake, bool needs_rename = false)
-{
-	auto content = load_file(file_path);
-	if (content.empty()) {
-		throw std::runtime_error("found empty file!");
-	}
-
-	if (!is_cmake) {
-		// replacing file include stub from CCxxx to xxx, do in editor is better
-		if (regex_search_for_replace(content, !g_use_fuzzy_pattern ? include_re : include_re_fuzzy)) {
-			printf("replacing c/c++,objc file %d: %s, len=%zu\n", ++totals, file_path.data(), content.size());
-			save_file(file_path, chunks);
-			++replaced_totals;
-		}
-		else {
-			printf("skipping c/c++,objc file %d: %s, len=%zu\n", ++totals, file_path.data(), content.size());
-		}
-
-		if (needs_rename) {
-			auto new_file_name = file_name.substr(2);
-			std::string new_file_path { file_path.data(), file_path.length() - file_name.length() };
-			new_file_path += new_file_name;
-
-			// rename
-			int ret = ::rename(file_path.data(), new_file_path.c_str());
-			if (ret != 0) {
-				throw std::runtime_error("rename file fail");
-			}
-		}
-	}
-	else {
-		if (regex_search_for_replace(content, cmake_re)) {
-			printf("replacing cmake file %d: %s, len=%zu\n", ++totals, file_path.data(), content.size());
-			save_file(file_path, chunks);
-			++replaced_totals;
-		}
-		else {
-			printf("skip cmake %s not part of axmol engine!\n", file_path.data());
-		}
-	}
-}
-
-void process_folder(std::string_view sub_path)
-{
-#if defined(_WIN32)
-	static std::string exclude = "\\DragonBones\\";
-#else
-	static std::string exclude = "/DragonBones/";
-#endif
-	for (const auto& entry : stdfs::recursive_directory_iterator(sub_path)) {
-		const auto isDir = entry.is_directory();
-		if (entry.is_regular_file()) {
-			auto& path = entry.path();
-			auto strPath = path.generic_string();
-			auto pathname = path.filename();
-			auto strName = pathname.generic_string();
-
-			if (strPath.find(exclude) != std::string::npos)
-				continue;
-
-			if (cxx20::ic::ends_with(strName, ".h") || cxx20::ic::ends_with(strName, ".hpp") || cxx20::ic::ends_with(strName, ".cpp") || cxx20::ic::ends_with(strName, ".mm") || cxx20::ic::ends_with(strName, ".m") || cxx20::ic::ends_with(strName, ".inl")) {
-				process_file(strPath, strName, false, cxx20::ic::starts_with(strName, "CC"));
-			}
-			else if (cxx20::ic::ends_with(strPath, "CMakeLists.txt")) {
-				process_file(strPath, strName, true);
-			}
-		}
-	}
-}
-
-// ---------------------------------------- migrate shader glsl 100 to essl 310 for glscc input
-namespace Strings {
-	inline bool replace_bound(std::string& str, const std::string& from, const std::string& to, int start) {
-		size_t start_pos = str.find(from);
-		if (start_pos != std::string::npos || start_pos >= start && start_pos + to.length() <= std::string::npos) {
-			str.replace(start_pos, from.length(), to);
-			return true;
+		if (progress->detail && strcmp(progress->detail, "semantic") == 0) {
+			logger::info("rewriting API of file {}: {}, edits={}", file_no, progress->path, progress->lines);
+			break;
 		}
-		return false;
-	}
-
-	inline bool replace(std::string& str, const std::string& from, const std::string& to) {
-		size_t start_pos = str.find(from);
-		if (start_pos == std::string::npos)
-			return false;
-		str.replace(start_pos, from.length(), to);
-		return true;
-	}
-
-	inline bool wreplace(std::wstring& str, const std::wstring& from, const std::wstring& to) {
-		size_t start_pos = str.find(from);
-		if (start_pos == std::wstring::npos)
-			return false;
-		str.replace(start_pos, from.length(), to);
-		return true;
-	}
-
-	inline std::string replace_const(const std::string str, const std::string& from, const std::string& to) {
-		std::string final = str;
-		size_t start_pos = final.find(from);
-		if (start_pos == std::string::npos)
-			return final;
-		final.replace(start_pos, from.length(), to);
-		return final;
-	}
-
-	inline std::wstring wreplace_const(const std::wstring str, const std::wstring& from, const std::wstring& to) {
-		std::wstring final = str;
-		size_t start_pos = final.find(from);
-		if (start_pos == std::wstring::npos)
-			return final;
-		final.replace(start_pos, from.length(), to);
-		return final;
-	}
-
-	inline void split_single_char(std::string& str, const char* delim, std::vector<char>& out)
-	{
-		size_t start;
-		size_t end = 0;
-
-		while ((start = str.find_first_not_of(delim, end)) != std::string::npos)
-		{
-			end = str.find(delim, start);
-			out.push_back(str.substr(start, end - start)[0]);
+		if (progress->detail && strcmp(progress->detail, "hoist") == 0) {
+			logger::info("hoisting lookups of file {}: {}, edits={}", file_no, progress->path, progress->lines);
+			break;
 		}
-	}
-
-	inline void split(std::string& str, const char* delim, std::vector<std::string>& out)
-	{
-		size_t start;
-		size_t end = 0;
-
-		while ((start = str.find_first_not_of(delim, end)) != std::string::npos)
-		{
-			end = str.find(delim, start);
-			out.push_back(str.substr(start, end - start));
+		if (progress->detail && strcmp(progress->detail, "gl-commands") == 0) {
+			logger::info("converting GL commands of file {}: {}, edits={}", file_no, progress->path, progress->lines);
+			break;
 		}
-	}
-
-	inline void wsplit(std::wstring& str, const wchar_t* delim, std::vector<std::wstring>& out)
-	{
-		size_t start;
-		size_t end = 0;
-
-		while ((start = str.find_first_not_of(delim, end)) != std::string::npos)
-		{
-			end = str.find(delim, start);
-			out.push_back(str.substr(start, end - start));
+		if (progress->detail && strcmp(progress->detail, "forward-decl") == 0) {
+			logger::info("forward declaring includes of file {}: {}, includes={}", file_no, progress->path, progress->lines);
+			break;
 		}
+		logger::info("replacing {} file {}: {}, len={}", is_cmake ? "cmake" : "c/c++,objc", file_no, progress->path, progress->size);
+		break;
+	case AX_MIGRATE_EVENT_SKIPPED:
+		if (is_cmake)
+			logger::verbose("skip cmake {} not part of axmol engine!", progress->path);
+		else
+			logger::verbose("skipping c/c++,objc file {}: {}, len={}", file_no, progress->path, progress->size);
+		break;
+	case AX_MIGRATE_EVENT_UNCHANGED:
+		logger::verbose("unchanged file {}: {}", file_no, progress->path);
+		break;
+	case AX_MIGRATE_EVENT_CONVERTED:
+		logger::info("Convert {} to 310 es done.", progress->path);
+		break;
+	case AX_MIGRATE_EVENT_WARNING:
+		logger::warn("Skipping {}, {}.", progress->path, progress->detail);
+		break;
+	case AX_MIGRATE_EVENT_END:
+		logger::end_item();
+		break;
 	}
 }
 
-// libclang APIs
-/**
- * Flags that control the creation of translation units.
- *
- * The enumerators in this enumeration type are meant to be bitwise
- * ORed together to specify which options should be used when
- * constructing the translation unit.
- */
-
- // llvm-15.0.7
-#include "clang-c/Index.h"
-void* hLibClang = nullptr;
-#define DEFINE_CLANG_FUNC(func) decltype(&clang_##func) func
-#if defined(_WIN32)
-#define GET_CLANG_FUNC(func) func = (decltype(&clang_##func))GetProcAddress((HMODULE)hLibClang, "clang_" #func)
-#else
-#include <dlfcn.h>
-#define GET_CLANG_FUNC(func) func = (decltype(&clang_##func))dlsym(hLibClang, "clang_" #func)
-#endif
-namespace clang {
-	DEFINE_CLANG_FUNC(createIndex);
-	DEFINE_CLANG_FUNC(parseTranslationUnit);
-	DEFINE_CLANG_FUNC(parseTranslationUnit2);
-	DEFINE_CLANG_FUNC(getTranslationUnitCursor);
-	DEFINE_CLANG_FUNC(visitChildren);
-	DEFINE_CLANG_FUNC(getCursorSpelling);
-	DEFINE_CLANG_FUNC(getCursorKindSpelling);
-	DEFINE_CLANG_FUNC(getCursorKind);
-	DEFINE_CLANG_FUNC(disposeTranslationUnit);
-	DEFINE_CLANG_FUNC(disposeIndex);
-	DEFINE_CLANG_FUNC(getCString);
-	DEFINE_CLANG_FUNC(disposeString);
-	DEFINE_CLANG_FUNC(getCursorLocation);
-	DEFINE_CLANG_FUNC(getExpansionLocation);
-	DEFINE_CLANG_FUNC(getFileName);
-	DEFINE_CLANG_FUNC(getCursorPrintingPolicy);
-	DEFINE_CLANG_FUNC(PrintingPolicy_setProperty);
-	DEFINE_CLANG_FUNC(PrintingPolicy_dispose);
-	DEFINE_CLANG_FUNC(getCursorPrettyPrinted);
-	DEFINE_CLANG_FUNC(PrintingPolicy_getProperty);
-
-	static void load_lib(const char** argv) {
-		if (hLibClang) return;
-
-		// load libclang
-#if defined(_WIN32)
-		hLibClang = LoadLibrary("libclang.dll");
-#else
-		std::string exePath = argv[0];
-		std::string_view exePathSV{exePath};
-		auto slash = exePath.find_last_of('/');
-		assert(slash != std::string::npos);
-		std::string libclang_file{exePathSV.substr(0, slash + 1)};
-#if defined(__linux__)
-		libclang_file += "/libclang.so";
-#elif defined(__APPLE__)
-		libclang_file += "/libclang.dylib";
-#endif
-		if (stdfs::is_regular_file(libclang_file)) {
-			fmt::println("Loading libclang: {}", libclang_file);
-			hLibClang = dlopen(libclang_file.c_str(), RTLD_LAZY | RTLD_LOCAL);
-	    }
-#endif
-		if (!hLibClang) {
-			fmt::println("load libclang fail.");
-			return; // can't load libclang
-		}
-		GET_CLANG_FUNC(createIndex);
-		GET_CLANG_FUNC(parseTranslationUnit);
-		GET_CLANG_FUNC(parseTranslationUnit2);
-		GET_CLANG_FUNC(getTranslationUnitCursor);
-		GET_CLANG_FUNC(visitChildren);
-		GET_CLANG_FUNC(getCursorSpelling);
-		GET_CLANG_FUNC(getCursorKindSpelling);
-		GET_CLANG_FUNC(getCursorKind);
-		GET_CLANG_FUNC(disposeTranslationUnit);
-		GET_CLANG_FUNC(disposeIndex);
-		GET_CLANG_FUNC(getCString);
-		GET_CLANG_FUNC(disposeString);
-		GET_CLANG_FUNC(getCursorLocation);
-		GET_CLANG_FUNC(getExpansionLocation);
-		GET_CLANG_FUNC(getFileName);
-		GET_CLANG_FUNC(getCursorPrintingPolicy);
-		GET_CLANG_FUNC(PrintingPolicy_setProperty);
-		GET_CLANG_FUNC(PrintingPolicy_dispose);
-		GET_CLANG_FUNC(getCursorPrettyPrinted);
-		GET_CLANG_FUNC(PrintingPolicy_getProperty);
-	}
+// returns the files replaced or shaders converted, -1 if fails
+extern int serve(const ax_migrate_options& defaults, const char* manifest_path, const char* source_dir);
+extern bool git_changed_files(const char* dir, const char* rev, std::vector<std::string>& files);
+extern int watch(const ax_migrate_options& opts, const char* source_dir, int debounce_ms);
+
+static int migrate_tree(const ax_migrate_options& opts, int type, const std::string& dir, cli_progress& progress) {
+	logger::begin_items();
+	auto hints = ax_migrate_tree(&opts, type, dir.c_str(), on_progress, &progress);
+	progress.file_base += progress.files.exchange(0);
+	if (hints < 0)
+		logger::error("Migrate {} fail: {}", dir, ax_migrate_last_error());
+	return hints;
 }
 
-int replace(std::string& string, const std::string& replaced_key, const std::string& replacing_key)
-{
-	int count = 0;
-	std::string::size_type pos = 0;
-	while ((pos = string.find(replaced_key, pos)) != std::string::npos)
-	{
-		(void)string.replace(pos, replaced_key.length(), replacing_key);
-		pos += replacing_key.length();
-		++count;
-	}
-	return count;
+// the changed files of watch, numbered from 1 per batch
+int migrate_files(const ax_migrate_options& opts, int type, const std::vector<std::string>& files) {
+	std::vector<const char*> paths;
+	paths.reserve(files.size());
+	for (auto& file : files)
+		paths.push_back(file.c_str());
+	cli_progress progress;
+	logger::begin_items();
+	auto hints = ax_migrate_files(&opts, type, paths.data(), static_cast<int>(paths.size()), on_progress, &progress);
+	if (hints < 0)
+		logger::error("Migrate changed files fail: {}", ax_migrate_last_error());
+	return hints;
 }
 
-#if !defined(ARRAYSIZE)
-#define ARRAYSIZE(A) (sizeof(A) / sizeof((A)[0]))
-#endif
-
-#include <set>
-
-std::string& migrate_strip_outpath(std::string& outpath, const std::set<std::string>& fileNameSet) {
-
-	auto slashpos = outpath.find_last_of("/\\");
-
-	if (slashpos != std::string::npos) {
-		std::string_view fileName {outpath.c_str() + slashpos + 1, outpath.size() - slashpos - 1};
-
-		std::string strippedFileName;
-		bool is3D = false;
-		if (cxx20::ic::starts_with(fileName, "CC2D_")) {
-			strippedFileName = fileName.substr(5);
-		}
-		else if (cxx20::ic::starts_with(fileName, "2D_")) {
-			strippedFileName = fileName.substr(3);
-		}
-		else if (cxx20::ic::starts_with(fileName, "CC3D_")) {
-			strippedFileName = fileName.substr(5);
-			is3D = true;
-		}
-		else if (cxx20::ic::starts_with(fileName, "3D_")) {
-			strippedFileName = fileName.substr(3);
-			is3D = true;
-		}
-		if (!strippedFileName.empty()) {
-			if (is3D) {
-				if (fileNameSet.find(strippedFileName) != fileNameSet.end()) {
-					auto dotpos = strippedFileName.find_last_of('.');
-					if (dotpos != std::string::npos)
-						strippedFileName.insert(dotpos, "3D");
-					else
-						strippedFileName.append("3D");
-				}
-			}
-			if (stdfs::is_regular_file(outpath))
-				stdfs::remove(outpath);
-			outpath.resize(outpath.size() - fileName.size());
-			outpath += strippedFileName;
-		}
-	}
-	return outpath;
+static void report_startup() {
+	auto to_ms = [](auto nanos) { return static_cast<double>(nanos) / 1000000.0; };
+	logger::info("Startup: first file processed {:.3f}(ms) after main",
+		to_ms(std::chrono::duration_cast<std::chrono::nanoseconds>(g_first_file_latency).count()));
+	logger::info("    regex: {} patterns compiled on first use, cost {:.3f}(ms)", axstd::lazy_regex::compiled_count.load(),
+		to_ms(axstd::lazy_regex::compile_nanos.load()));
+	if (clang::load_nanos >= 0)
+		logger::info("    libclang: {}, cost {:.3f}(ms)", hLibClang ? "loaded" : "load fail", to_ms(clang::load_nanos));
+	else
+		logger::info("    libclang: not loaded");
 }
 
-void insret_define_guard(std::string& shader, size_t& insertpos, std::string_view defineName) {
-	std::string define_guard_code = fmt::format("\n\n#if !defined({0})\n#define {0} 0\n#endif\n\n"sv, defineName);
-	shader.insert(insertpos, define_guard_code);
-	insertpos += define_guard_code.size();
-}
-
-extern void migrate_shader_source_one(std::string& shader_source, const std::string& outpath);
-extern int migrate_shader_source_one_ast(std::string& shader_source, const std::string& outpath);
-void migrate_shader_file_one(std::string_view inpath, const std::set<std::string>& fileNameSet) {
-
-#pragma region parse code file by libclang
-	struct ShaderSourceContext {
-		bool embedded = false;
-		std::vector<std::pair<std::string, std::string>> shaderDecls;
-		std::string curVarName;
-		stdfs::path fileDir;
-		std::string fileName;
-		const std::set<std::string>* fileNameSet;
-	};
-	ShaderSourceContext context;
-	context.fileDir = stdfs::path(inpath).parent_path();
-	context.fileName = stdfs::path(inpath).filename().generic_string();
-	context.fileNameSet = &fileNameSet;
-	const char* command_line_args[] = {
-		"-xc++",
-		"--std=c++17",
-	};
-	CXIndex index = clang::createIndex(0, 0);
-	CXTranslationUnit unit{};
-	auto err = clang::parseTranslationUnit2(
-		index,
-		inpath.data(), command_line_args, (int)ARRAYSIZE(command_line_args),
-		nullptr, 0,
-		CXTranslationUnit_None, &unit);
-
-	if (unit && err == CXError_Success)
-	{
-		context.embedded = true;
-		CXCursor cursor = clang::getTranslationUnitCursor(unit);
-		clang::visitChildren(
-			cursor,
-			[](CXCursor c, CXCursor parent, CXClientData client_data)
-			{
-				auto context = (ShaderSourceContext*)client_data;
-
-				CXFile from_file{};
-				unsigned line = 0;
-				unsigned column = 0;
-				unsigned offset = 0;
-				auto loc = clang::getCursorLocation(c);
-				clang::getExpansionLocation(loc, &from_file, &line, &column, &offset);
-				if (!from_file) {
-					return CXChildVisit_Continue;
-				}
-				auto from_spelling = clang::getFileName(from_file);
-				std::string fileName = clang::getCString(from_spelling);
-				std::string_view fv{fileName};
-				auto slash = fv.find_last_of("/\\");
-				if (slash != std::string::npos)
-					fv.remove_prefix(slash + 1);
-				clang::disposeString(from_spelling);
-
-				if (cxx20::ic::iequals(fv, context->fileName)) {
-					auto cursorKind = clang::getCursorKind(c);
-					auto cursorValue = clang::getCursorSpelling(c);
-					if (cursorKind == CXCursorKind::CXCursor_VarDecl) {
-						//cursorValue = clang::getCursorSpelling(c);
-						context->curVarName = clang::getCString(cursorValue);
-					}
-					else if (cursorKind == CXCursorKind::CXCursor_StringLiteral) {
-						if (!context->curVarName.empty()) {
-							//cursorValue = clang::getCursorSpelling(c);
-
-							std::string shaderCode = clang::getCString(cursorValue);
-							std::string curVarName {std::move(context->curVarName)};
-
-							// we assume it's engine builtin shaders
-							auto idx = curVarName.find_last_of('_');
-							if (idx != std::string::npos)
-								curVarName[idx] = '.';
-							auto path = context->fileDir;
-							path += "/";
-							path += curVarName;
-
-							replace(shaderCode, "\\n", "\n");
-							replace(shaderCode, "\"", "");
-							replace(shaderCode, "\\t", "\t");
-							context->shaderDecls.emplace_back(path.generic_string(), std::move(shaderCode));
-						}
-					}
-					clang::disposeString(cursorValue);
-				}
-				return CXChildVisit_Recurse;
-			},
-			&context);
-
-
-		clang::disposeTranslationUnit(unit);
-	}
-	else {
-		// read plain shader code line by line
-		std::fstream file;
-		file.open(inpath.data());
-
-		std::string shader;
-
-		if (file.is_open()) {
-			std::string tp;
-			while (std::getline(file, tp)) {
-				shader += tp + "\n";
-			}
-			file.close();
-		}
-
-		context.shaderDecls.emplace_back(inpath, shader);
-	}
-	clang::disposeIndex(index);
-#pragma endregion
-
-	if (context.shaderDecls.size() == 1) // single decl, use inpath
-		context.shaderDecls[0].first = inpath;
-	else if (context.shaderDecls.empty()) {
-		context.shaderDecls.emplace_back(
-			inpath,
-			load_file(inpath));
-	}
-	int hints = 0;
-	for (auto& item : context.shaderDecls) {
-		auto& shader = item.second;
-		auto& outpath = migrate_strip_outpath(item.first, fileNameSet);
-		if (g_use_ubo) {
-			hints += migrate_shader_source_one_ast(shader, outpath);
-		}
-		else {
-			migrate_shader_source_one(shader, outpath);
-			++hints;
-		}
-		fmt::println("Convert {} to 310 es done.", outpath);
-	}
-	if (hints && context.shaderDecls.size() > 1)
-		stdfs::remove(inpath);
-}
-
-bool is_in_filter(std::string_view fileName, const std::vector<std::string_view>& filterList) {
-	for (auto& filter : filterList)
-		if (cxx20::ic::ends_with(fileName, filter))
-			return true;
-	return false;
-}
-
-void migrate_shader_files_in_dir(std::string_view dir, const std::vector<std::string_view>& filterList, const char** argv) {
-	clang::load_lib(argv);
-
-	std::vector<stdfs::path> shader_files;
-	std::set<std::string> fileNameSet;
-	for (const auto& entry : stdfs::recursive_directory_iterator(dir)) {
-		const auto isDir = entry.is_directory();
-		if (entry.is_regular_file()) {
-			auto& path = entry.path();
-			auto strPath = path.generic_string();
-			auto pathname = path.filename();
-			auto strName = pathname.generic_string();
-
-			if (is_in_filter(strName, filterList)) {
-				fileNameSet.insert(strName);
-				shader_files.emplace_back(path);
-			}
-		}
-	}
-
-	for (const auto& path : shader_files) {
-		auto strPath = path.generic_string();
-		auto pathname = path.filename();
-		auto strName = pathname.generic_string();
-		migrate_shader_file_one(strPath, fileNameSet);
-	}
+static void print_usage() {
+	logger::info("Invalid parameter, usage: axmol-migrate <type> --source-dir <source_dir> [options]");
+	logger::info("\ttype: cpp [--fuzzy] [--lambdas] [--for-engine] [--suggest-pch <out_dir>]");
+	logger::info("\t      shader [--use-ubo] [--extractor lexer|tokens|ast]");
+	logger::info("\t      umbrella [--compile-commands <build_dir>]");
+	logger::info("\t      forward-decl [--compile-commands <build_dir>]");
+	logger::info("\t      semantic [--compile-commands <build_dir>]");
+	logger::info("\t      hoist [--compile-commands <build_dir>]");
+	logger::info("\t      gl-commands [--compile-commands <build_dir>]");
+	logger::info("\t      include-cost [--cache <dir>] [--report <out.json|csv>] [--top <N>]");
+	logger::info("\t      audit [--compile-commands <build_dir>] [--report <out.json>] [--top <N>]");
+	logger::info("\t      watch [--debounce <ms>]");
+	logger::info("\t      serve");
+	logger::info("\t      merge-manifests --manifest <out> <fragment>...");
+	logger::info("\toptions: [--filters .frag;.vert;.vsh;.fsh]");
+	logger::info("\t         [-j|--jobs <N>]");
+	logger::info("\t         [--manifest <path>]");
+	logger::info("\t         [--index <path>]");
+	logger::info("\t         [--shard <i/N>]");
+	logger::info("\t         [--since <rev>]");
+	logger::info("\t         [--journal <path> [--resume|--rollback]]");
+	logger::info("\t         [--quiet|--verbose]");
+	logger::info("\t         [--time-startup]");
+	logger::info("\t         [--trace <out.json>]");
+	logger::info("\t         [--stats json [--stats-file <path>] [--stats-top <N>]]");
 }
 
 /*
@@ -654,22 +218,48 @@ usage:
 
 int do_migrate(int argc, const char** argv)
 {
-	printf("axmol-migrate version %s\n\n", AX_MIGRATE_VER);
-
-	if (argc < 3) {
-		printf("Invalid parameter, usage: axmol-migrate <type> [--fuzzy] [--for-engine]  --source-dir <source_dir> [--filters .frag;.vert;.vsh;.fsh] [--use-ubo]\n\ttype: cpp, shader");
+	// all output goes through the logger, written by background thread
+	logger::start();
+	struct logger_guard {
+		~logger_guard() { logger::stop(); }
+	} _lg;
+
+	if (argc < 3 && !(argc == 2 && strcmp(argv[1], "serve") == 0)) {
+		logger::info("axmol-migrate version {}\n", AX_MIGRATE_VER);
+		print_usage();
 		return -1;
 	}
 
 	const char* type = argv[1];
+	ax_migrate_set_libclang_path(argv[0]);
 
 	// parse args
+	ax_migrate_options opts;
+	ax_migrate_options_init(&opts);
+	std::string filters;
 	bool migrateEngine = false;
+	const char* manifestFile = nullptr;
+	const char* indexFile = nullptr;
+	int debounceMs = 200;
+	const char* statsFile = nullptr;
+	int statsTopFiles = 10;
 	const char* sourceDir = nullptr;
-	auto&& filterList = strcmp(type, "cpp") == 0 ? std::vector<std::string_view>{".h", ".cpp", ".hpp", ".mm", ".m"} : std::vector<std::string_view>{ ".vert", ".frag", ".vsh", ".fsh" };
+	std::vector<const char*> inputs;
+	const char* sinceRev = nullptr;
+	const char* journalFile = nullptr;
+	const char* compileCommands = nullptr;
+	const char* pchDir = nullptr;
+	const char* cacheDir = nullptr;
+	const char* reportFile = nullptr;
+	int topLines = 20;
+	bool resume = false;
+	bool rollback = false;
 	for (int argi = 2; argi < argc; ++argi) {
 		if (strcmp(argv[argi], "--fuzzy") == 0) {
-			g_use_fuzzy_pattern = true;
+			opts.flags |= AX_MIGRATE_FUZZY;
+		}
+		else if (strcmp(argv[argi], "--lambdas") == 0) {
+			opts.flags |= AX_MIGRATE_LAMBDAS;
 		}
 		else if (strcmp(argv[argi], "--for-engine") == 0) {
 			migrateEngine = true;
@@ -679,7 +269,7 @@ int do_migrate(int argc, const char** argv)
 			if (argi < argc) {
 				sourceDir = argv[argi];
 				if (!stdfs::is_directory(sourceDir)) {
-					fprintf(stderr, "The source directory: %s not exist\n", sourceDir);
+					logger::error("The source directory: {} not exist", sourceDir);
 					return -1;
 				}
 			}
@@ -687,63 +277,502 @@ int do_migrate(int argc, const char** argv)
 		else if (strcmp(argv[argi], "--filters") == 0) {
 			++argi;
 			if (argi < argc) {
-				auto strFilters = argv[argi];
-				axstd::split_cb(strFilters, strlen(strFilters), ';', [&](const char* s, const char* e) {
-					std::string_view filter{s, static_cast<size_t>(e - s)};
-					if (!filter.empty() && std::find_if(filterList.begin(), filterList.end(), [=](const std::string_view& elem) {return cxx20::ic::iequals(elem, filter); }) == filterList.end()) {
-						filterList.emplace_back(filter);
-					}
-					});
+				if (!filters.empty())
+					filters.push_back(';');
+				filters += argv[argi];
 			}
 		}
 		else if (strcmp(argv[argi], "--use-ubo") == 0) {
-			g_use_ubo = true;
+			opts.flags |= AX_MIGRATE_USE_UBO;
+		}
+		else if (strcmp(argv[argi], "--trace") == 0) {
+			++argi;
+			if (argi < argc)
+				trace::start(argv[argi]);
+		}
+		else if (strcmp(argv[argi], "--stats") == 0) {
+			++argi;
+			if (argi < argc) {
+				if (strcmp(argv[argi], "json") != 0) {
+					logger::error("Invalid stats format: {}", argv[argi]);
+					return -1;
+				}
+				stats::enable(statsTopFiles);
+			}
+		}
+		else if (strcmp(argv[argi], "--stats-file") == 0) {
+			++argi;
+			if (argi < argc)
+				statsFile = argv[argi];
+		}
+		else if (strcmp(argv[argi], "--stats-top") == 0) {
+			++argi;
+			if (argi < argc)
+				statsTopFiles = atoi(argv[argi]);
+		}
+		else if (strcmp(argv[argi], "--jobs") == 0 || strcmp(argv[argi], "-j") == 0) {
+			++argi;
+			if (argi < argc) {
+				opts.jobs = atoi(argv[argi]); // <= 0: hardware concurrency
+			}
+		}
+		else if (strcmp(argv[argi], "--quiet") == 0) {
+			logger::set_level(logger::level::warn);
+		}
+		else if (strcmp(argv[argi], "--verbose") == 0) {
+			logger::set_level(logger::level::verbose);
+		}
+		else if (strcmp(argv[argi], "--manifest") == 0) {
+			++argi;
+			if (argi < argc)
+				manifestFile = argv[argi];
+		}
+		else if (strcmp(argv[argi], "--index") == 0) {
+			++argi;
+			if (argi < argc)
+				indexFile = argv[argi];
+		}
+		else if (strcmp(argv[argi], "--shard") == 0) {
+			++argi;
+			if (argi < argc) {
+				int index = 0, count = 0;
+				if (sscanf(argv[argi], "%d/%d", &index, &count) != 2 || index < 1 || index > count) {
+					logger::error("Invalid shard: {}, expected i/N and 1 <= i <= N", argv[argi]);
+					return -1;
+				}
+				opts.shard_index = index - 1;
+				opts.shard_count = count;
+			}
+		}
+		else if (strcmp(argv[argi], "--since") == 0) {
+			++argi;
+			if (argi < argc)
+				sinceRev = argv[argi];
+		}
+		else if (strcmp(argv[argi], "--compile-commands") == 0) {
+			++argi;
+			if (argi < argc)
+				compileCommands = argv[argi];
+		}
+		else if (strcmp(argv[argi], "--suggest-pch") == 0) {
+			++argi;
+			if (argi < argc)
+				pchDir = argv[argi];
+		}
+		else if (strcmp(argv[argi], "--cache") == 0) {
+			++argi;
+			if (argi < argc)
+				cacheDir = argv[argi];
+		}
+		else if (strcmp(argv[argi], "--report") == 0) {
+			++argi;
+			if (argi < argc)
+				reportFile = argv[argi];
+		}
+		else if (strcmp(argv[argi], "--top") == 0) {
+			++argi;
+			if (argi < argc)
+				topLines = atoi(argv[argi]);
+		}
+		else if (strcmp(argv[argi], "--journal") == 0) {
+			++argi;
+			if (argi < argc)
+				journalFile = argv[argi];
+		}
+		else if (strcmp(argv[argi], "--resume") == 0) {
+			resume = true;
 		}
+		else if (strcmp(argv[argi], "--rollback") == 0) {
+			rollback = true;
+		}
+		else if (strcmp(argv[argi], "--debounce") == 0) {
+			++argi;
+			if (argi < argc)
+				debounceMs = (std::max)(atoi(argv[argi]), 0);
+		}
+		else if (strcmp(argv[argi], "--time-startup") == 0) {
+			g_time_startup = true;
+		}
+		else if (strcmp(argv[argi], "--extractor") == 0) {
+			++argi;
+			if (argi < argc) {
+				if (strcmp(argv[argi], "lexer") == 0)
+					opts.extractor = AX_MIGRATE_EXTRACTOR_LEXER;
+				else if (strcmp(argv[argi], "tokens") == 0)
+					opts.extractor = AX_MIGRATE_EXTRACTOR_TOKENS;
+				else if (strcmp(argv[argi], "ast") == 0)
+					opts.extractor = AX_MIGRATE_EXTRACTOR_AST;
+				else {
+					logger::error("Invalid shader extractor: {}", argv[argi]);
+					return -1;
+				}
+			}
+		}
+		else if (argv[argi][0] != '-') {
+			inputs.push_back(argv[argi]);
+		}
+	}
+
+	if (stats::enabled())
+		stats::enable(statsTopFiles); // --stats-top may follow --stats
+	if (!filters.empty())
+		opts.filters = filters.c_str();
+	opts.compile_commands = compileCommands;
+	if (strcmp(type, "serve") == 0) {
+		logger::set_output(stderr);
+		logger::info("axmol-migrate version {}\n", AX_MIGRATE_VER);
+		return serve(opts, manifestFile, sourceDir);
+	}
+	logger::info("axmol-migrate version {}\n", AX_MIGRATE_VER);
+	auto runStart = std::chrono::steady_clock::now();
+
+	if ((resume || rollback) && !journalFile)
+		journalFile = "axmol-migrate.journal";
+	if (rollback) {
+		auto restored = ax_migrate_journal_rollback(journalFile);
+		if (restored < 0) {
+			logger::error("Rollback fail: {}", ax_migrate_last_error());
+			return -1;
+		}
+		logger::info("Rollback done, {} changes undone", restored);
+		return 0;
 	}
 
-	if (strcmp(type, "cpp") == 0) {
+	// the changes are journaled before made, an interrupted run may be resumed or rolled back
+	std::unique_ptr<ax_migrate_journal, decltype(&ax_migrate_journal_close)> journal{nullptr, ax_migrate_journal_close};
+	if (journalFile) {
+		journal.reset(ax_migrate_journal_open(journalFile, resume));
+		if (!journal) {
+			logger::error("{}", ax_migrate_last_error());
+			return -1;
+		}
+		opts.journal = journal.get();
+	}
+
+	// the files unchanged since the last run are skipped
+	struct manifest_holder {
+		~manifest_holder() { ax_migrate_manifest_free(manifest); }
+		ax_migrate_manifest* manifest = nullptr;
+	} manifest;
+	if (manifestFile) {
+		manifest.manifest = ax_migrate_manifest_create();
+		if (ax_migrate_manifest_load(manifest.manifest, manifestFile) < 0) {
+			logger::error("{}", ax_migrate_last_error());
+			return -1;
+		}
+		if (sourceDir)
+			ax_migrate_manifest_set_root(manifest.manifest, sourceDir);
+		opts.manifest = manifest.manifest;
+	}
+
+	// the include graph of the tree, updated by the files changed since saved
+	std::unique_ptr<ax_migrate_index, decltype(&ax_migrate_index_free)> index{nullptr, ax_migrate_index_free};
+	if (indexFile) {
+		if (!sourceDir) {
+			logger::error("--index needs the --source-dir it indexes");
+			return -1;
+		}
+		auto start = std::chrono::steady_clock::now();
+		index.reset(ax_migrate_index_open(&opts, sourceDir, indexFile));
+		if (!index) {
+			logger::error("{}", ax_migrate_last_error());
+			return -1;
+		}
+		int scanned = 0;
+		auto files = ax_migrate_index_size(index.get(), &scanned);
+		auto diff = std::chrono::steady_clock::now() - start;
+		logger::info("Include index {}: {} files, {} scanned, cost: {:.3f}(ms)", indexFile, files, scanned,
+			std::chrono::duration_cast<std::chrono::microseconds>(diff).count() / 1000.0);
+		opts.index = index.get();
+	}
+	cli_progress progress;
+
+	if (opts.shard_count > 1) {
+		logger::info("Shard {}/{}, migrating the files whose relative path hashes to it", opts.shard_index + 1, opts.shard_count);
+		stats::add("shard_index", opts.shard_index + 1);
+		stats::add("shard_count", opts.shard_count);
+	}
+
+	if (strcmp(type, "merge-manifests") == 0) {
+		// the fragments of shards into --manifest, the entries of later fragments win
+		if (!manifestFile) {
+			logger::error("No output manifest specified for to merge!");
+			return -1;
+		}
+		for (auto input : inputs) {
+			std::unique_ptr<ax_migrate_manifest, decltype(&ax_migrate_manifest_free)> fragment{ax_migrate_manifest_create(), ax_migrate_manifest_free};
+			if (!stdfs::is_regular_file(input) || ax_migrate_manifest_load(fragment.get(), input) < 0) {
+				logger::error("Invalid manifest fragment: {}", input);
+				return -1;
+			}
+			auto entries = ax_migrate_manifest_merge(manifest.manifest, fragment.get());
+			logger::info("Merged {}, entries: {}", input, entries);
+		}
+	}
+	else if (strcmp(type, "watch") == 0) {
+		if (!sourceDir) {
+			logger::error("Invalid source dir not specified for to watch!");
+			return -1;
+		}
+		// the files written by migrating are recorded, so their events are found unchanged
+		if (!manifest.manifest) {
+			manifest.manifest = ax_migrate_manifest_create();
+			ax_migrate_manifest_set_root(manifest.manifest, sourceDir);
+			opts.manifest = manifest.manifest;
+		}
+		if (watch(opts, sourceDir, debounceMs) < 0)
+			return -1;
+	}
+	else if (strcmp(type, "cpp") == 0) {
 
 		// perform migrate
 		if (!migrateEngine) {
 			if (!sourceDir) {
-				printf("Invalid source dir not specified for to migrate project of axmol engine!\n");
+				logger::error("Invalid source dir not specified for to migrate project of axmol engine!");
 				return -1;
 			}
-			printf("Migrating project sources in %s\n", sourceDir);
+			// the includes of all files are recorded while migrating for the pch
+			std::unique_ptr<ax_migrate_includes, decltype(&ax_migrate_includes_free)> includes{nullptr, ax_migrate_includes_free};
+			if (pchDir) {
+				if (sinceRev || opts.shard_count > 1) {
+					logger::error("--suggest-pch needs the includes of the whole tree, can't be used with {}", sinceRev ? "--since" : "--shard");
+					return -1;
+				}
+				includes.reset(ax_migrate_includes_create());
+				opts.includes = includes.get();
+			}
+			logger::info("Migrating project sources in {}", sourceDir);
 			auto start = std::chrono::steady_clock::now();
-			process_folder(sourceDir);
+			int replacedTotals = 0;
+			if (sinceRev) {
+				std::vector<std::string> files;
+				if (!git_changed_files(sourceDir, sinceRev, files))
+					return -1;
+				logger::info("{} files changed since {}", files.size(), sinceRev);
+				replacedTotals = migrate_files(opts, AX_MIGRATE_TYPE_CPP, files);
+			}
+			else
+				replacedTotals = migrate_tree(opts, AX_MIGRATE_TYPE_CPP, sourceDir, progress);
+			if (replacedTotals < 0)
+				return -1;
 			auto diff = std::chrono::steady_clock::now() - start;
-			printf("Migrate done, replaced totals: %d, total cost: %.3lf(ms)\n", replaced_totals,
+			logger::info("Migrate done, replaced totals: {}, total cost: {:.3f}(ms)", replacedTotals,
 				std::chrono::duration_cast<std::chrono::microseconds>(diff).count() / 1000.0);
+
+			if (pchDir) {
+				start = std::chrono::steady_clock::now();
+				auto headers = ax_migrate_suggest_pch(&opts, includes.get(), sourceDir, pchDir, 0);
+				if (headers < 0) {
+					logger::error("Suggest pch fail: {}", ax_migrate_last_error());
+					return -1;
+				}
+				diff = std::chrono::steady_clock::now() - start;
+				logger::info("Suggested pch of {} headers: {}/axmol_pch.h, {}/axmol_pch.cmake, cost: {:.3f}(ms)", headers, pchDir, pchDir,
+					std::chrono::duration_cast<std::chrono::microseconds>(diff).count() / 1000.0);
+			}
 		}
 		else {
 			if (!sourceDir) {
 				sourceDir = getenv("AX_ROOT");
 			}
 			if (!sourceDir || !stdfs::is_directory(sourceDir)) {
-				printf("No valid source dir to migrate axmol engine!\n");
+				logger::error("No valid source dir to migrate axmol engine!");
 				return -1;
 			}
 
-			printf("Migrating axmol engine sources in %s\n", sourceDir);
+			logger::info("Migrating axmol engine sources in {}", sourceDir);
 			auto start = std::chrono::steady_clock::now();
 
 			// 921 .h, .cpp, .mm, .m
-			process_folder(std::string { sourceDir } + "/core");
-			process_folder(std::string { sourceDir } + "/extensions");
-			process_folder(std::string { sourceDir } + "/tests");
+			int replacedTotals = 0;
+			if (sinceRev) {
+				std::vector<std::string> files;
+				if (!git_changed_files(sourceDir, sinceRev, files))
+					return -1;
+				auto root = stdfs::path{sourceDir}.generic_string();
+				while (root.size() > 1 && root.back() == '/')
+					root.pop_back();
+				std::erase_if(files, [&](const std::string& file) {
+					return !cxx20::starts_with(file, root + "/core/") && !cxx20::starts_with(file, root + "/extensions/") && !cxx20::starts_with(file, root + "/tests/");
+				});
+				logger::info("{} files changed since {}", files.size(), sinceRev);
+				replacedTotals = migrate_files(opts, AX_MIGRATE_TYPE_CPP, files);
+				if (replacedTotals < 0)
+					return -1;
+			}
+			for (auto subdir : {"/core", "/extensions", "/tests"}) {
+				if (sinceRev)
+					break;
+				auto hints = migrate_tree(opts, AX_MIGRATE_TYPE_CPP, std::string { sourceDir } + subdir, progress);
+				if (hints < 0)
+					return -1;
+				replacedTotals += hints;
+			}
 
 			auto diff = std::chrono::steady_clock::now() - start;
-			printf("Migrate done, replaced totals: %d, total cost: %.3lf(ms)\n", replaced_totals,
+			logger::info("Migrate done, replaced totals: {}, total cost: {:.3f}(ms)", replacedTotals,
 				std::chrono::duration_cast<std::chrono::microseconds>(diff).count() / 1000.0);
 		}
 	}
 	else if (strcmp(type, "shader") == 0)
 	{ // migrate glsl 100 to essl 310
-		if (sourceDir) {
-			migrate_shader_files_in_dir(sourceDir, filterList, argv);
+		if (sourceDir && sinceRev) {
+			std::vector<std::string> files;
+			if (!git_changed_files(sourceDir, sinceRev, files))
+				return -1;
+			logger::info("{} files changed since {}", files.size(), sinceRev);
+			if (migrate_files(opts, AX_MIGRATE_TYPE_SHADER, files) < 0)
+				return -1;
+		}
+		else if (sourceDir && migrate_tree(opts, AX_MIGRATE_TYPE_SHADER, sourceDir, progress) < 0) {
+			return -1;
 		}
 	}
+	else if (strcmp(type, "umbrella") == 0) {
+		// replace the umbrella includes by the headers used, parsed by libclang
+		if (!sourceDir) {
+			logger::error("Invalid source dir not specified for to decompose umbrella header!");
+			return -1;
+		}
+		logger::info("Decomposing umbrella includes in {}", sourceDir);
+		auto start = std::chrono::steady_clock::now();
+		int replacedTotals = 0;
+		if (sinceRev) {
+			std::vector<std::string> files;
+			if (!git_changed_files(sourceDir, sinceRev, files))
+				return -1;
+			replacedTotals = migrate_files(opts, AX_MIGRATE_TYPE_UMBRELLA, files);
+		}
+		else
+			replacedTotals = migrate_tree(opts, AX_MIGRATE_TYPE_UMBRELLA, sourceDir, progress);
+		if (replacedTotals < 0)
+			return -1;
+		auto diff = std::chrono::steady_clock::now() - start;
+		logger::info("Decompose done, replaced totals: {}, total cost: {:.3f}(ms)", replacedTotals,
+			std::chrono::duration_cast<std::chrono::microseconds>(diff).count() / 1000.0);
+	}
+	else if (strcmp(type, "semantic") == 0) {
+		// the API changes by the declarations referenced, parsed by libclang
+		if (!sourceDir) {
+			logger::error("Invalid source dir not specified for to rewrite API!");
+			return -1;
+		}
+		logger::info("Rewriting API in {}", sourceDir);
+		auto start = std::chrono::steady_clock::now();
+		int replacedTotals = 0;
+		if (sinceRev) {
+			std::vector<std::string> files;
+			if (!git_changed_files(sourceDir, sinceRev, files))
+				return -1;
+			replacedTotals = migrate_files(opts, AX_MIGRATE_TYPE_SEMANTIC, files);
+		}
+		else
+			replacedTotals = migrate_tree(opts, AX_MIGRATE_TYPE_SEMANTIC, sourceDir, progress);
+		if (replacedTotals < 0)
+			return -1;
+		auto diff = std::chrono::steady_clock::now() - start;
+		logger::info("Rewrite done, files rewritten: {}, total cost: {:.3f}(ms)", replacedTotals,
+			std::chrono::duration_cast<std::chrono::microseconds>(diff).count() / 1000.0);
+	}
+	else if (strcmp(type, "forward-decl") == 0) {
+		// replace the includes of headers used by pointers only by forward declarations, verified by libclang
+		if (!sourceDir) {
+			logger::error("Invalid source dir not specified for to forward declare includes!");
+			return -1;
+		}
+		if (sinceRev) {
+			logger::error("--since isn't supported by forward-decl, the edits are verified by all units of the tree");
+			return -1;
+		}
+		logger::info("Forward declaring includes in {}", sourceDir);
+		auto start = std::chrono::steady_clock::now();
+		auto replacedTotals = migrate_tree(opts, AX_MIGRATE_TYPE_FORWARD_DECL, sourceDir, progress);
+		if (replacedTotals < 0)
+			return -1;
+		auto diff = std::chrono::steady_clock::now() - start;
+		logger::info("Forward declare done, headers replaced: {}, total cost: {:.3f}(ms)", replacedTotals,
+			std::chrono::duration_cast<std::chrono::microseconds>(diff).count() / 1000.0);
+	}
+	else if (strcmp(type, "hoist") == 0) {
+		// cache the string keyed lookups of the per frame methods by member fields, parsed by libclang
+		if (!sourceDir) {
+			logger::error("Invalid source dir not specified for to hoist lookups!");
+			return -1;
+		}
+		if (sinceRev) {
+			logger::error("--since isn't supported by hoist, the fields of a class are named by all units of the tree");
+			return -1;
+		}
+		logger::info("Hoisting lookups in {}", sourceDir);
+		auto start = std::chrono::steady_clock::now();
+		auto replacedTotals = migrate_tree(opts, AX_MIGRATE_TYPE_HOIST, sourceDir, progress);
+		if (replacedTotals < 0)
+			return -1;
+		auto diff = std::chrono::steady_clock::now() - start;
+		logger::info("Hoist done, files rewritten: {}, total cost: {:.3f}(ms)", replacedTotals,
+			std::chrono::duration_cast<std::chrono::microseconds>(diff).count() / 1000.0);
+	}
+	else if (strcmp(type, "gl-commands") == 0) {
+		// convert the raw GL of the CustomCommand callbacks to the backend, parsed by libclang
+		if (!sourceDir) {
+			logger::error("Invalid source dir not specified for to convert GL commands!");
+			return -1;
+		}
+		logger::info("Converting GL commands in {}", sourceDir);
+		auto start = std::chrono::steady_clock::now();
+		int replacedTotals = 0;
+		if (sinceRev) {
+			std::vector<std::string> files;
+			if (!git_changed_files(sourceDir, sinceRev, files))
+				return -1;
+			replacedTotals = migrate_files(opts, AX_MIGRATE_TYPE_GL_COMMANDS, files);
+		}
+		else
+			replacedTotals = migrate_tree(opts, AX_MIGRATE_TYPE_GL_COMMANDS, sourceDir, progress);
+		if (replacedTotals < 0)
+			return -1;
+		auto diff = std::chrono::steady_clock::now() - start;
+		logger::info("Convert done, files rewritten: {}, total cost: {:.3f}(ms)", replacedTotals,
+			std::chrono::duration_cast<std::chrono::microseconds>(diff).count() / 1000.0);
+	}
+	else if (strcmp(type, "include-cost") == 0) {
+		// parse time of the headers by libclang, attributed to the include lines
+		if (!sourceDir) {
+			logger::error("Invalid source dir not specified for to profile include cost!");
+			return -1;
+		}
+		logger::info("Profiling include cost in {}", sourceDir);
+		auto start = std::chrono::steady_clock::now();
+		logger::begin_items();
+		auto lines = ax_migrate_include_cost(&opts, sourceDir, cacheDir, reportFile, topLines, on_progress, &progress);
+		if (lines < 0) {
+			logger::error("Profile include cost fail: {}", ax_migrate_last_error());
+			return -1;
+		}
+		auto diff = std::chrono::steady_clock::now() - start;
+		logger::info("Profile done, include lines: {}, total cost: {:.3f}(ms)", lines,
+			std::chrono::duration_cast<std::chrono::microseconds>(diff).count() / 1000.0);
+	}
+	else if (strcmp(type, "audit") == 0) {
+		// the per frame hot spots by libclang, reported as json
+		if (!sourceDir) {
+			logger::error("Invalid source dir not specified for to audit!");
+			return -1;
+		}
+		if (!reportFile)
+			reportFile = "axmol-audit.json";
+		logger::info("Auditing {}", sourceDir);
+		auto start = std::chrono::steady_clock::now();
+		logger::begin_items();
+		auto spots = ax_migrate_audit(&opts, sourceDir, reportFile, topLines, on_progress, &progress);
+		if (spots < 0) {
+			logger::error("Audit fail: {}", ax_migrate_last_error());
+			return -1;
+		}
+		auto diff = std::chrono::steady_clock::now() - start;
+		logger::info("Audit done, hot spots: {}, report: {}, total cost: {:.3f}(ms)", spots, reportFile,
+			std::chrono::duration_cast<std::chrono::microseconds>(diff).count() / 1000.0);
+	}
 	else if (strcmp(type, "code") == 0) {
 		auto axroot = getenv("AX_ROOT");
         if(axroot) { // batch modify axmol engine shaders.cpp sources to shader name
@@ -752,10 +781,9 @@ int do_migrate(int argc, const char** argv)
 			shaders_cpp += "core/renderer/Shaders.cpp";
 
 			auto lines = load_file_lines(shaders_cpp);
-			std::regex shader_varexp(R"([a-zA-Z_]+\w+(vert|frag)\b)");
 			for (auto& line : lines) {
 				std::match_results<std::string::const_iterator> results;
-				if (std::regex_search(line, results, shader_varexp))
+				if (std::regex_search(line, results, *shader_varexp))
 				{
 					auto& match = results[0];
 					auto first = match.first;
@@ -780,11 +808,37 @@ int do_migrate(int argc, const char** argv)
         }
 	}
 
+	if (manifestFile && ax_migrate_manifest_save(manifest.manifest, manifestFile) < 0) {
+		logger::error("{}", ax_migrate_last_error());
+		return -1;
+	}
+
+	if (g_time_startup)
+		report_startup();
+
+	if (stats::enabled()) {
+		auto runNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - runStart).count();
+		auto fp = statsFile ? fopen(statsFile, "wb") : stdout;
+		if (fp == stdout)
+			logger::flush(); // after the log
+		if (fp) {
+			stats::write_json(fp, AX_MIGRATE_VER, type, runNanos);
+			if (fp != stdout)
+				fclose(fp);
+		}
+		else
+			logger::error("Write stats file {} fail", statsFile);
+	}
+
+	if (trace::enabled() && !trace::stop())
+		logger::error("Write trace file fail");
+
 	return 0;
 }
 
 int main(int argc, const char** argv)
 {
+	g_main_start = std::chrono::steady_clock::now();
 	if (do_migrate(argc, argv) == 0)
 		return 0;
 #if defined(_DEBUG) || !defined(NDEBUG) // test only
@@ -803,6 +857,6 @@ int main(int argc, const char** argv)
 		if (stdfs::is_directory(ax_shader_root))
 		    do_migrate((int)ARRAYSIZE(test_args), test_args);
 	}
-	return 0;
 #endif
+	return 1; // seen by the scripts and git hooks running it
 }
@@ -0,0 +1,198 @@
+#pragma once
+
+// the state of a migrate call shared by the passes of libaxmigrate, not part of the C API
+#include "axmigrate.h"
+#include "base/axstd.h"
+#include "base/parallel.h"
+#include "base/stats.h"
+#include "base/manifest.h"
+#include "base/journal.h"
+#include "include-graph.h"
+#include "include-index.h"
+#include "yasio/string_view.hpp"
+#include "fmt/format.h"
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct ax_migrate_manifest {
+	manifest::table table;
+};
+
+struct ax_migrate_journal {
+	journal::log log;
+};
+
+struct ax_migrate_index {
+	include_index index;
+	int scanned = 0; // by the update of open
+};
+
+struct ax_migrate_includes {
+	std::mutex mutex;
+	include_graph graph; // of the c++ files
+	std::set<std::string> targets; // of add_executable and add_library
+};
+
+// the state of a call, the library keeps no globals so calls are re-entrant
+struct migrate_context {
+	bool fuzzy = false;
+	bool use_ubo = false;
+	bool dry_run = false;
+	bool lambdas = false;
+	manifest::table* manifest = nullptr;
+	journal::log* journal = nullptr; // not for dry run
+	int extractor = AX_MIGRATE_EXTRACTOR_LEXER;
+	int jobs = 1;
+	int shard_index = 0;
+	int shard_count = 1;
+	std::vector<std::string_view> filters;
+	std::string compile_commands; // build directory of compile_commands.json, empty if none
+	ax_migrate_includes* includes = nullptr; // the histogram of --suggest-pch, may be NULL
+	const include_index* index = nullptr; // the include graph of the tree, may be NULL
+	ax_migrate_progress_fn callback = nullptr;
+	void* user = nullptr;
+	int total = 0; // files of the tree
+	std::atomic<int> hints{0}; // files replaced or shaders converted
+
+	explicit migrate_context(const ax_migrate_options* opts) {
+		if (opts) {
+			fuzzy = (opts->flags & AX_MIGRATE_FUZZY) != 0;
+			use_ubo = (opts->flags & AX_MIGRATE_USE_UBO) != 0;
+			dry_run = (opts->flags & AX_MIGRATE_DRY_RUN) != 0;
+			lambdas = (opts->flags & AX_MIGRATE_LAMBDAS) != 0;
+			manifest = opts->manifest ? &opts->manifest->table : nullptr;
+			journal = opts->journal && !dry_run ? &opts->journal->log : nullptr;
+			includes = opts->includes;
+			index = opts->index ? &opts->index->index : nullptr;
+			if (opts->compile_commands)
+				compile_commands = opts->compile_commands;
+			extractor = opts->extractor;
+			jobs = opts->jobs > 0 ? opts->jobs : axstd::hardware_jobs();
+			if (opts->shard_count > 1) {
+				if (opts->shard_index < 0 || opts->shard_index >= opts->shard_count)
+					throw std::invalid_argument(fmt::format("invalid shard {} of {}", opts->shard_index, opts->shard_count));
+				shard_index = opts->shard_index;
+				shard_count = opts->shard_count;
+			}
+			if (opts->filters) {
+				axstd::split_cb(opts->filters, strlen(opts->filters), ';', [this](const char* s, const char* e) {
+					std::string_view filter{s, static_cast<size_t>(e - s)};
+					if (!filter.empty() && std::find_if(filters.begin(), filters.end(), [=](const std::string_view& elem) { return cxx20::ic::iequals(elem, filter); }) == filters.end())
+						filters.emplace_back(filter);
+					});
+			}
+		}
+	}
+
+	// whether the file of a tree belongs to this shard, by the hash of its path relative to the tree
+	bool in_shard(std::string_view path, size_t root_len) const {
+		if (shard_count <= 1)
+			return true;
+		auto rel = path.substr((std::min)(root_len, path.size()));
+		while (!rel.empty() && (rel.front() == '/' || rel.front() == '\\'))
+			rel.remove_prefix(1);
+		return static_cast<int>(manifest::hash_of(rel) % static_cast<uint64_t>(shard_count)) == shard_index;
+	}
+
+	// the options which affect the output, the manifest entries of other options don't match
+	int output_flags() const {
+		return (fuzzy ? AX_MIGRATE_FUZZY : 0) | (use_ubo ? AX_MIGRATE_USE_UBO : 0) | (lambdas ? AX_MIGRATE_LAMBDAS : 0);
+	}
+
+	void emit(int event, const char* path, int index, size_t size = 0, int lines = 0, const char* detail = nullptr) const {
+		if (callback) {
+			ax_migrate_progress progress{event, path, detail, index, total, size, lines};
+			callback(&progress, user);
+		}
+	}
+
+	// the journal entry of a write or removal, 0 if not journaled
+	uint64_t plan_write(std::string_view path) const { return journal ? journal->plan_write(path) : 0; }
+	uint64_t plan_write(std::string_view path, std::string_view original) const { return journal ? journal->plan_write(path, original) : 0; }
+	uint64_t plan_remove(std::string_view path) const { return journal ? journal->plan_remove(path) : 0; }
+	void commit(uint64_t id) const {
+		if (journal)
+			journal->commit(id);
+	}
+
+	// finished by an interrupted run, resume skips it
+	bool resumed(const char* path, int index) const {
+		if (!journal || !journal->finished(path))
+			return false;
+		stats::add("files_resumed");
+		emit(AX_MIGRATE_EVENT_UNCHANGED, path, index);
+		return true;
+	}
+};
+
+// marks a file finished in the journal unless migrating it throws
+struct journal_finish {
+	journal_finish(const migrate_context& ctx, const std::string& path) : _journal(ctx.journal), _path(path) {}
+	~journal_finish() {
+		if (_journal && std::uncaught_exceptions() == _exceptions)
+			_journal->finish(_path);
+	}
+
+	journal_finish(const journal_finish&) = delete;
+	journal_finish& operator=(const journal_finish&) = delete;
+
+private:
+	journal::log* _journal;
+	const std::string& _path;
+	int _exceptions = std::uncaught_exceptions();
+};
+
+// BEGIN and END events of a file, END is also sent when migrating fails
+struct file_events {
+	file_events(const migrate_context& ctx, const char* path, int index) : _ctx(ctx), _path(path), _index(index) {
+		_ctx.emit(AX_MIGRATE_EVENT_BEGIN, _path, _index);
+	}
+	~file_events() { _ctx.emit(AX_MIGRATE_EVENT_END, _path, _index); }
+
+	file_events(const file_events&) = delete;
+	file_events& operator=(const file_events&) = delete;
+
+private:
+	const migrate_context& _ctx;
+	const char* _path;
+	int _index;
+};
+
+// the passes of ax_migrate_tree and ax_migrate_files by type
+void process_folder(migrate_context& ctx, std::string_view sub_path);
+void migrate_shader_files_in_dir(migrate_context& ctx, std::string_view dir);
+void decompose_umbrella_in_dir(migrate_context& ctx, std::string_view dir);
+void decompose_umbrella_files(migrate_context& ctx, const std::vector<std::string>& paths);
+void forward_declare_in_dir(migrate_context& ctx, std::string_view dir);
+void rewrite_semantic_in_dir(migrate_context& ctx, std::string_view dir);
+void rewrite_semantic_files(migrate_context& ctx, const std::vector<std::string>& paths);
+void hoist_lookups_in_dir(migrate_context& ctx, std::string_view dir);
+void convert_gl_commands_in_dir(migrate_context& ctx, std::string_view dir);
+void convert_gl_commands_files(migrate_context& ctx, const std::vector<std::string>& paths);
+
+// rewrites the member callbacks of CC_CALLBACK_N and std::bind to lambdas, returns the number rewritten, out receives the
+// content rewritten if any
+int rewrite_callbacks(const std::string& content, std::string& out);
+
+// records the includes of a c++ file or the targets of a cmake file for ax_migrate_suggest_pch
+void record_includes(ax_migrate_includes& includes, const std::string& path, const std::vector<std::string_view>& chunks, bool is_cmake);
+
+// writes axmol_pch.h and axmol_pch.cmake to out_dir, returns the number of headers
+int suggest_pch(migrate_context& ctx, const ax_migrate_includes& includes, std::string_view dir, const std::string& out_dir, int max_headers);
+
+// logs the top include lines by the cost attributed, returns the number of lines
+int profile_include_cost(migrate_context& ctx, std::string_view dir, const std::string& cache_dir, const std::string& report, int top);
+
+// logs the top per frame hot spots by the schedules of their functions, returns the number of them
+int audit_hot_spots(migrate_context& ctx, std::string_view dir, const std::string& report, int top);
+
+std::string load_file(std::string_view path);
+void save_file(std::string_view path, const std::vector<std::string_view>& chunks);
@@ -0,0 +1,231 @@
+// ---------------------------------------- precompiled header suggestion
+// The cpp pass records the include directives of every c++ file and the targets of the cmake files it migrates. The
+// project includes are followed from each translation unit, the directives reaching out of the project are counted
+// once per unit, and the ones included by enough units are probed by libclang, a probe unit including just the header
+// is parsed and timed. The headers are ranked by units × parse cost, a header included by a higher ranked one already
+// is dropped, and the rest is written to axmol_pch.h with a cmake snippet applying it to the targets found.
+#include "migrate-context.h"
+#include "clang-api.h"
+#include "include-graph.h"
+#include "base/trace.h"
+#include "base/logger.h"
+#include <ctype.h>
+#include <filesystem>
+#include <map>
+#include <unordered_set>
+
+namespace stdfs = std::filesystem;
+
+namespace {
+	constexpr int default_max_headers = 16;
+	constexpr int probes_per_header = 4; // candidates probed per header suggested at most
+
+	// the targets of add_executable(name ...) and add_library(name ...), not the imported, interface or alias ones
+	void collect_targets(std::string_view content, std::set<std::string>& targets) {
+		auto next_word = [&](size_t& pos) {
+			while (pos < content.size() && is_space(content[pos]))
+				++pos;
+			auto start = pos;
+			while (pos < content.size() && !is_space(content[pos]) && content[pos] != ')' && content[pos] != '(')
+				++pos;
+			return content.substr(start, pos - start);
+		};
+		for (auto command : {"add_executable", "add_library"}) {
+			auto command_len = strlen(command);
+			for (size_t pos = 0; pos < content.size();) {
+				auto found = std::search(content.begin() + pos, content.end(), command, command + command_len,
+					[](char a, char b) { return ::tolower(static_cast<unsigned char>(a)) == b; });
+				if (found == content.end())
+					break;
+				pos = static_cast<size_t>(found - content.begin()) + command_len;
+				if (found != content.begin() && (isalnum(static_cast<unsigned char>(found[-1])) || found[-1] == '_'))
+					continue; // i.e. ax_add_executable
+				while (pos < content.size() && is_space(content[pos]))
+					++pos;
+				if (pos == content.size() || content[pos] != '(')
+					continue;
+				++pos;
+				auto name = next_word(pos);
+				auto kind = next_word(pos);
+				if (name.empty() || kind == "IMPORTED" || kind == "INTERFACE" || kind == "ALIAS")
+					continue;
+				targets.emplace(name);
+			}
+		}
+	}
+
+	// a header out of the project reached by the units, probed by libclang
+	struct candidate {
+		std::string directive;
+		const std::string* unit = nullptr; // a unit reaching it, for the compile command
+		int units = 0;
+		header_cost cost;
+		bool ok = false;
+
+		double score() const { return units * cost.parse_ms; }
+	};
+
+	class pch_suggester {
+	public:
+		pch_suggester(const migrate_context& ctx, const ax_migrate_includes& includes, std::string root)
+			: _ctx(ctx), _graph(includes.graph), _root(std::move(root)) {
+			if (!_ctx.compile_commands.empty() && !_db.load(_ctx.compile_commands))
+				throw std::runtime_error(fmt::format("No compile_commands.json in {}", _ctx.compile_commands));
+		}
+
+		int units() const { return _units; }
+
+		// the external directives of each unit, counted once per unit
+		std::vector<candidate> count() {
+			TRACE_SCOPE("pch_count");
+			std::map<std::string, candidate> counted;
+			for (auto& file : _graph.files()) {
+				auto& unit = file.first;
+				if (!is_translation_unit(unit))
+					continue;
+				++_units;
+				std::unordered_set<const std::string*> reached;
+				std::set<std::string> external;
+				_graph.reach(unit, reached, &external);
+				for (auto& directive : external) {
+					auto& entry = counted[directive];
+					if (!entry.unit) {
+						entry.directive = directive;
+						entry.unit = &unit;
+					}
+					++entry.units;
+				}
+			}
+			std::vector<candidate> candidates;
+			for (auto& entry : counted)
+				candidates.push_back(std::move(entry.second));
+			return candidates;
+		}
+
+		// the cost is the parse time of a unit including just the header
+		void probe(candidate& cand) const {
+			auto args = _db.args_of(*cand.unit);
+			if (args.empty())
+				args = clang::default_args(*cand.unit, _root);
+			if (!measure_header(_root + "axmol_pch_probe.cpp", cand.directive, args, cand.cost)) {
+				logger::verbose("Probing {} for the pch fail: {}", cand.directive, cand.cost.error);
+				return;
+			}
+			// a header of the project changes too often to be precompiled
+			cand.ok = !cxx20::starts_with(cand.cost.path, _root);
+		}
+
+	private:
+		const migrate_context& _ctx;
+		const include_graph& _graph;
+		std::string _root; // with trailing '/'
+		clang::compile_commands _db;
+		int _units = 0;
+	};
+
+	void write_text(const std::string& path, const std::string& text) {
+		auto fp = fopen(path.c_str(), "wb");
+		if (!fp)
+			throw std::runtime_error(fmt::format("write {} fail", path));
+		auto written = fwrite(text.data(), 1, text.size(), fp);
+		if (fclose(fp) != 0 || written != text.size())
+			throw std::runtime_error(fmt::format("write {} fail", path));
+	}
+
+	std::string pch_header(const std::vector<const candidate*>& chosen, int units) {
+		std::string text = "// generated by axmol-migrate --suggest-pch, the headers out of the project included by most of its\n"
+						   "// translation units, ranked by the units including them times their parse cost measured by libclang\n"
+						   "#pragma once\n"
+						   "#if defined(__cplusplus)\n";
+		for (auto cand : chosen)
+			text += fmt::format("#include {} // units: {}/{}, parse: {:.1f}(ms), includes: {}\n", cand->directive, cand->units, units, cand->cost.parse_ms, cand->cost.includes.size());
+		text += "#endif\n";
+		return text;
+	}
+
+	std::string pch_cmake(const std::set<std::string>& targets) {
+		std::string text = "# generated by axmol-migrate --suggest-pch, include() it after the targets are defined\n";
+		if (targets.empty()) {
+			text += "# no target found in the CMakeLists.txt migrated, add the pch to yours:\n"
+					"# target_precompile_headers(<target> PRIVATE \"${CMAKE_CURRENT_LIST_DIR}/axmol_pch.h\")\n";
+			return text;
+		}
+		text += "foreach(_ax_pch_target IN ITEMS";
+		for (auto& target : targets)
+			text += ' ' + target;
+		text += ")\n"
+				"    if(TARGET ${_ax_pch_target})\n"
+				"        target_precompile_headers(${_ax_pch_target} PRIVATE \"${CMAKE_CURRENT_LIST_DIR}/axmol_pch.h\")\n"
+				"    endif()\n"
+				"endforeach()\n";
+		return text;
+	}
+}
+
+void record_includes(ax_migrate_includes& includes, const std::string& path, const std::vector<std::string_view>& chunks, bool is_cmake) {
+	std::string content;
+	for (auto& chunk : chunks)
+		content += chunk;
+	if (is_cmake) {
+		std::set<std::string> targets;
+		collect_targets(content, targets);
+		std::lock_guard<std::mutex> lck(includes.mutex);
+		includes.targets.insert(targets.begin(), targets.end());
+		return;
+	}
+
+	auto directives = include_directives_of(content);
+	auto abspath = normalize_path(path);
+	std::lock_guard<std::mutex> lck(includes.mutex);
+	includes.graph.set(abspath, std::move(directives));
+}
+
+int suggest_pch(migrate_context& ctx, const ax_migrate_includes& includes, std::string_view dir, const std::string& out_dir, int max_headers) {
+	if (!clang::ensure_lib())
+		throw std::runtime_error("libclang is required to measure the parse cost of the headers");
+	if (max_headers <= 0)
+		max_headers = default_max_headers;
+
+	pch_suggester suggester(ctx, includes, root_of(dir));
+	auto candidates = suggester.count();
+	auto units = suggester.units();
+
+	// a header of a quarter of the units at least, the most included ones are probed
+	auto min_units = (std::max)(2, (units + 3) / 4);
+	std::erase_if(candidates, [=](const candidate& cand) { return cand.units < min_units; });
+	std::sort(candidates.begin(), candidates.end(), [](const candidate& lhs, const candidate& rhs) {
+		return lhs.units != rhs.units ? lhs.units > rhs.units : lhs.directive < rhs.directive;
+	});
+	if (candidates.size() > static_cast<size_t>(max_headers) * probes_per_header)
+		candidates.resize(static_cast<size_t>(max_headers) * probes_per_header);
+	stats::add("pch_units", units);
+	stats::add("pch_probes", static_cast<int64_t>(candidates.size()));
+	axstd::parallel_for(candidates.size(), ctx.jobs, [&](size_t index) { suggester.probe(candidates[index]); });
+
+	// by score, the headers included by a higher ranked one are covered by it already, the ones spelled
+	// differently resolve to the same path
+	std::vector<const candidate*> ranked;
+	for (auto& cand : candidates)
+		if (cand.ok)
+			ranked.push_back(&cand);
+	std::stable_sort(ranked.begin(), ranked.end(), [](const candidate* lhs, const candidate* rhs) { return lhs->score() > rhs->score(); });
+	std::vector<const candidate*> chosen;
+	for (auto cand : ranked) {
+		if (chosen.size() >= static_cast<size_t>(max_headers))
+			break;
+		auto covered = std::any_of(chosen.begin(), chosen.end(), [=](const candidate* prev) {
+			return prev->cost.path == cand->cost.path || prev->cost.includes_file(cand->cost.path);
+		});
+		if (covered)
+			continue;
+		std::erase_if(chosen, [=](const candidate* prev) { return cand->cost.includes_file(prev->cost.path); });
+		chosen.push_back(cand);
+	}
+	stats::add("pch_headers", static_cast<int64_t>(chosen.size()));
+
+	std::error_code ec;
+	stdfs::create_directories(out_dir, ec);
+	write_text(out_dir + "/axmol_pch.h", pch_header(chosen, units));
+	write_text(out_dir + "/axmol_pch.cmake", pch_cmake(includes.targets));
+	return static_cast<int>(chosen.size());
+}
@@ -0,0 +1,439 @@
+// ---------------------------------------- semantic rewrite
+// The API changes the include rules can't see, driven by the cursors of libclang instead of text: a reference is
+// rewritten by the engine name of the declaration it resolves to, i.e. a TypeRef of cocos2d::GLView, whatever it's
+// spelled as, and not a class of the project named alike. The rules are the tables below, by the name without the
+// engine namespace.
+//
+// The units are parsed in parallel by unit_parser, the ones sharing their first include, usually cocos2d.h or axmol.h,
+// on a precompiled header of it. The edits of a unit are collected for its file and the project headers it reaches,
+// a header by the lowest unit index having edits of it, and applied when all units are parsed by the CXRewriter of a
+// single file parse, so no unit reads a file half rewritten.
+#include "migrate-context.h"
+#include "clang-api.h"
+#include "include-graph.h"
+#include "unit-parser.h"
+#include "base/trace.h"
+#include "base/logger.h"
+#include <map>
+#include <mutex>
+
+namespace {
+	struct rename_rule {
+		std::string_view from; // the engine name, without cocos2d:: or ax::
+		std::string_view to;
+	};
+
+	// the types by TypeRef, qualified as spelled
+	const rename_rule type_renames[] = {
+		{"GLProgram", "backend::Program"},
+		{"GLProgramState", "ProgramState"},
+		{"GLView", "RenderView"},
+		{"GLViewImpl", "RenderViewImpl"},
+		{"Texture2D::PixelFormat", "backend::PixelFormat"},
+		{"Point", "Vec2"},
+	};
+
+	// the enumerators renamed, the others of a type renamed move with it
+	const rename_rule enumerator_renames[] = {
+		{"Texture2D::PixelFormat::RGBA8888", "backend::PixelFormat::RGBA8"},
+		{"Texture2D::PixelFormat::RGB888", "backend::PixelFormat::RGB8"},
+		{"Texture2D::PixelFormat::RGBA4444", "backend::PixelFormat::RGBA4"},
+		{"Texture2D::PixelFormat::I8", "backend::PixelFormat::L8"},
+		{"Texture2D::PixelFormat::AI88", "backend::PixelFormat::LA8"},
+	};
+
+	// the member name of a call or a reference
+	const rename_rule method_renames[] = {
+		{"Director::getOpenGLView", "getRenderView"},
+		{"Director::setOpenGLView", "setRenderView"},
+	};
+
+	// the whole call by a template of the arguments, {0} is the first, parenthesized unless a primary expression
+	const rename_rule call_rewrites[] = {
+		{"ccp", "Vec2({0}, {1})"},
+		{"ccpAdd", "({0} + {1})"},
+		{"ccpSub", "({0} - {1})"},
+		{"ccpMult", "({0} * {1})"},
+		{"ccpNeg", "(-{0})"},
+		{"ccpDot", "{0}.dot({1})"},
+		{"ccpCross", "{0}.cross({1})"},
+		{"ccpLength", "{0}.length()"},
+		{"ccpLengthSQ", "{0}.lengthSquared()"},
+		{"ccpDistance", "{0}.distance({1})"},
+		{"ccpDistanceSQ", "{0}.distanceSquared({1})"},
+		{"ccpNormalize", "{0}.getNormalized()"},
+		{"ccpMidpoint", "{0}.getMidpoint({1})"},
+		{"ccpRotateByAngle", "{0}.rotateByAngle({1}, {2})"},
+		{"ccpToAngle", "{0}.getAngle()"},
+		{"ccpForAngle", "Vec2::forAngle({0})"},
+	};
+
+	// the virtual methods taking std::string_view instead of const std::string&, the overrides must follow
+	const std::string_view string_view_overrides[] = {
+		"Node::setName",
+		"LabelProtocol::setString",
+		"Label::setString",
+		"ui::Text::setString",
+		"ui::TextField::setString",
+		"ui::Button::setTitleText",
+		"Sprite::initWithFile",
+		"Sprite::initWithSpriteFrameName",
+	};
+
+	const rename_rule* find_rule(const rename_rule* first, const rename_rule* last, std::string_view name) {
+		auto it = std::find_if(first, last, [=](const rename_rule& rule) { return rule.from == name; });
+		return it != last ? it : nullptr;
+	}
+
+	template <size_t N>
+	const rename_rule* find_rule(const rename_rule (&rules)[N], std::string_view name) {
+		return find_rule(rules, rules + N, name);
+	}
+
+	// an argument of a call template needs no parentheses, a name, a member or a call
+	bool is_primary(std::string_view text) {
+		int depth = 0;
+		for (size_t i = 0; i < text.size(); ++i) {
+			auto ch = text[i];
+			if (ch == '(' || ch == '[')
+				++depth;
+			else if (ch == ')' || ch == ']')
+				--depth;
+			else if (depth == 0 && !is_ident(ch) && ch != '.' && ch != ':' && !(ch == '-' && i + 1 < text.size() && text[i + 1] == '>') &&
+					 !(ch == '>' && i > 0 && text[i - 1] == '-'))
+				return false;
+		}
+		return !text.empty();
+	}
+
+	std::string format_call(std::string_view tmpl, const std::vector<std::string>& args) {
+		std::string text;
+		for (size_t i = 0; i < tmpl.size(); ++i) {
+			if (tmpl[i] == '{' && i + 2 < tmpl.size() && tmpl[i + 2] == '}' && isdigit(static_cast<unsigned char>(tmpl[i + 1]))) {
+				auto& arg = args[tmpl[i + 1] - '0'];
+				text += is_primary(arg) ? arg : fmt::format("({})", arg);
+				i += 2;
+			}
+			else
+				text.push_back(tmpl[i]);
+		}
+		return text;
+	}
+
+	size_t template_args(std::string_view tmpl) {
+		size_t count = 0;
+		for (size_t i = 0; i + 2 < tmpl.size(); ++i)
+			if (tmpl[i] == '{' && tmpl[i + 2] == '}' && isdigit(static_cast<unsigned char>(tmpl[i + 1])))
+				count = (std::max)(count, static_cast<size_t>(tmpl[i + 1] - '0' + 1));
+		return count;
+	}
+
+	// the edits of a unit, by post-order visit so an edit composes the edits within it
+	class unit_rewriter {
+	public:
+		explicit unit_rewriter(const unit_parser& parser) : _files(parser) {}
+
+		void visit(CXTranslationUnit unit) { clang::visitChildren(clang::getTranslationUnitCursor(unit), visit_child, this); }
+
+		// the edits by file, sorted
+		std::map<std::string, std::vector<text_edit>> take_edits() {
+			std::map<std::string, std::vector<text_edit>> edits;
+			for (auto& file : _edits)
+				if (!file.second.empty())
+					edits.emplace(file.first, std::move(file.second));
+			return edits;
+		}
+
+	private:
+		static CXChildVisitResult visit_child(CXCursor cursor, CXCursor, CXClientData data) {
+			auto self = static_cast<unit_rewriter*>(data);
+			CXFile file = nullptr;
+			clang::getSpellingLocation(clang::getCursorLocation(cursor), &file, nullptr, nullptr, nullptr);
+			if (!file || !self->_files.file_of(file).project)
+				return CXChildVisit_Continue; // the engine and system headers
+			clang::visitChildren(cursor, visit_child, data);
+			self->rewrite(cursor);
+			return CXChildVisit_Continue;
+		}
+
+		file_text* spelled_at(CXSourceLocation loc, unsigned& offset) { return _files.spelled_at(loc, offset); }
+
+		file_text* extent_of(CXCursor cursor, unsigned& begin, unsigned& end) { return _files.extent_of(cursor, begin, end); }
+
+		// an edit replaces the edits within it, one overlapping others partly is dropped
+		void add_edit(const file_text& file, unsigned begin, unsigned end, std::string text) {
+			auto& edits = _edits[file.path];
+			for (auto& prev : edits) {
+				bool within = prev.begin >= begin && prev.end <= end;
+				if (!within && prev.begin < end && begin < prev.end) {
+					stats::add("semantic_edits_overlapped");
+					return;
+				}
+			}
+			std::erase_if(edits, [=](const text_edit& prev) { return prev.begin >= begin && prev.end <= end; });
+			auto pos = std::lower_bound(edits.begin(), edits.end(), begin, [](const text_edit& prev, unsigned offset) { return prev.begin < offset; });
+			edits.insert(pos, text_edit{begin, end, std::move(text)});
+		}
+
+		// the text of a range with the edits within it
+		std::string text_of(const file_text& file, unsigned begin, unsigned end) {
+			std::string text;
+			auto cur = begin;
+			for (auto& prev : _edits[file.path]) {
+				if (prev.begin < begin || prev.end > end)
+					continue;
+				text.append(file.content, cur, prev.begin - cur);
+				text += prev.text;
+				cur = prev.end;
+			}
+			text.append(file.content, cur, end - cur);
+			return text;
+		}
+
+		// the begin of the nested name specifier before a name, i.e. cocos2d::Texture2D:: of PixelFormat
+		static unsigned qualifier_begin(std::string_view content, unsigned begin) {
+			for (;;) {
+				auto pos = begin;
+				while (pos > 0 && is_space(content[pos - 1]))
+					--pos;
+				if (pos < 2 || content[pos - 1] != ':' || content[pos - 2] != ':')
+					return begin;
+				pos -= 2;
+				while (pos > 0 && is_space(content[pos - 1]))
+					--pos;
+				auto ident = pos;
+				while (ident > 0 && is_ident(content[ident - 1]))
+					--ident;
+				begin = ident;
+				if (ident == pos)
+					return begin; // the global ::
+			}
+		}
+
+		// a name qualified as spelled, a fully qualified one stays fully qualified by ax::
+		void replace_qualified(const file_text& file, unsigned begin, unsigned end, std::string_view to) {
+			auto qualifier = qualifier_begin(file.content, begin);
+			auto spelled = std::string_view{file.content}.substr(qualifier, begin - qualifier);
+			auto head = spelled.substr(0, spelled.find(':'));
+			while (!head.empty() && is_space(head.back()))
+				head.remove_suffix(1);
+			bool global = !spelled.empty() && (head.empty() || head == "cocos2d" || head == "ax"); // not axis:: or axutil::
+			add_edit(file, qualifier, end, fmt::format("{}{}", global ? "ax::" : "", to));
+		}
+
+		void rewrite(CXCursor cursor) {
+			switch (clang::getCursorKind(cursor)) {
+			case CXCursor_TypeRef:
+				rewrite_type(cursor);
+				break;
+			case CXCursor_DeclRefExpr:
+			case CXCursor_MemberRefExpr:
+				rewrite_reference(cursor);
+				break;
+			case CXCursor_CallExpr:
+				rewrite_call(cursor);
+				break;
+			case CXCursor_CXXMethod:
+				rewrite_override(cursor);
+				break;
+			default:
+				break;
+			}
+		}
+
+		void rewrite_type(CXCursor cursor) {
+			auto rule = find_rule(type_renames, engine_name(clang::getCursorReferenced(cursor)));
+			unsigned begin = 0, end = 0;
+			if (!rule)
+				return;
+			if (auto file = extent_of(cursor, begin, end)) {
+				replace_qualified(*file, begin, end, rule->to);
+				stats::add("semantic_types_renamed");
+			}
+		}
+
+		void rewrite_reference(CXCursor cursor) {
+			auto referenced = clang::getCursorReferenced(cursor);
+			auto kind = clang::getCursorKind(referenced);
+			if (kind == CXCursor_EnumConstantDecl) {
+				auto name = engine_name(referenced);
+				std::string to;
+				if (auto rule = find_rule(enumerator_renames, name))
+					to = rule->to;
+				else if (auto rule = find_rule(type_renames, engine_name(clang::getCursorSemanticParent(referenced))))
+					to = fmt::format("{}::{}", rule->to, clang::to_string(clang::getCursorSpelling(referenced)));
+				unsigned begin = 0, end = 0;
+				if (to.empty())
+					return;
+				if (auto file = extent_of(cursor, begin, end)) {
+					auto nameBegin = end - static_cast<unsigned>(name.size() - name.find_last_of(':') - 1);
+					replace_qualified(*file, nameBegin, end, to);
+					stats::add("semantic_enumerators_renamed");
+				}
+			}
+			else if (kind == CXCursor_CXXMethod || kind == CXCursor_FunctionDecl) {
+				auto rule = find_rule(method_renames, engine_name(referenced));
+				unsigned begin = 0;
+				if (!rule)
+					return;
+				auto file = spelled_at(clang::getCursorLocation(cursor), begin);
+				auto name = clang::to_string(clang::getCursorSpelling(referenced));
+				if (file && std::string_view{file->content}.substr(begin, name.size()) == name) {
+					add_edit(*file, begin, begin + static_cast<unsigned>(name.size()), std::string{rule->to});
+					stats::add("semantic_methods_renamed");
+				}
+			}
+		}
+
+		void rewrite_call(CXCursor cursor) {
+			auto rule = find_rule(call_rewrites, engine_name(clang::getCursorReferenced(cursor)));
+			if (!rule)
+				return;
+			int count = clang::Cursor_getNumArguments(cursor);
+			if (count < 0 || static_cast<size_t>(count) != template_args(rule->to))
+				return; // an overload the template isn't for
+			unsigned begin = 0, end = 0;
+			auto file = extent_of(cursor, begin, end);
+			if (!file)
+				return;
+			std::vector<std::string> args;
+			for (int i = 0; i < count; ++i) {
+				unsigned argBegin = 0, argEnd = 0;
+				if (extent_of(clang::Cursor_getArgument(cursor, i), argBegin, argEnd) != file || argBegin < begin || argEnd > end)
+					return; // an argument of a macro
+				args.push_back(text_of(*file, argBegin, argEnd));
+			}
+			add_edit(*file, begin, end, format_call(rule->to, args));
+			stats::add("semantic_calls_rewritten");
+		}
+
+		static bool overrides_string_view(CXCursor method) {
+			CXCursor* overridden = nullptr;
+			unsigned count = 0;
+			clang::getOverriddenCursors(method, &overridden, &count);
+			bool found = false;
+			for (unsigned i = 0; i < count && !found; ++i) {
+				auto name = engine_name(overridden[i]);
+				found = std::find(std::begin(string_view_overrides), std::end(string_view_overrides), name) != std::end(string_view_overrides) ||
+						overrides_string_view(overridden[i]);
+			}
+			if (overridden)
+				clang::disposeOverriddenCursors(overridden);
+			return found;
+		}
+
+		// the std::string parameters of an override of a method taking std::string_view now
+		void rewrite_override(CXCursor cursor) {
+			if (!overrides_string_view(clang::getCanonicalCursor(cursor)))
+				return;
+			clang::visitChildren(cursor, [](CXCursor param, CXCursor, CXClientData data) {
+				if (clang::getCursorKind(param) != CXCursor_ParmDecl)
+					return CXChildVisit_Continue;
+				auto self = static_cast<unit_rewriter*>(data);
+				auto type = clang::to_string(clang::getTypeSpelling(clang::getCanonicalType(clang::getCursorType(param))));
+				if (type.find("basic_string<char") == std::string::npos || type.find('*') != std::string::npos ||
+					(type.back() == '&' && !cxx20::starts_with(type, "const ")))
+					return CXChildVisit_Continue; // an output parameter
+				unsigned begin = 0, end = 0, name = 0;
+				auto file = self->extent_of(param, begin, end);
+				if (!file || self->spelled_at(clang::getCursorLocation(param), name) != file)
+					return CXChildVisit_Continue;
+				bool named = name > begin && name < end;
+				self->add_edit(*file, begin, named ? name : end, named ? "std::string_view " : "std::string_view");
+				stats::add("semantic_parameters_changed");
+				return CXChildVisit_Continue;
+			}, this);
+		}
+
+		unit_files _files;
+		std::map<std::string, std::vector<text_edit>> _edits; // by file
+	};
+
+	class semantic_pass {
+	public:
+		semantic_pass(migrate_context& ctx, std::string root) : _ctx(ctx), _parser(ctx, std::move(root)) {}
+
+		void prepare(const std::vector<std::string>& units) { _parser.prepare(units); }
+
+		void parse_unit(const std::string& path, int index) {
+			TRACE_SCOPE("semantic_parse", path);
+			file_events _fe(_ctx, path.c_str(), index);
+			std::string error;
+			auto unit = _parser.parse(index, error);
+			if (!unit) {
+				_ctx.emit(AX_MIGRATE_EVENT_WARNING, path.c_str(), index, 0, 0, error.empty() ? "parse fail" : error.c_str());
+				return;
+			}
+			unit_rewriter rewriter(_parser);
+			rewriter.visit(unit);
+			clang::disposeTranslationUnit(unit);
+
+			// a file is rewritten by the edits of its own unit, a header by the ones of the lowest unit index having any,
+			// whichever unit is parsed first
+			auto edits = rewriter.take_edits();
+			std::lock_guard<std::mutex> lck(_mutex);
+			for (auto& file : edits) {
+				auto owner = file.first == path ? -1 : index;
+				auto it = _edits.find(file.first);
+				if (it == _edits.end())
+					_edits.emplace(file.first, file_edits{owner, std::move(file.second)});
+				else if (owner < it->second.owner)
+					it->second = file_edits{owner, std::move(file.second)};
+			}
+		}
+
+		// the edits applied by CXRewriter, on a parse of the file alone, the files are numbered after the units
+		void rewrite_all(int units) {
+			TRACE_SCOPE("semantic_rewrite");
+			std::vector<const std::pair<const std::string, file_edits>*> files;
+			for (auto& file : _edits)
+				files.push_back(&file);
+			_ctx.total = units + static_cast<int>(files.size());
+			axstd::parallel_for(files.size(), _ctx.jobs, [&](size_t index) {
+				rewrite(files[index]->first, files[index]->second.edits, units + static_cast<int>(index));
+			});
+		}
+
+	private:
+		struct file_edits {
+			int owner; // the unit index, -1 by the unit of the file itself
+			std::vector<text_edit> edits;
+		};
+
+		void rewrite(const std::string& path, const std::vector<text_edit>& edits, int index) {
+			TRACE_SCOPE("semantic_rewrite_file", path);
+			file_events _fe(_ctx, path.c_str(), index);
+			if (!rewrite_file(_ctx, path, edits, index))
+				return;
+			++_ctx.hints;
+			stats::add("semantic_edits", static_cast<int64_t>(edits.size()));
+			_ctx.emit(AX_MIGRATE_EVENT_REPLACED, path.c_str(), index, 0, static_cast<int>(edits.size()), "semantic");
+		}
+
+		migrate_context& _ctx;
+		unit_parser _parser;
+		std::mutex _mutex;
+		std::map<std::string, file_edits> _edits; // by file
+	};
+
+	void rewrite_units(migrate_context& ctx, const std::string& root, const std::vector<std::string>& units) {
+		if (!clang::ensure_lib())
+			throw std::runtime_error("libclang is required to rewrite by the semantic");
+		if (!clang::CXRewriter_create)
+			throw std::runtime_error("the libclang loaded has no CXRewriter, libclang 11 or later is required");
+		semantic_pass pass(ctx, root);
+		pass.prepare(units);
+		ctx.total = static_cast<int>(units.size());
+		axstd::parallel_for(units.size(), ctx.jobs, [&](size_t index) { pass.parse_unit(units[index], static_cast<int>(index)); });
+		pass.rewrite_all(static_cast<int>(units.size()));
+	}
+}
+
+void rewrite_semantic_in_dir(migrate_context& ctx, std::string_view dir) {
+	auto units = scan_tree(dir, is_translation_unit);
+	rewrite_units(ctx, root_of(dir), units);
+}
+
+void rewrite_semantic_files(migrate_context& ctx, const std::vector<std::string>& paths) {
+	rewrite_units(ctx, root_of_files(), translation_units_of(paths));
+}
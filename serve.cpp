@@ -0,0 +1,380 @@
+// axmol-migrate serve: migrate requests of editors and build tools as newline-delimited JSON-RPC 2.0 on stdin/stdout.
+// The process stays resident, so the compiled patterns, libclang and its per-thread index, and the manifest are warm
+// for every request after the first, the log goes to stderr.
+//
+// methods:
+//   initialize                                           -> {name, version, methods}
+//   migrate {paths:[...] | dir, type?, options?}         -> {dryRun, migrated, files:[{path, status, lines?, detail?}]}
+//   check   {paths:[...] | dir, type?, options?}         -> same as migrate, but nothing is written
+//   migrateBuffer {text, kind, path?, options?}          -> {changed, lines, text}
+//   checkBuffer   {text, kind, path?, options?}          -> {changed, lines}
+//   saveManifest                                         -> {entries}
+//   shutdown                                             -> null, saves the manifest, then exits
+//
+//   type: cpp (default) | shader | umbrella | semantic, kind: cpp | cmake | shader
+//   options: {fuzzy, useUbo, lambdas, extractor: lexer|tokens|ast, jobs, filters: ".cpp;.glsl", manifest: true,
+//             compileCommands: "<build dir>"}
+#include "axmigrate.h"
+#include "base/json.h"
+#include "base/logger.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+	constexpr int parse_error = -32700;
+	constexpr int invalid_request = -32600;
+	constexpr int method_not_found = -32601;
+	constexpr int invalid_params = -32602;
+	constexpr int migrate_failed = -32000;
+
+	struct rpc_error : std::runtime_error {
+		rpc_error(int code, const std::string& message) : std::runtime_error(message), code(code) {}
+		int code;
+	};
+
+	// the file events of a migrate request, ordered by file as serial run
+	struct file_collector {
+		struct item {
+			int index;
+			int seq;
+			std::string path;
+			const char* status;
+			int lines;
+			std::string detail;
+		};
+		std::mutex mtx;
+		std::vector<item> items;
+
+		static void on_progress(const ax_migrate_progress* progress, void* user) {
+			const char* status = nullptr;
+			switch (progress->event) {
+			case AX_MIGRATE_EVENT_REPLACED: status = "replaced"; break;
+			case AX_MIGRATE_EVENT_SKIPPED: status = "skipped"; break;
+			case AX_MIGRATE_EVENT_UNCHANGED: status = "unchanged"; break;
+			case AX_MIGRATE_EVENT_CONVERTED: status = "converted"; break;
+			case AX_MIGRATE_EVENT_WARNING: status = "warning"; break;
+			default: return;
+			}
+			auto collector = static_cast<file_collector*>(user);
+			std::lock_guard<std::mutex> lck(collector->mtx);
+			collector->items.push_back(item{progress->index, static_cast<int>(collector->items.size()), progress->path, status,
+				progress->lines, progress->event == AX_MIGRATE_EVENT_WARNING && progress->detail ? progress->detail : ""});
+		}
+
+		void append_json(std::string& out) {
+			std::sort(items.begin(), items.end(), [](const item& lhs, const item& rhs) {
+				return lhs.index != rhs.index ? lhs.index < rhs.index : lhs.seq < rhs.seq;
+			});
+			out.push_back('[');
+			for (auto& it : items) {
+				if (&it != &items.front())
+					out.push_back(',');
+				out += "{\"path\":";
+				json::append_quoted(out, it.path);
+				out += ",\"status\":\"";
+				out += it.status;
+				out.push_back('"');
+				if (it.lines)
+					out += ",\"lines\":" + std::to_string(it.lines);
+				if (!it.detail.empty()) {
+					out += ",\"detail\":";
+					json::append_quoted(out, it.detail);
+				}
+				out.push_back('}');
+			}
+			out.push_back(']');
+		}
+	};
+
+	struct server {
+		ax_migrate_options defaults;
+		ax_migrate_manifest* manifest = nullptr;
+		std::string manifest_path;
+		bool running = true;
+
+		// the strings referred by ax_migrate_options of a request
+		struct option_strings {
+			std::string filters;
+			std::string compile_commands;
+		};
+
+		// the options of request override the ones of command line
+		ax_migrate_options options_of(const json::value& params, option_strings& strings) const {
+			auto opts = defaults;
+			opts.manifest = manifest;
+			auto options = params.find("options");
+			if (!options)
+				return opts;
+			if (!options->is_object())
+				throw rpc_error(invalid_params, "options must be an object");
+			auto set_flag = [&](std::string_view key, int flag) {
+				if (options->find(key))
+					opts.flags = options->get_bool(key) ? (opts.flags | flag) : (opts.flags & ~flag);
+			};
+			set_flag("fuzzy", AX_MIGRATE_FUZZY);
+			set_flag("useUbo", AX_MIGRATE_USE_UBO);
+			set_flag("lambdas", AX_MIGRATE_LAMBDAS);
+			auto extractor = options->get_string("extractor");
+			if (extractor == "lexer")
+				opts.extractor = AX_MIGRATE_EXTRACTOR_LEXER;
+			else if (extractor == "tokens")
+				opts.extractor = AX_MIGRATE_EXTRACTOR_TOKENS;
+			else if (extractor == "ast")
+				opts.extractor = AX_MIGRATE_EXTRACTOR_AST;
+			else if (!extractor.empty())
+				throw rpc_error(invalid_params, "invalid extractor");
+			opts.jobs = static_cast<int>(options->get_number("jobs", opts.jobs));
+			if (options->find("filters")) {
+				strings.filters = options->get_string("filters");
+				opts.filters = strings.filters.c_str();
+			}
+			if (!options->get_bool("manifest", true))
+				opts.manifest = nullptr;
+			if (options->find("compileCommands")) {
+				strings.compile_commands = options->get_string("compileCommands");
+				opts.compile_commands = strings.compile_commands.c_str();
+			}
+			return opts;
+		}
+
+		std::string migrate(const json::value& params, bool dry_run) {
+			option_strings strings;
+			auto opts = options_of(params, strings);
+			if (dry_run)
+				opts.flags |= AX_MIGRATE_DRY_RUN;
+
+			auto type_name = params.get_string("type", "cpp");
+			int type = 0;
+			if (type_name == "cpp")
+				type = AX_MIGRATE_TYPE_CPP;
+			else if (type_name == "shader")
+				type = AX_MIGRATE_TYPE_SHADER;
+			else if (type_name == "umbrella")
+				type = AX_MIGRATE_TYPE_UMBRELLA;
+			else if (type_name == "semantic")
+				type = AX_MIGRATE_TYPE_SEMANTIC;
+			else if (type_name == "gl-commands")
+				type = AX_MIGRATE_TYPE_GL_COMMANDS;
+			else
+				throw rpc_error(invalid_params, "invalid type");
+
+			file_collector collector;
+			int migrated = 0;
+			if (auto paths = params.find("paths")) {
+				if (!paths->is_array())
+					throw rpc_error(invalid_params, "paths must be an array");
+				std::vector<const char*> files;
+				for (auto& path : paths->items) {
+					if (!path.is_string())
+						throw rpc_error(invalid_params, "paths must be strings");
+					files.push_back(path.string.c_str());
+				}
+				migrated = ax_migrate_files(&opts, type, files.data(), static_cast<int>(files.size()), file_collector::on_progress, &collector);
+			}
+			else if (auto dir = params.find("dir"); dir && dir->is_string())
+				migrated = ax_migrate_tree(&opts, type, dir->string.c_str(), file_collector::on_progress, &collector);
+			else
+				throw rpc_error(invalid_params, "paths or dir required");
+			if (migrated < 0)
+				throw rpc_error(migrate_failed, ax_migrate_last_error());
+
+			std::string result = "{\"dryRun\":";
+			result += dry_run ? "true" : "false";
+			result += ",\"migrated\":" + std::to_string(migrated) + ",\"files\":";
+			collector.append_json(result);
+			result.push_back('}');
+			return result;
+		}
+
+		std::string migrate_buffer(const json::value& params, bool with_text) {
+			option_strings strings;
+			auto opts = options_of(params, strings);
+			auto text = params.find("text");
+			if (!text || !text->is_string())
+				throw rpc_error(invalid_params, "text required");
+			auto kind = params.get_string("kind", "cpp");
+
+			char* out = nullptr;
+			size_t out_size = 0;
+			int lines = 0;
+			if (kind == "cpp" || kind == "cmake")
+				lines = ax_migrate_cpp_buffer(&opts, text->string.data(), text->string.size(), kind == "cmake", &out, &out_size);
+			else if (kind == "shader") {
+				std::string path{params.get_string("path", "shader.vert")};
+				// converted as a whole, no lines
+				lines = ax_migrate_shader_buffer(&opts, text->string.data(), text->string.size(), path.c_str(), &out, &out_size) < 0 ? -1 : 0;
+			}
+			else
+				throw rpc_error(invalid_params, "invalid kind");
+			if (lines < 0)
+				throw rpc_error(migrate_failed, ax_migrate_last_error());
+
+			std::string_view migrated{out, out_size};
+			std::string result = "{\"changed\":";
+			result += migrated != text->string ? "true" : "false";
+			result += ",\"lines\":" + std::to_string(lines);
+			if (with_text) {
+				result += ",\"text\":";
+				json::append_quoted(result, migrated);
+			}
+			result.push_back('}');
+			ax_migrate_free(out);
+			return result;
+		}
+
+		std::string save_manifest() {
+			if (manifest_path.empty())
+				throw rpc_error(invalid_request, "no manifest file, start the server with --manifest <path>");
+			auto entries = ax_migrate_manifest_save(manifest, manifest_path.c_str());
+			if (entries < 0)
+				throw rpc_error(migrate_failed, ax_migrate_last_error());
+			return "{\"entries\":" + std::to_string(entries) + "}";
+		}
+
+		std::string dispatch(std::string_view method, const json::value& params) {
+			if (method == "initialize") {
+				std::string result = "{\"name\":\"axmol-migrate\",\"version\":";
+				json::append_quoted(result, ax_migrate_version());
+				result += ",\"methods\":[\"migrate\",\"check\",\"migrateBuffer\",\"checkBuffer\",\"saveManifest\",\"shutdown\"]}";
+				return result;
+			}
+			if (method == "migrate")
+				return migrate(params, false);
+			if (method == "check")
+				return migrate(params, true);
+			if (method == "migrateBuffer")
+				return migrate_buffer(params, true);
+			if (method == "checkBuffer")
+				return migrate_buffer(params, false);
+			if (method == "saveManifest")
+				return save_manifest();
+			if (method == "shutdown" || method == "exit") {
+				running = false;
+				if (!manifest_path.empty())
+					save_manifest();
+				return "null";
+			}
+			throw rpc_error(method_not_found, "method not found");
+		}
+
+		// returns the response, empty for notifications
+		std::string handle(const json::value& request) {
+			const json::value* id = request.is_object() ? request.find("id") : nullptr;
+			std::string response;
+			try {
+				auto method = request.is_object() ? request.find("method") : nullptr;
+				if (!method || !method->is_string())
+					throw rpc_error(invalid_request, "invalid request");
+				static const json::value no_params = [] {
+					json::value params;
+					params.type = json::value::kind::object;
+					return params;
+				}();
+				auto params = request.find("params");
+				if (params && !params->is_object())
+					throw rpc_error(invalid_params, "params must be an object");
+				auto result = dispatch(method->string, params ? *params : no_params);
+				if (!id)
+					return {};
+				response = "{\"jsonrpc\":\"2.0\",\"id\":";
+				json::append(response, *id);
+				response += ",\"result\":" + result + "}";
+			}
+			catch (const rpc_error& ex) {
+				response = error_response(id, ex.code, ex.what());
+			}
+			catch (const std::exception& ex) {
+				response = error_response(id, migrate_failed, ex.what());
+			}
+			return response;
+		}
+
+		static std::string error_response(const json::value* id, int code, std::string_view message) {
+			std::string response = "{\"jsonrpc\":\"2.0\",\"id\":";
+			if (id)
+				json::append(response, *id);
+			else
+				response += "null";
+			response += ",\"error\":{\"code\":" + std::to_string(code) + ",\"message\":";
+			json::append_quoted(response, message);
+			response += "}}";
+			return response;
+		}
+
+		void reply(const std::string& response) {
+			if (response.empty())
+				return;
+			fwrite(response.data(), response.size(), 1, stdout);
+			fputc('\n', stdout);
+			fflush(stdout);
+		}
+	};
+}
+
+// serves until shutdown or stdin closed, returns 0 if the manifest is saved or not used, the manifest is keyed by the
+// paths relative to source_dir if given
+int serve(const ax_migrate_options& defaults, const char* manifest_path, const char* source_dir) {
+	// stdout carries the responses only
+	logger::set_output(stderr);
+
+	server svr;
+	svr.defaults = defaults;
+	svr.manifest = ax_migrate_manifest_create();
+	struct manifest_guard {
+		~manifest_guard() { ax_migrate_manifest_free(manifest); }
+		ax_migrate_manifest* manifest;
+	} _mg { svr.manifest };
+	ax_migrate_manifest_set_root(svr.manifest, source_dir);
+	if (manifest_path) {
+		svr.manifest_path = manifest_path;
+		auto entries = ax_migrate_manifest_load(svr.manifest, manifest_path);
+		if (entries < 0) {
+			logger::error("{}", ax_migrate_last_error());
+			return -1;
+		}
+		logger::info("Loaded manifest {}, {} entries", manifest_path, entries);
+	}
+	logger::info("Serving JSON-RPC on stdin");
+
+	std::string line;
+	while (svr.running && std::getline(std::cin, line)) {
+		if (line.find_first_not_of(" \t\r") == std::string::npos)
+			continue;
+		json::value request;
+		if (!json::parse(line, request)) {
+			svr.reply(server::error_response(nullptr, parse_error, "parse error"));
+			continue;
+		}
+		if (!request.is_array()) {
+			svr.reply(svr.handle(request));
+			continue;
+		}
+		// batch
+		if (request.items.empty()) {
+			svr.reply(server::error_response(nullptr, invalid_request, "empty batch"));
+			continue;
+		}
+		std::string responses;
+		for (auto& item : request.items) {
+			auto response = svr.handle(item);
+			if (response.empty())
+				continue;
+			responses.push_back(responses.empty() ? '[' : ',');
+			responses += response;
+		}
+		if (!responses.empty())
+			svr.reply(responses + "]");
+	}
+
+	if (svr.running && !svr.manifest_path.empty() && ax_migrate_manifest_save(svr.manifest, svr.manifest_path.c_str()) < 0) {
+		logger::error("{}", ax_migrate_last_error());
+		return -1;
+	}
+	return 0;
+}
@@ -0,0 +1,249 @@
+// extract shader sources embedded in c++ string literals without libclang, i.e.
+//   const char* positionTexture_frag = R"(...)";
+//   const char* ccPosition_uColor_frag = "\n"
+//   "#ifdef GL_ES\n"
+//   ...;
+// also the lines continued by a backslash at their end within a literal
+#include <string.h>
+#include <stdint.h>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <set>
+#include "yasio/string_view.hpp"
+#include "cxx-lexer.h"
+
+using namespace std::string_view_literals;
+
+namespace {
+	void append_utf8(std::string& out, uint32_t cp) {
+		if (cp < 0x80)
+			out.push_back(static_cast<char>(cp));
+		else if (cp < 0x800) {
+			out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+			out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+		}
+		else if (cp < 0x10000) {
+			out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+			out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+			out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+		}
+		else {
+			out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+			out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+			out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+			out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+		}
+	}
+
+	int hex_value(char ch) {
+		if (ch >= '0' && ch <= '9') return ch - '0';
+		if (ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+		if (ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+		return -1;
+	}
+
+	// decode a string literal token (with prefix, quotes and optional ud-suffix) and append to out
+	void decode_string_literal(std::string_view tok, std::string& out) {
+		auto quote = tok.find('"');
+		auto last = tok.rfind('"');
+		if (quote == std::string_view::npos || last <= quote)
+			return;
+		auto prefix = tok.substr(0, quote);
+		if (!prefix.empty() && prefix.back() == 'R') { // R"delim(...)delim"
+			auto paren = tok.find('(', quote);
+			if (paren == std::string_view::npos)
+				return;
+			auto delimLen = paren - quote - 1;
+			auto contentLast = last - delimLen - 1; // position of ')'
+			if (contentLast > paren)
+				out.append(tok.data() + paren + 1, contentLast - paren - 1);
+			return;
+		}
+
+		auto ptr = tok.data() + quote + 1;
+		auto end = tok.data() + last;
+		while (ptr < end) {
+			char ch = *ptr++;
+			if (ch != '\\' || ptr == end) {
+				out.push_back(ch);
+				continue;
+			}
+			ch = *ptr++;
+			switch (ch) {
+			case '\r': // line splice
+				if (ptr < end && *ptr == '\n')
+					++ptr;
+				break;
+			case '\n': break;
+			case 'n': out.push_back('\n'); break;
+			case 't': out.push_back('\t'); break;
+			case 'r': out.push_back('\r'); break;
+			case 'a': out.push_back('\a'); break;
+			case 'b': out.push_back('\b'); break;
+			case 'f': out.push_back('\f'); break;
+			case 'v': out.push_back('\v'); break;
+			case 'x': {
+				uint32_t value = 0;
+				int digit;
+				while (ptr < end && (digit = hex_value(*ptr)) != -1) {
+					value = (value << 4) | digit;
+					++ptr;
+				}
+				out.push_back(static_cast<char>(value));
+				break;
+			}
+			case 'u':
+			case 'U': {
+				uint32_t value = 0;
+				int ndigits = ch == 'u' ? 4 : 8;
+				int digit;
+				while (ndigits-- > 0 && ptr < end && (digit = hex_value(*ptr)) != -1) {
+					value = (value << 4) | digit;
+					++ptr;
+				}
+				append_utf8(out, value);
+				break;
+			}
+			default:
+				if (ch >= '0' && ch <= '7') { // octal, up to 3 digits
+					uint32_t value = ch - '0';
+					for (int i = 0; i < 2 && ptr < end && *ptr >= '0' && *ptr <= '7'; ++i)
+						value = (value << 3) | (*ptr++ - '0');
+					out.push_back(static_cast<char>(value));
+				}
+				else // \\ \" \' \?
+					out.push_back(ch);
+			}
+		}
+	}
+
+	bool is_class_key(std::string_view ident) {
+		return ident == "namespace"sv || ident == "class"sv || ident == "struct"sv || ident == "union"sv || ident == "enum"sv;
+	}
+}
+
+/*
+* Find var decls initialized by string literals at namespace scope (or static class members),
+* concatenated literals are joined and escapes decoded. Literals mixed with macros or other
+* expressions can't be resolved by lexing, in that case -1 returned and the caller should
+* use libclang instead.
+* @returns the number of decls extracted, or -1 if ambiguous
+*/
+int extract_shader_literals(std::string_view source, std::vector<std::pair<std::string, std::string>>& decls) {
+	CxxLexer lexer{source};
+	lexer.lex();
+
+	auto& tokens = lexer.tokens;
+	enum BraceKind { bkNamespace, bkClass, bkBlock };
+	std::vector<BraceKind> braces;
+	size_t stmtStart = 0; // first token of current statement
+	int parenDepth = 0;
+	bool ambiguous = false;
+
+	auto inScope = [&]() {
+		for (auto kind : braces)
+			if (kind == bkBlock)
+				return false;
+		return true;
+	};
+
+	auto stmtHas = [&](size_t last, std::string_view ident) {
+		for (size_t k = stmtStart; k < last; ++k)
+			if (tokens[k].kind == CxxToken::Ident && tokens[k].text == ident)
+				return true;
+		return false;
+	};
+
+	for (size_t i = 0; i < tokens.size(); ++i) {
+		auto& tok = tokens[i];
+		if (tok.kind == CxxToken::Punct) {
+			auto ch = tok.text[0];
+			if (tok.text.size() == 1 && (ch == '(' || ch == '['))
+				++parenDepth;
+			else if (tok.text.size() == 1 && (ch == ')' || ch == ']'))
+				parenDepth = (std::max)(parenDepth - 1, 0);
+			else if (ch == '{') {
+				auto kind = bkBlock;
+				for (size_t k = stmtStart; k < i && kind == bkBlock; ++k) {
+					auto& text = tokens[k].text;
+					if (tokens[k].kind == CxxToken::Ident) {
+						if (text == "namespace"sv || (text == "extern"sv && k + 1 < i && tokens[k + 1].kind == CxxToken::String))
+							kind = bkNamespace;
+						else if (is_class_key(text))
+							kind = bkClass;
+					}
+					else if (text == "="sv || text == ")"sv)
+						break;
+				}
+				braces.push_back(kind);
+				stmtStart = i + 1;
+				parenDepth = 0;
+			}
+			else if (ch == '}') {
+				if (!braces.empty())
+					braces.pop_back();
+				stmtStart = i + 1;
+			}
+			else if (ch == ';' && parenDepth == 0)
+				stmtStart = i + 1;
+			else if (tok.text == "="sv && parenDepth == 0 && i > 0 && inScope()) {
+				// var name: ident [ = ] or ident[N] [ = ]
+				size_t nameIdx = i - 1;
+				if (tokens[nameIdx].text == "]"sv) {
+					while (nameIdx > stmtStart && tokens[nameIdx].text != "["sv)
+						--nameIdx;
+					if (nameIdx == stmtStart)
+						continue;
+					--nameIdx;
+				}
+				if (tokens[nameIdx].kind != CxxToken::Ident || nameIdx == stmtStart)
+					continue; // not a decl or no type specifier
+				if (!braces.empty() && braces.back() == bkClass && !stmtHas(nameIdx, "static"sv))
+					continue; // default member initializer
+
+				// initializer until ',' or ';' of this declarator
+				size_t j = i + 1;
+				int depth = 0;
+				bool hasString = false, onlyStrings = true;
+				for (; j < tokens.size(); ++j) {
+					auto& init = tokens[j];
+					if (init.kind == CxxToken::Punct) {
+						auto c = init.text[0];
+						if (c == '(' || c == '[' || c == '{')
+							++depth;
+						else if (c == ')' || c == ']' || c == '}') {
+							if (--depth < 0)
+								break;
+						}
+						else if (depth == 0 && (c == ',' || c == ';'))
+							break;
+						onlyStrings = false;
+					}
+					else if (init.kind == CxxToken::String)
+						hasString = true;
+					else {
+						// ident of macro makes the literal ambiguous, i.e. STRINGIFY(...) or SHADER_HEADER "..."
+						if (init.kind == CxxToken::Ident && (lexer.macros.count(init.text) || (j + 1 < tokens.size() && tokens[j + 1].text == "("sv)))
+							hasString = true;
+						onlyStrings = false;
+					}
+				}
+
+				if (hasString) {
+					if (onlyStrings) {
+						std::string code;
+						for (size_t k = i + 1; k < j; ++k)
+							decode_string_literal(tokens[k].text, code);
+						decls.emplace_back(std::string{tokens[nameIdx].text}, std::move(code));
+					}
+					else
+						ambiguous = true;
+				}
+				i = j - 1;
+			}
+		}
+	}
+	return !ambiguous ? static_cast<int>(decls.size()) : -1;
+}
@@ -10,40 +10,44 @@
 #include "yasio/string_view.hpp"
 #include "yasio/object_pool.hpp"
 #include "xxhash/xxhash.h"
+#include "base/lazy_regex.h"
+#include "base/trace.h"
 
 using namespace std::string_view_literals;
 
 
 // GLSL100 shader language regex expressions
-static const std::regex attribute_decl_exp(R"(attribute\s+.*)", std::regex_constants::ECMAScript);
-static const std::regex varying_decl_exp(R"(varying\s+.*)", std::regex_constants::ECMAScript);
-static const std::regex uniform_decl_exp(R"(uniform\s+.*)", std::regex_constants::ECMAScript);
-static const std::regex sampler_decl_exp(R"(uniform\s+(sampler2D|samplerCube)\s+.*)", std::regex_constants::ECMAScript); // sampler2D or samplerCube
-static const std::regex var_name_exp(R"([\w_]+[a-zA-Z0-9_]*\s*(\[\s*[\w_]+[a-zA-Z0-9_]\s*\]\s*)?;)", std::regex_constants::ECMAScript);
-static const std::regex remove_var_array_exp(R"([\w_]+[a-zA-Z0-9_]*\s*;)", std::regex_constants::ECMAScript);
-static const std::regex func_decl_exp(R"([\w_]+[a-zA-Z0-9_]*\s+[\w_]+[a-zA-Z0-9_]*\s*\(.*\))", std::regex_constants::ECMAScript);
-static const std::regex main_decl_exp(R"(void\s+main\s*\()", std::regex_constants::ECMAScript);
-static const std::regex pp_define_exp(R"(#\s*define\s+.+)", std::regex_constants::ECMAScript);
-static const std::regex pp_block_if(R"(#\s*if)", std::regex_constants::ECMAScript);
-static const std::regex pp_block_elif(R"(#\s*elif)", std::regex_constants::ECMAScript);
-static const std::regex pp_block_else(R"(#\s*else)", std::regex_constants::ECMAScript);
-static const std::regex pp_block_endif(R"(#\s*endif)", std::regex_constants::ECMAScript);
-static const std::regex c_symbol_exp(R"([\w_]+[a-zA-Z0-9_]*)", std::regex_constants::ECMAScript);
+// only the match start is used, so no trailing '.*', the identifiers start at '\b', otherwise
+// the search retries from every char of a long word
+static const axstd::lazy_regex attribute_decl_exp(R"(attribute\s+)");
+static const axstd::lazy_regex varying_decl_exp(R"(varying\s+)");
+static const axstd::lazy_regex uniform_decl_exp(R"(uniform\s+)");
+static const axstd::lazy_regex sampler_decl_exp(R"(uniform\s+(sampler2D|samplerCube)\s+)"); // sampler2D or samplerCube
+static const axstd::lazy_regex var_name_exp(R"(\b\w+\s*(\[\s*\w\w+\s*\]\s*)?;)");
+static const axstd::lazy_regex remove_var_array_exp(R"(\b\w+\s*;)");
+static const axstd::lazy_regex func_decl_exp(R"(\b\w+\s+\w+\s*\()"); // and a ')' follows
+static const axstd::lazy_regex main_decl_exp(R"(void\s+main\s*\()");
+static const axstd::lazy_regex pp_define_exp(R"(#\s*define\s+\S)");
+static const axstd::lazy_regex pp_block_if(R"(#\s*if)");
+static const axstd::lazy_regex pp_block_elif(R"(#\s*elif)");
+static const axstd::lazy_regex pp_block_else(R"(#\s*else)");
+static const axstd::lazy_regex pp_block_endif(R"(#\s*endif)");
+static const axstd::lazy_regex c_symbol_exp(R"(\w+)");
 
 // vec4 sample = texture
-static const std::regex reserved_sample_decl_expr(R"(vec4\s+sample\s*=)", std::regex_constants::ECMAScript);
-static const std::regex reserved_sample_ref_expr(R"(.*=\s*sample\s*\.)", std::regex_constants::ECMAScript);
+static const axstd::lazy_regex reserved_sample_decl_expr(R"(vec4\s+sample\s*=)");
+static const axstd::lazy_regex reserved_sample_ref_expr(R"(=\s*sample\s*\.)");
 
-static const std::regex sample_texture2d_exp(R"(texture2D\s*\()", std::regex_constants::ECMAScript);
-static const std::regex sample_texturecube_exp(R"(.*=.*\s*textureCube\s*\()", std::regex_constants::ECMAScript);
+static const axstd::lazy_regex sample_texture2d_exp(R"(texture2D\s*\()");
+static const axstd::lazy_regex sample_texturecube_exp(R"(textureCube\s*\()"); // searched after the first '=', '.*=.*' is cubic
 
-static const std::regex gl_FragColor_exp(R"(gl_FragColor)", std::regex_constants::ECMAScript);
+static const axstd::lazy_regex gl_FragColor_exp(R"(gl_FragColor)");
 
 // preprocesser check
 /*
 * #if XXX > YYY XXX < YYY XXX == YYY XXX <= YYY XXX >= YYY
 */
-static const std::regex pp_cond_expr(R"([\w_]+[a-zA-Z0-9_]*\s*(<|>|==))");
+static const axstd::lazy_regex pp_cond_expr(R"(\b\w+\s*(<|>|==))");
 /*
 * uniform block: the name of uniform block must not same between vert and .frag
 *   uniform block naming rule:
@@ -85,7 +89,7 @@ struct ASTNode {
 	}
 };
 
-yasio::object_pool<ASTNode> _pool;
+thread_local yasio::object_pool<ASTNode> _pool; // per thread, shaders are migrated in parallel
 
 struct GlslParseContext {
 
@@ -166,16 +170,19 @@ struct GlslParseContext {
 
 			size_t matchOffset = 0;
 
-			if (line.length() > 1) {
+			if (line.length() > axstd::regex_max_subject) { // data table or minified code, keep it
+				createNode(line, _stack.top());
+			}
+			else if (line.length() > 1) {
 				std::match_results<std::string_view::const_iterator> results;
-				if (std::regex_search(line.begin(), line.end(), results, attribute_decl_exp)) { // vert: attribute ...
+				if (std::regex_search(line.begin(), line.end(), results, *attribute_decl_exp)) { // vert: attribute ...
 					std::string mutableLine = getMatchedMutableLine(results, line, matchOffset);
 					mutableLine.replace(matchOffset, sizeof("attribute") - 1, "in"); //
 					insertLocation(mutableLine, _curInLoc);
 					replace_precision_qualifiers(mutableLine);
 					createNode(cachestr(mutableLine), _stack.top());
 				}
-				else if (std::regex_search(line.begin(), line.end(), results, varying_decl_exp)) { // vert/frag: varying ...
+				else if (std::regex_search(line.begin(), line.end(), results, *varying_decl_exp)) { // vert/frag: varying ...
 					std::string mutableLine = getMatchedMutableLine(results, line, matchOffset);
 
 					mutableLine.replace(matchOffset, sizeof("varying") - 1, !_is_frag ? "out" : "in");
@@ -186,40 +193,41 @@ struct GlslParseContext {
 					replace_precision_qualifiers(mutableLine);
 					createNode(cachestr(mutableLine), _stack.top());
 				}
-				else if (std::regex_search(line.begin(), line.end(), results, sampler_decl_exp)) { // frag sampler2D or samplerCube
+				else if (std::regex_search(line.begin(), line.end(), results, *sampler_decl_exp)) { // frag sampler2D or samplerCube
 					std::string mutableLine = getMatchedMutableLine(results, line, matchOffset);
 					mutableLine.insert(0, fmt::format("layout(binding = {}) ", _samplerBindingIndex++));
 					createNode(cachestr(mutableLine), _stack.top());
 				}
-				else if (std::regex_search(line.begin(), line.end(), results, sample_texture2d_exp)) { // texture2D(
+				else if (std::regex_search(line.begin(), line.end(), results, *sample_texture2d_exp)) { // texture2D(
 					std::string mutableLine = getMatchedMutableLine(results, line, matchOffset);
 					replace(mutableLine, "texture2D", "texture");
 					replace_once(mutableLine, "sample", "texColor");
 					replace_once(mutableLine, "gl_FragColor", "FragColor");
 					createNode(cachestr(mutableLine), _stack.top());
 				}
-				else if (std::regex_search(line.begin(), line.end(), results, sample_texturecube_exp)) { // textureCube(
+				else if (auto eq = line.find('='); eq != std::string_view::npos &&
+					std::regex_search(line.begin() + eq, line.end(), results, *sample_texturecube_exp)) { // xxx = textureCube(
 					std::string mutableLine = getMatchedMutableLine(results, line, matchOffset);
 					replace(mutableLine, "textureCube", "texture");
 					replace_once(mutableLine, "gl_FragColor", "FragColor");
 					createNode(cachestr(mutableLine), _stack.top());
 				}
-				else if (std::regex_search(line.begin(), line.end(), results, gl_FragColor_exp)) { // vec4 sample = 
+				else if (std::regex_search(line.begin(), line.end(), results, *gl_FragColor_exp)) { // vec4 sample = 
 					std::string mutableLine = getMatchedMutableLine(results, line, matchOffset);
 					replace_once(mutableLine, "gl_FragColor", "FragColor");
 					createNode(cachestr(mutableLine), _stack.top());
 				}
-				else if (std::regex_search(line.begin(), line.end(), results, reserved_sample_decl_expr)) { // vec4 sample = 
+				else if (std::regex_search(line.begin(), line.end(), results, *reserved_sample_decl_expr)) { // vec4 sample = 
 					std::string mutableLine = getMatchedMutableLine(results, line, matchOffset);
 					replace_once(mutableLine, "sample", "texColor");
 					createNode(cachestr(mutableLine), _stack.top());
 				}
-				else if (std::regex_search(line.begin(), line.end(), results, reserved_sample_ref_expr)) { // fix syntax symbol: sample is reserved
+				else if (std::regex_search(line.begin(), line.end(), results, *reserved_sample_ref_expr)) { // fix syntax symbol: sample is reserved
 					std::string mutableLine = getMatchedMutableLine(results, line, matchOffset);
 					replace_once(mutableLine, "sample", "texColor");
 					createNode(cachestr(mutableLine), _stack.top());
 				}
-				else if (std::regex_search(line.begin(), line.end(), results, uniform_decl_exp)) { // vert/frag: uniforms
+				else if (std::regex_search(line.begin(), line.end(), results, *uniform_decl_exp)) { // vert/frag: uniforms
 					auto uniformOffset = std::distance(line.cbegin(), results[0].first);
 					auto commentOffset = line.find("//");
 					if (commentOffset == std::string::npos || uniformOffset < commentOffset) { // not comment
@@ -230,22 +238,20 @@ struct GlslParseContext {
 						createNode(line, _stack.top());
 					}
 				}
-				else if (std::regex_search(line.begin(), line.end(), results, pp_define_exp)) {
+				else if (std::regex_search(line.begin(), line.end(), results, *pp_define_exp)) {
 					createNode(line, _stack.top());
 
-					auto& match = results[0];
-					auto first = std::addressof(*match.first) + sizeof("#define"); // start search next char of #define
-					auto count = static_cast<size_t>(std::distance(match.first, match.second));
-
-					std::string_view subtext{first, count};
+					// the macro name starts at the last char of match
+					auto subtext = line.substr(std::distance(line.begin(), results[0].second) - 1);
 					std::match_results<std::string_view::const_iterator> results_;
-					assert(std::regex_search(subtext.begin(), subtext.end(), results_, c_symbol_exp));
-					auto& match_ = results_[0];
-					first = std::addressof(*match_.first);
-					count = static_cast<size_t>(std::distance(match_.first, match_.second));
-					_defines.insert(std::string_view{first, count});
+					if (std::regex_search(subtext.begin(), subtext.end(), results_, *c_symbol_exp)) {
+						auto& match_ = results_[0];
+						auto first = std::addressof(*match_.first);
+						auto count = static_cast<size_t>(std::distance(match_.first, match_.second));
+						_defines.insert(std::string_view{first, count});
+					}
 				}
-				else if (std::regex_search(line.begin(), line.end(), results, pp_block_if)) { // #if
+				else if (std::regex_search(line.begin(), line.end(), results, *pp_block_if)) { // #if
 					auto pp_if = createNode(line, _stack.top());
 					if (line.find("GL_ES") != std::string::npos)
 						pp_if->ppFlag = PPFlag::ppGLES;
@@ -257,8 +263,8 @@ struct GlslParseContext {
 					auto& match = results[0];
 					parsePPCondSymbols(match.second, line.end());
 				}
-				else if (std::regex_search(line.begin(), line.end(), results, pp_block_elif)) { // #elif
-					_stack.pop();
+				else if (std::regex_search(line.begin(), line.end(), results, *pp_block_elif)) { // #elif
+					popPPBlock();
 
 					auto pp_elif = createNode(line, _stack.top());
 					pp_elif->ppFlag = PPFlag::ppElif;
@@ -268,16 +274,16 @@ struct GlslParseContext {
 					auto& match = results[0];
 					parsePPCondSymbols(match.second, line.end());
 				}
-				else if (std::regex_search(line.begin(), line.end(), pp_block_else)) { // #else
-					_stack.pop();
+				else if (std::regex_search(line.begin(), line.end(), *pp_block_else)) { // #else
+					popPPBlock();
 
 					auto pp_else = createNode(line, _stack.top());
 					pp_else->ppFlag = PPFlag::ppElse;
 
 					_stack.push(pp_else);
 				}
-				else if (std::regex_search(line.begin(), line.end(), pp_block_endif)) { // #endif
-					_stack.pop();
+				else if (std::regex_search(line.begin(), line.end(), *pp_block_endif)) { // #endif
+					popPPBlock();
 
 					auto pp_endif = createNode(line, _stack.top());
 					pp_endif->ppFlag = PPFlag::ppEnd;
@@ -289,12 +295,13 @@ struct GlslParseContext {
 				*   - fix reserved sample code (regex)
 				*   - put all staged uniforms to vs_ub, fs_ub, then insert before first func del
 				*/
-				else if (std::regex_search(line.begin(), line.end(), func_decl_exp)) { // func decl
+				else if (std::regex_search(line.begin(), line.end(), results, *func_decl_exp) &&
+					line.find(')', std::distance(line.begin(), results[0].second)) != std::string_view::npos) { // func decl
 					if (_firstFuncNum == -1)
 						_firstFuncNum = line_count;
 					auto node = createNode(line, _stack.top());
 					node->isFuncDecl = true;
-					node->isMainDecl = std::regex_search(line.begin(), line.end(), main_decl_exp);
+					node->isMainDecl = std::regex_search(line.begin(), line.end(), *main_decl_exp);
 				}
 				else {
 					createNode(line, _stack.top());
@@ -479,7 +486,7 @@ struct GlslParseContext {
 	void insertLocation(std::string& mutableLine, int& curLoc) {
 		std::string_view linesv(mutableLine);
 		std::match_results<std::string_view::const_iterator> results;
-		if (std::regex_search(linesv.begin(), linesv.end(), results, var_name_exp))
+		if (std::regex_search(linesv.begin(), linesv.end(), results, *var_name_exp))
 		{
 			auto& match = results[0];
 			auto first = std::addressof(*match.first);
@@ -497,6 +504,12 @@ struct GlslParseContext {
 		}
 	}
 
+	// the root is never popped by unbalanced #else, #elif or #endif
+	void popPPBlock() {
+		if (_stack.size() > 1)
+			_stack.pop();
+	}
+
 	void parsePPCondSymbols(std::string_view::iterator first, std::string_view::iterator last) {
 		// modify shader manually is easier
 	}
@@ -574,8 +587,8 @@ struct GlslParseContext {
 
 };
 
-extern void save_file(std::string_view path, const std::vector<std::string_view>& chunks);
-int migrate_shader_source_one_ast(std::string& shader_source, const std::string& outpath) {
+// convert in place, the stage is detected by outpath, not accessed
+int convert_shader_source_one_ast(std::string& shader_source, const std::string& outpath) {
 #if 0
 	if (outpath.find("label_outline.frag") == std::string::npos)
 		return 0;
@@ -583,17 +596,39 @@ int migrate_shader_source_one_ast(std::string& shader_source, const std::string&
 	GlslParseContext context;
 
 	// parseAST
-	context.parseAST(shader_source, outpath);
-
+	{
+		TRACE_SCOPE("parseAST");
+		context.parseAST(shader_source, outpath);
+	}
 
 	// modify ast
-	context.modifyAST();
+	{
+		TRACE_SCOPE("modifyAST");
+		context.modifyAST();
+	}
 
-	// dump ast
+	// dump ast, the nodes refer to shader_source
 	std::string code;
-	context.dumpAST(code);
-
-	save_file(outpath, std::vector<std::string_view>{code});
+	{
+		TRACE_SCOPE("dumpAST");
+		context.dumpAST(code);
+	}
+	shader_source = std::move(code);
 
 	return 1;
 }
+
+extern void save_file(std::string_view path, const std::vector<std::string_view>& chunks);
+int migrate_shader_source_one_ast(std::string& shader_source, const std::string& outpath) {
+	auto hints = convert_shader_source_one_ast(shader_source, outpath);
+
+	save_file(outpath, std::vector<std::string_view>{shader_source});
+
+	return hints;
+}
+
+// parse only, for the regex fuzz harness
+int parse_shader_source_ast(std::string& shader_source, const std::string& outpath) {
+	GlslParseContext context;
+	return context.parseAST(shader_source, outpath) ? 1 : 0;
+}
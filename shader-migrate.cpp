@@ -9,9 +9,15 @@
 #include <regex>
 #include <unordered_set>
 #include <unordered_map>
+#include "base/lazy_regex.h"
+#include "base/trace.h"
+#include "base/stats.h"
+#include "base/logger.h"
 
 using namespace std::string_view_literals;
 
+static const axstd::lazy_regex whitespaces_exp(R"(\\s+)");
+
 namespace helper {
     int hash_function(std::string key) {
         int hashCode = 0;
@@ -108,7 +114,7 @@ namespace helper {
         str = "";
         for (auto& _ : lines)
             if (_.size() > 0)
-                str += std::regex_replace(_, std::regex(R"(\\s+)"), " ") + '\n';
+                str += std::regex_replace(_, *whitespaces_exp, " ") + '\n';
     }
 }
 
@@ -125,13 +131,15 @@ void load_shader_source(const std::string& path, std::string& out) {
 }
 
 void save_shader_source(const std::string& path, std::string& in) {
+    TRACE_SCOPE("save_file");
     std::ofstream modified;
     modified.open(path, std::ofstream::out | std::ofstream::trunc);
     modified << in;
     modified.close();
+    stats::add("bytes_written", static_cast<int64_t>(in.size()));
 }
 
-#define PARSE_ERROR_CONTINUE(T, I) do { std::cout << fmt::format("Warning: {} at line {} couldn't be parsed", T, I) << std::endl; continue; } while (0);
+#define PARSE_ERROR_CONTINUE(T, I) do { logger::warn("Warning: {} at line {} couldn't be parsed", T, I); continue; } while (0);
 
 void parse_vertex_100_310(std::string& vertex_shader) {
     std::vector<std::string> lines;
@@ -156,7 +164,7 @@ void parse_vertex_100_310(std::string& vertex_shader) {
         while (helper::replace(line, "precision float;", ""));
         while (helper::replace(line, "texColor.rgb(texColor.a)", "texColor.rgb * texColor.a"));
 
-        line = std::regex_replace(line, std::regex(R"(\\s+)"), " ");
+        line = std::regex_replace(line, *whitespaces_exp, " ");
 
         if (i == 0 && !line.starts_with("#version 310 es")) {
             lines.insert(lines.begin() + 0, "#version 310 es");
@@ -167,7 +175,7 @@ void parse_vertex_100_310(std::string& vertex_shader) {
         }
         else if (i == 0)
         {
-            std::cout << "Vertex shader is already in glsl 310 es format." << std::endl;
+            logger::verbose("Vertex shader is already in glsl 310 es format.");
         }
 
         if (line.find('=') != std::string::npos &&
@@ -396,7 +404,7 @@ void parse_fragment_100_310(std::string& fragment_shader) {
         while (helper::replace(line, "precision float;", ""));
         while (helper::replace(line, "texColor.rgb(texColor.a)", "texColor.rgb * texColor.a"));
 
-        line = std::regex_replace(line, std::regex(R"(\\s+)"), " ");
+        line = std::regex_replace(line, *whitespaces_exp, " ");
 
         while (helper::replace(line, "gl_FragColor", "FragColor")) {};
         while (helper::replace(line, "texture2D(", "texture(")) {};
@@ -415,7 +423,7 @@ void parse_fragment_100_310(std::string& fragment_shader) {
         }
         else if (i == 0)
         {
-            std::cout << "Vertex shader is already in glsl 310 es format." << std::endl;
+            logger::verbose("Vertex shader is already in glsl 310 es format.");
         }
 
         if (line.find('=') != std::string::npos &&
@@ -623,7 +631,9 @@ void format_any_stage(std::string& source) {
     helper::pack_vector_string_compact(source, lines);
 }
 
-void migrate_shader_source_one(std::string& shader_source, const std::string& outpath) {
+// convert in place, the stage is detected by outpath, not accessed
+void convert_shader_source_one(std::string& shader_source, const std::string& outpath) {
+    TRACE_SCOPE("convert_lines");
     auto is_frag = cxx20::ic::ends_with(outpath, ".frag"sv) || shader_source.find("gl_FragColor") != std::string::npos;
 
     if(is_frag)
@@ -632,6 +642,10 @@ void migrate_shader_source_one(std::string& shader_source, const std::string& ou
         parse_vertex_100_310(shader_source);
 
     format_any_stage(shader_source);
+}
+
+void migrate_shader_source_one(std::string& shader_source, const std::string& outpath) {
+    convert_shader_source_one(shader_source, outpath);
 
     save_shader_source(outpath, shader_source);
 }
@@ -672,6 +686,6 @@ int main(int argc, char* argv) {
     // save_shader_source(vshader_path2, vshader_source);
     // save_shader_source(fshader_path2, fshader_source);
 
-    std::cout << "converting shaders to gles 310 done!" << std::endl;
+    logger::info("converting shaders to gles 310 done!");
 }
 #endif
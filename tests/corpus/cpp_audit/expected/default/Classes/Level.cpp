@@ -0,0 +1,26 @@
+#include "Level.h"
+
+USING_NS_CC;
+
+bool Level::init() {
+    scheduleUpdate();
+    schedule([this](float delta) { tick(delta); }, 0.5f, "tick");
+    return true;
+}
+
+void Level::update(float delta) {
+    auto player = getChildByName("player");
+    player->setName("player");
+    auto children = getChildren();
+    spawn(_enemies);
+}
+
+void Level::tick(float delta) {
+    auto boss = getChildByTag(7);
+    boss->setPosition(Vec2(delta, 0));
+}
+
+void Level::spawn(Vector<Node*> enemies) {
+    for (int i = 0; i < enemies.size(); ++i)
+        addChild(enemies.at(i));
+}
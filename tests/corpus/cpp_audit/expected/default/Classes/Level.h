@@ -0,0 +1,14 @@
+#pragma once
+#include "cocos2d.h"
+
+class Level : public cocos2d::Node {
+public:
+    bool init();
+    void update(float delta) override;
+
+private:
+    void tick(float delta);
+    void spawn(cocos2d::Vector<cocos2d::Node*> enemies);
+
+    cocos2d::Vector<cocos2d::Node*> _enemies;
+};
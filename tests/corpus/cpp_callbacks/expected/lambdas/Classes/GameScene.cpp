@@ -0,0 +1,40 @@
+#include "GameScene.h"
+#include "ui/CocosGUI.h"
+
+USING_NS_CC;
+using namespace std::placeholders;
+
+#define BIND_MENU(__selector__) CC_CALLBACK_1(__selector__, this)
+#define kLocalTag 7
+
+bool GameScene::init()
+{
+    if (!Scene::init())
+        return false;
+
+    auto closeItem = MenuItemImage::create("CloseNormal.png", "CloseSelected.png",
+                                           [this](auto&& arg1, auto&&...) { return menuCloseCallback(std::forward<decltype(arg1)>(arg1)); });
+    auto menu = Menu::create(closeItem, nullptr);
+    this->addChild(menu, 1);
+
+    auto listener = EventListenerTouchOneByOne::create();
+    listener->onTouchBegan = [this](auto&& arg1, auto&& arg2, auto&&...) { return onTouchBegan(std::forward<decltype(arg1)>(arg1), std::forward<decltype(arg2)>(arg2)); };
+    listener->onTouchMoved = [this](auto&& arg1, auto&& arg2, auto&&...) { return onTouchMoved(std::forward<decltype(arg1)>(arg1), std::forward<decltype(arg2)>(arg2)); };
+    listener->onTouchEnded = [target = _hud, bound1 = kTagHud](auto&& arg1, auto&& arg2, auto&&...) mutable { return target->onTouchEnded(std::forward<decltype(arg1)>(arg1), std::forward<decltype(arg2)>(arg2), bound1); };
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(listener, this);
+
+    auto button = ui::Button::create("button.png");
+    button->addClickEventListener([this, bound1 = _level](auto&& arg1, auto&&...) mutable { return onButton(std::forward<decltype(arg1)>(arg1), bound1); });
+    button->addTouchEventListener([this](auto&& arg1, auto&& arg2, auto&&...) { return onButtonTouch(std::forward<decltype(arg2)>(arg2), std::forward<decltype(arg1)>(arg1)); });
+
+    button->addClickEventListener([this, bound1 = kLocalTag](auto&& arg1, auto&&...) mutable { return onTag(std::forward<decltype(arg1)>(arg1), bound1); });
+
+    scheduleOnce([target = getPlayer()](auto&&...) { return target->respawn(); }, 1.0f, "respawn");
+
+    // left as is: a callback bound within another one, template arguments and free functions
+    runAction(CallFunc::create(std::bind(&GameScene::onDone, this, std::bind(&GameScene::nextLevel, this))));
+    auto sorter = std::bind(&GameScene::sortBy, this, std::less<int>{}, _1);
+    auto handler = std::bind(onGlobalEvent, _1);
+    // CC_CALLBACK_1(GameScene::commented, this)
+    return true;
+}
@@ -0,0 +1,41 @@
+#include "GameScene.h"
+#include "ui/CocosGUI.h"
+
+USING_NS_CC;
+using namespace std::placeholders;
+
+#define BIND_MENU(__selector__) CC_CALLBACK_1(__selector__, this)
+#define kLocalTag 7
+
+bool GameScene::init()
+{
+    if (!Scene::init())
+        return false;
+
+    auto closeItem = MenuItemImage::create("CloseNormal.png", "CloseSelected.png",
+                                           CC_CALLBACK_1(GameScene::menuCloseCallback, this));
+    auto menu = Menu::create(closeItem, nullptr);
+    this->addChild(menu, 1);
+
+    auto listener = EventListenerTouchOneByOne::create();
+    listener->onTouchBegan = CC_CALLBACK_2(GameScene::onTouchBegan, this);
+    listener->onTouchMoved = CC_CALLBACK_2(GameScene::onTouchMoved,
+                                           this);
+    listener->onTouchEnded = CC_CALLBACK_2(HudLayer::onTouchEnded, _hud, kTagHud);
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(listener, this);
+
+    auto button = ui::Button::create("button.png");
+    button->addClickEventListener(std::bind(&GameScene::onButton, this, std::placeholders::_1, _level));
+    button->addTouchEventListener(std::bind(&GameScene::onButtonTouch, this, _2, _1));
+
+    button->addClickEventListener(CC_CALLBACK_1(GameScene::onTag, this, kLocalTag));
+
+    scheduleOnce(CC_CALLBACK_0(Player::respawn, getPlayer()), 1.0f, "respawn");
+
+    // left as is: a callback bound within another one, template arguments and free functions
+    runAction(CallFunc::create(std::bind(&GameScene::onDone, this, std::bind(&GameScene::nextLevel, this))));
+    auto sorter = std::bind(&GameScene::sortBy, this, std::less<int>{}, _1);
+    auto handler = std::bind(onGlobalEvent, _1);
+    // CC_CALLBACK_1(GameScene::commented, this)
+    return true;
+}
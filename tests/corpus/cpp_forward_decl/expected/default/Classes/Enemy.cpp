@@ -0,0 +1,2 @@
+#include "Enemy.h"
+#include "2d/CCSprite.h"
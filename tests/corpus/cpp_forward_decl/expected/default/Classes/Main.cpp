@@ -0,0 +1,7 @@
+#include "Player.h"
+
+int main() {
+    Player player;
+    player.attack(nullptr);
+    return 0;
+}
@@ -0,0 +1,12 @@
+#include "Player.h"
+#include "2d/CCLabel.h"
+#include "Enemy.h"
+
+void Player::attack(Enemy* target) {
+    _target = target;
+    _nameLabel->setString("attacking");
+}
+
+const Enemy& Player::lastTarget() const {
+    return *_target;
+}
@@ -0,0 +1 @@
+#include "Enemy.h"
@@ -0,0 +1,11 @@
+#pragma once
+#include "2d/CCSprite.h"
+
+class Enemy {
+public:
+    int health() const { return _health; }
+
+private:
+    cocos2d::Sprite* _sprite = nullptr;
+    int _health = 100;
+};
@@ -0,0 +1,10 @@
+#include "Player.h"
+
+void Player::attack(Enemy* target) {
+    _target = target;
+    _nameLabel->setString("attacking");
+}
+
+const Enemy& Player::lastTarget() const {
+    return *_target;
+}
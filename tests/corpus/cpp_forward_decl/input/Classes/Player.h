@@ -0,0 +1,16 @@
+#pragma once
+#include "2d/CCNode.h"
+#include "2d/CCLabel.h"
+#include "Enemy.h"
+#include "Weapon.h"
+
+class Player : public cocos2d::Node {
+public:
+    void attack(Enemy* target);
+    const Enemy& lastTarget() const;
+
+private:
+    cocos2d::Label* _nameLabel = nullptr;
+    Enemy* _target = nullptr;
+    Weapon _weapon;
+};
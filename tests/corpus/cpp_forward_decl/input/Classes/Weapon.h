@@ -0,0 +1,5 @@
+#pragma once
+
+struct Weapon {
+    int damage = 10;
+};
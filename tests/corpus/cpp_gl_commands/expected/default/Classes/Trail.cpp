@@ -0,0 +1,37 @@
+#include "Trail.h"
+
+USING_NS_CC;
+
+void Trail::draw(Renderer* renderer, const Mat4& transform, unsigned int flags) {
+    _customCommand.init(0);
+    onDraw(transform, flags);
+    renderer->addCommand(&_customCommand);
+
+    _outlineCommand.init(0);
+    _outlineCommand.func = [this]() {
+        glLineWidth(2);
+        glDrawArrays(GL_LINES, 0, _count);
+    };
+    renderer->addCommand(&_outlineCommand);
+}
+
+void Trail::onDraw(const Mat4& transform, unsigned int flags) {
+    _customCommand.getPipelineDescriptor().programState = getProgramState();
+    getProgramState()->setUniform(getProgramState()->getUniformLocation("u_MVPMatrix"), (Director::getInstance()->getMatrix(MATRIX_STACK_TYPE::MATRIX_STACK_PROJECTION) * transform).m, sizeof(Mat4::m));
+    auto& blendDescriptor = _customCommand.getPipelineDescriptor().blendDescriptor;
+    blendDescriptor.blendEnabled = true;
+    blendDescriptor.sourceRGBBlendFactor = blendDescriptor.sourceAlphaBlendFactor = utils::toBackendBlendFactor(GL_SRC_ALPHA);
+    blendDescriptor.destinationRGBBlendFactor = blendDescriptor.destinationAlphaBlendFactor = utils::toBackendBlendFactor(GL_ONE_MINUS_SRC_ALPHA);
+
+    auto vertexLayout = getProgramState()->getVertexLayout();
+    vertexLayout->setAttribute("a_position", getProgramState()->getAttributeLocation("a_position"), backend::VertexFormat::FLOAT2, 0, false);
+    vertexLayout->setAttribute("a_color", getProgramState()->getAttributeLocation("a_color"), backend::VertexFormat::UBYTE4, sizeof(Vec2), true);
+    vertexLayout->setLayout(sizeof(TrailVertex));
+    if (_customCommand.getVertexCapacity() < _count)
+        _customCommand.createVertexBuffer(sizeof(TrailVertex), _count, CustomCommand::BufferUsage::DYNAMIC);
+    _customCommand.updateVertexBuffer(_vertices, sizeof(TrailVertex) * _count);
+    _customCommand.setPrimitiveType(CustomCommand::PrimitiveType::TRIANGLE_STRIP);
+    _customCommand.setDrawType(CustomCommand::DrawType::ARRAY);
+    _customCommand.setVertexDrawInfo(0, _count);
+
+}
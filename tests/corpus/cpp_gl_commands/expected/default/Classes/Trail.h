@@ -0,0 +1,20 @@
+#pragma once
+#include "cocos2d.h"
+
+struct TrailVertex {
+    cocos2d::Vec2 position;
+    unsigned char color[4];
+};
+
+class Trail : public cocos2d::Node {
+public:
+    void draw(cocos2d::Renderer* renderer, const cocos2d::Mat4& transform, unsigned int flags) override;
+
+private:
+    void onDraw(const cocos2d::Mat4& transform, unsigned int flags);
+
+    cocos2d::CustomCommand _customCommand;
+    cocos2d::CustomCommand _outlineCommand;
+    TrailVertex _vertices[64];
+    int _count = 0;
+};
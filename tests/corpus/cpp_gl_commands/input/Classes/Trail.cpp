@@ -0,0 +1,31 @@
+#include "Trail.h"
+
+USING_NS_CC;
+
+void Trail::draw(Renderer* renderer, const Mat4& transform, unsigned int flags) {
+    _customCommand.init(0);
+    _customCommand.func = CC_CALLBACK_0(Trail::onDraw, this, transform, flags);
+    renderer->addCommand(&_customCommand);
+
+    _outlineCommand.init(0);
+    _outlineCommand.func = [this]() {
+        glLineWidth(2);
+        glDrawArrays(GL_LINES, 0, _count);
+    };
+    renderer->addCommand(&_outlineCommand);
+}
+
+void Trail::onDraw(const Mat4& transform, unsigned int flags) {
+    getGLProgram()->use();
+    getGLProgram()->setUniformsForBuiltins(transform);
+    GL::enableVertexAttribs(GL::VERTEX_ATTRIB_FLAG_POSITION | GL::VERTEX_ATTRIB_FLAG_COLOR);
+    GL::blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    long offset = (long)_vertices;
+    glVertexAttribPointer(GLProgram::VERTEX_ATTRIB_POSITION, 2, GL_FLOAT, GL_FALSE, sizeof(TrailVertex), (GLvoid*)offset);
+    glVertexAttribPointer(GLProgram::VERTEX_ATTRIB_COLOR, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(TrailVertex), (GLvoid*)(offset + sizeof(Vec2)));
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, _count);
+
+    CC_INCREMENT_GL_DRAWN_BATCHES_AND_VERTICES(1, _count);
+    CHECK_GL_ERROR_DEBUG();
+}
@@ -0,0 +1,18 @@
+#include "Ship.h"
+
+USING_NS_CC;
+
+void Ship::update(float delta) {
+    _time += delta;
+    auto hud = (_hudChild && _hudChild->getParent() == this ? _hudChild.get() : (_hudChild = getChildByName("hud")).get());
+    hud->setPosition(Vec2(_time, 0));
+    auto other = getParent()->getChildByName("hud");
+    other->setPosition(Vec2(0, _time));
+}
+
+void Ship::draw(Renderer* renderer, const Mat4& transform, unsigned int flags) {
+    auto loc = (_uTimeLocation ? _uTimeLocation : (_uTimeLocation = _programState->getUniformLocation("u_time")));
+    _programState->setUniform(loc, &_time, sizeof(_time));
+    auto again = (_uTimeLocation ? _uTimeLocation : (_uTimeLocation = this->_programState->getUniformLocation("u_time")));
+    _programState->setUniform(again, &_time, sizeof(_time));
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include "cocos2d.h"
+#include "base/CCRefPtr.h"
+
+class Ship : public cocos2d::Node {
+public:
+    void update(float delta) override;
+    void draw(cocos2d::Renderer* renderer, const cocos2d::Mat4& transform, unsigned int flags) override;
+
+private:
+    cocos2d::backend::ProgramState* _programState = nullptr;
+    float _time = 0;
+    cocos2d::RefPtr<cocos2d::Node> _hudChild;
+    cocos2d::backend::UniformLocation _uTimeLocation;
+};
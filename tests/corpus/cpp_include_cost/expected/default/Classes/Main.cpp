@@ -0,0 +1,7 @@
+#include "World.h"
+#include "cocos2d.h"
+
+int main() {
+    World world;
+    return world.background() ? 0 : kMaxEnemies;
+}
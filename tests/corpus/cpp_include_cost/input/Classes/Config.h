@@ -0,0 +1,3 @@
+#pragma once
+
+constexpr int kMaxEnemies = 16;
@@ -0,0 +1,6 @@
+#include "World.h"
+#include "2d/CCLabel.h"
+
+cocos2d::Sprite* World::background() const {
+    return cocos2d::Sprite::create("sky.png");
+}
@@ -0,0 +1,8 @@
+#pragma once
+#include "2d/CCSprite.h"
+#include "Config.h"
+
+class World {
+public:
+    cocos2d::Sprite* background() const;
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <vector>
+#include <string>
+
+struct GameLogic
+{
+    std::vector<std::string> levels;
+    int score = 0;
+
+    void addScore(int value);
+};
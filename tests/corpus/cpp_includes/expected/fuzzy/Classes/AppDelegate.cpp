@@ -0,0 +1,53 @@
+#include "AppDelegate.h"
+#include "HelloWorldScene.h"
+#include "audio/include/AudioEngine.h"
+#include "base/Director.h"
+#include   "platform/GLView.h"
+#include "base/Utils.h"
+#include <2d/Sprite.h>
+#include <cctype>
+
+USING_NS_CC;
+
+static cocos2d::Size designResolutionSize = cocos2d::Size(480, 320);
+
+AppDelegate::AppDelegate()
+{
+}
+
+AppDelegate::~AppDelegate()
+{
+    AudioEngine::end();
+}
+
+void AppDelegate::initGLContextAttrs()
+{
+    GLContextAttrs glContextAttrs = {8, 8, 8, 8, 24, 8, 0};
+    GLView::setGLContextAttrs(glContextAttrs);
+}
+
+bool AppDelegate::applicationDidFinishLaunching() {
+    auto director = Director::getInstance();
+    auto glview = director->getOpenGLView();
+    if(!glview) {
+        glview = GLViewImpl::createWithRect("HelloCpp", cocos2d::Rect(0, 0, designResolutionSize.width, designResolutionSize.height));
+        director->setOpenGLView(glview);
+    }
+
+    director->setAnimationInterval(1.0f / 60);
+    glview->setDesignResolutionSize(designResolutionSize.width, designResolutionSize.height, ResolutionPolicy::NO_BORDER);
+
+    auto scene = HelloWorld::createScene();
+    director->runWithScene(scene);
+    return true;
+}
+
+void AppDelegate::applicationDidEnterBackground() {
+    Director::getInstance()->stopAnimation();
+    AudioEngine::pauseAll();
+}
+
+void AppDelegate::applicationWillEnterForeground() {
+    Director::getInstance()->startAnimation();
+    AudioEngine::resumeAll();
+}
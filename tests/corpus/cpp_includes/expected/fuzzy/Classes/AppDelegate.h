@@ -0,0 +1,26 @@
+#ifndef  _APP_DELEGATE_H_
+#define  _APP_DELEGATE_H_
+
+#include "cocos2d.h"
+
+/**
+@brief    The cocos2d Application.
+
+Private inheritance here hides part of interface from Director.
+*/
+class  AppDelegate : private cocos2d::Application
+{
+public:
+    AppDelegate();
+    virtual ~AppDelegate();
+
+    virtual void initGLContextAttrs();
+
+    virtual bool applicationDidFinishLaunching();
+
+    virtual void applicationDidEnterBackground();
+
+    virtual void applicationWillEnterForeground();
+};
+
+#endif // _APP_DELEGATE_H_
@@ -0,0 +1,19 @@
+#include "CustomNode.h"
+#include "base/Scheduler.h"
+#include "base/Director.h"
+
+USING_NS_CC;
+
+bool CustomNode::init()
+{
+    if (!Node::init())
+        return false;
+    scheduleUpdate();
+    return true;
+}
+
+void CustomNode::update(float dt)
+{
+    _elapsed += dt;
+    setRotation(clampAngle(_elapsed * 90.0f));
+}
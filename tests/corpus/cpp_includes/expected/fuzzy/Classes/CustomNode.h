@@ -0,0 +1,19 @@
+#pragma once
+
+#include "base/Ref.h"
+#include "2d/Node.h"
+#include "math/Math.h"
+
+class CustomNode : public cocos2d::Node
+{
+public:
+    CREATE_FUNC(CustomNode);
+
+    bool init() override;
+    void update(float dt) override;
+
+private:
+    float _elapsed = 0;
+};
+
+#include "Utils.inl"
@@ -0,0 +1,13 @@
+#ifndef DRAGONBONES_CC_FACTORY_H
+#define DRAGONBONES_CC_FACTORY_H
+
+#include "dragonBones/DragonBonesHeaders.h"
+#include "CCArmatureDisplay.h"
+
+DRAGONBONES_NAMESPACE_BEGIN
+class CCFactory : public BaseFactory
+{
+};
+DRAGONBONES_NAMESPACE_END
+
+#endif // DRAGONBONES_CC_FACTORY_H
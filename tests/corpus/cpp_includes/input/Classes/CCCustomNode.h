@@ -0,0 +1,19 @@
+#pragma once
+
+#include "base/CCRef.h"
+#include "2d/CCNode.h"
+#include "math/CCMath.h"
+
+class CustomNode : public cocos2d::Node
+{
+public:
+    CREATE_FUNC(CustomNode);
+
+    bool init() override;
+    void update(float dt) override;
+
+private:
+    float _elapsed = 0;
+};
+
+#include "Utils.inl"
@@ -0,0 +1,9 @@
+#include "GameLogic.h"
+#include <algorithm>
+
+// "CCNotAnInclude.h" in a comment is kept
+
+void GameLogic::addScore(int value)
+{
+    score = std::max(0, score + value);
+}
@@ -0,0 +1,21 @@
+#ifndef __HELLOWORLD_SCENE_H__
+#define __HELLOWORLD_SCENE_H__
+
+#include "cocos2d.h"
+#include "2d/CCNode.h"
+#include "ui/UIButton.h"
+#include "CCCustomNode.h"
+
+class HelloWorld : public cocos2d::Scene
+{
+public:
+    static cocos2d::Scene* createScene();
+
+    virtual bool init();
+
+    void menuCloseCallback(cocos2d::Ref* pSender);
+
+    CREATE_FUNC(HelloWorld);
+};
+
+#endif // __HELLOWORLD_SCENE_H__
@@ -0,0 +1,8 @@
+#include "base/ccMacros.h"
+
+inline float clampAngle(float angle)
+{
+    while (angle >= 360.0f)
+        angle -= 360.0f;
+    return angle;
+}
@@ -0,0 +1,16 @@
+#import "RootViewController.h"
+#import "cocos2d.h"
+#import "platform/ios/CCEAGLView-ios.h"
+
+@implementation RootViewController
+
+- (void)loadView {
+    auto renderView = (__bridge CCEAGLView *)cocos2d::Director::getInstance()->getOpenGLView()->getEAGLView();
+    self.view = renderView;
+}
+
+- (BOOL)prefersStatusBarHidden {
+    return YES;
+}
+
+@end
@@ -0,0 +1,4 @@
+#pragma once
+#include "math/Vec2.h"
+
+inline cocos2d::Vec2 origin() { return cocos2d::Vec2(0, 0); }
@@ -0,0 +1,6 @@
+# generated by axmol-migrate --suggest-pch, include() it after the targets are defined
+foreach(_ax_pch_target IN ITEMS game)
+    if(TARGET ${_ax_pch_target})
+        target_precompile_headers(${_ax_pch_target} PRIVATE "${CMAKE_CURRENT_LIST_DIR}/axmol_pch.h")
+    endif()
+endforeach()
@@ -0,0 +1,6 @@
+// generated by axmol-migrate --suggest-pch, the headers out of the project included by most of its
+// translation units, ranked by the units including them times their parse cost measured by libclang
+#pragma once
+#if defined(__cplusplus)
+#include "cocos2d.h" // units: 4/4, parse: 0.0(ms), includes: 24
+#endif
@@ -0,0 +1,8 @@
+#include "cocos2d.h"
+#include "Common.h"
+
+USING_NS_CC;
+
+Node* createLevel() {
+    return Node::create();
+}
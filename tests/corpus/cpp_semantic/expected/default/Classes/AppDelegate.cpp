@@ -0,0 +1,12 @@
+#include "AppDelegate.h"
+
+USING_NS_CC;
+
+bool AppDelegate::applicationDidFinishLaunching() {
+    auto director = Director::getInstance();
+    _view = director->getRenderView();
+    director->setRenderView(_view);
+    Texture2D::setDefaultAlphaPixelFormat(backend::PixelFormat::RGBA8);
+    cocos2d::Texture2D::setDefaultAlphaPixelFormat(ax::backend::PixelFormat::AUTO);
+    return true;
+}
@@ -0,0 +1,10 @@
+#pragma once
+#include "cocos2d.h"
+
+class AppDelegate {
+public:
+    bool applicationDidFinishLaunching();
+
+private:
+    ax::RenderView* _view = nullptr;
+};
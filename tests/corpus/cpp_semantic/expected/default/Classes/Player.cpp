@@ -0,0 +1,18 @@
+#include "Player.h"
+
+USING_NS_CC;
+
+void Player::setName(std::string_view name) {
+    Sprite::setName(name);
+}
+
+bool Player::initWithFile(std::string_view filename) {
+    return Sprite::initWithFile(filename);
+}
+
+void Player::moveBy(const Vec2& offset) {
+    Vec2 start = Vec2(1, 2);
+    auto target = (start + (offset * 2));
+    auto far = start.distance(target) > 10;
+    setPosition(far ? (target - offset) : target);
+}
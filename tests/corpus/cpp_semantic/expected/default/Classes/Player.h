@@ -0,0 +1,12 @@
+#pragma once
+#include "cocos2d.h"
+
+class Player : public cocos2d::Sprite {
+public:
+    void setName(std::string_view name) override;
+    bool initWithFile(std::string_view) override;
+    void moveBy(const ax::Vec2& offset);
+
+private:
+    ax::ProgramState* _state = nullptr;
+};
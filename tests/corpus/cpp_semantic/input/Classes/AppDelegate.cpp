@@ -0,0 +1,12 @@
+#include "AppDelegate.h"
+
+USING_NS_CC;
+
+bool AppDelegate::applicationDidFinishLaunching() {
+    auto director = Director::getInstance();
+    _view = director->getOpenGLView();
+    director->setOpenGLView(_view);
+    Texture2D::setDefaultAlphaPixelFormat(Texture2D::PixelFormat::RGBA8888);
+    cocos2d::Texture2D::setDefaultAlphaPixelFormat(cocos2d::Texture2D::PixelFormat::AUTO);
+    return true;
+}
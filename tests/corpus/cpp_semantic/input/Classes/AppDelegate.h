@@ -0,0 +1,10 @@
+#pragma once
+#include "cocos2d.h"
+
+class AppDelegate {
+public:
+    bool applicationDidFinishLaunching();
+
+private:
+    cocos2d::GLView* _view = nullptr;
+};
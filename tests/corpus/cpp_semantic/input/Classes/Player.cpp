@@ -0,0 +1,18 @@
+#include "Player.h"
+
+USING_NS_CC;
+
+void Player::setName(const std::string& name) {
+    Sprite::setName(name);
+}
+
+bool Player::initWithFile(const std::string& filename) {
+    return Sprite::initWithFile(filename);
+}
+
+void Player::moveBy(const Point& offset) {
+    Point start = ccp(1, 2);
+    auto target = ccpAdd(start, ccpMult(offset, 2));
+    auto far = ccpDistance(start, target) > 10;
+    setPosition(far ? ccpSub(target, offset) : target);
+}
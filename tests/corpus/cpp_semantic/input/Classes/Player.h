@@ -0,0 +1,12 @@
+#pragma once
+#include "cocos2d.h"
+
+class Player : public cocos2d::Sprite {
+public:
+    void setName(const std::string& name) override;
+    bool initWithFile(const std::string&) override;
+    void moveBy(const cocos2d::Point& offset);
+
+private:
+    cocos2d::GLProgramState* _state = nullptr;
+};
@@ -0,0 +1,16 @@
+#include "Game.h"
+
+USING_NS_CC;
+
+Game* Game::create() {
+    return new Game();
+}
+
+bool Game::init() {
+    _player = Sprite::create("player.png");
+    addChild(_player);
+    auto label = Label::create();
+    label->setString("score");
+    addChild(label);
+    return true;
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include "base/CCScheduler.h"
+#include "2d/CCSprite.h"
+#include "2d/CCLabel.h"
+
+class Game : public cocos2d::Node {
+public:
+    static Game* create();
+    bool init();
+
+private:
+    cocos2d::Sprite* _player = nullptr;
+};
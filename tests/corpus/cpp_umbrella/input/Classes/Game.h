@@ -0,0 +1,11 @@
+#pragma once
+#include "cocos2d.h"
+
+class Game : public cocos2d::Node {
+public:
+    static Game* create();
+    bool init();
+
+private:
+    cocos2d::Sprite* _player = nullptr;
+};
@@ -0,0 +1,14 @@
+/*
+#include "base/CCScheduler.h" by the label once
+*/
+#include "2d/CCLabel.h"
+#include "cocos2d.h"
+
+USING_NS_CC;
+
+void showHud(Node* parent) {
+    auto title = Label::create();
+    title->setPosition(ccp(10, 20));
+    parent->addChild(title);
+    Director::getInstance()->getScheduler()->unschedule("hud", parent);
+}
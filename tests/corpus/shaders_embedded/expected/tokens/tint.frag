@@ -0,0 +1,13 @@
+#version 310 es
+precision highp float;
+precision highp int;
+layout (location = 0) in vec2 v_texCoord ;
+layout (binding = 0) uniform sampler2D u_texture;
+layout(std140, binding = 0) uniform u_tint {
+    vec4 U_4499;
+};
+layout (location = 0) out vec4 FragColor;
+void main()
+{
+    FragColor = texture(u_texture, v_texCoord) *  U_4499;
+}
@@ -0,0 +1,17 @@
+#version 310 es
+
+layout(location = 0) in vec4 a_position;
+layout(location = 1) in vec2 a_texCoord;
+
+
+layout(location = 0) out vec2 v_texCoord;
+
+layout(std140, binding = 0) uniform vs_ub {
+    mat4 u_MVPMatrix;
+};
+
+void main()
+{
+    gl_Position = u_MVPMatrix * a_position;
+    v_texCoord = a_texCoord;
+}
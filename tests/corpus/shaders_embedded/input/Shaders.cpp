@@ -0,0 +1,51 @@
+/*
+ * Shaders of a project embedded in c++ literals, both raw and concatenated literals
+ */
+#include "Shaders.h"
+
+namespace game
+{
+const char* sprite_vert = R"(
+attribute vec4 a_position;
+attribute vec2 a_texCoord;
+
+uniform mat4 u_MVPMatrix;
+
+#ifdef GL_ES
+varying mediump vec2 v_texCoord;
+#else
+varying vec2 v_texCoord;
+#endif
+
+void main()
+{
+    gl_Position = u_MVPMatrix * a_position;
+    v_texCoord = a_texCoord;
+}
+)";
+
+const char* sprite_frag =
+    "#ifdef GL_ES\n"
+    "precision lowp float;\n"
+    "#endif\n"
+    "\n"
+    "varying vec2 v_texCoord;\n"
+    "uniform sampler2D u_texture;\n"
+    "uniform float u_alpha;\n"
+    "\n"
+    "void main()\n"
+    "{\n"
+    "\tgl_FragColor = texture2D(u_texture, v_texCoord) * u_alpha;\n"
+    "}\n";
+
+static const char CC2D_tint_frag[] = R"(
+varying vec2 v_texCoord;
+uniform sampler2D u_texture;
+uniform vec4 u_tint;
+
+void main()
+{
+    gl_FragColor = texture2D(u_texture, v_texCoord) * u_tint;
+}
+)";
+}  // namespace game
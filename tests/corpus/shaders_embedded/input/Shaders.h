@@ -0,0 +1,11 @@
+/*
+ * Declarations only, no shader literal to extract, the file is left as is
+ */
+#pragma once
+
+namespace game
+{
+extern const char* sprite_vert;
+extern const char* sprite_frag;
+extern const char kShaderCacheKey[];
+}  // namespace game
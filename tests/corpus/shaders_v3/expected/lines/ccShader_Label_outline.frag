@@ -0,0 +1,27 @@
+#version 310 es
+precision highp float;
+precision highp int;
+#ifdef GL_ES
+#endif
+layout (location = 0) in vec4 v_fragmentColor ;
+layout (location = 1) in vec2 v_texCoord ;
+layout(std140, binding = 0) uniform u_effectColor {
+    vec4 U_21312;
+};
+layout(std140, binding = 0) uniform u_textColor {
+    vec4 U_15256;
+};
+layout (location = 0) out vec4 FragColor;
+void main()
+{
+    vec4 texColor= vec4(texture(CC_Texture0, v_texCoord));
+    float fontAlpha= float(texColor.a);
+    float outlineAlpha= float(texColor.r);
+    if ((fontAlpha + outlineAlpha) > 0.0){
+        vec4 color= vec4(U_15256 * fontAlpha +  U_21312 * (1.0 - fontAlpha));
+        FragColor = v_fragmentColor * vec4( color.rgb,max(fontAlpha,outlineAlpha)*color.a);
+    }
+    else {
+        discard;
+    }
+}
@@ -0,0 +1,16 @@
+#version 310 es
+precision highp float;
+precision highp int;
+layout (location = 0) in vec4 a_position;
+layout (location = 1) in vec4 a_color;
+#ifdef GL_ES
+layout (location = 0) out vec4 v_fragmentColor ;
+#else
+layout (location = 0) out vec4 v_fragmentColor ;
+#endif
+void main()
+{
+    gl_Position = CC_MVPMatrix * a_position;
+    gl_PointSize = CC_PointSize;
+    v_fragmentColor = a_color;
+}
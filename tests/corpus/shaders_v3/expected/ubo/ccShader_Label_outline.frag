@@ -0,0 +1,29 @@
+#version 310 es
+precision highp float;
+precision highp int;
+
+
+layout(location = 0) in vec4 v_fragmentColor;
+layout(location = 1) in vec2 v_texCoord;
+
+
+layout(std140, binding = 0) uniform fs_ub {
+    vec4 u_effectColor;
+    vec4 u_textColor;
+};
+
+layout(location = 0) out vec4 FragColor;
+
+void main()
+{
+    vec4 texColor = texture(CC_Texture0, v_texCoord);
+    float fontAlpha = texColor.a;
+    float outlineAlpha = texColor.r;
+    if ((fontAlpha + outlineAlpha) > 0.0){
+        vec4 color = u_textColor * fontAlpha + u_effectColor * (1.0 - fontAlpha);
+        FragColor = v_fragmentColor * vec4( color.rgb,max(fontAlpha,outlineAlpha)*color.a);
+    }
+    else {
+        discard;
+    }
+}
@@ -0,0 +1,13 @@
+#version 310 es
+
+layout(location = 0) in vec4 a_position;
+layout(location = 1) in vec4 a_color;
+
+layout(location = 0) out vec4 v_fragmentColor;
+
+void main()
+{
+    gl_Position = CC_MVPMatrix * a_position;
+    gl_PointSize = CC_PointSize;
+    v_fragmentColor = a_color;
+}
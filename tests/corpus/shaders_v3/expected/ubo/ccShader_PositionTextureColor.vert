@@ -0,0 +1,15 @@
+#version 310 es
+
+layout(location = 0) in vec4 a_position;
+layout(location = 1) in vec2 a_texCoord;
+layout(location = 2) in vec4 a_color;
+
+layout(location = 0) out vec4 v_fragmentColor;
+layout(location = 1) out vec2 v_texCoord;
+
+void main()
+{
+    gl_Position = CC_PMatrix * a_position;
+    v_fragmentColor = a_color;
+    v_texCoord = a_texCoord;
+}
@@ -0,0 +1,19 @@
+/*
+ * cocos2d for iPhone: http://www.cocos2d-iphone.org
+ *
+ * Copyright (c) 2011 Ricardo Quesada
+ * Copyright (c) 2012 Zynga Inc.
+ */
+
+const char* ccPositionColor_frag = R"(
+#ifdef GL_ES
+precision lowp float;
+#endif
+
+varying vec4 v_fragmentColor;
+
+void main()
+{
+    gl_FragColor = v_fragmentColor;
+}
+)";
@@ -0,0 +1,24 @@
+/*
+ * cocos2d for iPhone: http://www.cocos2d-iphone.org
+ *
+ * Copyright (c) 2011 Ricardo Quesada
+ * Copyright (c) 2012 Zynga Inc.
+ */
+
+const char* ccPositionColor_vert = R"(
+attribute vec4 a_position;
+attribute vec4 a_color;
+
+#ifdef GL_ES
+varying lowp vec4 v_fragmentColor;
+#else
+varying vec4 v_fragmentColor;
+#endif
+
+void main()
+{
+    gl_Position = CC_MVPMatrix * a_position;
+    gl_PointSize = CC_PointSize;
+    v_fragmentColor = a_color;
+}
+)";
@@ -0,0 +1,20 @@
+/*
+ * cocos2d for iPhone: http://www.cocos2d-iphone.org
+ *
+ * Copyright (c) 2011 Ricardo Quesada
+ * Copyright (c) 2012 Zynga Inc.
+ */
+
+const char* ccPositionTextureColor_frag = R"(
+#ifdef GL_ES
+precision lowp float;
+#endif
+
+varying vec4 v_fragmentColor;
+varying vec2 v_texCoord;
+
+void main()
+{
+    gl_FragColor = v_fragmentColor * texture2D(CC_Texture0, v_texCoord);
+}
+)";
@@ -0,0 +1,26 @@
+#version 310 es
+precision highp float;
+precision highp int;
+#ifdef GL_ES
+#endif
+layout (location = 0) in vec4 v_fragmentColor ;
+layout (location = 1) in vec2 v_texCoord ;
+layout(std140, binding = 0) uniform u_textColor {
+    vec4 U_15256;
+};
+layout (binding = 0) uniform sampler2D u_texture;
+layout (location = 0) out vec4 FragColor;
+void main()
+{
+    vec4 color= vec4(texture(u_texture, v_texCoord));
+    //the texture use dual channel 16-bit output for distance_map
+    //float dist= //float(color.b+color.g/256.0);
+    // the texture use single channel 8-bit output for distance_map
+    float dist= float(color.a);
+    //TODO: Implementation 'fwidth' for glsl 1.0
+    //float width= //float(fwidth(dist));
+    //assign width for constant will lead to a little bit fuzzy,it's temporary measure.
+    float width= float(0.04);
+    float alpha= float(smoothstep(0.5-width, 0.5+width, dist) *  U_15256.a);
+    FragColor = v_fragmentColor * vec4( U_15256.rgb,alpha);
+}
@@ -0,0 +1,22 @@
+#version 310 es
+precision highp float;
+precision highp int;
+layout (location = 0) in vec4 a_position;
+layout (location = 1) in vec2 a_texCoord;
+layout (location = 2) in vec4 a_color;
+layout(std140, binding = 0) uniform u_MVPMatrix {
+    mat4 U_15164;
+};
+#ifdef GL_ES
+layout (location = 0) out vec4 v_fragmentColor ;
+layout (location = 1) out vec2 v_texCoord ;
+#else
+layout (location = 0) out vec4 v_fragmentColor ;
+layout (location = 1) out vec2 v_texCoord ;
+#endif
+void main()
+{
+    gl_Position =  U_15164 * a_position;
+    v_fragmentColor = a_color;
+    v_texCoord = a_texCoord;
+}
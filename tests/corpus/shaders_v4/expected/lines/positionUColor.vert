@@ -0,0 +1,21 @@
+#version 310 es
+precision highp float;
+precision highp int;
+layout (location = 0) in vec4 a_position;
+layout(std140, binding = 0) uniform u_MVPMatrix {
+    mat4 U_15164;
+};
+layout(std140, binding = 0) uniform u_color {
+    vec4 U_6131;
+};
+#ifdef GL_ES
+layout (location = 0) out vec4 v_fragmentColor ;
+#else
+layout (location = 0) out vec4 v_fragmentColor ;
+#endif
+void main()
+{
+    gl_Position =  U_15164 * a_position;
+    gl_PointSize = 1.0;
+    v_fragmentColor =  U_6131;
+}
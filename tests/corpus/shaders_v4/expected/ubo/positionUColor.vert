@@ -0,0 +1,17 @@
+#version 310 es
+
+layout(location = 0) in vec4 a_position;
+
+layout(location = 0) out vec4 v_fragmentColor;
+
+layout(std140, binding = 0) uniform vs_ub {
+    mat4 u_MVPMatrix;
+    vec4 u_color;
+};
+
+void main()
+{
+    gl_Position = u_MVPMatrix * a_position;
+    gl_PointSize = 1.0;
+    v_fragmentColor = u_color;
+}
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2018-2019 Xiamen Yaji Software Co., Ltd.
+ */
+
+const char* positionTextureColor_frag = R"(
+#ifdef GL_ES
+precision lowp float;
+#endif
+
+varying vec4 v_fragmentColor;
+varying vec2 v_texCoord;
+
+uniform sampler2D u_texture;
+
+void main()
+{
+    gl_FragColor = v_fragmentColor * texture2D(u_texture, v_texCoord);
+}
+)";
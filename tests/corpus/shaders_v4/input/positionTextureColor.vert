@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2018-2019 Xiamen Yaji Software Co., Ltd.
+ */
+
+const char* positionTextureColor_vert = R"(
+attribute vec4 a_position;
+attribute vec2 a_texCoord;
+attribute vec4 a_color;
+
+uniform mat4 u_MVPMatrix;
+
+#ifdef GL_ES
+varying lowp vec4 v_fragmentColor;
+varying mediump vec2 v_texCoord;
+#else
+varying vec4 v_fragmentColor;
+varying vec2 v_texCoord;
+#endif
+
+void main()
+{
+    gl_Position = u_MVPMatrix * a_position;
+    v_fragmentColor = a_color;
+    v_texCoord = a_texCoord;
+}
+)";
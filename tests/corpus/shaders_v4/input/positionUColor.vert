@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2018-2019 Xiamen Yaji Software Co., Ltd.
+ */
+
+const char* positionUColor_vert = R"(
+attribute vec4 a_position;
+uniform mat4 u_MVPMatrix;
+uniform vec4 u_color;
+
+#ifdef GL_ES
+varying lowp vec4 v_fragmentColor;
+#else
+varying vec4 v_fragmentColor;
+#endif
+
+void main()
+{
+    gl_Position = u_MVPMatrix * a_position;
+    gl_PointSize = 1.0;
+    v_fragmentColor = u_color;
+}
+)";
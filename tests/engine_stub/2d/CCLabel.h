@@ -0,0 +1,10 @@
+#pragma once
+#include "2d/CCNode.h"
+
+namespace cocos2d {
+class Label : public Node {
+public:
+    static Label* create();
+    virtual void setString(const std::string& text);
+};
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <functional>
+#include <string>
+#include "platform/CCPlatformMacros.h"
+#include "base/CCRef.h"
+#include "base/CCVector.h"
+#include "math/Mat4.h"
+#include "math/Vec2.h"
+
+namespace cocos2d {
+class GLProgram;
+class GLProgramState;
+class Renderer;
+
+class Node : public Ref {
+public:
+    static Node* create();
+
+    virtual void setName(const std::string& name);
+    virtual Node* getChildByName(const std::string& name) const;
+    virtual Node* getChildByTag(int tag) const;
+    virtual void addChild(Node* child);
+    const Vector<Node*>& getChildren() const;
+    Node* getParent() const;
+    virtual void setPosition(const Vec2& position);
+
+    virtual void update(float delta);
+    virtual void draw(Renderer* renderer, const Mat4& transform, unsigned int flags);
+
+    void schedule(const std::function<void(float)>& callback, float interval, const std::string& key);
+    void unschedule(const std::string& key);
+    void scheduleUpdate();
+
+    GLProgram* getGLProgram() const;
+    GLProgramState* getGLProgramState() const;
+
+protected:
+    Mat4 _modelViewTransform;
+};
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include "2d/CCNode.h"
+
+namespace cocos2d {
+class Texture2D;
+
+class Sprite : public Node {
+public:
+    static Sprite* create(const std::string& filename);
+    virtual bool initWithFile(const std::string& filename);
+    Texture2D* getTexture() const;
+};
+}
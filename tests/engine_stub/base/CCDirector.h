@@ -0,0 +1,16 @@
+#pragma once
+
+namespace cocos2d {
+class GLView;
+class Renderer;
+class Scheduler;
+
+class Director {
+public:
+    static Director* getInstance();
+    GLView* getOpenGLView();
+    void setOpenGLView(GLView* view);
+    Renderer* getRenderer();
+    Scheduler* getScheduler();
+};
+}
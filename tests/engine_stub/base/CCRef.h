@@ -0,0 +1,13 @@
+#pragma once
+
+namespace cocos2d {
+class Ref {
+public:
+    void retain();
+    void release();
+
+protected:
+    Ref();
+    virtual ~Ref();
+};
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+namespace cocos2d {
+template <class T>
+class RefPtr {
+public:
+    RefPtr() = default;
+    RefPtr(T* ptr) : _ptr(ptr) {}
+    T* get() const { return _ptr; }
+    T* operator->() const { return _ptr; }
+    explicit operator bool() const { return _ptr != nullptr; }
+
+private:
+    T* _ptr = nullptr;
+};
+}
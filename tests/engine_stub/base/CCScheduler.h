@@ -0,0 +1,11 @@
+#pragma once
+#include <functional>
+#include <string>
+
+namespace cocos2d {
+class Scheduler {
+public:
+    void schedule(const std::function<void(float)>& callback, void* target, float interval, bool paused, const std::string& key);
+    void unschedule(const std::string& key, void* target);
+};
+}
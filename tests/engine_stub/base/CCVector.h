@@ -0,0 +1,16 @@
+#pragma once
+
+namespace cocos2d {
+template <class T>
+class Vector {
+public:
+    Vector() = default;
+    Vector(const Vector& other) = default;
+    int size() const { return _size; }
+    T at(int index) const;
+
+private:
+    T* _data = nullptr;
+    int _size = 0;
+};
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "platform/CCPlatformMacros.h"
+#include "platform/CCGL.h"
+#include "math/Vec2.h"
+#include "math/Mat4.h"
+#include "base/CCRef.h"
+#include "base/CCVector.h"
+#include "base/CCRefPtr.h"
+#include "base/CCScheduler.h"
+#include "base/CCDirector.h"
+#include "platform/CCGLView.h"
+#include "2d/CCNode.h"
+#include "2d/CCSprite.h"
+#include "2d/CCLabel.h"
+#include "renderer/CCTexture2D.h"
+#include "renderer/CCGLProgram.h"
+#include "renderer/CCGLProgramState.h"
+#include "renderer/ccGLStateCache.h"
+#include "renderer/CCCustomCommand.h"
+#include "renderer/CCRenderer.h"
+#include "renderer/backend/ProgramState.h"
+#include "deprecated/CCDeprecated.h"
+
@@ -0,0 +1,11 @@
+#pragma once
+#include "math/Vec2.h"
+
+namespace cocos2d {
+inline Vec2 ccp(float x, float y) { return Vec2(x, y); }
+inline Vec2 ccpAdd(const Vec2& v1, const Vec2& v2) { return v1 + v2; }
+inline Vec2 ccpSub(const Vec2& v1, const Vec2& v2) { return v1 - v2; }
+inline Vec2 ccpMult(const Vec2& v, float s) { return v * s; }
+inline float ccpLength(const Vec2& v) { return v.length(); }
+inline float ccpDistance(const Vec2& v1, const Vec2& v2) { return v1.distance(v2); }
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+namespace cocos2d {
+class Mat4 {
+public:
+    float m[16];
+};
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+namespace cocos2d {
+class Vec2 {
+public:
+    Vec2() = default;
+    Vec2(float xx, float yy) : x(xx), y(yy) {}
+    Vec2 operator+(const Vec2& v) const { return Vec2(x + v.x, y + v.y); }
+    Vec2 operator-(const Vec2& v) const { return Vec2(x - v.x, y - v.y); }
+    Vec2 operator*(float s) const { return Vec2(x * s, y * s); }
+    float length() const { return x + y; }
+    float distance(const Vec2& v) const { return (*this - v).length(); }
+
+    float x = 0;
+    float y = 0;
+};
+typedef Vec2 Point;
+}
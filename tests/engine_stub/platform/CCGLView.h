@@ -0,0 +1,9 @@
+#pragma once
+#include "base/CCRef.h"
+
+namespace cocos2d {
+class GLView : public Ref {
+public:
+    virtual void setFrameSize(float width, float height);
+};
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#define NS_CC_BEGIN namespace cocos2d {
+#define NS_CC_END }
+#define USING_NS_CC using namespace cocos2d
+
+#define CC_CALLBACK_0(__selector__, __target__, ...) std::bind(&__selector__, __target__, ##__VA_ARGS__)
+// as of COCOS2D_DEBUG
+#define CHECK_GL_ERROR_DEBUG() \
+    do {                       \
+    } while (false)
+#define CC_INCREMENT_GL_DRAWN_BATCHES_AND_VERTICES(__drawcalls__, __vertices__) \
+    do {                                                                        \
+        auto __renderer__ = cocos2d::Director::getInstance()->getRenderer();    \
+        __renderer__->addDrawnBatches(__drawcalls__);                           \
+        __renderer__->addDrawnVertices(__vertices__);                           \
+    } while (0)
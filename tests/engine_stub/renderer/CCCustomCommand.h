@@ -0,0 +1,11 @@
+#pragma once
+#include <functional>
+
+namespace cocos2d {
+class CustomCommand {
+public:
+    void init(float globalZOrder);
+
+    std::function<void()> func;
+};
+}
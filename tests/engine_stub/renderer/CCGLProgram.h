@@ -0,0 +1,18 @@
+#pragma once
+#include "base/CCRef.h"
+#include "math/Mat4.h"
+
+namespace cocos2d {
+class GLProgram : public Ref {
+public:
+    enum {
+        VERTEX_ATTRIB_POSITION,
+        VERTEX_ATTRIB_COLOR,
+        VERTEX_ATTRIB_TEX_COORD,
+    };
+
+    void use();
+    void setUniformsForBuiltins();
+    void setUniformsForBuiltins(const Mat4& modelView);
+};
+}
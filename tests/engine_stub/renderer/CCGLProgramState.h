@@ -0,0 +1,10 @@
+#pragma once
+#include "renderer/CCGLProgram.h"
+
+namespace cocos2d {
+class GLProgramState : public Ref {
+public:
+    static GLProgramState* getOrCreateWithGLProgram(GLProgram* program);
+    void apply(const Mat4& modelView);
+};
+}
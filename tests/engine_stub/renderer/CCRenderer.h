@@ -0,0 +1,12 @@
+#pragma once
+
+namespace cocos2d {
+class CustomCommand;
+
+class Renderer {
+public:
+    void addCommand(CustomCommand* command);
+    void addDrawnBatches(int number);
+    void addDrawnVertices(int number);
+};
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include "base/CCRef.h"
+#include "platform/CCGL.h"
+
+namespace cocos2d {
+class Texture2D : public Ref {
+public:
+    enum class PixelFormat {
+        AUTO,
+        RGBA8888,
+        RGB888,
+        RGBA4444,
+        I8,
+        AI88,
+    };
+
+    static void setDefaultAlphaPixelFormat(PixelFormat format);
+    GLuint getName() const;
+};
+}
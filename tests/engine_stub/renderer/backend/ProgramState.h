@@ -0,0 +1,18 @@
+#pragma once
+#include <string>
+#include "base/CCRef.h"
+
+namespace cocos2d {
+namespace backend {
+struct UniformLocation {
+    int location[2] = {-1, -1};
+    explicit operator bool() const { return location[0] >= 0; }
+};
+
+class ProgramState : public Ref {
+public:
+    UniformLocation getUniformLocation(const std::string& name) const;
+    void setUniform(const UniformLocation& location, const void* data, unsigned int size);
+};
+}
+}
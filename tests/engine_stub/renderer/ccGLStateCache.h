@@ -0,0 +1,20 @@
+#pragma once
+#include "platform/CCGL.h"
+
+namespace cocos2d {
+class Texture2D;
+
+namespace GL {
+enum {
+    VERTEX_ATTRIB_FLAG_POSITION = 1 << 0,
+    VERTEX_ATTRIB_FLAG_COLOR = 1 << 1,
+    VERTEX_ATTRIB_FLAG_TEX_COORD = 1 << 2,
+    VERTEX_ATTRIB_FLAG_POS_COLOR_TEX = VERTEX_ATTRIB_FLAG_POSITION | VERTEX_ATTRIB_FLAG_COLOR | VERTEX_ATTRIB_FLAG_TEX_COORD,
+};
+
+void enableVertexAttribs(unsigned int flags);
+void bindTexture2D(GLuint textureId);
+void bindTexture2D(Texture2D* texture);
+void blendFunc(GLenum sfactor, GLenum dfactor);
+}
+}
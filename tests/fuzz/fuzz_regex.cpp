@@ -0,0 +1,282 @@
+// Performance fuzzing of the std::regex hot paths, flags inputs which cost more than a time-per-byte budget:
+//   - ax_migrate_cpp_buffer with the c++ include patterns and the cmake pattern
+//   - GlslParseContext::parseAST
+//
+// standalone:
+//   axmol-migrate-fuzz [--budget <ns/byte>] [--target <name>] <file|dir>...   replay inputs, exit 1 if any over budget
+//   axmol-migrate-fuzz --generate <runs> --save-dir <dir> [--seed <n>] [--budget <ns/byte>] [<seed file|dir>...]
+//                                                                           mutate seeds, save the slow ones to dir
+// libFuzzer (AX_MIGRATE_LIBFUZZER=ON):
+//   axmol-migrate-fuzz [libFuzzer options] <corpus dir>, an input over budget aborts, so it is saved as crash-*
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "axmigrate.h"
+
+namespace stdfs = std::filesystem;
+
+extern int parse_shader_source_ast(std::string& shader_source, const std::string& outpath);
+
+namespace
+{
+// every target is allowed a fixed cost plus the budget of each byte
+double g_budget_ns_per_byte = 10000;
+const char* g_only_target   = nullptr;  // --target, run one target only
+constexpr int64_t fixed_allowance_ns = 5000000;
+
+void migrate_cpp(const std::string& input, int flags, bool is_cmake)
+{
+    ax_migrate_options opts;
+    ax_migrate_options_init(&opts);
+    opts.flags = flags;
+    char* out       = nullptr;
+    size_t out_size = 0;
+    if (ax_migrate_cpp_buffer(&opts, input.data(), input.size(), is_cmake, &out, &out_size) >= 0)
+        ax_migrate_free(out);
+}
+
+struct target
+{
+    const char* name;
+    void (*run)(const std::string& input);
+};
+
+const target g_targets[] = {
+    {"include", [](const std::string& input) { migrate_cpp(input, 0, false); }},
+    {"include_fuzzy", [](const std::string& input) { migrate_cpp(input, AX_MIGRATE_FUZZY, false); }},
+    {"cmake", [](const std::string& input) { migrate_cpp(input, 0, true); }},
+    {"parseAST.vert",
+     [](const std::string& input) {
+         std::string source = input;
+         parse_shader_source_ast(source, "fuzz.vert");
+     }},
+    {"parseAST.frag",
+     [](const std::string& input) {
+         std::string source = input;
+         parse_shader_source_ast(source, "fuzz.frag");
+     }},
+};
+
+struct verdict
+{
+    const char* target = nullptr;
+    double ns_per_byte = 0;
+    bool over_budget   = false;
+};
+
+// the slowest target of input
+verdict measure(const std::string& input)
+{
+    verdict worst;
+    for (auto& t : g_targets)
+    {
+        if (g_only_target && strcmp(g_only_target, t.name) != 0)
+            continue;
+        auto start = std::chrono::steady_clock::now();
+        t.run(input);
+        auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        auto ns_per_byte = static_cast<double>(nanos) / static_cast<double>(input.size() ? input.size() : 1);
+        bool over_budget = nanos > fixed_allowance_ns + g_budget_ns_per_byte * static_cast<double>(input.size());
+        if (!worst.target || over_budget > worst.over_budget ||
+            (over_budget == worst.over_budget && ns_per_byte > worst.ns_per_byte))
+            worst = verdict{t.name, ns_per_byte, over_budget};
+    }
+    return worst;
+}
+}  // namespace
+
+#if defined(AX_MIGRATE_LIBFUZZER)
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    std::string input{reinterpret_cast<const char*>(data), size};
+    auto result = measure(input);
+    if (result.over_budget)
+    {
+        fprintf(stderr, "%s: %.1f ns/byte over budget %.1f ns/byte, size=%zu\n", result.target, result.ns_per_byte,
+                g_budget_ns_per_byte, size);
+        abort();
+    }
+    return 0;
+}
+#else
+namespace
+{
+std::string read_file(const stdfs::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::string{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+void write_file(const stdfs::path& path, const std::string& content)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), content.size());
+}
+
+void collect_inputs(const char* arg, std::vector<stdfs::path>& inputs)
+{
+    if (stdfs::is_directory(arg))
+    {
+        for (auto& entry : stdfs::recursive_directory_iterator(arg))
+            if (entry.is_regular_file())
+                inputs.push_back(entry.path());
+    }
+    else
+        inputs.emplace_back(arg);
+}
+
+// tokens the patterns are sensitive to
+const std::string_view g_dict[] = {
+    "#include \"", "#import <", "#include <", "CC", "cc", "\\bCC", "/CC", "\"", "<", ">", "/", " ", "\t", "\n",
+    "attribute ", "varying ", "uniform ", "sampler2D ", "samplerCube ", "texture2D(", "textureCube(", "gl_FragColor",
+    "vec4 sample =", "= sample.", "#define ", "#if ", "#ifdef GL_ES", "#elif ", "#else", "#endif", "void main(",
+    "(", ")", ";", "=", "[", "]", "a_position", "u_MVPMatrix", "0123456789", "aaaaaaaaaaaaaaaa",
+};
+
+std::string mutate(std::string input, std::mt19937& rng)
+{
+    auto pick = [&](size_t n) { return n ? static_cast<size_t>(rng() % n) : 0; };
+    int steps = 1 + static_cast<int>(pick(4));
+    for (int i = 0; i < steps; ++i)
+    {
+        switch (pick(5))
+        {
+        case 0:  // insert a dictionary token
+            input.insert(pick(input.size() + 1), g_dict[pick(std::size(g_dict))]);
+            break;
+        case 1:
+        {  // repeat a small range many times, long lines are what backtracking suffers from
+            auto pos   = pick(input.size() + 1);
+            auto len   = 1 + pick(std::min<size_t>(input.size() - std::min(pos, input.size()), 16));
+            auto piece = input.substr(pos, len);
+            if (piece.empty())
+                piece = g_dict[pick(std::size(g_dict))];
+            std::string repeated;
+            for (size_t n = 64 + pick(4096); n > 0; --n)
+                repeated += piece;
+            input.insert(pos, repeated);
+            break;
+        }
+        case 2:  // join lines as minified code
+            for (auto& ch : input)
+                if (ch == '\n' && pick(4) == 0)
+                    ch = ' ';
+            break;
+        case 3:
+        {  // erase a range
+            auto pos = pick(input.size() + 1);
+            input.erase(pos, pick(64));
+            break;
+        }
+        default:  // flip a byte
+            if (!input.empty())
+                input[pick(input.size())] = static_cast<char>(rng());
+            break;
+        }
+    }
+    constexpr size_t max_size = 1024 * 1024;
+    if (input.size() > max_size)
+        input.resize(max_size);
+    return input;
+}
+
+int replay(const std::vector<stdfs::path>& inputs)
+{
+    int failures = 0;
+    for (auto& path : inputs)
+    {
+        auto input  = read_file(path);
+        auto result = measure(input);
+        printf("%s %s: %.1f ns/byte, size=%zu\n", result.over_budget ? "SLOW" : "ok  ", path.generic_string().c_str(),
+               result.ns_per_byte, input.size());
+        if (result.over_budget)
+            ++failures;
+    }
+    printf("%d of %zu inputs over budget %.1f ns/byte (%s)\n", failures, inputs.size(), g_budget_ns_per_byte,
+           failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
+
+int generate(const std::vector<stdfs::path>& seeds, int runs, const char* save_dir, unsigned seed)
+{
+    std::vector<std::string> pool;
+    for (auto& path : seeds)
+        pool.push_back(read_file(path));
+    if (pool.empty())
+        pool.emplace_back("#include \"CCNode.h\"\nattribute vec4 a_position;\nvoid main() {}\n");
+
+    stdfs::create_directories(save_dir);
+    auto pending_path = stdfs::path(save_dir) / "pending.input";  // kept when the input crashes the process
+    std::mt19937 rng(seed);
+    int found = 0;
+    for (int i = 0; i < runs; ++i)
+    {
+        auto input = mutate(pool[rng() % pool.size()], rng);
+        write_file(pending_path, input);
+        auto result = measure(input);
+        if (result.over_budget)
+        {
+            char name[64];
+            snprintf(name, sizeof(name), "slow-%s-%08x.input", result.target, static_cast<unsigned>(rng()));
+            write_file(stdfs::path(save_dir) / name, input);
+            printf("run %d: %s %.1f ns/byte, size=%zu, saved %s\n", i, result.target, result.ns_per_byte, input.size(),
+                   name);
+            ++found;
+        }
+        else if (input.size() < 64 * 1024)
+            pool.push_back(std::move(input));  // grow the pool by cheap inputs
+    }
+    stdfs::remove(pending_path);
+    printf("%d of %d runs over budget %.1f ns/byte\n", found, runs, g_budget_ns_per_byte);
+    return found ? 1 : 0;
+}
+}  // namespace
+
+int main(int argc, const char** argv)
+{
+    int runs              = 0;
+    unsigned seed         = 1;
+    const char* save_dir  = nullptr;
+    std::vector<stdfs::path> inputs;
+    for (int argi = 1; argi < argc; ++argi)
+    {
+        if (strcmp(argv[argi], "--budget") == 0 && argi + 1 < argc)
+            g_budget_ns_per_byte = atof(argv[++argi]);
+        else if (strcmp(argv[argi], "--generate") == 0 && argi + 1 < argc)
+            runs = atoi(argv[++argi]);
+        else if (strcmp(argv[argi], "--save-dir") == 0 && argi + 1 < argc)
+            save_dir = argv[++argi];
+        else if (strcmp(argv[argi], "--target") == 0 && argi + 1 < argc)
+            g_only_target = argv[++argi];
+        else if (strcmp(argv[argi], "--seed") == 0 && argi + 1 < argc)
+            seed = static_cast<unsigned>(strtoul(argv[++argi], nullptr, 10));
+        else
+            collect_inputs(argv[argi], inputs);
+    }
+
+    if (runs > 0)
+    {
+        if (!save_dir)
+        {
+            fprintf(stderr, "--save-dir required by --generate\n");
+            return 2;
+        }
+        return generate(inputs, runs, save_dir, seed);
+    }
+    if (inputs.empty())
+    {
+        fprintf(stderr, "usage: axmol-migrate-fuzz [--budget <ns/byte>] [--target <name>] <file|dir>...\n"
+                        "       axmol-migrate-fuzz --generate <runs> --save-dir <dir> [--seed <n>] [<seed file|dir>...]\n");
+        return 2;
+    }
+    return replay(inputs);
+}
+#endif
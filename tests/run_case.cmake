@@ -0,0 +1,120 @@
+# Migrates a copy of a corpus input and compares the result with the expected tree
+#
+# cmake -DEXE=<axmol-migrate> -DTYPE=<cpp|shader> -DINPUT_DIR=<dir> -DEXPECTED_DIR=<dir> -DWORK_DIR=<dir>
+#       [-DARGS=<arg1|arg2>] [-DBUDGET_MS=<ms>] [-DNEEDS_LIBCLANG=1]
+#       [-DCOMPILE_COMMANDS=<compile_commands.json.in> -DENGINE_DIR=<dir>] [-DSCRUB=<file1|file2>] -P run_case.cmake
+#
+# NEEDS_LIBCLANG skips the case when no libclang is next to EXE, the test is reported as skipped.
+# COMPILE_COMMANDS is configured with @WORK_DIR@ and @ENGINE_DIR@ into the build dir passed by --compile-commands.
+# SCRUB are the files of the result, i.e. reports, whose absolute paths are replaced by @WORK_DIR@ and @ENGINE_DIR@ and
+# whose times measured are zeroed, the rows of a csv ranked by them are sorted.
+# EXE runs in WORK_DIR, so relative ARGS write into the result.
+# BUDGET_MS is checked against the wall time reported by --stats json, which excludes process startup.
+# Set env AX_MIGRATE_UPDATE_GOLDEN=1 to overwrite the expected tree with the result instead.
+
+cmake_minimum_required(VERSION 3.13)
+
+foreach(var EXE TYPE INPUT_DIR EXPECTED_DIR WORK_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} not specified")
+    endif()
+endforeach()
+
+if(NEEDS_LIBCLANG)
+    get_filename_component(exe_dir ${EXE} DIRECTORY)
+    file(GLOB libclang ${exe_dir}/libclang.so ${exe_dir}/libclang.dylib ${exe_dir}/libclang.dll)
+    if(NOT libclang)
+        message(STATUS "libclang not found, skipped")
+        return()
+    endif()
+endif()
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+file(COPY ${INPUT_DIR}/ DESTINATION ${WORK_DIR})
+# libclang reports the real paths
+get_filename_component(WORK_DIR ${WORK_DIR} REALPATH)
+
+string(REPLACE "|" ";" args "${ARGS}")
+if(COMPILE_COMMANDS)
+    get_filename_component(ENGINE_DIR ${ENGINE_DIR} REALPATH)
+    file(REMOVE_RECURSE ${WORK_DIR}.build)
+    configure_file(${COMPILE_COMMANDS} ${WORK_DIR}.build/compile_commands.json @ONLY)
+    list(APPEND args --compile-commands ${WORK_DIR}.build)
+endif()
+set(stats_file ${WORK_DIR}.stats.json)
+execute_process(COMMAND ${EXE} ${TYPE} --source-dir ${WORK_DIR} ${args} --stats json --stats-file ${stats_file}
+    WORKING_DIRECTORY ${WORK_DIR}
+    RESULT_VARIABLE ret
+    OUTPUT_VARIABLE out
+    ERROR_VARIABLE err)
+if(NOT ret EQUAL 0)
+    message(FATAL_ERROR "axmol-migrate exit with ${ret}\n${out}${err}")
+endif()
+
+string(REPLACE "|" ";" scrub "${SCRUB}")
+foreach(file IN LISTS scrub)
+    if(NOT EXISTS ${WORK_DIR}/${file})
+        continue()
+    endif()
+    file(READ ${WORK_DIR}/${file} content)
+    string(REPLACE "${WORK_DIR}" "@WORK_DIR@" content "${content}")
+    if(ENGINE_DIR)
+        string(REPLACE "${ENGINE_DIR}" "@ENGINE_DIR@" content "${content}")
+    endif()
+    string(REGEX REPLACE "[0-9]+\\.[0-9]+\\(ms\\)" "0.0(ms)" content "${content}")
+    if(file MATCHES "\\.csv$")
+        string(REGEX REPLACE ",[0-9]+\\.[0-9]+" ",0.000" content "${content}")
+        string(REGEX REPLACE "\n$" "" content "${content}")
+        string(REPLACE "\n" ";" rows "${content}")
+        list(GET rows 0 head)
+        list(REMOVE_AT rows 0)
+        list(SORT rows)
+        list(JOIN rows "\n" content)
+        set(content "${head}\n${content}\n")
+    endif()
+    file(WRITE ${WORK_DIR}/${file} "${content}")
+endforeach()
+
+if("$ENV{AX_MIGRATE_UPDATE_GOLDEN}" STREQUAL "1")
+    file(REMOVE_RECURSE ${EXPECTED_DIR})
+    file(COPY ${WORK_DIR}/ DESTINATION ${EXPECTED_DIR})
+    message(STATUS "Updated ${EXPECTED_DIR}")
+    return()
+endif()
+
+file(GLOB_RECURSE expected_files RELATIVE ${EXPECTED_DIR} ${EXPECTED_DIR}/*)
+file(GLOB_RECURSE actual_files RELATIVE ${WORK_DIR} ${WORK_DIR}/*)
+
+set(failures "")
+foreach(file IN LISTS expected_files)
+    if(NOT file IN_LIST actual_files)
+        string(APPEND failures "  missing: ${file}\n")
+    endif()
+endforeach()
+if(CMAKE_VERSION VERSION_GREATER_EQUAL 3.14)
+    set(compare_opts --ignore-eol) # the checkout may have crlf
+endif()
+foreach(file IN LISTS actual_files)
+    if(NOT file IN_LIST expected_files)
+        string(APPEND failures "  unexpected: ${file}\n")
+        continue()
+    endif()
+    execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${compare_opts} ${EXPECTED_DIR}/${file} ${WORK_DIR}/${file}
+        RESULT_VARIABLE differ)
+    if(differ)
+        string(APPEND failures "  differ: ${file}\n")
+    endif()
+endforeach()
+if(failures)
+    message(FATAL_ERROR "Result of ${WORK_DIR} not match ${EXPECTED_DIR}:\n${failures}${out}${err}")
+endif()
+
+if(DEFINED BUDGET_MS AND CMAKE_VERSION VERSION_GREATER_EQUAL 3.19)
+    file(READ ${stats_file} stats)
+    string(JSON wall_ms GET "${stats}" wall_ms)
+    if(wall_ms GREATER BUDGET_MS)
+        message(FATAL_ERROR "Migrate cost ${wall_ms}(ms), over budget ${BUDGET_MS}(ms)")
+    endif()
+    message(STATUS "Migrate cost ${wall_ms}(ms), budget ${BUDGET_MS}(ms)")
+endif()
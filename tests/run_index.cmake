@@ -0,0 +1,99 @@
+# Checks the include index with --since on a git copy of a corpus input
+#
+# cmake -DEXE=<axmol-migrate> -DGIT=<git> -DINPUT_DIR=<dir> -DWORK_DIR=<dir> -DHEADER=<path> -DAFFECTED=<N>
+#       -P run_index.cmake
+#
+# The first run indexes all files, a rerun reads the saved index and scans none, a touched file is found unchanged
+# by its content, and after HEADER changes only it is scanned again and cpp --since migrates the AFFECTED files
+# including it too. An index file of other content fails to open.
+
+cmake_minimum_required(VERSION 3.19)
+
+foreach(var EXE GIT INPUT_DIR WORK_DIR HEADER AFFECTED)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} not specified")
+    endif()
+endforeach()
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+file(COPY ${INPUT_DIR}/ DESTINATION ${WORK_DIR}/tree)
+
+function(run_git)
+    execute_process(COMMAND ${GIT} -c user.name=axmol -c user.email=axmol@localhost ${ARGN}
+        WORKING_DIRECTORY ${WORK_DIR}/tree
+        RESULT_VARIABLE ret
+        OUTPUT_QUIET
+        ERROR_VARIABLE err)
+    if(NOT ret EQUAL 0)
+        message(FATAL_ERROR "git ${ARGN} fail\n${err}")
+    endif()
+endfunction()
+run_git(init -q)
+run_git(add -A)
+run_git(commit -q -m input)
+
+# the index is out of the tree, an untracked file would be changed since HEAD
+set(run 0)
+function(run_indexed var)
+    math(EXPR run "${run} + 1")
+    set(run ${run} PARENT_SCOPE)
+    set(stats_file ${WORK_DIR}/run${run}.stats.json)
+    execute_process(COMMAND ${EXE} cpp --source-dir . --index ${WORK_DIR}/tree.index --since HEAD
+            --stats json --stats-file ${stats_file}
+        WORKING_DIRECTORY ${WORK_DIR}/tree
+        RESULT_VARIABLE ret
+        OUTPUT_VARIABLE out
+        ERROR_VARIABLE err)
+    if(NOT ret EQUAL 0 OR NOT EXISTS ${stats_file})
+        message(FATAL_ERROR "axmol-migrate run ${run} fail\n${out}${err}")
+    endif()
+    file(READ ${stats_file} stats)
+    set(${var} "${stats}" PARENT_SCOPE)
+endfunction()
+
+# a counter of the stats, 0 if not counted
+function(counter stats name var)
+    string(JSON value ERROR_VARIABLE missing GET "${stats}" counters ${name})
+    if(missing)
+        set(value 0)
+    endif()
+    set(${var} ${value} PARENT_SCOPE)
+endfunction()
+
+function(expect stats name expected what)
+    counter("${stats}" ${name} value)
+    if(NOT value EQUAL expected)
+        message(FATAL_ERROR "${what}: ${name} is ${value}, expected ${expected}\n${stats}")
+    endif()
+endfunction()
+
+run_indexed(stats)
+counter("${stats}" index_files files)
+if(files LESS 2)
+    message(FATAL_ERROR "Nothing indexed\n${stats}")
+endif()
+expect("${stats}" index_files_scanned ${files} "The first run")
+
+run_indexed(stats)
+expect("${stats}" index_files ${files} "The rerun")
+expect("${stats}" index_files_scanned 0 "The rerun")
+
+file(TOUCH ${WORK_DIR}/tree/${HEADER})
+run_indexed(stats)
+expect("${stats}" index_files_scanned 0 "The header touched")
+
+file(APPEND ${WORK_DIR}/tree/${HEADER} "// changed\n")
+run_indexed(stats)
+expect("${stats}" index_files_scanned 1 "The header changed")
+expect("${stats}" files_affected ${AFFECTED} "The header changed")
+
+file(WRITE ${WORK_DIR}/tree.index "not an index")
+execute_process(COMMAND ${EXE} cpp --source-dir . --index ${WORK_DIR}/tree.index --since HEAD
+    WORKING_DIRECTORY ${WORK_DIR}/tree
+    OUTPUT_VARIABLE out
+    ERROR_VARIABLE err)
+if(NOT "${out}${err}" MATCHES "is not an include index")
+    message(FATAL_ERROR "An invalid index is opened\n${out}${err}")
+endif()
+message(STATUS "${files} files indexed, ${AFFECTED} files affected by ${HEADER}")
@@ -0,0 +1,116 @@
+# Checks the write-ahead journal of a migration on a copy of a corpus input
+#
+# cmake -DEXE=<axmol-migrate> -DTYPE=<cpp|shader> -DINPUT_DIR=<dir> -DWORK_DIR=<dir> -DMODE=<rollback|resume>
+#       -P run_journal.cmake
+#
+# rollback: a journaled run, then --rollback restores the input exactly and removes the journal.
+# resume: the journal of a run is cut after its second write, which is left pending, and the tree is reset to the
+# state the run had there, with the file written garbled; --resume skips the files finished, restores the pending
+# one and migrates the rest, the result equals a run without interruption. It's rolled back to the input after.
+
+cmake_minimum_required(VERSION 3.13)
+
+foreach(var EXE TYPE INPUT_DIR WORK_DIR MODE)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} not specified")
+    endif()
+endforeach()
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+file(COPY ${INPUT_DIR}/ DESTINATION ${WORK_DIR}/tree)
+
+# the journal records the paths as given, so all runs are relative to WORK_DIR
+function(run_migrate)
+    execute_process(COMMAND ${EXE} ${ARGN}
+        WORKING_DIRECTORY ${WORK_DIR}
+        RESULT_VARIABLE ret
+        OUTPUT_VARIABLE out
+        ERROR_VARIABLE err)
+    if(NOT ret EQUAL 0 OR err MATCHES "fail|Invalid")
+        message(FATAL_ERROR "axmol-migrate ${ARGN} fail\n${out}${err}")
+    endif()
+endfunction()
+
+# whether the trees have the same files of the same bytes
+function(compare_trees expected actual what)
+    file(GLOB_RECURSE expected_files RELATIVE ${expected} ${expected}/*)
+    file(GLOB_RECURSE actual_files RELATIVE ${actual} ${actual}/*)
+    if(NOT expected_files STREQUAL actual_files)
+        message(FATAL_ERROR "The files ${what} not match:\n  ${actual_files}\n  ${expected_files}")
+    endif()
+    foreach(file IN LISTS expected_files)
+        execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${expected}/${file} ${actual}/${file}
+            RESULT_VARIABLE differ)
+        if(differ)
+            message(FATAL_ERROR "${file} ${what} differ")
+        endif()
+    endforeach()
+endfunction()
+
+function(rollback_to_input)
+    run_migrate(${TYPE} --journal journal --rollback)
+    compare_trees(${INPUT_DIR} ${WORK_DIR}/tree "rolled back and of the input")
+    if(EXISTS ${WORK_DIR}/journal OR EXISTS ${WORK_DIR}/journal.d)
+        message(FATAL_ERROR "The journal is kept after rolled back")
+    endif()
+endfunction()
+
+if(MODE STREQUAL "rollback")
+    run_migrate(${TYPE} --source-dir tree --journal journal)
+    file(STRINGS ${WORK_DIR}/journal writes REGEX "^W ")
+    if(NOT writes)
+        message(FATAL_ERROR "Nothing migrated to roll back")
+    endif()
+    rollback_to_input()
+    message(STATUS "Rolled back to the input")
+    return()
+endif()
+
+if(NOT MODE STREQUAL "resume")
+    message(FATAL_ERROR "Invalid MODE ${MODE}")
+endif()
+
+# the result of a run without interruption, and its journal, one file at a time so the entries are in order
+file(COPY ${INPUT_DIR}/ DESTINATION ${WORK_DIR}/expected)
+run_migrate(${TYPE} --source-dir expected --journal expected.journal -j 1)
+file(STRINGS ${WORK_DIR}/expected.journal lines)
+
+# cut after the second write, the entries are of the tree then
+set(journal "")
+set(finished "")
+set(pending "")
+set(writes 0)
+foreach(line IN LISTS lines)
+    string(REPLACE "expected/" "tree/" line "${line}")
+    string(APPEND journal "${line}\n")
+    if(line MATCHES "^F tree/(.*)$")
+        list(APPEND finished ${CMAKE_MATCH_1})
+    elseif(line MATCHES "^W [0-9]+ [0-9a-f-]+ tree/(.*)$")
+        math(EXPR writes "${writes} + 1")
+        if(writes EQUAL 2)
+            set(pending ${CMAKE_MATCH_1})
+            break()
+        endif()
+    endif()
+endforeach()
+if(NOT pending OR NOT finished)
+    message(FATAL_ERROR "The journal has less than 2 writes:\n${lines}")
+endif()
+file(WRITE ${WORK_DIR}/journal "${journal}")
+file(COPY ${WORK_DIR}/expected.journal.d/ DESTINATION ${WORK_DIR}/journal.d)
+foreach(file IN LISTS finished)
+    configure_file(${WORK_DIR}/expected/${file} ${WORK_DIR}/tree/${file} COPYONLY)
+endforeach()
+file(WRITE ${WORK_DIR}/tree/${pending} "garbled by the run killed while writing")
+
+run_migrate(${TYPE} --source-dir tree --journal journal --resume -j 1 --stats json --stats-file ${WORK_DIR}/resume.stats.json)
+compare_trees(${WORK_DIR}/expected ${WORK_DIR}/tree "resumed and of the run without interruption")
+list(LENGTH finished count)
+file(READ ${WORK_DIR}/resume.stats.json stats)
+if(NOT stats MATCHES "\"files_resumed\": ${count}[,\n]")
+    message(FATAL_ERROR "Expected ${count} files skipped as finished by --resume:\n${stats}")
+endif()
+
+rollback_to_input()
+message(STATUS "Resumed ${count} files finished, ${pending} pending")
@@ -0,0 +1,48 @@
+# Pipes the requests to axmol-migrate serve and compares the responses with the expected ones
+#
+# cmake -DEXE=<axmol-migrate> -DINPUT_DIR=<dir> -DREQUESTS=<file> -DEXPECTED=<file> -DWORK_DIR=<dir> -P run_serve.cmake
+#
+# @WORK_DIR@ in the requests and responses stands for the copy of INPUT_DIR, the server runs with a manifest,
+# so a file migrated twice is unchanged the second time.
+# Set env AX_MIGRATE_UPDATE_GOLDEN=1 to overwrite the expected responses with the result instead.
+
+cmake_minimum_required(VERSION 3.13)
+
+foreach(var EXE INPUT_DIR REQUESTS EXPECTED WORK_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} not specified")
+    endif()
+endforeach()
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+file(COPY ${INPUT_DIR}/ DESTINATION ${WORK_DIR})
+
+file(READ ${REQUESTS} requests)
+string(REPLACE "@WORK_DIR@" "${WORK_DIR}" requests "${requests}")
+file(WRITE ${WORK_DIR}.requests.jsonl "${requests}")
+file(REMOVE ${WORK_DIR}.manifest)
+
+execute_process(COMMAND ${EXE} serve --manifest ${WORK_DIR}.manifest
+    INPUT_FILE ${WORK_DIR}.requests.jsonl
+    RESULT_VARIABLE ret
+    OUTPUT_VARIABLE out
+    ERROR_VARIABLE err)
+if(NOT ret EQUAL 0)
+    message(FATAL_ERROR "axmol-migrate serve exit with ${ret}\n${out}${err}")
+endif()
+string(REPLACE "${WORK_DIR}" "@WORK_DIR@" out "${out}")
+
+if("$ENV{AX_MIGRATE_UPDATE_GOLDEN}")
+    file(WRITE ${EXPECTED} "${out}")
+    message(STATUS "Updated ${EXPECTED}")
+    return()
+endif()
+
+file(READ ${EXPECTED} expected)
+if(NOT out STREQUAL expected)
+    message(FATAL_ERROR "The responses differ from ${EXPECTED}:\n${out}")
+endif()
+if(NOT EXISTS ${WORK_DIR}.manifest)
+    message(FATAL_ERROR "The manifest is not saved on shutdown")
+endif()
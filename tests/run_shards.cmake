@@ -0,0 +1,81 @@
+# Migrates a copy of a corpus input whole and another copy shard by shard, then checks that the shards together
+# equal the whole run, that merge-manifests combines their fragments into the manifest of the whole run, and that
+# the merged manifest finds a migrated checkout at another path unchanged
+#
+# cmake -DEXE=<axmol-migrate> -DTYPE=<cpp|shader> -DINPUT_DIR=<dir> -DWORK_DIR=<dir> -DSHARDS=<N> -P run_shards.cmake
+
+cmake_minimum_required(VERSION 3.19)
+
+foreach(var EXE TYPE INPUT_DIR WORK_DIR SHARDS)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} not specified")
+    endif()
+endforeach()
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+foreach(tree whole sharded)
+    file(COPY ${INPUT_DIR}/ DESTINATION ${WORK_DIR}/${tree})
+endforeach()
+
+function(run_migrate)
+    execute_process(COMMAND ${EXE} ${ARGN}
+        RESULT_VARIABLE ret
+        OUTPUT_VARIABLE out
+        ERROR_VARIABLE err)
+    if(NOT ret EQUAL 0 OR err MATCHES "fail|Invalid")
+        message(FATAL_ERROR "axmol-migrate ${ARGN} fail\n${out}${err}")
+    endif()
+endfunction()
+
+run_migrate(${TYPE} --source-dir ${WORK_DIR}/whole --manifest ${WORK_DIR}/whole.manifest)
+set(fragments "")
+foreach(shard RANGE 1 ${SHARDS})
+    run_migrate(${TYPE} --source-dir ${WORK_DIR}/sharded --shard ${shard}/${SHARDS} --manifest ${WORK_DIR}/shard${shard}.manifest)
+    list(APPEND fragments ${WORK_DIR}/shard${shard}.manifest)
+endforeach()
+
+# the trees
+file(GLOB_RECURSE whole_files RELATIVE ${WORK_DIR}/whole ${WORK_DIR}/whole/*)
+file(GLOB_RECURSE sharded_files RELATIVE ${WORK_DIR}/sharded ${WORK_DIR}/sharded/*)
+if(NOT whole_files STREQUAL sharded_files)
+    message(FATAL_ERROR "The files of shards not match the whole run:\n  ${sharded_files}\n  ${whole_files}")
+endif()
+foreach(file IN LISTS whole_files)
+    execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${WORK_DIR}/whole/${file} ${WORK_DIR}/sharded/${file}
+        RESULT_VARIABLE differ)
+    if(differ)
+        message(FATAL_ERROR "${file} of shards differ from the whole run")
+    endif()
+endforeach()
+
+# the manifests, by hash and relative path, the mtimes are of the copies
+run_migrate(merge-manifests --manifest ${WORK_DIR}/merged.manifest ${fragments})
+function(read_entries path var)
+    file(STRINGS ${path} lines REGEX "^[0-9a-f]+ ")
+    set(entries "")
+    foreach(line IN LISTS lines)
+        string(REGEX REPLACE "^([0-9a-f]+) [-0-9]+ [-0-9]+ ([-0-9]+) (.*)$" "\\1 \\2 \\3" entry "${line}")
+        list(APPEND entries "${entry}")
+    endforeach()
+    list(SORT entries)
+    set(${var} "${entries}" PARENT_SCOPE)
+endfunction()
+read_entries(${WORK_DIR}/whole.manifest whole_entries)
+read_entries(${WORK_DIR}/merged.manifest merged_entries)
+list(LENGTH whole_entries count)
+if(count EQUAL 0 OR NOT whole_entries STREQUAL merged_entries)
+    message(FATAL_ERROR "The merged manifest not match the whole run:\n  ${merged_entries}\n  ${whole_entries}")
+endif()
+
+# a checkout at another path reuses the merged manifest
+file(COPY ${WORK_DIR}/sharded/ DESTINATION ${WORK_DIR}/checkout)
+run_migrate(${TYPE} --source-dir ${WORK_DIR}/checkout --manifest ${WORK_DIR}/merged.manifest
+    --stats json --stats-file ${WORK_DIR}/checkout.stats.json)
+file(READ ${WORK_DIR}/checkout.stats.json stats)
+string(JSON unchanged ERROR_VARIABLE no_unchanged GET "${stats}" counters files_unchanged)
+string(JSON replaced ERROR_VARIABLE no_replaced GET "${stats}" counters files_replaced)
+if(no_unchanged OR NOT unchanged EQUAL count OR NOT no_replaced)
+    message(FATAL_ERROR "The checkout at another path is migrated again by the merged manifest:\n${stats}")
+endif()
+message(STATUS "${SHARDS} shards equal the whole run, ${count} manifest entries")
@@ -0,0 +1,10 @@
+#include "generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/CCData0.h
+#include "generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/CCData1.h
+#include "generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/CCData2.h
+#include "generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/CCData3.h
+#include "generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/CCData4.h
+#include "generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/CCData5.h
+#include "generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/CCData6.h
+#include "generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/generated/CCData7.h
+static const unsigned char s_data[] = {0x79, 0x42, 0xbd, 0xf2, 0x21, 0x06, 0xf0, 0x84, 0x77, 0x62, 0xf0, 0xf3, 0xcb, 0x4d, 0x76, 0x4d, 0xc7, 0x07, 0x20, 0x51, 0x15, 0x9a, 0x0f, 0x89, 0xf2, 0xc6, 0xda, 0xca, 0xe3, 0x44, 0xbb, 0x31, 0x12, 0x45, 0xfd, 0x6f, 0x84, 0xdf, 0x9a, 0xd7, 0xc5, 0xb3, 0xd0, 0x76, 0xac, 0x0e, 0x8f, 0x53, 0xa7, 0x35, 0x6c, 0x88, 0x91, 0x3f, 0x20, 0xf6, 0xf7, 0x2d, 0xb0, 0x22, 0xd2, 0x4d, 0x0a, 0x96, 0xda, 0xd4, 0x3c, 0x16, 0x17, 0xc1, 0xa9, 0x8e, 0x78, 0x12, 0x9e, 0x03, 0x27, 0x37, 0x10, 0x65, 0xd0, 0x95, 0x86, 0x4f, 0x15, 0xad, 0xa0, 0xb8, 0x46, 0xc1, 0xc0, 0xeb, 0xc5, 0x34, 0x8a, 0xdc, 0x79, 0x9a, 0xdf, 0x84, 0x9b, 0xad, 0x05, 0xd4, 0xa1, 0x0a, 0xc0, 0x44, 0x1e, 0xaa, 0xee, 0xb4, 0xb4, 0x8e, 0xfa, 0x0b, 0x1f, 0x0a, 0xbd, 0x80, 0xe9, 0x98, 0xa3, 0x5a, 0xba, 0x5e, 0xa0, 0xbd, 0x87, 0x99, 0xc1, 0x35, 0x0d, 0x43, 0x9e, 0x71, 0x89, 0x7a, 0xa7, 0x5f, 0xde, 0x31, 0x34, 0xa4, 0xaa, 0x72, 0xe0, 0x56, 0x28, 0xac, 0x6f, 0xe6, 0x8a, 0x73, 0x3d, 0x11, 0x61, 0xa1, 0x5d, 0x8e, 0xae, 0x2b, 0xb0, 0x42, 0xd7, 0x95, 0x8a, 0xed, 0xb1, 0xd5, 0x94, 0xd6, 0xd1, 0x12, 0xd3, 0x4f, 0x66, 0x02, 0xf4, 0xde, 0x71, 0x10, 0xe9, 0x93, 0xae, 0x74, 0x22, 0x92, 0x3d, 0x7d, 0x17, 0x11, 0x65, 0xdc, 0x19, 0x06, 0xf6, 0x3d, 0x57, 0x99, 0x7a, 0x0a, 0xd3, 0x1b, 0x3a, 0xae, 0x40, 0x81, 0xf4, 0x1f, 0xb4, 0x71, 0x65, 0x3e, 0x3d, 0x57, 0x7a, 0x8c, 0x41, 0x03, 0xf9, 0xcc, 0x19, 0x8a, 0x7f, 0x89, 0xd8, 0x1a, 0xf2, 0xa5, 0x00, 0x1c, 0x40, 0x17, 0x3f, 0x19, 0x23, 0xf7, 0x10, 0x2c, 0xfa, 0xa1, 0x50, 0xa1, 0x24, 0xb3, 0xc5, 0xc7, 0x9b, 0xb8, 0x87, 0x61, 0xa8, 0xdb, 0x3f, 0x41, 0x01, 0xc2, 0x28, 0x5b, 0x15, 0xbf, 0xeb, 0xc2, 0x16, 0xdc, 0x1b, 0xbe, 0xfe, 0xa1, 0xd7, 0xd6, 0xeb, 0x09, 0x7d, 0x6f, 0x8a, 0x24, 0xd9, 0x72, 0xda, 0x42, 0x0e, 0xa6, 0xbf, 0x86, 0x3e, 0xed, 0x3f, 0xc0, 0x37, 0xa3, 0x34, 0x02, 0xf2, 0x49, 0x78, 0xc7, 0x16, 0x2f, 0x32, 0xc0, 0x5b, 0x0c, 0xae, 0x3e, 0x0d, 0x3a, 0xf6, 0x91, 0x99, 0x2d, 0x12, 0x7a, 0x36, 0x33, 0x1f, 0xa6, 0x5c, 0x27, 0x7b, 0x5c, 0x7f, 0xe8, 0xc9, 0x81, 0xbc, 0xcb, 0xb3, 0xd6, 0x2a, 0xc0, 0x78, 0xd3, 0x52, 0xd4, 0xf7, 0x4f, 0xcd, 0x4c, 0x53, 0x31, 0xfe, 0xf7, 0xe2, 0x5f, 0x45, 0x88, 0x65, 0x4b, 0xa1, 0x76, 0x97, 0xd3, 0x88, 0x6f, 0x9d, 0x0b, 0x89, 0xf5, 0xc3, 0x66, 0x58, 0xb8, 0x7a, 0xa4, 0xf7, 0x49, 0xd6, 0xf5, 0x69, 0xef, 0x0e, 0xf6, 0x25, 0xcc, 0x17, 0xef, 0x75, 0x78, 0x23, 0x6f, 0x82, 0x7b, 0x61, 0x84, 0x46, 0x5f, 0x12, 0x82, 0x56, 0x17, 0xa0, 0x5d, 0xd8, 0x2e, 0x2b, 0x3c, 0x2f, 0x87, 0x95, 0x12, 0xb6, 0xe7, 0xac, 0x03, 0x0f, 0xab, 0xa9, 0xdf, 0xc2, 0xf8, 0x27, 0x6b, 0xfa, 0xc8, 0x40, 0xa3, 0x3d, 0x8c, 0x27, 0xdd, 0x39, 0xe0, 0x80, 0x31, 0xbf, 0xbc, 0xe6, 0x97, 0x87, 0x36, 0xad, 0x3a, 0xfc, 0xb4, 0x1e, 0x96, 0x5d, 0x4c, 0x5b, 0xbd, 0xe8, 0x3f, 0x37, 0x48, 0xa9, 0xd7, 0x99, 0x5f, 0xea, 0xf6, 0x9f, 0x5a, 0x23, 0x36, 0x5c, 0xc8, 0xb7, 0x33, 0x88, 0x8a, 0xc4, 0x1b, 0x45, 0x15, 0xf5, 0x8a, 0x7e, 0xb5, 0xaa, 0xce, 0xe5, 0x23, 0xb4, 0xfe, 0x39, 0x4d, 0x8a, 0x33, 0x39, 0x39, 0x5e, 0x60, 0xd5, 0xc8, 0x41, 0x4a, 0xcb, 0x63, 0x57, 0x5b, 0x67, 0x80, 0xbd, 0x96, 0x0f, 0xe3, 0xd0, 0xc4, 0xa1, 0x9e, 0xfe, 0x99, 0xf7, 0x0f, 0x61, 0x01, 0x37, 0x77, 0xfb, 0x58, 0xeb, 0x65, 0x63, 0x6c, 0x12, 0xe3, 0x39, 0x91, 0x4e, 0x45, 0xef, 0x2d, 0x19, 0x0d, 0xb8, 0x77, 0x27, 0xff, 0x09, 0xad, 0xa5, 0xa8, 0xb0, 0x44, 0x29, 0x11, 0x28, 0xaf, 0x69, 0x20, 0x66, 0xdf, 0x71, 0xf8, 0xa1, 0x37, 0x15, 0xd1, 0x27, 0x66, 0x52, 0xc8, 0xfe, 0xf2, 0x22, 0xd8, 0x6a, 0xfa, 0x9b, 0x0b, 0xed, 0xea, 0xcd, 0xe0, 0x5c, 0xe9, 0x13, 0x83, 0xbb, 0xbd, 0xe5, 0xb9, 0xcd, 0x72, 0x01, 0x6b, 0x84, 0xbd, 0x49, 0xeb, 0x63, 0x51, 0x6b, 0x0b, 0x57, 0xce, 0x56, 0x0e, 0x47, 0x38, 0x56, 0xe2, 0xfb, 0x5e, 0x1e, 0x0b, 0xce, 0xe5, 0xa2, 0xd0, 0x10, 0x1a, 0x7a, 0xce, 0x14, 0xcb, 0xfc, 0x0d, 0x70, 0x7b, 0x30, 0xc7, 0xf2, 0x61, 0x54, 0xaa, 0x3b, 0xb1, 0x3f, 0x1a, 0x94, 0x8c, 0xee, 0x99, 0xfa, 0x7f, 0x88, 0x0f, 0xac, 0xb0, 0xa2, 0x2f, 0x1d, 0xde, 0x2d, 0x01, 0x35, 0x0f, 0x2e, 0x09, 0x57, 0x12, 0xf6, 0x1b, 0x60, 0xa9, 0x66, 0xf4, 0xae, 0xf5, 0xb3, 0x11, 0xc3, 0x9c, 0xc9, 0x2c, 0x96, 0x5e, 0xd3, 0x3a, 0xc7, 0xab, 0xce, 0x59, 0xc5, 0xb7, 0x5e, 0xb9, 0xd4, 0xe0, 0x75, 0xe3, 0xf6, 0xb0, 0x89, 0x56, 0xc6, 0xf9, 0x15, 0x4e, 0x57, 0x0b, 0xef, 0x2f, 0x31, 0xa3, 0x79, 0x1c, 0x18, 0xe6, 0xee, 0xaa, 0xbd, 0x00, 0x24, 0x63, 0xcc, 0x35, 0xad, 0x9f, 0x38, 0xe6, 0x29, 0x6b, 0x7b, 0x18, 0x4e, 0x49, 0x05, 0x39, 0x75, 0x93, 0x6a, 0x70, 0xd6, 0xa3, 0x60, 0xef, 0x5a, 0x28, 0x15, 0x39, 0x0c, 0x33, 0x66, 0x82, 0x2b, 0x37, 0xee, 0xcc, 0x72, 0x37, 0xf8, 0xb1, 0xce, 0xe4, 0x38, 0x95, 0xe3, 0xc2, 0x69, 0x3b, 0x03, 0xed, 0x99, 0x27, 0xae, 0xb1, 0x62, 0xf8, 0x24, 0xba, 0xd8, 0x22, 0x6d, 0x7f, 0xb3, 0x1f, 0xab, 0x78, 0xdc, 0xe0, 0x2b, 0x80, 0x6f, 0xa5, 0x54, 0x69, 0x6f, 0xed, 0xd6, 0xbc, 0x61, 0xd1, 0xf7, 0xd0, 0xf0, 0x11, 0x95, 0x09, 0x5e, 0x31, 0x0e, 0x4d, 0x96, 0x1f, 0xf1, 0x14, 0x63, 0x6a, 0x8d, 0xfb, 0xdd, 0x13, 0xb0, 0xef, 0x64, 0x93, 0x49, 0x34, 0xe3, 0x99, 0xd2, 0xe3, 0x27, 0x69, 0x4e, 0xf9, 0x91, 0xc0, 0xbe, 0x52, 0xdc, 0x9f, 0xed, 0xf2, 0x71, 0xb8, 0x93, 0x92, 0x0f, 0xed, 0xbf, 0xb7, 0x98, 0x7c, 0x05, 0x07, 0x43, 0x4c, 0x0a, 0x54, 0x19, 0x00, 0x68, 0xee, 0xb5, 0xb9, 0x11, 0xfa, 0x5e, 0x7a, 0x06, 0x8d, 0xdd, 0xad, 0x1a, 0x30, 0xe6, 0x9f, 0x86, 0x7e, 0xff, 0xd6, 0x85, 0xad, 0x16, 0x0f, 0xdb, 0x13, 0x54, 0x7e, 0x45, 0xd3, 0xac, 0x44, 0x8f, 0x08, 0x56, 0x17, 0x08, 0xf8, 0x1e, 0xeb, 0xef, 0xd4, 0xbd, 0x57, 0x96, 0x5d, 0x25, 0x47, 0x34, 0xd0, 0xb4, 0xe3, 0xe8, 0x8e, 0x82, 0xe7, 0x90, 0x4f, 0xa1, 0x47, 0x13, 0xd2, 0xf8, 0x76, 0xea, 0x8b, 0x0f, 0xa2, 0x3b, 0xf9, 0x40, 0x8f, 0x89, 0x34, 0xde, 0x26, 0xbe, 0x11, 0xf9, 0xe5, 0x63, 0x9f, 0xb1, 0x5c, 0xc4, 0xcb, 0xa1, 0x19, 0x8a, 0x6d, 0x13, 0xa2, 0xa2, 0xc8, 0x90, 0x12, 0x43, 0xd5, 0x80, 0xd3, 0x28, 0xfd, 0x75, 0x66, 0x28, 0x3a, 0x3f, 0x02, 0x90, 0x23, 0xdc, 0x89, 0xf7, 0xec, 0x89, 0x94, 0x18, 0x59, 0x78, 0xf9, 0x56, 0x49, 0x4c, 0x5b, 0xef, 0xcb, 0x04, 0x48, 0xc8, 0x1b, 0x5c, 0x5a, 0x9f, 0x61, 0x42, 0x4b, 0x18, 0x4d, 0x6d, 0xc3, 0x36, 0xdd, 0xc7, 0x5d, 0x0d, 0x8f, 0x35, 0x43, 0x3a, 0x4a, 0x97, 0x40, 0xc4, 0xb4, 0x27, 0x62, 0x03, 0xbd, 0x48, 0xf4, 0x7d, 0x20, 0xb5, 0xf8, 0x35, 0xa0, 0xf2, 0x0a, 0xb0, 0xe2, 0xd0, 0xed, 0x9c, 0xe2, 0x4c, 0xe9, 0xc4, 0x66, 0x97, 0x5b, 0x99, 0x55, 0xa2, 0x88, 0x67, 0x42, 0x1b, 0x1d, 0xd1, 0x5b, 0x3a, 0x07, 0x50, 0x3e, 0xce, 0xbf, 0x8c, 0x2f, 0xed, 0xe1, 0xa6, 0x4a, 0x6f, 0xa5, 0xe9, 0xbf, 0xa2, 0xb7, 0xb0, 0xae, 0x92, 0x98, 0x8a, 0x5d, 0x3f, 0x71, 0xae, 0x7f, 0x90, 0xde, 0x88, 0xe7, 0x42, 0xf4, 0xab, 0x5a, 0xe2, 0x1a, 0x23, 0xd5, 0xd9, 0x95, 0x1e, 0x79, 0xc3, 0xc4, 0x6c, 0x26, 0xbb, 0x6d, 0x1c, 0xfc, 0x3c, 0xdc, 0xc7, 0xb9, 0x06, 0x99, 0xbe, 0xbd, 0xcc, 0xe0, 0xbe, 0x35, 0xfd, 0x4a, 0xa5, 0x70, 0x00, 0xbd, 0x20, 0x00, 0x47, 0x29, 0x6b, 0xa4, 0xde, 0x90, 0x64, 0x0f, 0x0e, 0xa0, 0xe3, 0xba, 0x6d, 0xe1, 0xad, 0x3d, 0xc1, 0x73, 0xf3, 0x47, 0x9d, 0x92, 0x61, 0x3c, 0x58, 0x2b, 0xdc, 0x0e, 0xb3, 0xc3, 0x03, 0xfa, 0x5e, 0xf2, 0x8c, 0x47, 0xc7, 0x68, 0xdd, 0x98, 0xdf, 0x92, 0x31, 0x2a, 0x20, 0xe2, 0xa4, 0x21, 0x04, 0xa6, 0xf5, 0xd8, 0x30, 0xa9, 0xd6, 0x73, 0xa5, 0x67, 0xc8, 0x2d, 0x1a, 0x0d, 0x7a, 0x2b, 0x5c, 0x76, 0xf0, 0xca, 0x91, 0xb0, 0xe9, 0x74, 0x67, 0x98, 0xaf, 0x44, 0xba, 0xb5, 0xa1, 0x68, 0xe4, 0x1e, 0xdd, 0x9f, 0x63, 0xfc, 0x6e, 0x5e, 0x35, 0xe9, 0x3d, 0xcb, 0x6c, 0xa1, 0x5f, 0x13, 0xa7, 0xff, 0x7e, 0xc4, 0x1d, 0x79, 0xcd, 0xbb, 0xc7, 0x72, 0x5a, 0x91, 0x80, 0xb0, 0x86, 0x1b, 0xae, 0x38, 0x6a, 0x70, 0x9b, 0xe2, 0x58, 0x56, 0x7d, 0xf7, 0x6b, 0x6e, 0xba, 0x76, 0x59, 0xc9, 0xd9, 0x5a, 0x9a, 0xe2, 0xbf, 0x1c, 0x28, 0xea, 0xfa, 0x09, 0x5a, 0x89, 0xd6, 0xfd, 0x71, 0xc7, 0xf8, 0xb1, 0xcf, 0xf7, 0x5b, 0x3a, 0xd6, 0xad, 0x49, 0xa4, 0x37, 0xb2, 0x4b, 0x98, 0xf4, 0x4d, 0xe4, 0xbf, 0xfc, 0x15, 0xb1, 0x67, 0x2f, 0x9b, 0x93, 0xa5, 0xd2, 0x95, 0x05, 0xd8, 0xb3, 0xd8, 0xf5, 0xbd, 0x5c, 0x7f, 0x97, 0x60, 0xc5, 0x38, 0xa5, 0x52, 0xa3, 0xf8, 0x58, 0xc9, 0xee, 0x64, 0xd1, 0xbb, 0x36, 0x1c, 0xf6, 0x67, 0x54, 0x55, 0x3d, 0x33, 0x3c, 0xc6, 0xa1, 0xcb, 0x8c, 0x21, 0xf5, 0x8d, 0xa0, 0x75, 0x85, 0x3c, 0x6c, 0x38, 0xf4, 0xbe, 0xde, 0x4b, 0x86, 0xbd, 0x5f, 0x87, 0x66, 0x72, 0x7e, 0x84, 0xb1, 0xaf, 0x36, 0x32, 0x45, 0x2a, 0x73, 0xea, 0xaa, 0x3a, 0xa7, 0x48, 0x54, 0x15, 0xfb, 0x89, 0x44, 0xbe, 0xe1, 0xdb, 0xda, 0xdc, 0x83, 0x97, 0x8b, 0xc6, 0x4e, 0x17, 0x10, 0x57, 0xdc, 0x00, 0x6c, 0x43, 0x6a, 0xbe, 0x83, 0x16, 0xb7, 0x67, 0x3c, 0x51, 0x6f, 0x25, 0xf8, 0xdb, 0x93, 0x4c, 0x3b, 0xac, 0x52, 0x84, 0x46, 0x2c, 0x28, 0x46, 0x30, 0x03, 0x2a, 0xc8, 0xe9, 0xe2, 0x86, 0x5a, 0x01, 0x23, 0x90, 0xd4, 0x57, 0x03, 0x10, 0xac, 0xa7, 0xb9, 0x34, 0x16, 0x6c, 0xc6, 0x05, 0xe3, 0xa7, 0x72, 0xe1, 0xe7, 0x79, 0x02, 0xb0, 0x6e, 0x75, 0x50, 0xd4, 0xc8, 0x31, 0xca, 0xa1, 0x3a, 0x7c, 0x94, 0x31, 0x0c, 0xcf, 0x0d, 0xad, 0x72, 0x64, 0xe8, 0x87, 0xc3, 0x6b, 0xda, 0x9d, 0x20, 0x5b, 0xe7, 0x33, 0x91, 0x4b, 0xe0, 0x40, 0x9d, 0x56, 0x73, 0xbb, 0x97, 0x3e, 0x25, 0xff, 0x22, 0xf5, 0x7e, 0xd4, 0x0a, 0x05, 0x0b, 0xf2, 0x02, 0x1d, 0xf5, 0x06, 0x18, 0xb0, 0x97, 0x9c, 0xf1, 0xfb, 0x99, 0x9c, 0x43, 0x9e, 0x2d, 0xcf, 0x16, 0x3a, 0x62, 0x79, 0x2a, 0x51, 0xc8, 0x47, 0x54, 0x2a, 0x9a, 0x03, 0xfd, 0x22, 0xb9, 0xff, 0x2b, 0xd7, 0xaa, 0xc8, 0xde, 0xee, 0xaf, 0x0e, 0xa5, 0x9c, 0xf6, 0x84, 0xf2, 0x83, 0x69, 0xb7, 0x31, 0x86, 0xf5, 0xd7, 0xf4, 0x67, 0xac, 0x1d, 0x7a, 0x18, 0xcd, 0x7b, 0xc5, 0x5c, 0xa3, 0x32, 0x5b, 0xe7, 0x82, 0xdc, 0xd7, 0xae, 0xc1, 0xdc, 0x14, 0xba, 0xc9, 0xba, 0xc8, 0x8b, 0x70, 0x46, 0x74, 0x64, 0x0f, 0xd3, 0x35, 0xcd, 0xf4, 0xf4, 0xc1, 0xdd, 0x66, 0xf2, 0xca, 0x1d, 0x52, 0x0b, 0x63, 0x31, 0x46, 0xca, 0x3b, 0x3e, 0x35, 0x6d, 0x96, 0x41, 0xd8, 0xde, 0x4a, 0x50, 0x6e, 0xd8, 0xfe, 0xa1, 0xe2, 0x0e, 0x82, 0x09, 0xaf, 0xa2, 0xc5, 0x6d, 0x3e, 0x90, 0x65, 0x2b, 0x69, 0xc7, 0x7c, 0x71, 0xaa, 0x75, 0x2f, 0xaa, 0x9b, 0x6e, 0x6a, 0xcb, 0x00, 0x98, 0x7a, 0x4a, 0x8e, 0x24, 0x80, 0xb0, 0x68, 0x94, 0x4f, 0xb0, 0x6e, 0x66, 0x3b, 0xe8, 0xda, 0x80, 0x1c, 0xca, 0x87, 0x93, 0x66, 0xe6, 0x68, 0x9f, 0xb2, 0x2d, 0x36, 0xd7, 0xcc, 0xb0, 0x79, 0x80, 0x3f, 0x3e, 0x0c, 0x58, 0xa3, 0xb0, 0x56, 0x72, 0xa7, 0x18, 0x3a, 0xa2, 0x22, 0xd0, 0xab, 0x94, 0x0a, 0xf9, 0xe2, 0xe0, 0x56, 0xf7, 0x00, 0x3d, 0x57, 0xbd, 0xf5, 0x8e, 0xc3, 0x65, 0xeb, 0xc0, 0xf2, 0xb9, 0xbb, 0x05, 0xa8, 0xf5, 0xfd, 0xe7, 0x05, 0xf1, 0x25, 0x9c, 0x5f, 0x77, 0x3a, 0x58, 0x59, 0x85, 0xa0, 0x28, 0xb9, 0x02, 0x71, 0xaa, 0x07, 0x1b, 0xc2, 0x54, 0x36, 0xe7, 0xb2, 0xf8, 0x04, 0xeb, 0xde, 0x29, 0x37, 0x2e, 0x2b, 0x67, 0x35, 0x8f, 0x2a, 0xaa, 0x0e, 0x6b, 0x19, 0xe1, 0x13, 0x3f, 0x6d, 0xa7, 0xe3, 0x9b, 0xa4, 0x07, 0x62, 0x07, 0x6f, 0xde, 0x41, 0xb2, 0xe3, 0xd2, 0xf1, 0x45, 0x9b, 0x90, 0x27, 0x77, 0x54, 0xaa, 0xe0, 0xc7, 0x7b, 0xa2, 0x95, 0xac, 0xb0, 0x57, 0x97, 0xbe, 0x25, 0x5e, 0xc5, 0x9b, 0xe9, 0xcf, 0xdc, 0x6e, 0x33, 0xb3, 0x03, 0xba, 0xe1, 0x1c, 0xea, 0x80, 0xfd, 0xfb, 0x62, 0x98, 0x2c, 0x25, 0xf8, 0xe2, 0xca, 0x54, 0x67, 0x86, 0x44, 0x86, 0x00, 0x5b, 0x66, 0x79, 0xe8, 0x3c, 0x94, 0xbc, 0x62, 0x33, 0x00, 0xa6, 0xe1, 0x9a, 0xfa, 0x16, 0xa3, 0x96, 0x5b, 0xeb, 0xfe, 0x9f, 0xf3, 0xaf, 0x7b, 0x20, 0x67, 0x12, 0xba, 0x25, 0xb1, 0x03, 0x5b, 0x13, 0xf2, 0x50, 0xa7, 0x30, 0x57, 0xba, 0x7a, 0xf3, 0x1f, 0x05, 0x75, 0xa3, 0x48, 0x92, 0x7f, 0xb2, 0xb2, 0xc0, 0x4c, 0xe8, 0xdb, 0xcf, 0x1d, 0xed, 0xce, 0x0b, 0x29, 0x88, 0xd6, 0x9c, 0xba, 0x3f, 0x04, 0x5c, 0x30, 0xd0, 0x16, 0xca, 0xd8, 0x7f, 0x27, 0xde, 0x15, 0x87, 0xbc, 0x5e, 0xdb, 0xb2, 0xd3, 0x0a, 0x77, 0xb6, 0x77, 0xc4, 0xbd, 0xb5, 0x93, 0x51, 0x74, 0xba, 0x00, 0x7d, 0x50, 0xf8, 0x86, 0x63, 0x46, 0xf2, 0xe2, 0x54, 0xcf, 0x82, 0xc3, 0xc8, 0x2f, 0x69, 0xc1, 0x36, 0x6b, 0xb9, 0xb6, 0x84, 0x9b, 0xc1, 0xde, 0x4e, 0xb0, 0x26, 0x92, 0xa4, 0x8e, 0x63, 0x62, 0xcb, 0x6d, 0x6e, 0x77, 0xbf, 0x86, 0xe5, 0x7e, 0x3c, 0x38, 0x09, 0xd3, 0x10, 0x9f, 0x9f, 0xb6, 0x40, 0x43, 0x83, 0x58, 0xf2, 0xc5, 0x85, 0x7a, 0x52, 0xf5, 0x2a, 0x63, 0xb5, 0x06, 0xf9, 0x1e, 0xd7, 0xdd, 0x3b, 0xc8, 0xa1, 0xd2, 0x9a, 0xb5, 0xcd, 0x27, 0xed, 0x63, 0x24, 0x81, 0xe0, 0x3a, 0x87, 0x22, 0x78, 0xb2, 0x8e, 0x7e, 0xa5, 0xd0, 0x19, 0x26, 0x00, 0x4b, 0x64, 0x73, 0x36, 0x66, 0xb5, 0x56, 0x2c, 0x56, 0xca, 0xe9, 0x0b, 0x35, 0xa5, 0x6a, 0xc3, 0xd4, 0x71, 0x37, 0x17, 0x2d, 0x22, 0x9b, 0x64, 0x5d, 0xe3, 0x5e, 0x2c, 0xb3, 0x25, 0xf8, 0x4e, 0x48, 0x79, 0x73, 0xf8, 0x8e, 0xcf, 0x1f, 0x76, 0x99, 0xb5, 0x23, 0x58, 0x51, 0x0d, 0xe5, 0x38, 0x79, 0x37, 0x58, 0x44, 0xa1, 0x6c, 0xd9, 0x0c, 0x96, 0x2d, 0xe0, 0x7f, 0xeb, 0x79, 0x3d, 0xcf, 0x52, 0x73, 0x88, 0x32, 0x40, 0xef, 0xd1, 0x0d, 0xc5, 0x3a, 0x78, 0xd6, 0x54, 0x2d, 0x27, 0xf2, 0x0f, 0x59, 0x79, 0xa5, 0xaa, 0xf0, 0xeb, 0x95, 0x27, 0x37, 0xb7, 0x1f, 0x0a, 0xb7, 0xa1, 0x12, 0x22, 0x5b, 0x84, 0x3d, 0x0d, 0x90, 0xf0, 0x03, 0xd7, 0xc4, 0x19, 0x80, 0xaf, 0x4f, 0xb4, 0x68, 0x22, 0xa4, 0x99, 0xc2, 0x4f, 0xc7, 0x83, 0x2a, 0x6d, 0xfa, 0x2e, 0xc7, 0x9c, 0x24, 0xa1, 0x7e, 0x63, 0x71, 0xc9, 0xed, 0x94, 0x49, 0x4e, 0x01, 0x7b, 0x58, 0xe8, 0xbe, 0xd4, 0xcb, 0xe0, 0x9a, 0xcf, 0xc2, 0x9b, 0x28, 0xa1, 0x36, 0x28, 0xc5, 0xd8, 0x85, 0xed, 0x98, 0x31, 0x76, 0xe8, 0xf7, 0x53, 0x37, 0xc2, 0xfd, 0x6c, 0xe0, 0x98, 0x0a, 0x93, 0x95, 0x25, 0x46, 0x60, 0x15, 0x15, 0xf4, 0xd2, 0xc6, 0xc0, 0xdc, 0x07, 0x4e, 0x02, 0xc0, 0xd2, 0xe6, 0x35, 0x7d, 0x5a, 0x5a, 0xbf, 0x39, 0xb4, 0xb1, 0x0c, 0x9e, 0xb9, 0x19, 0x8e, 0xfb, 0xa8, 0x01, 0x68, 0xc1, 0x12, 0x81, 0x03, 0x2a, 0x7f, 0xa4, 0xf3, 0x23, 0xf4, 0xcb, 0x03, 0xc0, 0x09, 0x9a, 0xe7, 0x45, 0xce, 0x7e, 0x4e, 0xde, 0x30, 0x22, 0x25, 0x3b, 0x7e, 0x09, 0x7e, 0xa5, 0xa0, 0xe4, 0x17, 0xd3, 0x73, 0x26, 0xae, 0x39, 0xf3, 0x7c, 0xc3, 0x59, 0xa1, 0x57, 0xb7, 0xbe, 0xaa, 0x33, 0x5b, 0xe2, 0x2b, 0xaf, 0x5a, 0xb3, 0x73, 0x2f, 0x42, 0xf0, 0x9b, 0xed, 0x94, 0x32, 0xcb, 0x21, 0x62, 0x35, 0x25, 0x7b, 0x80, 0xa1, 0x67, 0x58, 0x57, 0x38, 0x4f, 0x64, 0xaf, 0xa5, 0x79, 0x26, 0x58, 0xcc, 0x05, 0x7d, 0x8f, 0x9e, 0x18, 0xbe, 0xe8, 0xbd, 0xaa, 0x9b, 0xac, 0xe1, 0x32, 0xad, 0x63, 0x85, 0xf7, 0x73, 0xe4, 0x9c, 0x65, 0xbb, 0x36, 0xf3, 0x3b, 0xfe, 0x5d, 0xad, 0x4c, 0x19, 0xaa, 0x1f, 0x8c, 0x01, 0x78, 0x9b, 0xbd, 0x85, 0x5b, 0xe3, 0x41, 0x4c, 0xa1, 0xba, 0x6e, 0x9e, 0xa4, 0xd9, 0x29, 0xd5, 0x77, 0x3f, 0x82, 0x37, 0x46, 0x08, 0xf9, 0xe0, 0x84, 0xa4, 0x90, 0x6a, 0x92, 0xcc, 0x27, 0x08, 0x3c, 0xda, 0x2d, 0x4a, 0x52, 0xe7, 0x7b, 0x8b, 0xa8, 0xdb, 0x1d, 0xc9, 0x7a, 0x05, 0xc0, 0x8c, 0x90, 0x82, 0x50, 0xb4, 0x09, 0x71, 0x28, 0x58, 0x40, 0x6e, 0x26, 0xd5, 0x04, 0xe2, 0xd1, 0xf2, 0x7a, 0x2f, 0xa7, 0x84, 0xb1, 0x0d, 0x6c, 0x7b, 0xe4, 0xf1, 0x0b, 0xfe, 0xec, 0xaf, 0x55, 0xac, 0x2c, 0xb3, 0x0c, 0x80, 0xdf, 0xe1, 0xa0, 0xbf, 0x32, 0x0f, 0x82, 0x49, 0x30, 0x95, 0xe3, 0x96, 0xe5, 0xfa, 0x2b, 0x8f, 0x97, 0x1a, 0xb7, 0xdb, 0x8d, 0x72, 0xaf, 0x4f, 0x7a, 0xf3, 0x68, 0xbe, 0x20, 0x07, 0x0b, 0xfa, 0xd9, 0x90, 0xcb, 0xc0, 0x8b, 0xbc, 0xe8, 0x1a, 0xd9, 0x32, 0x5d, 0x7f, 0x4d, 0xa0, 0xb2, 0x20, 0x62, 0x91, 0xcc, 0x84, 0xb3, 0xa5, 0x6e, 0x03, 0x09, 0xe6, 0x2d, 0xa1, 0x9d, 0xdd, 0x37, 0x43, 0x3f, 0xb0, 0x38, 0x59, 0x42, 0x61, 0x60, 0xeb, 0xf9, 0x9b, 0x6a, 0xa2, 0x9c, 0xb4, 0xb5, 0x63, 0xbf, 0xb9, 0x41, 0x92, 0x8d, 0x61, 0xd6, 0xb8, 0xed, 0xea, 0x32, 0x29, 0x07, 0xdb, 0xe1, 0xe7, 0xe3, 0xb6, 0x95, 0xee, 0xb7, 0x10, 0x83, 0x51, 0x3d, 0x19, 0x2c, 0x18, 0x91, 0xbf, 0xe6, 0xec, 0xa3, 0x02, 0x00, 0x68, 0x9e, 0xe8, 0x9b, 0xc0, 0x76, 0xa4, 0xcc, 0xb7, 0x67, 0xfd, 0x79, 0x61, 0x6c, 0x42, 0x22, 0x86, 0xe9, 0x98, 0x44, 0xf1, 0x3f, 0xd7, 0xc1, 0xef, 0x94, 0x79, 0x17, 0xf8, 0x2e, 0x84, 0x26, 0x7a, 0xc0, 0x0b, 0xe3, 0x44, 0xc5, 0x19, 0x39, 0xfe, 0xf1, 0xdb, 0xaa, 0x11, 0x9f, 0x3d, 0x06, 0x8b, 0xb7, 0x8c, 0x7f, 0x30, 0xb7, 0x24, 0xf3, 0x82, 0x27, 0xc0, 0xe2, 0x2d, 0x01, 0x9e, 0xa4, 0xaa, 0xa0, 0xce, 0x46, 0x9a, 0xbb, 0x8e, 0x7f, 0xe9, 0x39, 0x4f, 0xb5, 0x7e, 0xbe, 0x2b, 0xb7, 0x69, 0x9b, 0x60, 0x4e, 0x0b, 0x2b, 0xc8, 0x3b, 0x1c, 0x69, 0xfc, 0xd5, 0xb3, 0xba, 0x79, 0xcd, 0x26, 0xd0, 0xc0, 0x65, 0x6f, 0xc5, 0xf2, 0x66, 0x00, 0xbe, 0xbd, 0x15, 0x1f, 0xae, 0xa3, 0x37, 0x6a, 0xee, 0x61, 0x89, 0xa5, 0xb9, 0xb2, 0xd9, 0xdf, 0xcf, 0x5f, 0xc0, 0x84, 0xca, 0xfd, 0x97, 0x09, 0x25, 0xe1, 0x33, 0x32, 0x39, 0xbf, 0xfa, 0x83, 0x8b, 0x6d, 0x31, 0xf4, 0xf6, 0x93, 0xfc, 0x0b, 0x04, 0x60, 0x7a, 0xd9, 0xbb, 0xe4, 0x4d, 0xa1, 0x93, 0xbf, 0x64, 0x55, 0x87, 0x00, 0xd2, 0x2e, 0x24, 0x5c, 0xc7, 0xa6, 0x73, 0xca, 0x13, 0x14, 0x84, 0x7c, 0x17, 0xaa, 0x37, 0x26, 0x91, 0xac, 0x6c, 0xf1, 0x36, 0xf0, 0x8a, 0x27, 0x66, 0x14, 0x51, 0x6e, 0xcb, 0x24, 0x34, 0x0f, 0xc5, 0xe0, 0x0d, 0x8c, 0xf3, 0x72, 0x4a, 0xb9, 0xe2, 0xa7, 0xe9, 0x8c, 0xbc, 0xd0, 0xc8, 0x1a, 0xcc, 0xe9, 0x31, 0xbc, 0x41, 0x0b, 0x89, 0x67, 0x5c, 0x2c, 0x87, 0x47, 0xf7, 0x7c, 0x89, 0x3f, 0x56, 0x91, 0x58, 0x0a, 0x96, 0xf9, 0x67, 0xc9, 0x0a, 0xf1, 0x65, 0x84, 0xe8, 0x27, 0xe7, 0xc0, 0x97, 0xae, 0xfb, 0x6f, 0xbe, 0x3b, 0x74, 0x2a, 0x2d, 0x21, 0x69, 0xdd, 0x32, 0x6e, 0x7a, 0x5b, 0x56, 0x9f, 0x26, 0x5b, 0x90, 0x9b, 0x4c, 0xe7, 0xbc, 0x18, 0x14, 0x60, 0xb4, 0xe6, 0xac, 0x9b, 0xc0, 0x12, 0x0c, 0xb2, 0x01, 0xcc, 0xce, 0x2a, 0x59, 0x55, 0x48, 0x43, 0xba, 0x8a, 0x29, 0x34, 0x59, 0xe8, 0x78, 0xc6, 0x34, 0x14, 0x8e, 0x67, 0xe2, 0x99, 0x15, 0x7d, 0x8a, 0xea, 0xec, 0x5a, 0xa1, 0x5b, 0x62, 0xcd, 0x5e, 0xda, 0x3b, 0xe6, 0x9c, 0x51, 0x70, 0x75, 0xf1, 0x67, 0x14, 0x5e, 0x74, 0xcf, 0x8e, 0xa8, 0x9c, 0x95, 0x77, 0x0d, 0x93, 0x65, 0x93, 0xb8, 0xd8, 0xc0, 0xa2, 0x75, 0xe6, 0xcc, 0x62, 0xb7, 0x4f, 0xb3, 0x19, 0x98, 0x22, 0x83, 0xed, 0x3a, 0x39, 0x6e, 0x48, 0xac, 0x61, 0x6f, 0x0e, 0x8f, 0x9d, 0x6b, 0x0a, 0xc7, 0x4d, 0x17, 0x9c, 0xaa, 0xaf, 0x59, 0xe0, 0xbe, 0x85, 0x71, 0x5f, 0x84, 0x3f, 0x58, 0xff, 0xb5, 0xbd, 0xdf, 0xe2, 0xc2, 0xbb, 0xae, 0x55, 0x13, 0xc1, 0xf1, 0x9b, 0xc6, 0x26, 0x56, 0xe5, 0x1a, 0x26, 0x57, 0x96, 0x71, 0x48, 0x95, 0x4a, 0x9c, 0x5f, 0x91, 0xb8, 0xb6, 0x21, 0xa8, 0x55, 0xda, 0xa1, 0x8e, 0x11, 0xf0, 0xd7, 0xeb, 0x97, 0x36, 0x5b, 0x13, 0xd3, 0x53, 0xf9, 0xcf, 0x96, 0x3c, 0x71, 0x3e, 0x75, 0xad, 0x28, 0xc8, 0xd4, 0x82, 0x4c, 0x63, 0x15, 0x94, 0xff, 0x37, 0xfa, 0x84, 0x1d, 0x70, 0x48, 0x29, 0xdb, 0x10, 0x94, 0x84, 0x90, 0x47, 0xa2, 0x0b, 0x73, 0x45, 0x7f, 0xfd, 0xdf, 0x1e, 0x4d, 0xb4, 0xeb, 0x2d, 0xdc, 0x30, 0xe8, 0x7f, 0x77, 0x8a, 0x6c, 0x30, 0x05, 0x54, 0xb6, 0x24, 0x01, 0xa3, 0xe0, 0x31, 0x5a, 0x4c, 0x7d, 0x9c, 0x49, 0xc0, 0x91, 0x67, 0x44, 0x64, 0x1f, 0x37, 0xd3, 0x7b, 0x21, 0xfd, 0x4d, 0x77, 0xe6, 0x43, 0x33, 0x9b, 0xde, 0x17, 0x0c, 0x0c, 0x17, 0x7c, 0xbf, 0x0f, 0x84, 0x03, 0x3c, 0xfd, 0xe1, 0x3a, 0x7d, 0xcf, 0x19, 0x5b, 0xcd, 0x2d, 0xf1, 0x19, 0x5f, 0x81, 0x88, 0x79, 0x93, 0xf2, 0xbc, 0xa3, 0xe4, 0x0c, 0xda, 0xf1, 0xca, 0xe7, 0xfc, 0x9a, 0x24, 0xbc, 0x43, 0xd2, 0x63, 0x55, 0xf1, 0x89, 0x87, 0xe0, 0xba, 0xfd, 0xdb, 0x03, 0x0c, 0x20, 0x63, 0xbf, 0xc3, 0x4c, 0x08, 0x7c, 0x52, 0x63, 0x3d, 0x74, 0x93, 0x5c, 0x09, 0xfb, 0x7d, 0x39, 0x1b, 0x7e, 0x78, 0x53, 0x58, 0xa1, 0x83, 0x05, 0x2e, 0x3d, 0x9e, 0x7b, 0xd6, 0x97, 0x46, 0x84, 0xee, 0xa4, 0xca, 0xe2, 0x3b, 0x70, 0xd8, 0x0f, 0x5a, 0x24, 0x42, 0xf6, 0x6b, 0x3d, 0x35, 0xe2, 0xf3, 0x2d, 0xbc, 0xfe, 0x15, 0xdf, 0x24, 0x5a, 0xd4, 0x10, 0x5b, 0xd3, 0xb7, 0x58, 0x28, 0xd7, 0xcc, 0x28, 0xb6, 0xb3, 0x6c, 0xa8, 0xaa, 0xff, 0xb9, 0xda, 0x2d, 0x03, 0x5f, 0xd9, 0x52, 0xe3, 0xe3, 0x39, 0xc8, 0x4a, 0xb6, 0x25, 0xeb, 0xbb, 0xe5, 0x98, 0x0e, 0x99, 0x8e, 0x93, 0x88, 0xdd, 0xaf, 0x2b, 0xe6, 0x63, 0xe5, 0x05, 0x30, 0xd7, 0xb0, 0x74, 0x82, 0x03, 0x8a, 0x6d, 0xd2, 0x0c, 0xa2, 0xe8, 0x86, 0x33, 0x71, 0x83, 0x92, 0x0c, 0x3d, 0xb2, 0x4f, 0xbd, 0x0e, 0x91, 0x5f, 0x5d, 0x62, 0x0e, 0xc0, 0x15, 0x2a, 0xa9, 0x38, 0x17, 0x12, 0xa4, 0x8a, 0xf6, 0xe4, 0x2d, 0x69, 0x8b, 0xf0, 0xe4, 0x5f, 0x9b, 0xf7, 0x68, 0x4b, 0xca, 0xeb, 0x2b, 0x8a, 0xf2, 0xeb, 0xec, 0x34, 0x45, 0xd2, 0xeb, 0xbd, 0xe8, 0xbd, 0xb8, 0x8b, 0x77, 0xbb, 0x67, 0x6d, 0x6b, 0xf3, 0x02, 0xb4, 0x5e, 0x9b, 0x1a, 0x7b, 0x11, 0x05, 0x2e, 0xd6, 0xb3, 0xb6, 0x7b, 0x99, 0x91, 0xde, 0xc0, 0x4a, 0x56, 0x8d, 0x07, 0x76, 0xdc, 0x91, 0x0f, 0xf0, 0xed, 0x9e, 0x20, 0xca, 0xdf, 0x57, 0x1b, 0xe9, 0x4c, 0xf5, 0xfa, 0xad, 0x1d, 0x61, 0xa6, 0x3d, 0xbb, 0x5d, 0xd8, 0x7f, 0x0a, 0x80, 0x65, 0x7a, 0x86, 0xd1, 0xb8, 0x3b, 0x03, 0x7a, 0x09, 0xcb, 0x7c, 0x53, 0x14, 0x6d, 0x53, 0xdc, 0x79, 0xde, 0xa2, 0x27, 0x00, 0x3a, 0x73, 0x8e, 0x7d, 0x20, 0x42, 0x1f, 0xda, 0x65, 0x77, 0xb6, 0xd7, 0x1c, 0x00, 0x22, 0x7b, 0x12, 0x26, 0xff, 0x4c, 0x8c, 0x3e, 0xd4, 0xfd, 0x0f, 0xb6, 0x28, 0xf2, 0x2f, 0x37, 0xa2, 0x03, 0xa4, 0x38, 0xb0, 0x43, 0x6b, 0x94, 0x9a, 0x6a, 0xd7, 0xa8, 0xac, 0xa5, 0xf1, 0x7e, 0x3c, 0x4f, 0xd0, 0x29, 0x6c, 0xbd, 0x10, 0x5d, 0x6b, 0x15, 0x7b, 0x8b, 0x3f, 0x41, 0x58, 0xb7, 0xd4, 0x3e, 0xc3, 0xe4, 0xc4, 0xa6, 0x95, 0x26, 0xee, 0x81, 0xb6, 0x05, 0x4c, 0xde, 0x22, 0x36, 0x3c, 0x83, 0xc4, 0xaa, 0xfd, 0x6f, 0x25, 0x19, 0x0b, 0x5b, 0x0f, 0x96, 0x4f, 0x2a, 0xd9, 0x23, 0x9c, 0xd1, 0xe1, 0xff, 0xa1, 0x15, 0xe5, 0x9a, 0x55, 0x0c, 0x13, 0x30, 0x91, 0xd6, 0x5a, 0x5c, 0xba, 0xaf, 0x96, 0x50, 0xaa, 0xdb, 0xb5, 0x3e, 0xfa, 0x48, 0xac, 0x03, 0xb3, 0xf9, 0x6d, 0x94, 0xd7, 0x76, 0xe8, 0x56, 0x30, 0x93, 0xef, 0x40, 0x3e, 0xc7, 0x18, 0x49, 0xd0, 0x3e, 0xeb, 0x24, 0x00, 0x28, 0xa7, 0x60, 0x1d, 0x98, 0xb2, 0xc0, 0xdb, 0xd7, 0x31, 0x38, 0x14, 0x63, 0xcd, 0x92, 0x44, 0xde, 0x95, 0x48, 0x21, 0x7d, 0xa9, 0x5a, 0x1f, 0x0d, 0x61, 0x05, 0x51, 0x83, 0xc9, 0x75, 0xa6, 0xae, 0x3e, 0xb4, 0x8e, 0x5c, 0x0f, 0xf6, 0xcc, 0xc1, 0xfc, 0x20, 0x9e, 0xcc, 0xa5, 0x27, 0x42, 0xf2, 0x1c, 0x96, 0x0b, 0xcc, 0x9d, 0xbf, 0xb3, 0x8d, 0xd7, 0x26, 0xf7, 0x85, 0x8d, 0x7f, 0x02, 0x9d, 0xa0, 0x41, 0x98, 0x65, 0x46, 0xc0, 0x1e, 0x83, 0x04, 0xee, 0xaa, 0xc0, 0x8d, 0xbe, 0xcf, 0xd6, 0xd4, 0xe7, 0xad, 0xd1, 0x73, 0x33, 0xc5, 0x5e, 0xe0, 0x76, 0x45, 0x6e, 0x4c, 0xfd, 0x3c, 0x2e, 0xfb, 0xc1, 0x00, 0x8f, 0x74, 0xf3, 0x4b, 0xda, 0x8c, 0xa3, 0x50, 0x82, 0x48, 0x0a, 0x8c, 0x86, 0x3b, 0x76, 0xa4, 0x92, 0xbb, 0xf3, 0x78, 0x18, 0x60, 0xc7, 0x8c, 0xa0, 0x38, 0x47, 0xf5, 0xf9, 0x25, 0xc2, 0xc8, 0xf3, 0x7a, 0x4b, 0x66, 0xb5, 0x71, 0xbe, 0xa8, 0x49, 0x16, 0x9f, 0x8c, 0x5d, 0x50, 0x18, 0x04, 0x8e, 0xa5, 0xaf, 0x72, 0x70, 0x26, 0xa2, 0xa2, 0xc0, 0xda, 0x94, 0x42, 0x32, 0xba, 0x13, 0x08, 0x9d, 0x9a, 0x05, 0xe1, 0xcb, 0x97, 0xbb, 0x70, 0xd0, 0x7a, 0xcc, 0x76, 0x70, 0x82, 0xe0, 0x9d, 0xc6, 0x2b, 0x6e, 0xaa, 0x07, 0xf5, 0xb2, 0xb1, 0x7f, 0x76, 0x92, 0x1c, 0xbb, 0x21, 0xf2, 0xad, 0x66, 0xb9, 0x41, 0x33, 0x73, 0xeb, 0x7a, 0x9c, 0x21, 0xc5, 0xbc, 0xed, 0xe8, 0x77, 0xb2, 0x0b, 0x93, 0x59, 0x28, 0x74, 0xad, 0x62, 0x7a, 0x01, 0xc2, 0x66, 0x31, 0x09, 0x85, 0x6d, 0x28, 0xe8, 0x12, 0x05, 0x40, 0x86, 0x9f, 0x50, 0xc3, 0xb5, 0x2c, 0xa0, 0x9a, 0x69, 0x66, 0x60, 0xf1, 0xd8, 0xd0, 0xcd, 0x76, 0x21, 0x4a, 0xe2, 0x0f, 0xc9, 0x4d, 0xf4, 0xb5, 0x44, 0x32, 0x70, 0xd2, 0x3d, 0x62, 0xa3, 0x17, 0xab, 0x53, 0x74, 0x05, 0x28, 0x84, 0xf9, 0xa5, 0xc5, 0xed, 0xda, 0xf7, 0x9b, 0xb6, 0x79, 0x60, 0x30, 0xdf, 0x47, 0xef, 0xed, 0x89, 0xd5, 0x29, 0x98, 0x8a, 0x36, 0x60, 0x8b, 0x56, 0xf6, 0xaf, 0xa0, 0x01, 0x70, 0x4e, 0x2f, 0xc7, 0x3a, 0x4d, 0x1f, 0xbe, 0x06, 0x83, 0x73, 0x14, 0x9d, 0x98, 0x5f, 0x66, 0xd2, 0x12, 0xf7, 0xb2, 0x7a, 0xd2, 0x38, 0xc1, 0x26, 0x9f, 0x86, 0x71, 0xaa, 0xac, 0x0a, 0x4b, 0x30, 0xb2, 0x28, 0xef, 0xe2, 0x5b, 0xa4, 0xf7, 0x95, 0x45, 0x3f, 0x58, 0x06, 0x3b, 0xa4, 0xa8, 0x5f, 0xa3, 0xd3, 0xd5, 0x7d, 0x1f, 0xa8, 0xf1, 0x4d, 0x10, 0xca, 0x4d, 0x03, 0xe2, 0xb6, 0xcf, 0x0d, 0x7f, 0xe0, 0xe9, 0x7c, 0x2b, 0x27, 0x06, 0x63, 0x54, 0xab, 0x9f, 0x74, 0x8f, 0xbb, 0xbe, 0xda, 0x5a, 0x87, 0x73, 0x0b, 0xda, 0x0c, 0x25, 0x09, 0x68, 0x96, 0x70, 0x70, 0xb7, 0x2e, 0xfe, 0x08, 0x1c, 0x06, 0xa2, 0x45, 0xac, 0x4f, 0x75, 0xbd, 0x41, 0x4d, 0x45, 0x8f, 0x81, 0x91, 0x05, 0x63, 0x8a, 0x5c, 0xa8, 0x95, 0x01, 0x6c, 0x36, 0x42, 0xd9, 0xea, 0xde, 0x11, 0xd8, 0x6b, 0xb7, 0x0a, 0x4c, 0x9a, 0xd0, 0x9b, 0x9b, 0x82, 0xae, 0xff, 0x99, 0x2a, 0x22, 0x46, 0xa4, 0x6c, 0xb8, 0x19, 0xd0, 0x72, 0x55, 0x47, 0x30, 0x9a, 0x75, 0xa3, 0x96, 0xa9, 0x74, 0x64, 0x05, 0x08, 0xb2, 0xc3, 0x2e, 0xde, 0x6d, 0x32, 0x1e, 0x82, 0x59, 0xdd, 0x02, 0xfe, 0x36, 0xac, 0x0d, 0x47, 0x05, 0xc7, 0x1c, 0xcf, 0x69, 0x7c, 0xf7, 0x45, 0xf6, 0xed, 0x16, 0xf4, 0x69, 0x2b, 0xc6, 0x4e, 0xdc, 0xa1, 0xda, 0x1f, 0x82, 0xb0, 0x6a, 0xc7, 0x10, 0xad, 0x0c, 0x5b, 0xeb, 0xc2, 0xc5, 0x95, 0x96, 0x88, 0x9e, 0x2d, 0x26, 0xd1, 0xf1, 0xd1, 0x2d, 0xbd, 0xc3, 0x42, 0xd3, 0xcb, 0xc5, 0x6b, 0x07, 0xcc, 0x23, 0xc8, 0x3a, 0xed, 0xa5, 0x93, 0x60, 0x19, 0xfb, 0x22, 0xce, 0xf8, 0x97, 0x0e, 0x51, 0xfd, 0x70, 0xe9, 0x65, 0x98, 0x75, 0x51, 0xfe, 0xbf, 0x71, 0x91, 0xc2, 0xc5, 0x03, 0xa5, 0x41, 0xcd, 0x53, 0x06, 0xe9, 0xda, 0x1f, 0x73, 0xd7, 0x30, 0x33, 0xa8, 0x85, 0x39, 0xcd, 0x74, 0x4d, 0xa1, 0x1f, 0xbc, 0xb6, 0x3b, 0xaa, 0x7d, 0x0a, 0xdc, 0x7a, 0x63, 0x82, 0x62, 0x1f, 0x63, 0x17, 0x4a, 0x9d, 0x49, 0x36, 0xb8, 0x9d, 0x84, 0x54, 0xdf, 0xb4, 0x1f, 0xc3, 0xd6, 0xb6, 0x06, 0x52, 0x13, 0xeb, 0x41, 0xca, 0xe3, 0x6a, 0x84, 0x2a, 0x34, 0x01, 0x92, 0xf4, 0xcf, 0xbc, 0x76, 0x57, 0x9e, 0x98, 0xf9, 0x4f, 0x00, 0x42, 0xe9, 0x10, 0x79, 0x22, 0x18, 0x6d, 0x08, 0x59, 0xfa, 0xb2, 0xc5, 0xf4, 0x32, 0xf4, 0xb5, 0xce, 0xb6, 0xd8, 0x9a, 0x33, 0xb2, 0xea, 0x1c, 0x21, 0xf1, 0xce, 0x6c, 0xba, 0xc9, 0x98, 0x2b, 0xa2, 0x2a, 0xc4, 0x71, 0x51, 0xdd, 0xf5, 0x54, 0xa3, 0xf8, 0x76, 0xae, 0x55, 0x9b, 0x61, 0xad, 0x3c, 0x89, 0x29, 0x5f, 0xcf, 0xe0, 0x68, 0x42, 0xa7, 0x93, 0x73, 0x18, 0x15, 0x6d, 0x87, 0x85, 0xab, 0xba, 0xa9, 0x2f, 0x82, 0x06, 0x64, 0xef, 0x8c, 0xce, 0x4a, 0x0d, 0x30, 0x3d, 0xca, 0xf8, 0xdd, 0x38, 0xeb, 0x23, 0x75, 0x2f, 0xaf, 0x09, 0x86, 0xfd, 0xb9, 0xa3, 0x3b, 0x42, 0xf1, 0xfb, 0xb6, 0x80, 0xaf, 0x4d, 0x6a, 0x90, 0x91, 0x40, 0x72, 0x4a, 0x6d, 0xc2, 0x2f, 0xd8, 0xd6, 0xfa, 0x75, 0x82, 0xaa, 0x72, 0x52, 0xe1, 0x8b, 0x45, 0x2c, 0x96, 0x7b, 0x6c, 0x74, 0x73, 0x04, 0x7f, 0x0b, 0x23, 0x66, 0xc8, 0x82, 0xb9, 0x84, 0x51, 0x7c, 0xd0, 0xc8, 0xb5, 0xfb, 0xb9, 0xa2, 0xbe, 0xa2, 0x60, 0x70, 0x3b, 0x39, 0x55, 0xe3, 0x2d, 0xf5, 0xbb, 0x53, 0x90, 0x13, 0x94, 0x51, 0x89, 0xac, 0x14, 0xa4, 0x6b, 0xa8, 0x26, 0xaf, 0xfa, 0x97, 0xd8, 0xb7, 0x02, 0x3e, 0xce, 0x12, 0x27, 0x52, 0x2d, 0x83, 0x99, 0x70, 0xd6, 0x59, 0x05, 0x7e, 0x77, 0xe1, 0xa4, 0x70, 0x69, 0xe6, 0x87, 0x1b, 0x98, 0xd5, 0x38, 0x9e, 0x08, 0x2f, 0x18, 0xaa, 0xf0, 0xf4, 0xfe, 0x0d, 0xaf, 0x25, 0x86, 0x39, 0x2f, 0x84, 0x38, 0xf2, 0x1c, 0x4c, 0xb4, 0x05, 0xc0, 0x10, 0x9b, 0xdd, 0xf8, 0xb1, 0xdd, 0x6b, 0x9a, 0xd4, 0xfe, 0xab, 0xb7, 0xe7, 0x54, 0x57, 0x62, 0x38, 0xda, 0x60, 0x78, 0xaa, 0x71, 0x34, 0xd2, 0x58, 0x34, 0xe0, 0x00, 0xef, 0x46, 0x14, 0xb3, 0x37, 0x16, 0x67, 0x49, 0x5d, 0xbd, 0xd7, 0x40, 0xc4, 0xb9, 0xf8, 0x12, 0x36, 0x3a, 0xe9, 0x41, 0xf2, 0x44, 0x58, 0x49, 0xd1, 0xa1, 0xc3, 0x50, 0xc2, 0x1f, 0xa7, 0x64, 0x4a, 0x36, 0xa7, 0xd1, 0x32, 0x45, 0x40, 0x0c, 0x89, 0x93, 0xa0, 0x81, 0xaa, 0x0d, 0x66, 0x77, 0x19, 0xc1, 0x8e, 0x2f, 0x37, 0xea, 0x11, 0x36, 0xc0, 0xed, 0x37, 0xe2, 0xc6, 0x24, 0x6d, 0x60, 0xe8, 0x7d, 0xb3, 0xac, 0xf9, 0xbf, 0x53, 0xa1, 0x69, 0x3f, 0x0d, 0xc7, 0x16, 0xbb, 0xc1, 0x14, 0x3d, 0x6a, 0x43, 0xfe, 0xed, 0x18, 0x93, 0xf3, 0xab, 0x7f, 0x93, 0xbb, 0xb3, 0x37, 0x82, 0x21, 0x65, 0xb2, 0x4c, 0xb3, 0x91, 0x66, 0xe7, 0x3e, 0x81, 0x1b, 0x91, 0x89, 0x27, 0xe1, 0x3c, 0xf6, 0x85, 0xf3, 0xa1, 0xe1, 0x9e, 0xbd, 0xdd, 0xc1, 0xb9, 0x4b, 0xe3, 0x9d, 0x94, 0x74, 0x50, 0x72, 0xca, 0x39, 0xa1, 0xde, 0x9b, 0x2a, 0x7b, 0x3e, 0xfc, 0x54, 0x3f, 0x3d, 0xd8, 0xf4, 0x15, 0x74, 0x9e, 0xdb, 0x63, 0x37, 0x9b, 0x9e, 0x7a, 0xb9, 0xcb, 0x83, 0x10, 0xa6, 0x7a, 0x79, 0xd8, 0xaa, 0xe6, 0xa9, 0x8f, 0xd2, 0x53, 0x17, 0x94, 0xe0, 0x7c, 0xe1, 0xa6, 0x41, 0x53, 0xb0, 0x8f, 0x78, 0x54, 0x03, 0xa7, 0x7d, 0x5c, 0x67, 0x54, 0xa2, 0x16, 0x56, 0x23, 0x06, 0x5f, 0xc3, 0x62, 0xa3, 0xf0, 0x06, 0x13, 0x19, 0xe5, 0xe3, 0xf8, 0x86, 0xb5, 0xc0, 0xf5, 0x49, 0x6d, 0x0b, 0x05, 0x19, 0x4f, 0xc7, 0x58, 0x31, 0x83, 0x0d, 0x55, 0x27, 0x55, 0x9b, 0x1d, 0xfd, 0x60, 0x84, 0x15, 0xf1, 0x81, 0x63, 0x27, 0xbe, 0x86, 0xe6, 0xef, 0xa9, 0x32, 0x37, 0x9b, 0x7c, 0xda, 0xcb, 0xa3, 0x1a, 0x59, 0xd8, 0xdb, 0x35, 0x4d, 0xb2, 0x4c, 0x2a, 0x15, 0xfc, 0x7a, 0x8a, 0xd7, 0x10, 0x53, 0x72, 0x9b, 0x6a, 0x47, 0xee, 0x8a, 0x41, 0x03, 0xcb, 0xa1, 0x40, 0xf2, 0xfc, 0xaf, 0x7c, 0x00, 0x90, 0xa3, 0x0e, 0x44, 0x9c, 0x0c, 0xd2, 0x7e, 0x4c, 0x82, 0xfb, 0xc7, 0x47, 0x26, 0x1e, 0xe3, 0x34, 0x50, 0x11, 0x84, 0xfe, 0xce, 0x59, 0x1e, 0x2f, 0xb4, 0xaa, 0xed, 0x53, 0xfa, 0x80, 0xb8, 0x23, 0xb8, 0x6d, 0xbb, 0x38, 0xf5, 0xff, 0x98, 0x1f, 0xcb, 0xd2, 0x65, 0x6f, 0xcd, 0x8e, 0x5e, 0xa7, 0x90, 0xb7, 0xd6, 0x0c, 0x61, 0xc7, 0x2d, 0x6e, 0x96, 0x6a, 0xfe, 0xb1, 0x11, 0x1e, 0xce, 0xd1, 0x7b, 0xd3, 0x44, 0x28, 0x8a, 0xb3, 0x58, 0x8d, 0xf5, 0x21, 0x86, 0x53, 0x22, 0x2e, 0x7d, 0xed, 0x96, 0xb2, 0xef, 0x5a, 0xe8, 0x73, 0x17, 0xdc, 0x1d, 0xf3, 0x8b, 0xd7, 0x18, 0x70, 0xca, 0x80, 0xa3, 0x0d, 0x36, 0x7d, 0x64, 0x6e, 0x92, 0xf1, 0x3b, 0x31, 0x08, 0xdd, 0x4f, 0xb2, 0xfc, 0xc9, 0x74, 0x5d, 0x7b, 0x0c, 0x43, 0x2d, 0x48, 0x50, 0x44, 0x0f, 0x52, 0xed, 0x57, 0x04, 0x31, 0x02, 0x8a, 0xbf, 0xe7, 0xd5, 0x83, 0xa2, 0x90, 0x6c, 0xbf, 0x77, 0x7f, 0x83, 0x21, 0x9b, 0xb8, 0x07, 0x95, 0x51, 0xd8, 0x94, 0xe9, 0x40, 0xd3, 0xb8, 0x83, 0xea, 0x03, 0xe1, 0x67, 0x71, 0xca, 0x63, 0xae, 0xa7, 0xa1, 0xc1, 0xc9, 0xa7, 0x43, 0xa6, 0x17, 0x17, 0xaf, 0xd1, 0xef, 0x97, 0x7f, 0x85, 0x5b, 0x1d, 0x37, 0x69, 0x7a, 0xcb, 0xea, 0x0b, 0x76, 0x84, 0x12, 0x9b, 0x47, 0xdd, 0x8d, 0x5c, 0x38, 0x6e, 0x5b, 0x31, 0x8d, 0x01, 0xb2, 0xb9, 0x5a, 0x81, 0x0f, 0x5e, 0x7c, 0x16, 0x97, 0xd4, 0xbe, 0x9a, 0xe3, 0xce, 0xa8, 0xdf, 0x5b, 0x8d, 0x71, 0xe3, 0x1a, 0x56, 0x4f, 0x8d, 0xce, 0x96, 0x63, 0x14, 0x5a, 0xc2, 0x88, 0x88, 0x77, 0x2b, 0x5c, 0xba, 0xc0, 0x68, 0x51, 0x6c, 0x4c, 0x65, 0x3a, 0x1b, 0x2a, 0xde, 0xa3, 0x42, 0x04, 0xe5, 0xd4, 0xd7, 0x96, 0xf6, 0x7c, 0x4a, 0x07, 0xbc, 0x1b, 0x97, 0x8e, 0x9e, 0x00, 0xe2, 0x16, 0xac, 0x3b, 0x74, 0x1c, 0x89, 0xab, 0x88, 0xfb, 0xb8, 0x8d, 0x54, 0x69, 0x8f, 0x8e, 0x74, 0x3b, 0x42, 0x26, 0x0c, 0xea, 0x19, 0x63, 0xb1, 0x62, 0x06, 0x18, 0x64, 0x1b, 0x47, 0x46, 0xa3, 0xdd, 0xd3, 0x5d, 0xca, 0x3e, 0xe6, 0x1b, 0x6d, 0x20, 0x09, 0x66, 0xb4, 0x5e, 0xe5, 0x2e, 0x4f, 0x8b, 0x3a, 0x98, 0xe6, 0xa8, 0x2d, 0xd5, 0x3f, 0x00, 0xfa, 0xfb, 0xdf, 0x46, 0x9d, 0xe0, 0x01, 0x72, 0x03, 0xac, 0x5d, 0xcd, 0x9c, 0xb5, 0x74, 0xfc, 0x49, 0xb5, 0x2e, 0x00, 0x26, 0x1f, 0x5b, 0xea, 0xf4, 0x19, 0x0e, 0x96, 0x32, 0x58, 0x1c, 0x6a, 0xf2, 0x57, 0xfb, 0x90, 0xfc, 0xe2, 0x25, 0xca, 0xa8, 0xa5, 0xd8, 0x8d, 0xd9, 0x7e, 0xc3, 0xa9, 0xae, 0x1c, 0xd4, 0x0e, 0xd8, 0xde, 0x73, 0xd6, 0x8f, 0xf9, 0x91, 0x7f, 0x05, 0xfa, 0x4c, 0xaf, 0xc2, 0x52, 0xc2, 0x88, 0xb4, 0x00, 0xab, 0x56, 0x62, 0x8f, 0xf0, 0xe9, 0x1e, 0xbe, 0x39, 0x0d, 0xef, 0xd9, 0xcc, 0x71, 0x61, 0x47, 0x4c, 0xe7, 0x9b, 0x4e, 0x6a, 0xc7, 0x37, 0x5e, 0xa9, 0x25, 0xc6, 0xb2, 0x80, 0x39, 0x5d, 0xf4, 0x8f, 0x24, 0xff, 0xd8, 0x86, 0x00, 0x3f, 0x4f, 0xf1, 0x8e, 0xca, 0x50, 0x06, 0x8b, 0xca, 0xb0, 0xef, 0xeb, 0xee, 0x15, 0x20, 0x23, 0x61, 0x6e, 0x2f, 0xfb, 0x8d, 0xfd, 0x82, 0xb0, 0xd1, 0xd8, 0xd5, 0xf1, 0xd7, 0xe8, 0x18, 0xd1, 0x05, 0x91, 0x1a, 0x3d, 0xe8, 0x5d, 0x49, 0x64, 0x58, 0xce, 0xb6, 0xf6, 0x3f, 0xf5, 0x8d, 0x88, 0xf2, 0x1c, 0xea, 0x1a, 0x1f, 0x7c, 0xca, 0xfd, 0x38, 0x70, 0x54, 0x8d, 0x49, 0xf9, 0x4f, 0xb5, 0x44, 0x4c, 0x49, 0xf9, 0x49, 0x9f, 0x18, 0x2e, 0x06, 0xbc, 0x93, 0x90, 0x61, 0x02, 0xee, 0xa6, 0x21, 0x72, 0x86, 0xce, 0xf4, 0xc5, 0x1a, 0x0a, 0x76, 0x63, 0x5d, 0x65, 0x48, 0x52, 0x26, 0x1f, 0xdb, 0x0e, 0xde, 0xe8, 0xc1, 0x91, 0xb3, 0x23, 0x20, 0x56, 0x5a, 0xba, 0x76, 0x15, 0x49, 0x45, 0x10, 0xd4, 0x34, 0xd7, 0xb1, 0xa7, 0x77, 0x62, 0x31, 0xd3, 0x2e, 0x42, 0x54, 0x9e, 0x1a, 0x95, 0x74, 0x3d, 0x71, 0xec, 0x98, 0xf6, 0x8c, 0x89, 0x62, 0x68, 0x25, 0x92, 0x88, 0xaa, 0x3a, 0x12, 0x29, 0x01, 0x71, 0x8c, 0x90, 0x30, 0x08, 0xcc, 0xe8, 0xbe, 0x45, 0xe4, 0xa7, 0xa1, 0xed, 0xce, 0xfa, 0x30, 0xbe, 0xaa, 0x5b, 0x36, 0x45, 0xf7, 0x5d, 0x4a, 0xe7, 0x8a, 0x0a, 0xa3, 0xb6, 0xc9, 0xca, 0x36, 0x75, 0xeb, 0x19, 0xd0, 0x83, 0x79, 0x39, 0x16, 0xa6, 0xb1, 0xae, 0xf6, 0x1c, 0x0e, 0xa8, 0x14, 0xab, 0x4f, 0x3f, 0x80, 0x70, 0x1e, 0x13, 0x60, 0x4e, 0x4a, 0x49, 0x36, 0x1b, 0x89, 0x18, 0x00, 0x3b, 0x4f, 0x08, 0xd3, 0x19, 0xae, 0x93, 0x3d, 0xcd, 0xf0, 0x5e, 0x62, 0x27, 0x2c, 0x7a, 0xb0, 0xfc, 0x3c, 0xd3, 0x74, 0x9a, 0xeb, 0x88, 0x82, 0xf8, 0xd2, 0x1d, 0x97, 0xee, 0xd7, 0x58, 0x2b, 0x2f, 0x9b, 0x34, 0x80, 0xbd, 0xe2, 0x9b, 0x6f, 0x47, 0x60, 0x55, 0x62, 0x0b, 0xa8, 0x6b, 0x39, 0x42, 0xdc, 0x08, 0xc6, 0xfb, 0x56, 0x1c, 0xfc, 0x4d, 0xbb, 0x20, 0xb1, 0xca, 0xc0, 0xbe, 0x8c, 0x5d, 0x44, 0xfc, 0x7a, 0x60, 0xf2, 0xc6, 0x93, 0x4f, 0x3e, 0xeb, 0xd9, 0xb9, 0x20, 0x35, 0x2b, 0xe7, 0x50, 0xf7, 0x9d, 0x3f, 0xa6, 0x1f, 0x97, 0x6b, 0x99, 0x76, 0xaf, 0x1b, 0x64, 0x5a, 0x76, 0x0b, 0xa8, 0xdb, 0xd0, 0x9e, 0xd2, 0x10, 0x21, 0x85, 0x2a, 0x89, 0xee, 0x84, 0xdd, 0xec, 0x76, 0xf7, 0xca, 0x24, 0xb1, 0xca, 0x14, 0x65, 0x09, 0x5b, 0xb3, 0xa6, 0x5f, 0xfe, 0x21, 0x96, 0x72, 0xb9, 0xf7, 0x70, 0xf5, 0x22, 0xc2, 0x40, 0xb2, 0x53, 0x82, 0x86, 0xec, 0x43, 0x90, 0xde, 0x8f, 0xb1, 0xb9, 0x1b, 0x88, 0x86, 0x04, 0x68, 0xd1, 0xd4, 0x31, 0x54, 0x21, 0x5a, 0xd2, 0x2a, 0xa8, 0x0d, 0xe1, 0xa8, 0x43, 0xae, 0x77, 0x1d, 0xbe, 0x69, 0x74, 0xd6, 0x04, 0xbf, 0x69, 0x66, 0x83, 0xf2, 0x1f, 0xcb, 0x89, 0x49, 0xc7, 0xdc, 0x66, 0x97, 0x0e, 0x06, 0x8f, 0x23, 0x37, 0x7b, 0xc3, 0x61, 0xb9, 0x40, 0x0e, 0x08, 0x18, 0x1c, 0x59, 0x63, 0xe6, 0xf5, 0xb3, 0x0b, 0xfa, 0xdb, 0x82, 0x76, 0xf0, 0xa2, 0xa1, 0x5f, 0xc5, 0xf2, 0xd8, 0x76, 0x2c, 0x8f, 0xb1, 0x69, 0x91, 0x14, 0x9d, 0x5a, 0xfe, 0x1f, 0x72, 0x47, 0x2f, 0xf1, 0xe3, 0xbe, 0x54, 0xa8, 0xdb, 0x5c, 0xab, 0x7e, 0x24, 0x09, 0x26, 0x99, 0x96, 0x01, 0x03, 0xc0, 0x54, 0x23, 0x35, 0xbb, 0x0c, 0x43, 0xba, 0xb9, 0xad, 0xb0, 0x40, 0xbd, 0x2f, 0xdd, 0x7c, 0xfc, 0xe2, 0xac, 0xd7, 0xc9, 0x7f, 0xd6, 0xf6, 0xc2, 0xf4, 0xf9, 0xa8, 0xb6, 0xb8, 0xf8, 0x51, 0xd7, 0xaa, 0x39, 0xdc, 0x77, 0x00, 0x95, 0xb4, 0xea, 0xd0, 0x9f, 0x96, 0xb6, 0x6c, 0xd8, 0xb0, 0x13, 0xe3, 0xe1, 0x1f, 0x8f, 0x2c, 0x8b, 0xea, 0x55, 0x34, 0x6d, 0x4c, 0x3b, 0x1b, 0xe7, 0xb0, 0x47, 0x66, 0x28, 0x9b, 0xdd, 0xcc, 0xa5, 0xf8, 0x8d, 0x5d, 0x4d, 0x76, 0x04, 0xaa, 0x0a, 0xe9, 0x67, 0x7e, 0x86, 0xbc, 0xe6, 0x55, 0xe1, 0xbd, 0xfe, 0x97, 0x23, 0xe1, 0x9a, 0xc6, 0xfe, 0x9c, 0x62, 0x96, 0xb6, 0xbc, 0x77, 0x22, 0x1b, 0x8a, 0xe5, 0xa6, 0xcd, 0xbf, 0xb1, 0x36, 0x9a, 0x86, 0x61, 0xf2, 0xc4, 0x46, 0x6d, 0x3b, 0xe2, 0xfd, 0x86, 0x44, 0xeb, 0x10, 0x90, 0x08, 0xf2, 0xc3, 0x75, 0xf1, 0x31, 0xc5, 0x2b, 0x33, 0x48, 0x66, 0xcf, 0x46, 0x9e, 0x52, 0xe4, 0xc5, 0x6a, 0x31, 0xd9, 0xc0, 0x31, 0xba, 0x7c, 0x2b, 0xd6, 0x10, 0x9b, 0x6d, 0x8f, 0x24, 0x80, 0xbc, 0xb0, 0x57, 0x8e, 0xde, 0xff, 0xf2, 0xc2, 0xd7, 0x49, 0x1f, 0xc0, 0x02, 0x08, 0x23, 0x09, 0xe4, 0x96, 0xf6, 0xa2, 0x86, 0x15, 0xdf, 0x3a, 0xc7, 0x46, 0x0b, 0x99, 0x70, 0xec, 0x9d, 0xef, 0x0f, 0x4f, 0xa7, 0x7b, 0x45, 0x54, 0xdf, 0x0b, 0x1a, 0x16, 0x01, 0xb4, 0xd9, 0xb7, 0x08, 0xc2, 0xe4, 0xe6, 0x29, 0x5e, 0x38, 0xa6, 0x5a, 0xdb, 0x6a, 0x5f, 0x9d, 0x04, 0x00, 0x29, 0xcc, 0x4c, 0xb4, 0x74, 0xad, 0x88, 0x37, 0x01, 0x86, 0x05, 0xc6, 0x11, 0x22, 0x59, 0x3d, 0x4c, 0x9d, 0x97, 0xab, 0x8f, 0xc7, 0xfe, 0xce, 0xfe, 0x49, 0x06, 0xeb, 0x56, 0xe2, 0x44, 0x6b, 0xbb, 0xee, 0x43, 0xb7, 0x27, 0x8a, 0x05, 0xcf, 0xab, 0xa2, 0xb8, 0xe1, 0x07, 0x56, 0xf4, 0x63, 0x8c, 0xcd, 0xa9, 0xed, 0x15, 0x7d, 0xda, 0xe5, 0xbb, 0xc0, 0xed, 0x02, 0xd0, 0x5c, 0x1c, 0x6e, 0x9c, 0x93, 0x45, 0xf6, 0x6a, 0xd9, 0x08, 0xa9, 0x0e, 0xf5, 0x87, 0x1d, 0x10, 0x43, 0xf7, 0x87, 0xc6, 0xab, 0xca, 0x2c, 0x9c, 0x35, 0x6b, 0xdb, 0x1b, 0xbf, 0x9d, 0x11, 0xd3, 0x75, 0x9b, 0xc7, 0x36, 0xba, 0x19, 0xa3, 0x44, 0xaf, 0x05, 0x41, 0xa9, 0x33, 0xa9, 0x6b, 0xc4, 0x41, 0x35, 0x20, 0x80, 0xb8, 0x7b, 0x28, 0x84, 0x09, 0x9b, 0x66, 0x3c, 0xd2, 0xb8, 0xd9, 0x30, 0x77, 0x01, 0xe7, 0x2d, 0xeb, 0xbb, 0x67, 0xbc, 0x1b, 0x05, 0x8b, 0xf0, 0x48, 0xdd, 0xa7, 0x75, 0xf6, 0x0a, 0xd1, 0xdb, 0x26, 0x93, 0xf8, 0x82, 0x13, 0x5b, 0xb4, 0x71, 0xc9, 0xed, 0x23, 0xcc, 0xf6, 0x20, 0x7b, 0xa9, 0xf4, 0x88, 0x12, 0xca, 0x0a, 0x0a, 0xe7, 0x68, 0x11, 0x9f, 0x07, 0xb4, 0x7c, 0xa2, 0xd1, 0xd4, 0x8c, 0x07, 0x6e, 0xa1, 0xa5, 0xd7, 0xe5, 0x0d, 0x4d, 0x45, 0x06, 0x6e, 0x69, 0xc5, 0x5d, 0xc7, 0x53, 0x16, 0xfe, 0x32, 0xd6, 0xc0, 0x6c, 0x30, 0x77, 0x0a, 0x54, 0x94, 0xd2, 0x09, 0x44, 0x11, 0xe5, 0xa8, 0x3e, 0xd8, 0x69, 0xf9, 0xa6, 0x15, 0x66, 0x58, 0xeb, 0x7c, 0xff, 0x75, 0x55, 0x2d, 0xea, 0x11, 0x48, 0x24, 0x59, 0xda, 0xe8, 0x14, 0x8b, 0x78, 0x0d, 0xa2, 0x4b, 0x2c, 0xa4, 0x7b, 0x17, 0x89, 0xe3, 0x74, 0x01, 0x68, 0xca, 0xfc, 0x28, 0x7a, 0x9c, 0xd9, 0xb7, 0xf3, 0xe6, 0xdc, 0xb7, 0x70, 0x39, 0x56, 0xa1, 0x75, 0x44, 0xbd, 0x5f, 0x1e, 0xd4, 0x61, 0x75, 0x0c, 0xd5, 0x35, 0xe1, 0x9d, 0x6e, 0xd0, 0xa1, 0xa0, 0x8d, 0x40, 0xfe, 0x16, 0x28, 0x05, 0x70, 0x07, 0xbc, 0xf5, 0x90, 0x40, 0xa7, 0xca, 0x3a, 0xc7, 0x95, 0x4e, 0xbe, 0xa8, 0xe6, 0x63, 0x99, 0x94, 0xe3, 0x0f, 0x29, 0x23, 0xb5, 0x7b, 0xc3, 0x78, 0x71, 0x0e, 0x3c, 0x84, 0xbb, 0xf4, 0x3f, 0x94, 0x73, 0x2a, 0x34, 0x47, 0x86, 0xd8, 0x79, 0xf2, 0x36, 0x7e, 0xbe, 0xfc, 0xfa, 0xb0, 0xa2, 0xc4, 0xa5, 0x30, 0xc3, 0xd6, 0x0c, 0xd6, 0xfd, 0x48, 0x64, 0xc9, 0xae, 0x37, 0x9c, 0x37, 0xe2, 0x78, 0xfd, 0xc6, 0xff, 0x8b, 0x9a, 0x6a, 0x90, 0xc7, 0x22, 0xde, 0x4f, 0x5c, 0xa3, 0x9e, 0x06, 0xd5, 0x90, 0x5b, 0x40, 0x3c, 0xf0, 0x95, 0x50, 0x30, 0x8d, 0x60, 0x17, 0x7e, 0xb1, 0x46, 0x63, 0xab, 0x40, 0x72, 0xae, 0x92, 0x40, 0x2e, 0x84, 0xca, 0xae, 0x97, 0xce, 0x5b, 0x6e, 0xee, 0x6a, 0xb2, 0x3b, 0xd5, 0x04, 0x5c, 0x91, 0x20, 0x0f, 0xd4, 0x8e, 0xba, 0xf9, 0x44, 0xbb, 0xa1, 0xb7, 0xc9, 0xe2, 0x13, 0x19, 0xe3, 0x2b, 0x88, 0x96, 0xaf, 0x2a, 0x34, 0xd2, 0x0f, 0x3f, 0x19, 0x1e, 0xa8, 0x84, 0x4b, 0x24, 0xc6, 0xfc, 0xfb, 0x21, 0xd7, 0x64, 0x7e, 0xc4, 0x52, 0x14, 0x89, 0x3d, 0x85, 0xa0, 0xfa, 0xe5, 0xcd, 0xf3, 0x7c, 0xf4, 0xb4, 0xbf, 0x1a, 0xd3, 0x5b, 0x0d, 0xb2, 0xd7, 0x03, 0x36, 0x81, 0x88, 0x93, 0x26, 0x37, 0xae, 0xe3, 0x77, 0xd7, 0x7e, 0x07, 0x4c, 0x51, 0xc6, 0xcc, 0xd4, 0xff, 0x68, 0x9d, 0x3a, 0x74, 0x2c, 0x67, 0x9b, 0x87, 0xce, 0x98, 0x2a, 0x0e, 0xd3, 0xb2, 0x95, 0x2f, 0xd6, 0x95, 0xd1, 0x03, 0xf1, 0x7d, 0xdf, 0x87, 0x10, 0x1b, 0x00, 0x91, 0x2a, 0x5c, 0x39, 0x1f, 0xc1, 0xed, 0xea, 0x9f, 0x19, 0xa7, 0x59, 0x96, 0x04, 0x99, 0xec, 0x03, 0xb3, 0x3f, 0x67, 0xdb, 0xa9, 0x80, 0xa7, 0x3f, 0x27, 0x20, 0xd3, 0xdf, 0x99, 0x1b, 0x91, 0x6e, 0xe1, 0xc8, 0x51, 0xf2, 0x01, 0x7c, 0x8e, 0x29, 0x26, 0x59, 0xd7, 0x61, 0x81, 0x64, 0x15, 0x36, 0xc2, 0xac, 0x96, 0xb1, 0x9b, 0xfe, 0x39, 0x60, 0x5f, 0x17, 0x2a, 0x22, 0x78, 0x35, 0xbe, 0xd5, 0x2b, 0x22, 0xb7, 0x5a, 0xe5, 0x9b, 0x6d, 0x6e, 0x37, 0xb6, 0x3d, 0x3c, 0x50, 0x7e, 0xa9, 0x86, 0x74, 0xe0, 0xb5, 0x3d, 0x57, 0x93, 0x0d, 0x2a, 0x23, 0x5d, 0xac, 0x35, 0xb1, 0xec, 0xe9, 0xbc, 0x05, 0xcc, 0x72, 0xe8, 0xac, 0x94, 0xe5, 0x93, 0xca, 0x3e, 0x5e, 0xf7, 0x40, 0xd5, 0xb4, 0x5d, 0x54, 0xd6, 0x37, 0x00, 0xed, 0x7a, 0xae, 0xf8, 0xf9, 0x3f, 0xed, 0xfe, 0x1a, 0x40, 0x9e, 0xeb, 0x51, 0x5e, 0x42, 0x6d, 0x47, 0x54, 0x25, 0x62, 0xb6, 0x2d, 0x6d, 0xd7, 0xb4, 0xe2, 0x95, 0xef, 0x17, 0x25, 0xd0, 0xb3, 0x61, 0xa6, 0xea, 0x7e, 0xb9, 0x74, 0x3f, 0x39, 0x44, 0x78, 0xcf, 0xce, 0x6a, 0x4f, 0xf6, 0x8c, 0x6e, 0x83, 0x42, 0x11, 0x77, 0xc4, 0x63, 0x72, 0x9d, 0x3f, 0x01, 0xf2, 0x7d, 0x32, 0x2c, 0x57, 0xed, 0xc5, 0x7f, 0xbe, 0x2e, 0x3b, 0x8a, 0x86, 0x0e, 0x09, 0xc5, 0xe7, 0xe0, 0xe7, 0x18, 0xf1, 0xb9, 0xa8, 0x2e, 0x7d, 0x94, 0x52, 0x5c, 0xb2, 0xa3, 0x60, 0x35, 0xd1, 0x17, 0x08, 0x33, 0x09, 0xd6, 0xb9, 0x19, 0x81, 0x9c, 0x31, 0x97, 0x59, 0x56, 0x84, 0xc9, 0x79, 0x70, 0x08, 0x35, 0x20, 0x54, 0x84, 0xe2, 0x4c, 0x9f, 0x2c, 0xe0, 0x1b, 0x92, 0x06, 0xb1, 0x19, 0xa5, 0xc0, 0xdf, 0x01, 0xcb, 0xe4, 0x5b, 0xb2, 0x0f, 0x61, 0x14, 0x04, 0x35, 0x75, 0x45, 0xcb, 0xc2, 0x59, 0xe1, 0x9b, 0x7b, 0xb3, 0xa0, 0x6a, 0xdb, 0xb7, 0x6d, 0xef, 0x6b, 0x5b, 0x22, 0xbf, 0xdd, 0xdd, 0xa2, 0xb4, 0x99, 0x2c, 0x80, 0xaa, 0x41, 0xb2, 0xa7, 0x95, 0x14, 0xfd, 0x6b, 0xbd, 0x1f, 0xbf, 0x1e, 0xdd, 0xf6, 0x74, 0xfe, 0x18, 0x66, 0xc8, 0xb0, 0xf3, 0x8c, 0xcf, 0x87, 0x92, 0xe9, 0xa2, 0xd4, 0xb1, 0x1e, 0xce, 0x4d, 0xda, 0x6b, 0xe2, 0xd6, 0x8d, 0xdd, 0x9f, 0x28, 0x31, 0xe0, 0x44, 0x3b, 0x77, 0x5b, 0x64, 0xeb, 0x20, 0x60, 0x1b, 0x73, 0xf9, 0x76, 0x40, 0x0f, 0xa7, 0xfa, 0x8f, 0xe6, 0x5c, 0x31, 0x0c, 0xb5, 0x7e, 0x49, 0xb1, 0xce, 0x36, 0xc0, 0x81, 0xe6, 0xe9, 0xe6, 0xab, 0x3a, 0x6d, 0x13, 0x1a, 0xa3, 0x1e, 0x47, 0x13, 0xce, 0xb4, 0xd1, 0x3d, 0x72, 0x6e, 0x78, 0x97, 0x8e, 0x47, 0x53, 0x5c, 0xdc, 0xad, 0xae, 0x3c, 0xeb, 0x14, 0x6a, 0xda, 0x3c, 0x0d, 0x6b, 0x1d, 0xc8, 0xfa, 0x70, 0x63, 0x66, 0x0d, 0xdf, 0xae, 0x93, 0x7d, 0xcd, 0xc4, 0x22, 0x30, 0x0f, 0x1c, 0x66, 0x79, 0x91, 0x29, 0x58, 0xa7, 0xc5, 0x00, 0x7c, 0x3f, 0xe6, 0x4a, 0x9e, 0x8c, 0x36, 0x9b, 0x7d, 0xfe, 0x63, 0xdf, 0x20, 0x71, 0xd2, 0xb5, 0xab, 0xca, 0x7a, 0x19, 0x53, 0x6d, 0x78, 0xdb, 0x82, 0xf9, 0x9b, 0xb4, 0xf4, 0x09, 0x4f, 0x03, 0x64, 0xea, 0x87, 0x0c, 0x50, 0x7a, 0x73, 0xda, 0x13, 0x07, 0x18, 0x3b, 0x5c, 0xbd, 0xa3, 0xfe, 0x47, 0x80, 0xc6, 0xbe, 0xe2, 0x74, 0xc1, 0x78, 0xe6, 0x4a, 0xa7, 0xc0, 0x4c, 0xfd, 0xdb, 0x21, 0x9a, 0x93, 0x71, 0x44, 0x08, 0x90, 0xbe, 0xff, 0x64, 0xb9, 0x0f, 0xac, 0xd9, 0xdc, 0x83, 0xf4, 0x29, 0x15, 0x3c, 0x9a, 0x39, 0x57, 0x3b, 0x29, 0xeb, 0x53, 0x1f, 0x14, 0x84, 0x3b, 0xf9, 0x1c, 0xc1, 0xe3, 0x4f, 0x86, 0xdb, 0xbc, 0x88, 0x28, 0x54, 0xc5, 0x3b, 0x9a, 0x46, 0xfc, 0x0e, 0xba, 0xf8, 0x8d, 0xd4, 0xf1, 0xd9, 0x56, 0x36, 0x67, 0xbb, 0xbc, 0xf4, 0x01, 0x94, 0x2e, 0xee, 0x95, 0xc8, 0x91, 0x7e, 0x97, 0x14, 0xc1, 0x90, 0x57, 0x0a, 0x9b, 0x52, 0x13, 0x30, 0x9f, 0xe3, 0xd8, 0x12, 0x76, 0x7e, 0x2e, 0xf7, 0xce, 0xda, 0x6f, 0xac, 0x0d, 0x63, 0x43, 0x50, 0x5b, 0xae, 0x1d, 0x74, 0x58, 0x35, 0xc0, 0x2b, 0x43, 0xd4, 0xd9, 0xc1, 0x54, 0x0d, 0xa5, 0xb4, 0x7c, 0x4c, 0x1e, 0x65, 0x49, 0x1c, 0x7e, 0x02, 0xcb, 0x28, 0x69, 0x17, 0x72, 0x94, 0x6a, 0x6b, 0xaf, 0x9c, 0xa9, 0x16, 0x63, 0xb9, 0x2d, 0xcf, 0xe4, 0xaf, 0x7a, 0xf5, 0x29, 0x56, 0x97, 0x1d, 0x9d, 0xb2, 0x18, 0xbf, 0x26, 0x70, 0x6f, 0xc0, 0x12, 0xf5, 0xd6, 0x29, 0x8c, 0x09, 0xed, 0x7d, 0x0b, 0xb7, 0xbb, 0xeb, 0x59, 0xed, 0x15, 0xe1, 0xca, 0xa0, 0x66, 0xa0, 0x70, 0xaf, 0x09, 0x66, 0x74, 0x90, 0xbd, 0xe8, 0x32, 0x7e, 0x3f, 0xc1, 0x92, 0xb3, 0xe8, 0x17, 0x3f, 0xe5, 0x25, 0xb1, 0xec, 0xc3, 0x31, 0x23, 0x88, 0xd9, 0x33, 0x24, 0xe5, 0x6e, 0xb8, 0x49, 0x6d, 0x75, 0x36, 0x1f, 0x40, 0xae, 0x6c, 0xb2, 0x46, 0x0d, 0x10, 0x6f, 0xe3, 0xb9, 0x9f, 0x77, 0xd4, 0xfc, 0x17, 0x27, 0x0b, 0x5d, 0xe6, 0x26, 0xa4, 0x28, 0xec, 0xc4, 0x4d, 0x8d, 0x6f, 0xb0, 0xee, 0x6e, 0xf2, 0x7a, 0x2b, 0x13, 0x1d, 0x64, 0xb6, 0xd2, 0x88, 0x05, 0x91, 0x21, 0x00, 0x44, 0x81, 0xd0, 0x7a, 0xb8, 0x92, 0x05, 0x1b, 0xee, 0x95, 0x26, 0x43, 0x66, 0x62, 0x35, 0xe8, 0x47, 0x4a, 0x47, 0x9a, 0x96, 0x6c, 0x61, 0xd9, 0xf9, 0x6f, 0x96, 0xa2, 0x0e, 0x26, 0x62, 0xac, 0x55, 0x76, 0x5f, 0x54, 0xc6, 0xa8, 0xaf, 0x1a, 0xe2, 0x9e, 0x68, 0xc6, 0xad, 0xac, 0x72, 0xf0, 0x45, 0x82, 0xb1, 0x59, 0x4c, 0xb8, 0x1e, 0x66, 0x02, 0xe1, 0x79, 0xd6, 0x9c, 0x5f, 0x40, 0x53, 0xcc, 0xf6, 0xbd, 0x97, 0xff, 0xe2, 0xbf, 0x36, 0xa0, 0x09, 0xee, 0x1a, 0xf5, 0xbb, 0xda, 0x41, 0xbc, 0x97, 0x9d, 0xd4, 0xcd, 0x84, 0xdf, 0x48, 0x89, 0xc5, 0x01, 0xc8, 0x3e, 0xd8, 0xda, 0x2a, 0x08, 0x6d, 0x0d, 0x08, 0x94, 0x03, 0x64, 0x31, 0xe4, 0x69, 0x3c, 0x5b, 0x65, 0xc4, 0xb4, 0x35, 0x9e, 0x97, 0xfc, 0x72, 0x31, 0xba, 0xbc, 0xaa, 0x44, 0x88, 0x58, 0x9d, 0xae, 0x87, 0xe6, 0xf9, 0x94, 0x0d, 0x2e, 0xf4, 0xb8, 0x44, 0x4d, 0x26, 0xd0, 0xde, 0x36, 0xa8, 0x0e, 0x60, 0xbf, 0x67, 0xc7, 0x3d, 0x17, 0xc7, 0x07, 0xa4, 0x71, 0x79, 0xc5, 0xea, 0x1f, 0xf2, 0xe4, 0x7b, 0x0c, 0xe8, 0x0a, 0x37, 0x61, 0xa5, 0xee, 0x9d, 0xec, 0xb7, 0xcd, 0x0e, 0x83, 0xce, 0xa4, 0xc2, 0x55, 0x43, 0x1a, 0x12, 0xef, 0x25, 0x5e, 0x31, 0xea, 0xc6, 0x79, 0x0b, 0x51, 0xf5, 0x6d, 0xca, 0xa7, 0xd7, 0xde, 0x89, 0x00, 0x9c, 0x9a, 0xac, 0x6b, 0x40, 0xef, 0xe6, 0xb5, 0xff, 0xb4, 0x72, 0xc4, 0xb4, 0xa7, 0xde, 0x1d, 0xcf, 0x04, 0xdf, 0x65, 0xc5, 0xfc, 0xa6, 0x7d, 0x8d, 0x76, 0xd7, 0x15, 0x34, 0x1f, 0x65, 0xd8, 0x8a, 0xc2, 0xb9, 0xd6, 0x6f, 0x20, 0xd6, 0xdc, 0x0e, 0x67, 0xdb, 0x86, 0x9a, 0xa6, 0xac, 0xb7, 0xc2, 0xb3, 0xf3, 0x3b, 0x2a, 0xea, 0x97, 0xb0, 0x84, 0x37, 0x16, 0xea, 0x26, 0x31, 0x97, 0xc7, 0x1f, 0x57, 0x9a, 0x60, 0x39, 0x58, 0x18, 0xd9, 0x32, 0xe0, 0x33, 0x78, 0xdc, 0x9c, 0xea, 0x91, 0xc9, 0x13, 0xfa, 0x29, 0xbd, 0x1d, 0x95, 0x5c, 0x64, 0xa8, 0x8e, 0xd2, 0xc1, 0x10, 0x42, 0x76, 0x68, 0x3a, 0x75, 0x1a, 0xbd, 0xb5, 0xcc, 0x52, 0x6d, 0x15, 0x00, 0xf2, 0xdb, 0x91, 0x41, 0x74, 0x8c, 0x58, 0xde, 0x2e, 0x96, 0x04, 0xc3, 0x66, 0xbc, 0x18, 0x21, 0xc8, 0xcb, 0x15, 0xb7, 0x53, 0xf7, 0x44, 0xc5, 0xd2, 0xa5, 0xe7, 0x94, 0xcf, 0x7e, 0x45, 0x50, 0x17, 0x3b, 0x0c, 0x8c, 0x2c, 0xf7, 0xe0, 0x2b, 0xe0, 0x68, 0x21, 0xcb, 0x65, 0xed, 0xea, 0x45, 0xc4, 0xc8, 0x43, 0xe9, 0xfa, 0x55, 0xc3, 0x73, 0xda, 0xc3, 0x13, 0x60, 0x26, 0x91, 0x77, 0x4d, 0xe4, 0x18, 0x9c, 0x61, 0x2b, 0x87, 0xf5, 0xb7, 0x39, 0x7d, 0x2a, 0x2e, 0xc2, 0x80, 0x4b, 0x7f, 0x23, 0x83, 0x5f, 0xc2, 0x6f, 0xbe, 0xb5, 0x7b, 0x6e, 0x6c, 0xa7, 0x76, 0x29, 0x54, 0x01, 0x67, 0x73, 0xfe, 0x4c, 0x8a, 0x78, 0x0a, 0xe8, 0x4a, 0x86, 0xd1, 0x9e, 0xa6, 0xfc, 0x5d, 0xdb, 0x67, 0x5d, 0x90, 0xb2, 0x9f, 0xb1, 0x04, 0xe4, 0x29, 0x8f, 0x9f, 0x4b, 0xbd, 0xbd, 0x2b, 0xba, 0x26, 0x01, 0x47, 0x1f, 0x5f, 0x38, 0x79, 0x56, 0x1b, 0x50, 0xd3, 0xac, 0xa9, 0x61, 0x89, 0x8d, 0x0b, 0xbd, 0x63, 0x44, 0x0c, 0x70, 0xf9, 0xf5, 0xe0, 0xb7, 0x1b, 0xba, 0xa4, 0x91, 0xa6, 0xd1, 0xc8, 0x9e, 0x19, 0x0b, 0x26, 0x55, 0x08, 0xcb, 0xec, 0x7a, 0x7a, 0xb3, 0x14, 0x97, 0x7a, 0xc3, 0x23, 0x84, 0x03, 0x41, 0x78, 0xf1, 0xb9, 0xd4, 0xde, 0xd9, 0x4b, 0x10, 0x57, 0xc4, 0xeb, 0x6a, 0x40, 0x42, 0x20, 0xf5, 0x5c, 0x04, 0x4d, 0x98, 0xcb, 0xb0, 0x3d, 0x60, 0x06, 0xcc, 0x01, 0x18, 0xdd, 0x39, 0xe7, 0x9b, 0x9f, 0xc5, 0x42, 0xf0, 0x75, 0x6b, 0x9a, 0x5c, 0x15, 0xc7, 0x1f, 0x46, 0xa0, 0x31, 0x5a, 0x9e, 0xe6, 0x7f, 0xcc, 0xbf, 0x2c, 0xab, 0xbe, 0x49, 0x77, 0x14, 0x37, 0xf2, 0xdb, 0xa4, 0x04, 0xd0, 0xbd, 0x84, 0xe0, 0x79, 0x69, 0x3f, 0x41, 0x01, 0x5c, 0xbc, 0x80, 0x7d, 0x5d, 0xc8, 0xf3, 0xae, 0x8d, 0x60, 0x76, 0x90, 0xe7, 0x40, 0x04, 0x62, 0x40, 0x31, 0x82, 0x98, 0x57, 0xd8, 0x5e, 0xb3, 0x23, 0x9e, 0xeb, 0xfd, 0x8b, 0x2f, 0x19, 0x41, 0x71, 0x1e, 0xb5, 0x56, 0x93, 0x39, 0x71, 0xb1, 0xac, 0x45, 0x10, 0xd2, 0x32, 0x23, 0xdb, 0x19, 0xca, 0x9c, 0x48, 0x51, 0xd7, 0x31, 0x15, 0xb1, 0xaf, 0x90, 0x28, 0x4a, 0xd9, 0x09, 0x2d, 0xf7, 0x09, 0xe6, 0x09, 0xcf, 0xfe, 0xb0, 0x32, 0x34, 0xf1, 0x0a, 0x95, 0x6d, 0xab, 0xd1, 0x92, 0x8c, 0xfc, 0xe2, 0xb6, 0x5a, 0xd0, 0xe0, 0x1e, 0x35, 0xae, 0xa5, 0x08, 0xf7, 0xb2, 0x2a, 0x96, 0xe7, 0x98, 0xb4, 0xcd, 0x9d, 0xc5, 0xaf, 0xdd, 0x09, 0x48, 0xed, 0x5c, 0x8a, 0x9f, 0xeb, 0xc2, 0x36, 0x2b, 0x14, 0x2c, 0x11, 0xb6, 0x3b, 0x80, 0x3f, 0x8c, 0x05, 0xb2, 0x76, 0xca, 0xf9, 0x72, 0x82, 0xd4, 0xc6, 0x2e, 0x23, 0xe0, 0x6c, 0x0a, 0xc8, 0x42, 0x52, 0xe3, 0x53, 0xf3, 0xc7, 0xa0, 0x5a, 0x7e, 0x62, 0xe2, 0xbc, 0x20, 0x9d, 0x64, 0x04, 0x35, 0xc0, 0x55, 0x7c, 0x0d, 0xb9, 0x86, 0x52, 0xd8, 0x4c, 0xa6, 0x91, 0x3d, 0xc8, 0x1b, 0x20, 0x4e, 0xfd, 0xff, 0x7f, 0x6a, 0x88, 0x4a, 0x99, 0x48, 0xf5, 0xda, 0x15, 0xa6, 0x21, 0xc8, 0x1d, 0xb6, 0xcf, 0xa7, 0x56, 0xd1, 0x30, 0xbf, 0x65, 0x08, 0xba, 0xf8, 0x38, 0x5a, 0xa7, 0x00, 0xa8, 0xcf, 0x93, 0x85, 0x9d, 0x36, 0x8d, 0x99, 0xa7, 0x07, 0x1a, 0xf9, 0x86, 0x57, 0x86, 0xc2, 0x03, 0x89, 0xab, 0x4b, 0xac, 0xae, 0xa8, 0x73, 0x77, 0x55, 0x55, 0xfc, 0x25, 0xea, 0xfc, 0xf5, 0xad, 0x69, 0xb6, 0xa9, 0x1e, 0xc1, 0x0a, 0x2d, 0x23, 0x87, 0xad, 0xb8, 0x8a, 0xda, 0xc0, 0x58, 0x73, 0xbe, 0x30, 0x9b, 0x92, 0x76, 0xb1, 0x0b, 0x8b, 0xad, 0x19, 0x41, 0xf1, 0xed, 0xed, 0x8c, 0x9f, 0x2c, 0x79, 0x2e, 0x3f, 0xa5, 0xf3, 0xae, 0x39, 0x46, 0xc4, 0x1b, 0x4c, 0xeb, 0xce, 0x24, 0x86, 0x02, 0x11, 0xad, 0xd6, 0xf8, 0x3f, 0xf5, 0xf7, 0xa9, 0x27, 0xb0, 0x7e, 0x2a, 0xc2, 0xda, 0x94, 0x4d, 0xfd, 0x71, 0x64, 0xda, 0xa8, 0x9e, 0x82, 0x90, 0xc1, 0x61, 0x71, 0x1d, 0x06, 0x8c, 0x48, 0xaf, 0xec, 0xda, 0x43, 0xa8, 0x6d, 0x89, 0x77, 0x59, 0xa9, 0x1c, 0x77, 0x28, 0x2b, 0x91, 0xd2, 0x5e, 0x99, 0x02, 0xb9, 0x6c, 0x60, 0x48, 0x4b, 0xa7, 0xee, 0x2d, 0xe6, 0x44, 0x73, 0x2b, 0x62, 0x21, 0x64, 0xa4, 0xa0, 0xc9, 0xdf, 0x1c, 0x15, 0x8b, 0x5a, 0x4d, 0x24, 0xa5, 0xe2, 0x7f, 0x81, 0xbd, 0xb1, 0xe1, 0xfb, 0xb8, 0x43, 0xbb, 0x61, 0xb9, 0x0d, 0x3f, 0x36, 0x94, 0xe2, 0xe2, 0x2d, 0x4e, 0xda, 0xdb, 0x37, 0x8d, 0x93, 0x99, 0x6d, 0x80, 0x89, 0x6f, 0x38, 0x3a, 0xfe, 0x9b, 0xa6, 0x40, 0xa5, 0xb5, 0x4c, 0xc0, 0xca, 0x49, 0x41, 0x99, 0x58, 0x05, 0xf1, 0x68, 0x19, 0x4a, 0x9e, 0x18, 0xe8, 0x1a, 0xb3, 0x30, 0x11, 0xd8, 0x5d, 0x36, 0x80, 0xbb, 0xcf, 0x98, 0x47, 0x92, 0x64, 0xe1, 0x4e, 0x19, 0x89, 0x83, 0x99, 0xdc, 0xac, 0xde, 0x05, 0x2e, 0xca, 0xad, 0x59, 0xe5, 0x1b, 0xb5, 0x11, 0xe9, 0xc9, 0x2d, 0xfb, 0x50, 0x0f, 0x9c, 0x1b, 0x50, 0x61, 0x39, 0xac, 0x75, 0xb8, 0x14, 0x5c, 0xfe, 0xa8, 0xa8, 0xc8, 0x58, 0x89, 0x8a, 0xc6, 0xe3, 0xb1, 0xa6, 0x38, 0x6f, 0x22, 0xa0, 0xe9, 0xa7, 0x77, 0xb0, 0x30, 0x0f, 0xdd, 0x70, 0xe5, 0xe6, 0x56, 0xdf, 0x3d, 0xd1, 0x19, 0x90, 0x0c, 0x2e, 0xe6, 0x82, 0xbb, 0x6a, 0x4f, 0x7e, 0xed, 0x88, 0x34, 0x7b, 0x9d, 0x1d, 0xc7, 0xd0, 0x0c, 0x5b, 0xa6, 0x44, 0x46, 0xbd, 0x01, 0x41, 0xbf, 0x58, 0xc1, 0x40, 0x7a, 0xf8, 0x67, 0x3d, 0xf5, 0x4a, 0xc0, 0xc6, 0x6a, 0x94, 0x44, 0x48, 0xbc, 0x1d, 0x9d, 0xf9, 0x35, 0xf4, 0xaa, 0xf1, 0x02, 0x2d, 0x78, 0x2c, 0xe6, 0x18, 0x5c, 0xdc, 0x28, 0x36, 0x14, 0xf7, 0x96, 0x2a, 0xa4, 0xa9, 0x56, 0x08, 0x97, 0xc9, 0x76, 0x4e, 0xdb, 0xfe, 0xa3, 0x4d, 0xee, 0xce, 0xcc, 0x67, 0x7a, 0xf7, 0x90, 0x1e, 0x35, 0x42, 0x77, 0x97, 0xdc, 0xd5, 0x05, 0x36, 0x97, 0x13, 0x0d, 0xc5, 0xb1, 0xa2, 0xd4, 0x62, 0xe7, 0x03, 0xde, 0x21, 0x80, 0xf9, 0x50, 0x76, 0x61, 0x21, 0x02, 0xba, 0x8a, 0xed, 0x8b, 0x56, 0x6f, 0x22, 0xb0, 0x97, 0x30, 0xa3, 0xc2, 0xef, 0xa1, 0x10, 0x51, 0xc3, 0x63, 0x16, 0xe5, 0xde, 0x77, 0x09, 0xe8, 0xf4, 0xd1, 0x04, 0x73, 0xa8, 0x9e, 0x2d, 0x4d, 0x20, 0x80, 0xe8, 0x1d, 0x12, 0xda, 0x21, 0xe3, 0x6c, 0x5c, 0xe1, 0xce, 0x94, 0xa7, 0x65, 0x3f, 0x08, 0x33, 0xd2, 0xb5, 0x04, 0xad, 0x51, 0x63, 0x6f, 0x0e, 0x66, 0x29, 0x20, 0x5d, 0x05, 0x88, 0xee, 0xae, 0x36, 0xc2, 0xef, 0xe1, 0xb4, 0xb5, 0xa4, 0xac, 0x8a, 0x34, 0xc6, 0x5f, 0x7b, 0x3e, 0xd7, 0x0b, 0x0f, 0x1f, 0x0a, 0x4a, 0x7a, 0x56, 0x38, 0x45, 0xdf, 0xbb, 0xae, 0xd4, 0x94, 0x64, 0x37, 0x22, 0x36, 0xb1, 0x9d, 0xd5, 0x61, 0xed, 0x83, 0x95, 0x9d, 0x9b, 0xd3, 0x0c, 0x29, 0x85, 0x75, 0x6b, 0xc9, 0x07, 0x07, 0x38, 0x02, 0x80, 0x36, 0x79, 0x67, 0x2b, 0xa0, 0x9c, 0x43, 0x15, 0xb3, 0x86, 0x57, 0xab, 0x8b, 0xdb, 0x52, 0xe4, 0xfb, 0xa8, 0x3b, 0x96, 0xf4, 0xb3, 0x49, 0xe0, 0x9f, 0x55, 0x9d, 0x8c, 0xbc, 0x5f, 0x05, 0x7f, 0x4c, 0x2a, 0x32, 0x17, 0x25, 0x11, 0x75, 0x76, 0xbb, 0x24, 0xf8, 0x0d, 0x43, 0xb3, 0xdf, 0x31, 0x55, 0xaf, 0xc4, 0xa6, 0x2e, 0x3f, 0xfe, 0x83, 0x3f, 0x0c, 0x25, 0xff, 0xe8, 0xb2, 0xc3, 0x36, 0x0f, 0x20, 0xce, 0x0a, 0x95, 0xbd, 0x1a, 0x56, 0xd6, 0xbe, 0x96, 0xc1, 0xae, 0x42, 0x25, 0x30, 0xb5, 0x47, 0x5c, 0x82, 0x3e, 0x5e, 0xbf, 0x3f, 0xc4, 0xb3, 0x89, 0x4c, 0xd7, 0xaf, 0x60, 0x03, 0x5f, 0xac, 0x44, 0x7a, 0x6d, 0x4f, 0x7a, 0x35, 0x64, 0x19, 0xf8, 0x60, 0x84, 0xce, 0x8b, 0x9d, 0xfb, 0x4e, 0x49, 0x8a, 0xef, 0xaa, 0xeb, 0x73, 0x46, 0xb3, 0x3e, 0xa4, 0x7d, 0x38, 0x37, 0xf2, 0xaa, 0xa5, 0x1a, 0x59, 0x78, 0xab, 0x22, 0x62, 0x6c, 0xaa, 0x58, 0x3c, 0xf0, 0x74, 0xc7, 0xdd, 0xc1, 0x28, 0xd3, 0x76, 0x66, 0x75, 0x7d, 0xdb, 0xc0, 0x7e, 0x75, 0x36, 0x59, 0x5f, 0x44, 0x4b, 0x3f, 0xc4, 0x82, 0x06, 0x3d, 0xf7, 0x35, 0xa7, 0x5b, 0x62, 0x5f, 0x9d, 0xac, 0x4e, 0xee, 0xe5, 0xe4, 0x42, 0xb6, 0xa3, 0x89, 0x3d, 0x48, 0x16, 0xbf, 0xea, 0x7f, 0x8d, 0x8f, 0x3a, 0x61, 0xbf, 0xdb, 0x2a, 0x0a, 0xff, 0x6f, 0x6e, 0xe3, 0xde, 0xde, 0xc6, 0x8c, 0x4f, 0x19, 0x52, 0x4c, 0x10, 0xe6, 0x71, 0x8a, 0xf5, 0xc8, 0x5f, 0x8f, 0x0e, 0x0e, 0x9c, 0x7f, 0xd7, 0xc6, 0xf0, 0x27, 0xb9, 0xd1, 0x24, 0xcf, 0xb3, 0xe2, 0x93, 0x5f, 0x41, 0xe7, 0x33, 0x76, 0xf7, 0x9f, 0x18, 0xd3, 0x2b, 0xde, 0x50, 0xab, 0x21, 0x55, 0x80, 0xc4, 0x68, 0x73, 0x7a, 0xb8, 0x6c, 0xfe, 0x94, 0x20, 0x12, 0xb1, 0x64, 0xef, 0x72, 0x8c, 0xa3, 0x33, 0x38, 0xe3, 0x1b, 0x37, 0xe5, 0xb9, 0xf3, 0xea, 0xc1, 0xf8, 0x9e, 0x16, 0x5a, 0xda, 0x07, 0xd8, 0xbc, 0x48, 0x21, 0x2e, 0x59, 0xef, 0x44, 0x39, 0x7d, 0x89, 0x5e, 0xee, 0x41, 0x72, 0x25, 0x84, 0x4b, 0x97, 0x37, 0x71, 0xb7, 0x0b, 0x6a, 0x7f, 0xa7, 0x67, 0x63, 0x45, 0xcc, 0x44, 0xb3, 0x6f, 0xab, 0x83, 0x4c, 0x8a, 0x39, 0x26, 0x34, 0xcb, 0xdd, 0xb1, 0xf7, 0xc8, 0xd3, 0xb6, 0x8b, 0x93, 0x75, 0x67, 0xa7, 0x5a, 0xb3, 0xca, 0x24, 0xcd, 0x88, 0xc9, 0x82, 0x02, 0xcf, 0x16, 0x73, 0x1d, 0x83, 0x3b, 0xf9, 0x45, 0xc2, 0xe9, 0x20, 0xdb, 0x54, 0x5d, 0xa4, 0xfe, 0x2c, 0xb2, 0xd2, 0x06, 0xcf, 0xe8, 0xec, 0xb2, 0xa1, 0xdc, 0xdc, 0xa7, 0x37, 0xe4, 0xd2, 0xdb, 0x14, 0xbe, 0x85, 0xd9, 0xd9, 0x27, 0x96, 0xa4, 0x87, 0x76, 0x83, 0x54, 0xee, 0xcc, 0xc8, 0x81, 0xae, 0x48, 0x03, 0x11, 0x03, 0x31, 0x5b, 0xf6, 0x9c, 0x59, 0xfc, 0xa3, 0xa6, 0xff, 0x10, 0x8a, 0x13, 0x82, 0x6b, 0xb3, 0x7e, 0xfc, 0xf4, 0x6e, 0x02, 0xfb, 0x06, 0x28, 0xf9, 0x96, 0xcb, 0x7e, 0x75, 0xa2, 0xde, 0xde, 0x1b, 0x7d, 0xab, 0x3b, 0x32, 0x77, 0x88, 0xe6, 0x83, 0xc7, 0x25, 0x5d, 0x09, 0x22, 0x32, 0xab, 0x73, 0x65, 0xc7, 0xe3, 0xc9, 0x10, 0x5b, 0x1b, 0xe7, 0x83, 0x1d, 0x1b, 0x5a, 0x73, 0x4e, 0x60, 0xe9, 0x52, 0x7d, 0x27, 0xcf, 0x0c, 0xe4, 0x53, 0x2a, 0xe2, 0xc1, 0xd6, 0x1f, 0x8f, 0x8c, 0xd8, 0x1a, 0xff, 0x78, 0xc9, 0xfd, 0x1c, 0xc3, 0xfd, 0x8b, 0xb2, 0x00, 0xe6, 0x1f, 0xf4, 0xb4, 0xc2, 0x4a, 0x1c, 0xe5, 0x8c, 0xe8, 0x30, 0xe2, 0xbe, 0xf1, 0x8f, 0x5e, 0xb9, 0x51, 0x11, 0x58, 0xcc, 0x53, 0xeb, 0x61, 0x37, 0x29, 0x28, 0x84, 0x07, 0xdc, 0x0c, 0xbf, 0xa0, 0x09, 0xe5, 0xb1, 0x8c, 0xdf, 0x23, 0xb1, 0x21, 0xb0, 0x79, 0x18, 0x75, 0xba, 0xbd, 0x9b, 0x11, 0x91, 0x03, 0x70, 0x7b, 0x5e, 0xa3, 0xb3, 0xde, 0x16, 0xbd, 0xe0, 0xca, 0x72, 0x80, 0x5f, 0x40, 0x3a, 0xfe, 0x17, 0xa5, 0x6f, 0x80, 0x7c, 0x2d, 0x71, 0x72, 0xa0, 0xbf, 0xd6, 0x80, 0xa8, 0x30, 0x65, 0xf6, 0x30, 0xfe, 0x98, 0x07, 0x3c, 0x3e, 0xfd, 0xf0, 0x05, 0x54, 0xe0, 0x30, 0xb6, 0x56, 0x7b, 0x7f, 0x9e, 0xa8, 0xad, 0xfc, 0xca, 0xf0, 0xa3, 0xdb, 0x72, 0xda, 0xb3, 0xb3, 0xc9, 0x78, 0x74, 0xab, 0xc9, 0x77, 0x7f, 0x19, 0x38, 0xa4, 0x35, 0x2d, 0xb4, 0x5c, 0x2d, 0x3b, 0xd0, 0x55, 0x28, 0xdc, 0xb5, 0x43, 0x2d, 0x6a, 0x46, 0x41, 0x38, 0x75, 0x68, 0xf9, 0x37, 0xc2, 0xef, 0x6a, 0xc9, 0x7b, 0x42, 0x3a, 0xc8, 0x0f, 0x8b, 0xe6, 0x3c, 0x1a, 0xbd, 0x42, 0x47, 0x74, 0xc5, 0xda, 0x8f, 0x00, 0xfe, 0xa1, 0xba, 0x35, 0xab, 0x58, 0x63, 0xdc, 0x49, 0x86, 0x49, 0xac, 0x10, 0x84, 0xdf, 0xba, 0xf6, 0xe4, 0xd8, 0xc6, 0xb9, 0x7b, 0x65, 0x40, 0x59, 0x73, 0xb3, 0x51, 0x63, 0x2c, 0x70, 0x4c, 0x33, 0x05, 0xc7, 0x0a, 0x31, 0xd9, 0x0a, 0x50, 0x95, 0xb9, 0x7f, 0x93, 0xb0, 0xc3, 0xcb, 0xe5, 0x0c, 0x45, 0xe7, 0xa2, 0x89, 0x46, 0x85, 0x15, 0x47, 0xe7, 0xc4, 0x64, 0x92, 0xcc, 0x4c, 0x9a, 0x72, 0xf5, 0x56, 0x58, 0x2e, 0x89, 0x6c, 0x64, 0xfe, 0x5b, 0xb1, 0x7c, 0x70, 0x00, 0x5c, 0xf4, 0x5f, 0xa9, 0x86, 0x1e, 0xd3, 0x80, 0xa6, 0xc2, 0x5c, 0x5a, 0xd3, 0xbc, 0x9d, 0x55, 0xcd, 0x49, 0x59, 0x8b, 0xa2, 0x49, 0x75, 0xeb, 0x1c, 0xae, 0x5b, 0xc4, 0x96, 0xd0, 0xf1, 0x11, 0x4c, 0x3e, 0x45, 0x8a, 0x73, 0xce, 0x4a, 0x1a, 0x23, 0x2a, 0x48, 0xff, 0x7b, 0xe7, 0x64, 0x8e, 0x84, 0x47, 0xf8, 0xb2, 0x89, 0x29, 0x18, 0x49, 0xb7, 0xb9, 0xe1, 0xf0, 0x8c, 0xb2, 0x60, 0x38, 0x73, 0xc6, 0xcc, 0x87, 0xa5, 0xf7, 0xc6, 0xff, 0x36, 0xb6, 0x29, 0x33, 0x86, 0xba, 0xe8, 0x20, 0x5d, 0x23, 0xcb, 0xa8, 0x25, 0xc1, 0xee, 0x1b, 0x5c, 0x2d, 0x2a, 0x22, 0x1e, 0x58, 0x45, 0x71, 0xfc, 0x27, 0x55, 0x4d, 0x0b, 0x7e, 0x1b, 0x9b, 0x1e, 0xad, 0xc9, 0x1f, 0xdc, 0x15, 0xee, 0x66, 0xc0, 0x35, 0x7c, 0x15, 0xa6, 0xb9, 0xe0, 0x3e, 0x29, 0x38, 0x8d, 0x34, 0x6e, 0x30, 0x8d, 0x5d, 0x2f, 0x68, 0xed, 0x87, 0x28, 0xb4, 0x91, 0x27, 0x30, 0x4c, 0xfd, 0x11, 0xcd, 0xf9, 0xa1, 0xb3, 0xf4, 0x15, 0x3d, 0x8e, 0xcf, 0xa3, 0x3f, 0x1c, 0xba, 0x6b, 0xe1, 0x9b, 0x02, 0x70, 0x5f, 0x14, 0x59, 0x62, 0x74, 0xfd, 0x1b, 0xf6, 0x5e, 0xa2, 0x9d, 0x0b, 0x20, 0xb7, 0xd7, 0x82, 0x43, 0x6c, 0x11, 0xf7, 0x06, 0xb1, 0x5d, 0x18, 0xed, 0xa2, 0x99, 0x48, 0x55, 0xeb, 0x7d, 0x87, 0x92, 0x9b, 0xaa, 0x05, 0x28, 0xed, 0xf3, 0x52, 0xfc, 0x3e, 0xd8, 0x39, 0x31, 0x40, 0x8c, 0x60, 0x03, 0x8d, 0xb8, 0x07, 0xb5, 0x26, 0xf6, 0xcf, 0xed, 0x47, 0x54, 0xff, 0xc8, 0x92, 0x78, 0x85, 0x0b, 0x5d, 0x84, 0xbc, 0x7b, 0xe9, 0x88, 0x48, 0x3d, 0x70, 0x3b, 0x71, 0x0e, 0xf9, 0xc1, 0x96, 0x65, 0xf3, 0x05, 0xa5, 0x07, 0x05, 0xd8, 0xb0, 0x19, 0x33, 0x77, 0x4b, 0x15, 0x6f, 0xe6, 0x9c, 0x7a, 0x23, 0x2c, 0xee, 0xbe, 0xc0, 0xfd, 0x08, 0x72, 0xd6, 0x48, 0x2e, 0xdf, 0x42, 0xfa, 0x83, 0xfd, 0xf7, 0x1d, 0xc6, 0xd6, 0xb8, 0x46, 0x5a, 0xd4, 0x63, 0x33, 0x2f, 0xa3, 0x0a, 0xfc, 0x33, 0xb8, 0xb9, 0xfc, 0x6f, 0xb1, 0xcb, 0xce, 0xb3, 0xa3, 0x66, 0x7f, 0x3b, 0x3f, 0x0a, 0x0d, 0x0f, 0xe4, 0xdd, 0xb7, 0x82, 0x6b, 0x5e, 0x4d, 0x3b, 0x01, 0x48, 0x03, 0xbd, 0x69, 0xeb, 0x7e, 0x68, 0xc0, 0xee, 0xaa, 0x4e, 0xfb, 0xd5, 0x09, 0x1a, 0x95, 0x3d, 0xce, 0xe4, 0xca, 0xd1, 0xdc, 0x9e, 0x2f, 0x13, 0x1e, 0xb6, 0xcf, 0xda, 0x2e, 0xcd, 0xd8, 0xd9, 0x27, 0xee, 0xe1, 0x52, 0x65, 0x9b, 0x40, 0x5d, 0x73, 0x71, 0x72, 0x80, 0x06, 0x69, 0x77, 0xf8, 0x52, 0x08, 0x6f, 0x60, 0x27, 0xec, 0xf0, 0x35, 0xde, 0x50, 0xce, 0x88, 0xc9, 0x61, 0x39, 0x1c, 0x50, 0x57, 0x05, 0xa3, 0xb6, 0x81, 0x5c, 0xa4, 0x40, 0x0f, 0xb5, 0x5d, 0xb9, 0x0c, 0x4e, 0x8e, 0xa1, 0x52, 0x29, 0xc2, 0x7d, 0xd8, 0x69, 0x32, 0xb8, 0x05, 0xcf, 0xbe, 0xdf, 0x4e, 0xf7, 0x08, 0xe5, 0xa9, 0x77, 0x77, 0x65, 0x49, 0x59, 0x2d, 0x58, 0xc2, 0x59, 0x71, 0x59, 0x8f, 0xdb, 0x46, 0xe3, 0xf7, 0x15, 0x18, 0xdd, 0x4d, 0x25, 0xe4, 0x19, 0x45, 0xee, 0x71, 0xb7, 0xf5, 0x3c, 0x7f, 0x9e, 0x33, 0x0d, 0x6a, 0x03, 0x87, 0xc5, 0x77, 0x90, 0x0b, 0xbc, 0xd3, 0xcd, 0x47, 0x7d, 0x5c, 0x91, 0xbe, 0xd8, 0x21, 0xa3, 0xf5, 0xd1, 0xc0, 0xac, 0x46, 0xfb, 0x83, 0xe2, 0x85, 0xaf, 0xc4, 0x65, 0xce, 0x7d, 0xbb, 0x55, 0xdd, 0xb1, 0x97, 0x97, 0xec, 0x3c, 0x55, 0xb1, 0x86, 0xaa, 0x26, 0xab, 0xe7, 0xb2, 0x71, 0x12, 0x3a, 0xac, 0xe9, 0x91, 0xa6, 0xb2, 0x7f, 0x67, 0x40, 0x0a, 0xd6, 0x9d, 0x94, 0x0a, 0xb1, 0xef, 0x51, 0x4d, 0x4c, 0x29, 0x58, 0xdd, 0x79, 0x09, 0xd4, 0x31, 0xfa, 0xc2, 0xaf, 0x55, 0x52, 0x52, 0x74, 0xe1, 0x3c, 0x31, 0x88, 0xe3, 0x31, 0xef, 0x39, 0xab, 0x5a, 0x23, 0xe6, 0xd1, 0x20, 0x76, 0xb7, 0x29, 0x73, 0xbd, 0x3a, 0x36, 0x7f, 0x00, 0xab, 0xde, 0x20, 0xf8, 0x8b, 0x85, 0xea, 0xb4, 0xd0, 0x6c, 0x26, 0x9b, 0xfd, 0x85, 0x35, 0x37, 0x2a, 0x4b, 0x2b, 0x1e, 0xd6, 0x48, 0xa8, 0x46, 0x82, 0xd6, 0x61, 0x76, 0x44, 0x07, 0x00, 0x1d, 0x10, 0x93, 0xba, 0x0c, 0x55, 0x3a, 0x5e, 0x0e, 0x02, 0x8c, 0xe8, 0x63, 0x97, 0xef, 0x42, 0xde, 0xc2, 0xaa, 0x9c, 0x30, 0x75, 0xb1, 0x44, 0xfd, 0x2e, 0x85, 0xc7, 0xba, 0x15, 0x86, 0x9b, 0xcc, 0x3d, 0x13, 0x75, 0xb5, 0x03, 0x8b, 0xcf, 0x2b, 0xf4, 0xa3, 0x7d, 0x7c, 0x94, 0x45, 0x39, 0x71, 0xc1, 0xdc, 0xa2, 0x6f, 0xf9, 0x1a, 0xfb, 0x0a, 0xd7, 0xe1, 0x05, 0xc5, 0x35, 0x9e, 0x17, 0x5d, 0xc3, 0x8c, 0x45, 0x69, 0xf1, 0x09, 0xa2, 0x7d, 0xe1, 0xf0, 0x47, 0x66, 0xb4, 0x4b, 0x7c, 0xf6, 0x4f, 0xc3, 0x9d, 0x87, 0xff, 0xc2, 0x00, 0x81, 0xd0, 0xf9, 0x86, 0x21, 0x1b, 0x3e, 0x09, 0x5c, 0x01, 0x12, 0x85, 0x1c, 0x63, 0x12, 0x01, 0x24, 0xcb, 0x06, 0x98, 0x63, 0x0e, 0xb8, 0x8f, 0xa8, 0x4a, 0x09, 0x1a, 0xb9, 0x72, 0x2b, 0x3e, 0xb3, 0xd2, 0x72, 0xbf, 0xd9, 0x50, 0xdc, 0xed, 0x9f, 0x2d, 0x86, 0x8f, 0x05, 0x5a, 0x2c, 0x99, 0x57, 0x32, 0x5d, 0x01, 0xcd, 0xa1, 0x56, 0x01, 0x4e, 0x64, 0x06, 0x0d, 0x2f, 0x83, 0x2a, 0x41, 0x3e, 0x45, 0x10, 0xba, 0xbd, 0x63, 0xfb, 0xfc, 0x41, 0xdf, 0x63, 0xa9, 0xb2, 0xff, 0xbd, 0x78, 0xac, 0x33, 0x57, 0x71, 0xa6, 0x04, 0xa4, 0x83, 0x81, 0xc2, 0xb9, 0xa4, 0x7a, 0xed, 0x6a, 0xfd, 0x62, 0x48, 0xaf, 0x62, 0x6c, 0x2e, 0xfe, 0x3b, 0x55, 0x5b, 0xbc, 0x09, 0xa2, 0x0e, 0xf8, 0x6e, 0xef, 0x81, 0x07, 0xc1, 0xbf, 0x07, 0xcb, 0x96, 0x4a, 0x05, 0xb2, 0x8a, 0x8b, 0xe3, 0x13, 0x68, 0x89, 0x32, 0x72, 0x25, 0x7f, 0xb9, 0x9b, 0xec, 0x18, 0x02, 0xf5, 0xb4, 0x71, 0xcc, 0x92, 0xa3, 0xbc, 0xfa, 0x87, 0x49, 0x42, 0xf1, 0x9e, 0xb0, 0xcc, 0x7c, 0xc9, 0x50, 0x34, 0x24, 0x80, 0xd0, 0xe2, 0x4a, 0x5c, 0x1d, 0x74, 0xfd, 0x64, 0xa7, 0x23, 0x00, 0xc6, 0x13, 0xb7, 0x5a, 0x99, 0x01, 0x76, 0xfd, 0xd1, 0x34, 0x0d, 0xc2, 0xbe, 0xce, 0xb6, 0x0b, 0xb2, 0xb4, 0x7b, 0xa5, 0xc5, 0x94, 0x78, 0xc4, 0xf0, 0x6e, 0x14, 0x49, 0xac, 0xcb, 0x86, 0xe4, 0x9e, 0x53, 0xcc, 0x87, 0x3f, 0x09, 0x69, 0xbc, 0x82, 0x3b, 0x57, 0x57, 0x31, 0x24, 0x11, 0xcf, 0x5c, 0x12, 0x94, 0xf9, 0x6e, 0x28, 0xe9, 0xd8, 0x65, 0x89, 0xa1, 0x90, 0x3c, 0x0e, 0xf2, 0x51, 0x91, 0xcd, 0x05, 0xa5, 0xfb, 0xcc, 0xe2, 0xab, 0x03, 0x8b, 0xc9, 0x2b, 0x3c, 0xca, 0xea, 0xe4, 0xd9, 0x7e, 0x3c, 0xb3, 0xb1, 0xb1, 0x35, 0x01, 0xa3, 0x84, 0xe3, 0xa2, 0x83, 0xeb, 0x75, 0xeb, 0x8d, 0x99, 0xca, 0x3c, 0x19, 0x00, 0xda, 0x70, 0xdf, 0x14, 0x4f, 0x4f, 0x2c, 0xb2, 0xcd, 0x32, 0xf5, 0x2b, 0x77, 0x04, 0xe4, 0xbd, 0xeb, 0x16, 0x5a, 0xf1, 0x74, 0xa1, 0x7c, 0x85, 0x78, 0x91, 0xc7, 0x77, 0x95, 0x14, 0x46, 0x13, 0x33, 0x9e, 0xd1, 0x04, 0x30, 0x12, 0x3d, 0x62, 0x06, 0x1b, 0xaa, 0x28, 0x6d, 0x6e, 0xd5, 0x57, 0x16, 0x94, 0xd4, 0x3f, 0x3b, 0x6e, 0xee, 0xbd, 0x26, 0x4c, 0x0b, 0x4f, 0x1d, 0xf6, 0xd4, 0x78, 0x2e, 0x96, 0xa0, 0xd7, 0x0f, 0x22, 0x21, 0x84, 0x7b, 0xe4, 0xe1, 0xc7, 0xb9, 0xd6, 0x8b, 0x68, 0x3e, 0x37, 0x90, 0x8a, 0x3d, 0xfc, 0x5e, 0x35, 0x82, 0x8c, 0x9c, 0xa8, 0x1d, 0x00, 0xb8, 0xa4, 0xf3, 0x3e, 0x10, 0x41, 0xb0, 0x3b, 0xf8, 0x15, 0x6a, 0x8e, 0x41, 0xbd, 0xad, 0x51, 0x49, 0x91, 0x3f, 0xcc, 0x1a, 0x1a, 0x60, 0x4b, 0x18, 0x8e, 0x2e, 0x14, 0xbb, 0x1b, 0x13, 0xe7, 0x9e, 0xbc, 0xa1, 0x9b, 0x2c, 0x2f, 0x9b, 0xca, 0xdb, 0xf3, 0xb0, 0xe4, 0x72, 0x84, 0x4d, 0xa6, 0xda, 0x90, 0x1d, 0xdf, 0xb4, 0x4f, 0xfa, 0x59, 0xba, 0x2f, 0x13, 0x8d, 0x04, 0x67, 0xf7, 0x6b, 0xdd, 0xcb, 0xc5, 0xda, 0xe7, 0xc4, 0x74, 0x78, 0x90, 0x0a, 0x1b, 0x76, 0xf8, 0x75, 0xe3, 0x4a, 0x46, 0x6e, 0xdb, 0xac, 0x07, 0xb0, 0xd7, 0x57, 0xc3, 0x09, 0x98, 0x70, 0xe8, 0xf8, 0x42, 0x79, 0x1b, 0xbe, 0xaa, 0xde, 0x6f, 0xbd, 0xdb, 0xb5, 0x4e, 0x0e, 0xa9, 0x6d, 0xdc, 0xbd, 0xd2, 0x37, 0x55, 0xa7, 0x40, 0x93, 0xd2, 0xa7, 0xcb, 0x9d, 0x60, 0xc4, 0xd4, 0x56, 0xcf, 0x83, 0x68, 0x03, 0x09, 0x97, 0x8c, 0x8f, 0xa9, 0xeb, 0x4d, 0xbc, 0x5e, 0x3d, 0xca, 0xcc, 0x69, 0xe7, 0x1e, 0x14, 0x7d, 0xee, 0x9b, 0xec, 0x3c, 0x27, 0xc3, 0x27, 0x11, 0x74, 0x17, 0x8d, 0xea, 0x46, 0xe6, 0x00, 0x34, 0x36, 0x5d, 0xbe, 0xb0, 0xca, 0xb1, 0x21, 0xdd, 0xe9, 0x96, 0xf2, 0x9d, 0xda, 0x2f, 0x25, 0xf2, 0x42, 0xa9, 0x0c, 0x94, 0x81, 0x61, 0x83, 0xc3, 0x85, 0xdf, 0x00, 0x43, 0xa8, 0x77, 0xff, 0x01, 0x29, 0x2a, 0xe2, 0xed, 0x17, 0x44, 0x77, 0x8a, 0x5d, 0x7c, 0xca, 0xe6, 0x59, 0xfe, 0x92, 0x5d, 0xb9, 0xf9, 0xc5, 0xb7, 0x91, 0x0f, 0xe4, 0x69, 0x9e, 0x44, 0xf5, 0x6e, 0xd9, 0x1d, 0x18, 0x08, 0x17, 0xb6, 0x04, 0x25, 0x1a, 0x5e, 0x02, 0x00, 0xe1, 0x09, 0xb1, 0xf6, 0x07, 0x66, 0x5f, 0x34, 0xf5, 0xfc, 0xff, 0x48, 0x50, 0xf7, 0xb1, 0xbf, 0xa4, 0xe9, 0x4b, 0x77, 0x99, 0x67, 0x7b, 0xcf, 0xc7, 0x2f, 0xe9, 0x63, 0x5d, 0x5d, 0xce, 0x08, 0x0b, 0x32, 0xd2, 0x47, 0x57, 0x72, 0x5f, 0x17, 0xd6, 0xa8, 0x20, 0x26, 0x36, 0x6d, 0x50, 0xf6, 0x56, 0x6a, 0xa9, 0xc7, 0x29, 0x0c, 0x0f, 0x1b, 0x88, 0x81, 0xef, 0x9b, 0x91, 0x66, 0x0e, 0x43, 0xf0, 0x56, 0xaf, 0xd8, 0xe4, 0x02, 0x54, 0x25, 0x3c, 0x7c, 0xf9, 0x2c, 0xf9, 0x17, 0xe4, 0xcc, 0x0c, 0x96, 0xcf, 0x6f, 0x41, 0x93, 0x6c, 0x5c, 0xc8, 0xce, 0x97, 0xa8, 0xe7, 0xb1, 0x57, 0x6a, 0xab, 0x77, 0xba, 0x38, 0x31, 0xad, 0x5d, 0xca, 0xea, 0x09, 0x95, 0x48, 0xea, 0x7f, 0x5f, 0x2b, 0xfa, 0x04, 0x2e, 0x65, 0xa7, 0xf8, 0xfb, 0x36, 0x5c, 0x6a, 0x65, 0x9f, 0x94, 0x8b, 0x9a, 0x6b, 0xde, 0x52, 0x76, 0x4f, 0x01, 0x2a, 0xf1, 0xfb, 0x02, 0x5d, 0xd4, 0x72, 0x15, 0x2c, 0x4e, 0x86, 0xab, 0xd5, 0xcf, 0x02, 0x3a, 0x9c, 0x1e, 0x63, 0xa5, 0xca, 0x11, 0xee, 0xdd, 0x59, 0x6f, 0xf7, 0xb2, 0x52, 0xd4, 0x57, 0x42, 0xc1, 0xc9, 0x40, 0xfe, 0x2e, 0x50, 0x5e, 0xa6, 0xfa, 0x61, 0xc3, 0xd5, 0x83, 0x88, 0x7b, 0x34, 0xc6, 0x61, 0x3e, 0xef, 0x3b, 0xff, 0x3e, 0xbb, 0xd8, 0xb5, 0x5b, 0x75, 0xba, 0x82, 0xe4, 0xa3, 0x8c, 0x99, 0x66, 0xa6, 0x98, 0xb6, 0xc9, 0xd1, 0x40, 0x45, 0x93, 0xce, 0x29, 0xf7, 0x94, 0xed, 0x76, 0xf7, 0x79, 0xa7, 0x25, 0xb9, 0xc0, 0x16, 0xa8, 0xaa, 0x82, 0x97, 0x9f, 0xd3, 0x12, 0xeb, 0x8d, 0x4f, 0xf7, 0x71, 0x57, 0xea, 0x04, 0x42, 0x4f, 0xb7, 0x7d, 0x01, 0xcd, 0x4e, 0x7e, 0x4e, 0x42, 0x90, 0xfb, 0x19, 0x18, 0xf7, 0x8e, 0xe2, 0x7a, 0xc8, 0x87, 0x9d, 0x1e, 0xa7, 0x4d, 0xb9, 0xde, 0xd6, 0xec, 0x92, 0x5e, 0x60, 0x07, 0x7d, 0x0f, 0x94, 0xd3, 0xb4, 0x63, 0xcd, 0x98, 0x37, 0x25, 0x03, 0x2d, 0xd5, 0x8b, 0x93, 0xa5, 0x76, 0xe6, 0xb0, 0xb7, 0x86, 0xba, 0x2d, 0x90, 0x92, 0xdc, 0x22, 0x48, 0x37, 0x58, 0x6b, 0x5b, 0xad, 0xcb, 0xe3, 0x78, 0xcf, 0xc5, 0x44, 0x4f, 0x8b, 0x22, 0x30, 0x90, 0x68, 0x13, 0x6d, 0xff, 0xef, 0x6f, 0x0f, 0x48, 0x61, 0xf1, 0xee, 0x1d, 0x3f, 0x09, 0x00, 0x55, 0x8d, 0x7a, 0x01, 0x4a, 0x6a, 0xa5, 0x0d, 0x5c, 0x3c, 0xaa, 0x07, 0x85, 0x21, 0x67, 0x79, 0x05, 0x7d, 0x99, 0xe7, 0x44, 0xaf, 0xa1, 0xb0, 0xf7, 0xc5, 0x6a, 0x8d, 0x0b, 0x62, 0xa1, 0x2c, 0x76, 0x2f, 0xe6, 0x4e, 0x82, 0x6d, 0x5c, 0x88, 0x21, 0xaf, 0xfa, 0x49, 0xac, 0x7a, 0x8a, 0xc9, 0xa0, 0xd8, 0x43, 0x19, 0x7f, 0x86, 0x1f, 0x7d, 0xe0, 0xd4, 0xfa, 0x00, 0x61, 0x43, 0x6c, 0x67, 0x74, 0x1a, 0x02, 0x1f, 0xb1, 0x1f, 0xf4, 0x00, 0xf7, 0x05, 0xb7, 0x8c, 0x97, 0x90, 0x1e, 0xf4, 0xff, 0xb2, 0x22, 0x30, 0xa5, 0xd5, 0x56, 0x4f, 0x11, 0xcc, 0xd9, 0xc8, 0xdd, 0x8d, 0x5f, 0x96, 0x12, 0x72, 0x3d, 0x8d, 0x55, 0xc4, 0xaa, 0xb8, 0xcd, 0xfe, 0x38, 0x03, 0x7a, 0xe8, 0x34, 0x61, 0x66, 0xa0, 0xaa, 0xd8, 0x66, 0x5d, 0x35, 0x35, 0xef, 0xb0, 0x0a, 0x10, 0xbc, 0x4d, 0x45, 0x8b, 0x80, 0xaf, 0x1d, 0x3e, 0xe2, 0xe7, 0x41, 0x75, 0xa1, 0xf8, 0x9f, 0xe5, 0xf9, 0x4f, 0x29, 0xc7, 0xea, 0xb5, 0x05, 0x4b, 0x8f, 0x53, 0x45, 0x74, 0xd9, 0x15, 0x9b, 0xef, 0x3a, 0x6a, 0x21, 0x15, 0xcd, 0x37, 0xdb, 0x66, 0x75, 0xbe, 0x3c, 0x9b, 0x7f, 0x4c, 0x49, 0x5b, 0x68, 0x06, 0x07, 0x1b, 0xef, 0x7c, 0xf4, 0x28, 0x9a, 0x54, 0x50, 0x1d, 0xb7, 0x66, 0x26, 0xe6, 0xc3, 0x70, 0x4e, 0x4c, 0x44, 0xfd, 0xdb, 0x75, 0xef, 0xd0, 0xd4, 0xab, 0x54, 0xd2, 0xa3, 0xac, 0x89, 0x69, 0xe2, 0x5b, 0xff, 0x96, 0x7a, 0xeb, 0x45, 0xcf, 0xa2, 0xec, 0x39, 0xba, 0x99, 0x6a, 0x86, 0xed, 0x08, 0x1e, 0x94, 0x25, 0xa3, 0xab, 0x23, 0xe1, 0x42, 0x37, 0xde, 0xf9, 0x9c, 0x38, 0xfc, 0x2b, 0x6e, 0xb7, 0x33, 0x34, 0xf2, 0x9c, 0xd4, 0x40, 0xe3, 0xfe, 0x99, 0x6d, 0xb9, 0x47, 0xef, 0xc8, 0x9a, 0x51, 0x1d, 0x28, 0xf9, 0x08, 0x24, 0x82, 0xe4, 0x88, 0x68, 0x20, 0xd8, 0x86, 0x27, 0xb0, 0x62, 0x8c, 0x71, 0x52, 0xf9, 0xd5, 0xaa, 0xa4, 0xc8, 0x1a, 0xa0, 0x4d, 0x19, 0x20, 0x80, 0xb3, 0xef, 0x7a, 0xe6, 0x24, 0x77, 0x6b, 0x24, 0xfd, 0xeb, 0x8c, 0x6c, 0xef, 0x36, 0xc3, 0xd5, 0xd1, 0xda, 0x42, 0x1b, 0x59, 0x8e, 0x89, 0xa7, 0x4a, 0xdf, 0xed, 0x3e, 0xa9, 0x23, 0xcd, 0xa2, 0xec, 0x85, 0x2b, 0xe2, 0xe1, 0xf4, 0x6c, 0xe1, 0xf0, 0xc8, 0x16, 0xba, 0x88, 0xdf, 0x01, 0xf4, 0x59, 0x5b, 0xad, 0xfa, 0xa1, 0xe5, 0x7d, 0xd5, 0x56, 0x39, 0x38, 0x34, 0x91, 0xb9, 0x01, 0xb5, 0x3a, 0x3c, 0xbf, 0x0a, 0x4d, 0xfb, 0x63, 0xb3, 0xfe, 0x74, 0xba, 0x64, 0xef, 0x83, 0x82, 0xd1, 0xa7, 0x16, 0x7c, 0x14, 0xb5, 0xea, 0x84, 0x2a, 0x5c, 0xb6, 0x91, 0xf3, 0x32, 0xb8, 0x17, 0x13, 0x5d, 0xbf, 0x52, 0x72, 0x79, 0x90, 0xc0, 0xde, 0xae, 0xef, 0x3f, 0x01, 0xc5, 0xc2, 0x52, 0x80, 0xc6, 0xe0, 0x0f, 0x79, 0xee, 0x9a, 0xa4, 0x7c, 0x4c, 0x66, 0x1a, 0x79, 0xa2, 0x40, 0xb7, 0x94, 0xf2, 0xaa, 0x71, 0x87, 0x91, 0x98, 0xf3, 0x5c, 0x87, 0x06, 0x09, 0x2d, 0x02, 0xe2, 0x1c, 0x53, 0x4e, 0x4a, 0x66, 0x1e, 0xa5, 0xbd, 0x89, 0xf9, 0x1b, 0xd3, 0xa0, 0x15, 0x56, 0x74, 0xfb, 0xf8, 0xa5, 0x8d, 0xcc, 0x0c, 0x0f, 0xac, 0x43, 0x48, 0x19, 0x3a, 0xad, 0x74, 0x5c, 0x7a, 0xd9, 0xb9, 0x43, 0xc0, 0xa7, 0x7d, 0xf5, 0x9e, 0x6b, 0xc6, 0xb3, 0xd6, 0x30, 0x5e, 0x91, 0x38, 0x1b, 0x5a, 0x99, 0x1f, 0xdc, 0xbe, 0xf3, 0x20, 0xef, 0x0d, 0x11, 0x84, 0x63, 0xdf, 0x81, 0xcc, 0x55, 0x1c, 0x9e, 0x77, 0x95, 0x14, 0xa4, 0xc3, 0xc8, 0x08, 0x1b, 0xb3, 0x26, 0x4f, 0xfc, 0x59, 0x47, 0x96, 0xa3, 0x4c, 0xd8, 0x80, 0xa4, 0xb1, 0x60, 0xc3, 0xef, 0xcd, 0xa2, 0x34, 0x8c, 0xe2, 0x92, 0xfb, 0xfa, 0x88, 0x40, 0xa5, 0x43, 0x0f, 0xad, 0x35, 0x27, 0x46, 0x0a, 0x53, 0x25, 0x6b, 0x66, 0x5d, 0xe9, 0xa9, 0xb3, 0xf4, 0x5b, 0x4e, 0x4f, 0x59, 0x16, 0x63, 0x56, 0x2c, 0x38, 0xfb, 0x57, 0xd3, 0xa3, 0x60, 0x1e, 0xac, 0x78, 0x81, 0xfe, 0xbc, 0x04, 0xbf, 0x95, 0x11, 0x69, 0x85, 0xad, 0x3f, 0x4a, 0x2c, 0xce, 0xaa, 0xaa, 0xb9, 0x2e, 0x23, 0x7c, 0x28, 0x82, 0xd7, 0x87, 0x95, 0x08, 0x29, 0x7c, 0xd6, 0x76, 0xf0, 0x85, 0x46, 0x3a, 0x01, 0xef, 0x2d, 0x1e, 0x59, 0x64, 0xa4, 0xb4, 0xe4, 0x06, 0x53, 0x95, 0x23, 0xf4, 0x54, 0xe4, 0xcc, 0xd7, 0x80, 0xd2, 0x3f, 0x6a, 0xa6, 0xeb, 0x2e, 0x8c, 0xd4, 0xec, 0x0e, 0xf2, 0x0a, 0x2a, 0x3e, 0xcb, 0xb0, 0x98, 0x43, 0x0a, 0x6f, 0x05, 0x29, 0x4b, 0xa2, 0x49, 0x18, 0xf7, 0xb6, 0x63, 0x16, 0x13, 0x51, 0xcc, 0xee, 0x2b, 0xf8, 0x5f, 0x73, 0xc5, 0xd1, 0xbb, 0xbf, 0x80, 0x7d, 0x08, 0xa8, 0xc2, 0x15, 0xbd, 0xbd, 0x5c, 0x0c, 0x6f, 0x85, 0x1f, 0xf9, 0xe1, 0x0f, 0x1a, 0x1c, 0x12, 0xe1, 0xa2, 0xb9, 0x69, 0x12, 0x9c, 0xa2, 0x96, 0xe0, 0x47, 0x67, 0xd3, 0xfa, 0x91, 0xe2, 0x0a, 0xcb, 0x2d, 0x89, 0xa3, 0xc4, 0xa2, 0x58, 0x1d, 0xcb, 0x58, 0xbd, 0x95, 0xf7, 0x5c, 0x63, 0x29, 0x95, 0xc9, 0xbf, 0xbc, 0xfa, 0x97, 0xaf, 0xfe, 0x85, 0x65, 0x78, 0xc9, 0xe4, 0x46, 0xcd, 0xef, 0x08, 0x9f, 0xd8, 0x63, 0x12, 0xb6, 0x18, 0xb0, 0x9b, 0x1e, 0x8c, 0xd2, 0x25, 0x09, 0x78, 0x3e, 0xd1, 0x52, 0xb4, 0xcf, 0x2c, 0xac, 0x4e, 0x32, 0x26, 0xb3, 0x32, 0x2b, 0x7a, 0x0f, 0x0c, 0xda, 0xa6, 0x3a, 0x9b, 0x4e, 0x2a, 0x1f, 0xa3, 0x25, 0x5f, 0x4c, 0x2b, 0xd5, 0x69, 0xa2, 0xe2, 0x7f, 0x5e, 0xea, 0xbe, 0x07, 0xcc, 0x38, 0x5f, 0xaf, 0x17, 0xca, 0xda, 0x14, 0x76, 0x3b, 0x10, 0x84, 0x2c, 0x9a, 0x3d, 0x9f, 0xe7, 0x83, 0x89, 0x15, 0x33, 0x2e, 0x28, 0xed, 0xa0, 0xbb, 0xdd, 0xad, 0xf8, 0xe2, 0xad, 0x40, 0xa3, 0x67, 0xbe, 0x51, 0x0d, 0x6e, 0x8e, 0xff, 0xe0, 0x23, 0x66, 0x97, 0xb2, 0x6a, 0x34, 0xf8, 0x1a, 0x78, 0x2b, 0x07, 0x87, 0x95, 0x9d, 0xdc, 0x98, 0x8b, 0x92, 0x59, 0xee, 0xb3, 0x41, 0x2e, 0xfe, 0x9d, 0x11, 0xe3, 0x21, 0x3e, 0xc0, 0x42, 0x55, 0xb0, 0xbf, 0x5b, 0x11, 0x7d, 0x5c, 0x5b, 0x1d, 0x46, 0xc8, 0x96, 0x99, 0xd0, 0xe3, 0xc5, 0xa7, 0x5d, 0x88, 0x1f, 0x64, 0xc4, 0x60, 0xc5, 0x52, 0x29, 0x6e, 0x72, 0x58, 0xf7, 0xc2, 0x24, 0x4f, 0x0c, 0x86, 0x04, 0x80, 0x5c, 0x15, 0x84, 0xdb, 0x42, 0xd2, 0xf4, 0x63, 0xcf, 0xa6, 0xe6, 0xf8, 0x81, 0x64, 0xf7, 0x92, 0x29, 0xdc, 0x4d, 0x72, 0x66, 0x36, 0xdd, 0x46, 0x66, 0x85, 0xa2, 0x7c, 0x53, 0xdf, 0x60, 0x3b, 0x2f, 0x3a, 0x0b, 0xcc, 0xfc, 0x6a, 0x5e, 0xad, 0x61, 0xe0, 0xb0, 0x15, 0x4a, 0x59, 0x52, 0x80, 0x0e, 0xa6, 0xad, 0x5f, 0x26, 0xa5, 0x97, 0xd4, 0xf7, 0x98, 0x5b, 0x56, 0x6f, 0x8d, 0x33, 0xd6, 0x50, 0x3c, 0x8f, 0xf0, 0xe3, 0x14, 0x3b, 0xe9, 0x36, 0x3c, 0x83, 0x7b, 0x63, 0x49, 0xfd, 0xd8, 0xbb, 0x09, 0x16, 0x20, 0x5e, 0x08, 0x9e, 0x88, 0x0e, 0xbc, 0x63, 0x5e, 0x9b, 0xc4, 0xae, 0xd9, 0x0b, 0x5b, 0xdd, 0xa0, 0xec, 0xc3, 0x67, 0x69, 0x52, 0xff, 0x72, 0x7b, 0xed, 0xa9, 0x9e, 0xa2, 0x9e, 0x1b, 0x87, 0x8d, 0x9e, 0xd2, 0xce, 0x5d, 0x19, 0xa2, 0x40, 0xc2, 0x9f, 0x4a, 0x46, 0xa5, 0x53, 0x94, 0x8b, 0xb0, 0xf1, 0x47, 0x9b, 0x79, 0xe8, 0x19, 0xfe, 0x6a, 0x9b, 0x8a, 0x6b, 0x4b, 0x55, 0x51, 0x61, 0x07, 0x52, 0x7b, 0x45, 0x41, 0x63, 0x37, 0x11, 0x2f, 0xff, 0x93, 0xff, 0x93, 0x27, 0xbf, 0x5f, 0xf8, 0xef, 0xb1, 0xb4, 0x9b, 0xf1, 0xe8, 0x93, 0x1c, 0x74, 0xf7, 0x3e, 0x7d, 0xfa, 0x3d, 0x58, 0x2c, 0xeb, 0xe4, 0xec, 0x6f, 0x69, 0x62, 0x9f, 0x46, 0xd6, 0x69, 0x63, 0x99, 0x67, 0xd0, 0x17, 0x12, 0x00, 0x26, 0xaf, 0x30, 0x82, 0x1a, 0xa9, 0x7a, 0x83, 0x01, 0x36, 0xd7, 0x54, 0x89, 0x7f, 0x92, 0x3e, 0xae, 0xc6, 0x54, 0x52, 0x65, 0x22, 0x1d, 0xa7, 0x4d, 0xb8, 0xc0, 0x4c, 0xef, 0xa4, 0xde, 0xb1, 0x3a, 0x15, 0xbd, 0xdf, 0x36, 0x51, 0xf6, 0x83, 0xe1, 0x20, 0x50, 0xfa, 0xf0, 0x05, 0xda, 0x6a, 0x85, 0x72, 0x8e, 0x3c, 0xbd, 0x18, 0xea, 0xda, 0xd0, 0x50, 0x58, 0x54, 0xb2, 0xbf, 0xdb, 0x80, 0x36, 0x20, 0x1d, 0xee, 0xdb, 0x3f, 0xa2, 0xd3, 0xc6, 0x76, 0x02, 0x6c, 0x30, 0xe0, 0xc9, 0x2d, 0x6d, 0x63, 0x86, 0x34, 0x98, 0x8e, 0x9a, 0x6a, 0x5f, 0x32, 0x2d, 0xe2, 0x9b, 0x42, 0x19, 0x50, 0x4a, 0xf8, 0x74, 0xa7, 0x90, 0x94, 0xd4, 0x64, 0xef, 0xc5, 0x08, 0xc8, 0x0a, 0x34, 0x3c, 0x91, 0x4a, 0x25, 0x24, 0x6e, 0xcb, 0x08, 0x45, 0x63, 0x2d, 0x4f, 0x07, 0x4c, 0x35, 0x47, 0xa7, 0x25, 0x67, 0x65, 0xb4, 0x3b, 0x80, 0x44, 0x47, 0x36, 0x07, 0xc3, 0xbf, 0x29, 0xf8, 0x8b, 0xf4, 0x04, 0x1c, 0xc8, 0x92, 0x2f, 0x81, 0x9f, 0x22, 0x3e, 0xa5, 0xda, 0x7e, 0x64, 0x20, 0xe8, 0xe9, 0x2d, 0x29, 0x81, 0x88, 0xda, 0xc5, 0xcd, 0x28, 0xc5, 0x8f, 0x5f, 0x2c, 0x2d, 0x1e, 0x4d, 0x6b, 0xb4, 0x70, 0x74, 0x31, 0xbd, 0xc3, 0x15, 0x07, 0xb5, 0x1d, 0xa4, 0x5e, 0xde, 0xca, 0x11, 0x3d, 0x34, 0x19, 0xd7, 0xa3, 0xfa, 0xb8, 0x91, 0x4c, 0xea, 0xc7, 0xe9, 0x19, 0x22, 0x86, 0xc7, 0x7c, 0x4d, 0x9a, 0xe6, 0xbb, 0x1b, 0xad, 0x27, 0x6a, 0xb5, 0x6b, 0x79, 0x9b, 0xe0, 0x87, 0xe8, 0x92, 0x9a, 0x0f, 0x6a, 0x93, 0xf1, 0x34, 0x83, 0x63, 0x96, 0xca, 0xca, 0x92, 0x4d, 0x9e, 0x70, 0x91, 0x15, 0x62, 0x32, 0x9a, 0x08, 0xa8, 0xae, 0x2c, 0x9a, 0xd2, 0xee, 0xf0, 0x2f, 0x75, 0x01, 0x99, 0xb0, 0x77, 0x09, 0x1d, 0x2e, 0x06, 0xfa, 0xdf, 0x4d, 0xc8, 0xd0, 0x3f, 0xde, 0xe4, 0xb2, 0xc2, 0x11, 0x63, 0xeb, 0xc7, 0xa4, 0xd0, 0xfc, 0x24, 0x75, 0xf3, 0xf4, 0x8b, 0x21, 0x28, 0xee, 0x4e, 0x62, 0x3a, 0x47, 0xe8, 0x54, 0x9a, 0x7a, 0x04, 0x1a, 0x3e, 0x75, 0x26, 0x93, 0x94, 0x52, 0x71, 0x7c, 0xb3, 0x1c, 0xbf, 0x0c, 0x27, 0x2e, 0x81, 0xec, 0x28, 0xf9, 0xe5, 0x1b, 0x38, 0x92, 0xb3, 0x6c, 0x74, 0x53, 0xf4, 0x5d, 0x73, 0xef, 0x4c, 0x19, 0xe5, 0x30, 0x4d, 0x4f, 0x56, 0x6c, 0x87, 0xb9, 0x30, 0x0e, 0xb4, 0x80, 0xe1, 0xc9, 0x7a, 0xea, 0x87, 0x37, 0x8c, 0xcc, 0x48, 0xbd, 0xbe, 0x44, 0x7e, 0x06, 0x03, 0x12, 0x94, 0xc5, 0xe4, 0x08, 0x36, 0xfd, 0x9f, 0x65, 0x7b, 0x18, 0x6c, 0xf1, 0x1f, 0xff, 0x27, 0xff, 0x40, 0x4d, 0xc8, 0x4f, 0x78, 0x6c, 0x4a, 0xd5, 0xe8, 0x8b, 0x44, 0x2c, 0x68, 0xd6, 0x6a, 0x94, 0x98, 0xea, 0x43, 0xa6, 0x4a, 0x29, 0x3a, 0xb8, 0x13, 0xb0, 0x72, 0x4d, 0x11, 0x1a, 0x89, 0xd4, 0xc5, 0xfd, 0x87, 0x00, 0x13, 0x06, 0x2d, 0xa0, 0xf6, 0xe6, 0x6f, 0xf4, 0xa2, 0x86, 0xce, 0xff, 0x81, 0xda, 0x28, 0x40, 0x3a, 0xb3, 0x8d, 0x51, 0x4e, 0x4f, 0x04, 0xc4, 0xac, 0xa3, 0x2f, 0xbc, 0x41, 0x29, 0x9a, 0x15};
+#include "base/CCDirector.h"
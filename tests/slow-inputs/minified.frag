@@ -0,0 +1,14 @@
+varying vec4 v_color; varying vec2 v_texCoord; uniform sampler2D u_texture; uniform vec4 u_color;
+void f0() { v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a0 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a1 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a2 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a3 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a4 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a5 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a6 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a7 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a8 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a9 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a10 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a11 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a12 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a13 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float }
+void f1() { v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a0 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a1 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a2 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a3 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a4 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a5 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a6 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a7 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a8 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a9 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a10 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a11 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a12 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a13 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float }
+void f2() { v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a0 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a1 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a2 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a3 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a4 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a5 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a6 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a7 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a8 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a9 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a10 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a11 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a12 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a13 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float }
+void f3() { v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a0 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a1 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a2 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a3 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a4 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a5 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a6 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a7 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a8 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a9 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a10 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a11 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a12 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a13 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float }
+void f4() { v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a0 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a1 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a2 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a3 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a4 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a5 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a6 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a7 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a8 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a9 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a10 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a11 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a12 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a13 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float }
+void f5() { v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a0 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a1 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a2 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a3 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a4 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a5 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a6 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a7 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a8 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a9 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a10 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a11 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a12 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a13 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float }
+void f6() { v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a0 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a1 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a2 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a3 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a4 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a5 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a6 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a7 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a8 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a9 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a10 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a11 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a12 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a13 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float }
+void f7() { v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a0 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a1 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a2 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a3 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a4 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a5 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a6 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a7 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a8 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a9 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a10 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a11 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a12 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a13 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float }
+void f8() { v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a0 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a1 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a2 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a3 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a4 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a5 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a6 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a7 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a8 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a9 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a10 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a11 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a12 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a13 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float }
+void f9() { v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a0 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a1 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a2 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a3 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a4 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a5 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a6 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a7 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a8 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a9 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a10 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a11 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a12 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a13 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float }
+void f10() { v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a0 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a1 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a2 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a3 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a4 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a5 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a6 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a7 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a8 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a9 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a10 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a11 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a12 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a13 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float }
+void f11() { v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a0 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a1 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a2 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a3 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a4 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a5 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a6 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a7 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a8 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a9 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a10 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a11 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a12 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float(i), 0.0)) * u_color; float a13 = sample.x + textureCube(u_env, n).r; v_color = texture2D(u_texture, v_texCoord + vec2(0.001 * float }
+void main() { gl_FragColor = v_color; }
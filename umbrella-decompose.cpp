@@ -0,0 +1,374 @@
+// ---------------------------------------- umbrella header decomposition
+// Most projects include the umbrella axmol.h (cocos2d.h before migrating) in every translation unit, which
+// preprocesses to hundreds of thousands of lines. Each unit is parsed by libclang, the declarations and macros
+// referenced by the project files are resolved to their defining headers, and each defining header to the header
+// of the umbrella which brings it in. The include of the umbrella is replaced by that minimal set, in the order of
+// the umbrella, the headers included by another one of the set already are dropped.
+//
+// A project header which includes the umbrella also provides it to the files including the header, so the references
+// of those files are attributed to the header too, a header is rewritten by the union over all units including it,
+// and not at all if any of them fails to parse.
+//
+// The units are parsed by unit_parser without its precompiled headers, the inclusions of the umbrella are needed.
+#include "migrate-context.h"
+#include "clang-api.h"
+#include "include-graph.h"
+#include "unit-parser.h"
+#include "base/trace.h"
+#include "base/logger.h"
+#include <map>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+	const char* const umbrella_names[] = {"axmol.h", "cocos2d.h"};
+
+	bool is_umbrella(std::string_view path) {
+		auto slash = path.find_last_of('/');
+		auto name = slash != std::string_view::npos ? path.substr(slash + 1) : path;
+		for (auto umbrella : umbrella_names)
+			if (name == umbrella)
+				return true;
+		return false;
+	}
+
+	// the lines of the umbrella files, shared by all units
+	class umbrella_lines {
+	public:
+		// <name> or "name" of the include at line, empty if it isn't one
+		std::string directive(const std::string& umbrella, unsigned line) {
+			std::lock_guard<std::mutex> lck(_mutex);
+			auto it = _files.find(umbrella);
+			if (it == _files.end()) {
+				std::vector<std::string> lines;
+				auto content = load_file(umbrella);
+				axstd::split_cb(content, '\n', [&](const char* s, const char* e) { lines.emplace_back(s, e); });
+				it = _files.emplace(umbrella, std::move(lines)).first;
+			}
+			return line > 0 && line <= it->second.size() ? std::string{include_directive_of(it->second[line - 1])} : std::string{};
+		}
+
+	private:
+		std::mutex _mutex;
+		std::map<std::string, std::vector<std::string>> _files;
+	};
+
+	// a project file to rewrite, merged over the units including it
+	struct umbrella_plan {
+		std::string umbrella;
+		unsigned line = 0; // of the umbrella include in the file
+		bool failed = false; // a unit including it failed to parse, or a header can't be spelled
+		std::map<unsigned, std::string> includes; // the line in the umbrella -> <name> or "name", in umbrella order
+	};
+
+	struct unit_state {
+		std::string root; // source dir with trailing '/'
+		std::unordered_map<CXFile, std::string> paths;
+		std::unordered_map<std::string, std::vector<std::pair<std::string, unsigned>>> edges; // includer -> included, line
+		std::map<std::string, std::pair<std::string, unsigned>> includers; // project file -> umbrella, line
+		std::unordered_map<std::string, std::unordered_set<std::string>> closures;
+		std::unordered_map<std::string, std::string> child_of; // defining header -> child of umbrella
+		std::unordered_map<std::string, std::vector<std::string>> providers; // project file -> includers it reaches
+		std::map<std::string, std::set<std::string>> used; // includer -> children used
+
+		const std::string& path_of(CXFile file) {
+			auto it = paths.find(file);
+			if (it != paths.end())
+				return it->second;
+			auto path = clang::to_string(clang::File_tryGetRealPathName(file));
+			if (path.empty())
+				path = clang::to_string(clang::getFileName(file));
+			return paths.emplace(file, normalize_path(path)).first->second;
+		}
+
+		bool is_project(std::string_view path) const {
+			return cxx20::starts_with(path, root) && !is_umbrella(path);
+		}
+
+		const std::unordered_set<std::string>& closure_of(const std::string& file) {
+			auto it = closures.find(file);
+			if (it != closures.end())
+				return it->second;
+			std::unordered_set<std::string> closure{file};
+			std::vector<const std::string*> pending{&file};
+			while (!pending.empty()) {
+				auto cur = pending.back();
+				pending.pop_back();
+				auto edge = edges.find(*cur);
+				if (edge == edges.end())
+					continue;
+				for (auto& included : edge->second)
+					if (closure.insert(included.first).second)
+						pending.push_back(&included.first);
+			}
+			return closures.emplace(file, std::move(closure)).first->second;
+		}
+
+		// the child of umbrella which brings in file, the file itself first, then the first child in umbrella order
+		const std::string* child_of_file(const std::string& umbrella, const std::string& file) {
+			auto it = child_of.find(file);
+			if (it != child_of.end())
+				return it->second.empty() ? nullptr : &it->second;
+			std::string found;
+			auto children = edges.find(umbrella);
+			if (children != edges.end()) {
+				for (auto& child : children->second)
+					if (child.first == file)
+						found = child.first;
+				for (size_t i = 0; found.empty() && i < children->second.size(); ++i)
+					if (closure_of(children->second[i].first).count(file))
+						found = children->second[i].first;
+			}
+			it = child_of.emplace(file, std::move(found)).first;
+			return it->second.empty() ? nullptr : &it->second;
+		}
+
+		// the project files including the umbrella which provide it to file
+		const std::vector<std::string>& providers_of(const std::string& file) {
+			auto it = providers.find(file);
+			if (it != providers.end())
+				return it->second;
+			std::vector<std::string> result;
+			if (includers.count(file))
+				result.push_back(file); // includes the umbrella itself
+			else {
+				std::unordered_set<std::string> visited{file};
+				std::vector<std::string> pending{file};
+				while (!pending.empty()) {
+					auto cur = std::move(pending.back());
+					pending.pop_back();
+					auto edge = edges.find(cur);
+					if (edge == edges.end())
+						continue;
+					for (auto& included : edge->second) {
+						if (!is_project(included.first) || !visited.insert(included.first).second)
+							continue;
+						if (includers.count(included.first))
+							result.push_back(included.first);
+						else
+							pending.push_back(included.first);
+					}
+				}
+			}
+			return providers.emplace(file, std::move(result)).first->second;
+		}
+	};
+
+	// every include directive, also the ones of headers included already, which clang_getInclusions doesn't report
+	void collect_inclusions(CXTranslationUnit unit, unit_state& state) {
+		clang::visitChildren(clang::getTranslationUnitCursor(unit), [](CXCursor cursor, CXCursor, CXClientData data) {
+			if (clang::getCursorKind(cursor) != CXCursor_InclusionDirective)
+				return CXChildVisit_Continue;
+			auto& state = *static_cast<unit_state*>(data);
+			CXFile file = nullptr;
+			unsigned line = 0;
+			clang::getSpellingLocation(clang::getCursorLocation(cursor), &file, &line, nullptr, nullptr);
+			auto included = clang::getIncludedFile(cursor);
+			if (!file || !included)
+				return CXChildVisit_Continue;
+			auto& includer = state.path_of(file);
+			auto& path = state.path_of(included);
+			state.edges[includer].emplace_back(path, line);
+			if (is_umbrella(path) && state.is_project(includer))
+				state.includers.emplace(includer, std::make_pair(path, line));
+			return CXChildVisit_Continue;
+		}, &state);
+	}
+
+	void collect_references(CXTranslationUnit unit, unit_state& state) {
+		clang::visitChildren(clang::getTranslationUnitCursor(unit), [](CXCursor cursor, CXCursor, CXClientData data) {
+			auto& state = *static_cast<unit_state*>(data);
+			CXFile file = nullptr;
+			clang::getSpellingLocation(clang::getCursorLocation(cursor), &file, nullptr, nullptr, nullptr);
+			if (!file)
+				return CXChildVisit_Continue;
+			auto& from = state.path_of(file);
+			if (!state.is_project(from))
+				return CXChildVisit_Continue; // the declarations of the headers, not references of the project
+
+			auto referenced = clang::getCursorReferenced(cursor);
+			if (clang::Cursor_isNull(referenced) || clang::getCursorKind(referenced) == CXCursor_Namespace)
+				return CXChildVisit_Recurse; // a namespace is reopened by every header
+			auto definition = clang::getCursorDefinition(referenced);
+			if (!clang::Cursor_isNull(definition))
+				referenced = definition;
+			CXFile declFile = nullptr;
+			clang::getSpellingLocation(clang::getCursorLocation(referenced), &declFile, nullptr, nullptr, nullptr);
+			if (!declFile)
+				return CXChildVisit_Recurse;
+			auto& declPath = state.path_of(declFile);
+			if (state.is_project(declPath))
+				return CXChildVisit_Recurse;
+
+			for (auto& provider : state.providers_of(from)) {
+				auto& umbrella = state.includers[provider].first;
+				if (auto child = state.child_of_file(umbrella, declPath))
+					state.used[provider].insert(*child);
+			}
+			return CXChildVisit_Recurse;
+		}, &state);
+	}
+
+	class umbrella_pass {
+	public:
+		explicit umbrella_pass(migrate_context& ctx, std::string root) : _ctx(ctx), _parser(ctx, std::move(root)) {}
+
+		void prepare(const std::vector<std::string>& units) { _parser.prepare(units, false); }
+
+		void parse_unit(const std::string& path, int index) {
+			TRACE_SCOPE("decompose_unit", path);
+			file_events _fe(_ctx, path.c_str(), index);
+			std::string error;
+			unit_state state;
+			state.root = _parser.root();
+			auto unit = _parser.parse_alone(index, CXTranslationUnit_DetailedPreprocessingRecord, error);
+			if (unit)
+				collect_inclusions(unit, state);
+			if (!unit || !error.empty()) {
+				// the references are incomplete, none of the files providing the umbrella to it is rewritten
+				if (unit)
+					clang::disposeTranslationUnit(unit);
+				stats::add("units_failed");
+				_ctx.emit(AX_MIGRATE_EVENT_WARNING, path.c_str(), index, 0, 0, error.empty() ? "parse fail" : error.c_str());
+				std::lock_guard<std::mutex> lck(_mutex);
+				for (auto& includer : state.includers)
+					_failed.insert(includer.first);
+				return;
+			}
+			collect_references(unit, state);
+			clang::disposeTranslationUnit(unit);
+			stats::add("units_parsed");
+			merge(state);
+		}
+
+		void finish_failed() {
+			for (auto& path : _failed) {
+				auto it = _plans.find(path);
+				if (it != _plans.end())
+					it->second.failed = true;
+			}
+		}
+
+		void rewrite_all(int index_base) {
+			std::vector<std::pair<const std::string*, const umbrella_plan*>> plans;
+			for (auto& item : _plans)
+				plans.emplace_back(&item.first, &item.second);
+			_ctx.total = index_base + static_cast<int>(plans.size());
+			axstd::parallel_for(plans.size(), _ctx.jobs, [&](size_t i) {
+				rewrite(*plans[i].first, *plans[i].second, index_base + static_cast<int>(i));
+			});
+		}
+
+	private:
+		void merge(unit_state& state) {
+			std::lock_guard<std::mutex> lck(_mutex);
+			for (auto& includer : state.includers) {
+				auto& plan = _plans[includer.first];
+				plan.umbrella = includer.second.first;
+				plan.line = includer.second.second;
+				auto used = state.used.find(includer.first);
+				if (used == state.used.end())
+					continue;
+				// the lines of the children in the umbrella, the ones included by another child are redundant
+				auto& children = state.edges[plan.umbrella];
+				for (auto& child : used->second) {
+					bool redundant = false;
+					for (auto& other : used->second)
+						if (&other != &child && state.closure_of(other).count(child) && !state.closure_of(child).count(other))
+							redundant = true;
+					if (redundant)
+						continue;
+					auto found = std::find_if(children.begin(), children.end(), [&](auto& elem) { return elem.first == child; });
+					auto directive = found != children.end() ? _lines.directive(plan.umbrella, found->second) : std::string{};
+					if (directive.empty())
+						plan.failed = true; // i.e. an include by macro
+					else
+						plan.includes.emplace(found->second, std::move(directive));
+				}
+			}
+		}
+
+		void rewrite(const std::string& path, const umbrella_plan& plan, int index) {
+			TRACE_SCOPE("decompose_rewrite", path);
+			file_events _fe(_ctx, path.c_str(), index);
+			if (plan.failed) {
+				_ctx.emit(AX_MIGRATE_EVENT_WARNING, path.c_str(), index, 0, 0, "a translation unit including it can't be parsed");
+				return;
+			}
+			auto content = load_file(path);
+			// the chunks before and after the line of the umbrella include
+			size_t begin = 0;
+			for (unsigned line = 1; line < plan.line && begin != std::string::npos; ++line) {
+				begin = content.find('\n', begin);
+				if (begin != std::string::npos)
+					++begin;
+			}
+			auto end = begin != std::string::npos ? content.find('\n', begin) : std::string::npos;
+			if (begin == std::string::npos || !is_umbrella_line(std::string_view{content}.substr(begin, end - begin))) {
+				_ctx.emit(AX_MIGRATE_EVENT_WARNING, path.c_str(), index, content.size(), 0, "the umbrella include moved since parsed");
+				return;
+			}
+			end = end != std::string::npos ? end + 1 : content.size();
+			auto eol = end - begin >= 2 && content[end - 2] == '\r' ? "\r\n" : "\n";
+			// the headers the file includes already are not included twice
+			auto directives = include_directives_of(content);
+			std::set<std::string> existing{directives.begin(), directives.end()};
+			std::string replacement;
+			int included = 0;
+			for (auto& include : plan.includes) {
+				if (existing.count(include.second))
+					continue;
+				replacement += "#include ";
+				replacement += include.second;
+				replacement += eol;
+				++included;
+			}
+
+			if (!_ctx.dry_run) {
+				auto id = _ctx.plan_write(path, content);
+				save_file(path, {std::string_view{content}.substr(0, begin), replacement, std::string_view{content}.substr(end)});
+				_ctx.commit(id);
+			}
+			++_ctx.hints;
+			stats::add("umbrella_includes_replaced");
+			stats::add("umbrella_headers_included", included);
+			_ctx.emit(AX_MIGRATE_EVENT_REPLACED, path.c_str(), index, content.size(), included, "umbrella");
+		}
+
+		static bool is_umbrella_line(std::string_view line) {
+			auto directive = include_directive_of(line);
+			return !directive.empty() && is_umbrella(directive.substr(1, directive.size() - 2));
+		}
+
+		migrate_context& _ctx;
+		unit_parser _parser;
+		umbrella_lines _lines;
+		std::mutex _mutex;
+		std::map<std::string, umbrella_plan> _plans;
+		std::set<std::string> _failed; // the includers of the umbrella in units failed to parse
+	};
+
+	void decompose_units(migrate_context& ctx, const std::string& root, const std::vector<std::string>& units) {
+		if (!clang::ensure_lib())
+			throw std::runtime_error("libclang is required to decompose the umbrella header");
+		umbrella_pass pass(ctx, root);
+		pass.prepare(units);
+		ctx.total = static_cast<int>(units.size());
+		axstd::parallel_for(units.size(), ctx.jobs, [&](size_t index) {
+			pass.parse_unit(units[index], static_cast<int>(index));
+		});
+		pass.finish_failed();
+		pass.rewrite_all(static_cast<int>(units.size()));
+	}
+}
+
+void decompose_umbrella_in_dir(migrate_context& ctx, std::string_view dir) {
+	auto units = scan_tree(dir, is_translation_unit);
+	decompose_units(ctx, root_of(dir), units);
+}
+
+void decompose_umbrella_files(migrate_context& ctx, const std::vector<std::string>& paths) {
+	decompose_units(ctx, root_of_files(), translation_units_of(paths));
+}
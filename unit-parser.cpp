@@ -0,0 +1,244 @@
+#include "unit-parser.h"
+#include "include-graph.h"
+#include "migrate-context.h"
+#include "base/trace.h"
+#include "base/logger.h"
+#include <filesystem>
+
+namespace stdfs = std::filesystem;
+
+namespace {
+	constexpr int min_pch_units = 2; // units sharing a first include to precompile it
+}
+
+std::string_view leading_include(std::string_view content) {
+	bool in_comment = false;
+	while (!content.empty()) {
+		auto eol = content.find('\n');
+		auto line = content.substr(0, eol);
+		content.remove_prefix(eol != std::string_view::npos ? eol + 1 : content.size());
+		while (!line.empty() && is_space(line.front()))
+			line.remove_prefix(1);
+		while (!line.empty() && is_space(line.back()))
+			line.remove_suffix(1);
+		if (in_comment) {
+			auto close = line.find("*/");
+			if (close == std::string_view::npos)
+				continue;
+			in_comment = false;
+			line.remove_prefix(close + 2);
+			while (!line.empty() && is_space(line.front()))
+				line.remove_prefix(1);
+		}
+		if (line.empty() || cxx20::starts_with(line, "//"))
+			continue;
+		if (cxx20::starts_with(line, "/*")) {
+			in_comment = line.find("*/", 2) == std::string_view::npos;
+			continue;
+		}
+		return include_directive_of(line);
+	}
+	return {};
+}
+
+std::vector<CXCursor> children_of(CXCursor cursor) {
+	std::vector<CXCursor> children;
+	clang::visitChildren(cursor, [](CXCursor child, CXCursor, CXClientData data) {
+		static_cast<std::vector<CXCursor>*>(data)->push_back(child);
+		return CXChildVisit_Continue;
+	}, &children);
+	return children;
+}
+
+std::string engine_name(CXCursor decl) {
+	std::vector<std::string> names{clang::to_string(clang::getCursorSpelling(decl))};
+	for (auto parent = clang::getCursorSemanticParent(decl); clang::getCursorKind(parent) != CXCursor_TranslationUnit;
+		 parent = clang::getCursorSemanticParent(parent)) {
+		switch (clang::Cursor_isNull(parent) ? CXCursor_UnexposedDecl : clang::getCursorKind(parent)) {
+		case CXCursor_Namespace:
+		case CXCursor_ClassDecl:
+		case CXCursor_StructDecl:
+		case CXCursor_UnionDecl:
+		case CXCursor_EnumDecl:
+		case CXCursor_ClassTemplate:
+			names.push_back(clang::to_string(clang::getCursorSpelling(parent)));
+			break;
+		default:
+			return {}; // local to a function
+		}
+	}
+	if (names.size() < 2 || (names.back() != "cocos2d" && names.back() != "ax"))
+		return {};
+	std::string name;
+	for (auto it = names.rbegin() + 1; it != names.rend(); ++it) {
+		if (!name.empty())
+			name += "::";
+		name += *it;
+	}
+	return name;
+}
+
+bool rewrite_file(const migrate_context& ctx, const std::string& path, const std::vector<text_edit>& edits, int index) {
+	std::string error;
+	auto unit = clang::parse_file(path, {cxx20::ic::ends_with(path, ".mm") ? "-xobjective-c++" : "-xc++"}, CXTranslationUnit_SingleFileParse, error);
+	auto file = unit ? clang::getFile(unit, path.c_str()) : nullptr;
+	if (!file) {
+		if (unit)
+			clang::disposeTranslationUnit(unit);
+		ctx.emit(AX_MIGRATE_EVENT_WARNING, path.c_str(), index, 0, 0, "parse fail");
+		return false;
+	}
+	auto rewriter = clang::CXRewriter_create(unit);
+	for (auto& change : edits) {
+		auto range = clang::getRange(clang::getLocationForOffset(unit, file, change.begin), clang::getLocationForOffset(unit, file, change.end));
+		clang::CXRewriter_replaceText(rewriter, range, change.text.c_str());
+	}
+	bool ok = true;
+	if (!ctx.dry_run) {
+		auto id = ctx.plan_write(path, load_file(path));
+		ok = clang::CXRewriter_overwriteChangedFiles(rewriter) == 0;
+		if (ok)
+			ctx.commit(id);
+	}
+	clang::CXRewriter_dispose(rewriter);
+	clang::disposeTranslationUnit(unit);
+	if (!ok)
+		ctx.emit(AX_MIGRATE_EVENT_WARNING, path.c_str(), index, 0, 0, "write fail");
+	return ok;
+}
+
+unit_parser::unit_parser(const migrate_context& ctx, std::string root) : _ctx(ctx), _root(std::move(root)) {
+	if (!_ctx.compile_commands.empty() && !_db.load(_ctx.compile_commands))
+		throw std::runtime_error(fmt::format("No compile_commands.json in {}", _ctx.compile_commands));
+}
+
+unit_parser::~unit_parser() {
+	std::error_code ec;
+	for (auto& preamble : _preambles)
+		if (!preamble.second.pch.empty())
+			stdfs::remove(preamble.second.pch, ec);
+}
+
+bool unit_parser::is_project(const std::string& path) const {
+	return cxx20::starts_with(path, _root) && !is_excluded_path(path);
+}
+
+void unit_parser::prepare(const std::vector<std::string>& units, bool precompile) {
+	TRACE_SCOPE("parse_preambles");
+	_units = units;
+	_unit_preambles.assign(units.size(), nullptr);
+	_unit_args.resize(units.size());
+	axstd::parallel_for(units.size(), _ctx.jobs, [&](size_t index) {
+		auto args = _db.args_of(units[index]);
+		_unit_args[index] = !args.empty() ? std::move(args) : clang::default_args(units[index], _root);
+	});
+	for (size_t index = 0; precompile && index < units.size(); ++index) {
+		auto content = load_file(units[index]);
+		auto directive = leading_include(content);
+		if (directive.empty())
+			continue;
+		// a quoted include resolves by the dir of the unit first
+		std::string key{directive};
+		if (directive.front() == '"')
+			key += units[index].substr(0, units[index].find_last_of('/'));
+		for (auto& arg : _unit_args[index])
+			key += '\n' + arg;
+		auto& preamble = _preambles[key];
+		if (preamble.units++ == 0) {
+			preamble.directive = directive;
+			preamble.unit = index;
+		}
+		_unit_preambles[index] = &preamble;
+	}
+	std::vector<preamble_pch*> building;
+	for (auto& preamble : _preambles)
+		if (preamble.second.units >= min_pch_units)
+			building.push_back(&preamble.second);
+	axstd::parallel_for(building.size(), _ctx.jobs, [&](size_t index) { build_pch(*building[index], static_cast<int>(index)); });
+}
+
+void unit_parser::build_pch(preamble_pch& preamble, int index) {
+	TRACE_SCOPE("parse_pch", preamble.directive);
+	auto& unitPath = _units[preamble.unit];
+	auto probe = unitPath.substr(0, unitPath.find_last_of('/') + 1) + "axmol_preamble_probe.h";
+	auto args = _unit_args[preamble.unit];
+	args.push_back(cxx20::ic::ends_with(unitPath, ".mm") ? "-xobjective-c++-header" : "-xc++-header");
+	std::string error;
+	auto unit = clang::parse_source(probe, fmt::format("#include {}\n", preamble.directive), args,
+		CXTranslationUnit_ForSerialization | CXTranslationUnit_Incomplete, error);
+	if (!unit || !error.empty()) {
+		logger::verbose("Precompiling {} fail: {}", preamble.directive, error);
+		if (unit)
+			clang::disposeTranslationUnit(unit);
+		return;
+	}
+	std::error_code ec;
+	auto pch = (stdfs::temp_directory_path(ec) / fmt::format("axmol-migrate-{:016x}-{}.pch", manifest::hash_of(_root), index)).generic_string();
+	if (clang::saveTranslationUnit(unit, pch.c_str(), clang::defaultSaveOptions(unit)) == CXSaveError_None)
+		preamble.pch = std::move(pch);
+	else
+		logger::verbose("Saving the pch of {} fail", preamble.directive);
+	clang::disposeTranslationUnit(unit);
+}
+
+CXTranslationUnit unit_parser::parse(size_t index, std::string& error) {
+	auto& path = _units[index];
+	auto preamble = _unit_preambles[index];
+	CXTranslationUnit unit = nullptr;
+	if (preamble && !preamble->pch.empty()) {
+		auto args = _unit_args[index];
+		args.insert(args.end(), {"-include-pch", preamble->pch});
+		unit = clang::parse_file(path, args, CXTranslationUnit_None, error);
+		if (unit && error.empty()) {
+			stats::add("parse_pch_units");
+			return unit;
+		}
+		logger::verbose("Parsing {} on the pch fail, parse it alone: {}", path, error);
+		stats::add("parse_pch_fallbacks");
+		if (unit)
+			clang::disposeTranslationUnit(unit);
+		error.clear();
+	}
+	unit = parse_alone(index, CXTranslationUnit_None, error);
+	if (unit && !error.empty()) {
+		clang::disposeTranslationUnit(unit);
+		unit = nullptr;
+	}
+	return unit;
+}
+
+CXTranslationUnit unit_parser::parse_alone(size_t index, unsigned options, std::string& error) {
+	return clang::parse_file(_units[index], _unit_args[index], options, error);
+}
+
+file_text& unit_files::file_of(CXFile file) {
+	auto it = _files.find(file);
+	if (it != _files.end())
+		return it->second;
+	auto& text = _files[file];
+	auto path = clang::to_string(clang::File_tryGetRealPathName(file));
+	if (path.empty())
+		path = clang::to_string(clang::getFileName(file));
+	text.path = normalize_path(path);
+	text.project = _parser.is_project(text.path);
+	if (text.project)
+		text.content = load_file(text.path);
+	return text;
+}
+
+file_text* unit_files::spelled_at(CXSourceLocation loc, unsigned& offset) {
+	CXFile spelling = nullptr, expansion = nullptr;
+	unsigned expansionOffset = 0;
+	clang::getSpellingLocation(loc, &spelling, nullptr, nullptr, &offset);
+	clang::getExpansionLocation(loc, &expansion, nullptr, nullptr, &expansionOffset);
+	if (!spelling || spelling != expansion || offset != expansionOffset)
+		return nullptr;
+	auto& file = file_of(spelling);
+	return file.project && offset <= file.content.size() ? &file : nullptr;
+}
+
+file_text* unit_files::extent_of(CXCursor cursor, unsigned& begin, unsigned& end) {
+	auto extent = clang::getCursorExtent(cursor);
+	auto file = spelled_at(clang::getRangeStart(extent), begin);
+	return file && spelled_at(clang::getRangeEnd(extent), end) == file && begin < end ? file : nullptr;
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+// the translation units of a project parsed by libclang for the passes reading the AST: the flags of each unit come
+// from compile_commands.json or the defaults, and the units sharing their first include and flags parse on a
+// precompiled header of it, built once, so the engine headers aren't parsed again per unit
+#include "clang-api.h"
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+struct migrate_context;
+
+// the include of the first line of a file, comments aside, empty if anything else comes first
+std::string_view leading_include(std::string_view content);
+
+// the name of a declaration of the engine without the engine namespace, i.e. Texture2D::PixelFormat, empty if it
+// isn't one of cocos2d or ax
+std::string engine_name(CXCursor decl);
+
+// the direct children of cursor in order
+std::vector<CXCursor> children_of(CXCursor cursor);
+
+// a replacement of the bytes [begin, end) of a file
+struct text_edit {
+	unsigned begin = 0;
+	unsigned end = 0;
+	std::string text;
+};
+
+// applies the edits, sorted and not overlapping, by the CXRewriter of a parse of the file alone, the original is
+// journaled unless a dry run, false with a warning emitted if the file can't be parsed or written
+bool rewrite_file(const migrate_context& ctx, const std::string& path, const std::vector<text_edit>& edits, int index);
+
+class unit_parser {
+public:
+	// throws if the compile commands of ctx can't be loaded
+	unit_parser(const migrate_context& ctx, std::string root);
+	~unit_parser();
+
+	unit_parser(const unit_parser&) = delete;
+	unit_parser& operator=(const unit_parser&) = delete;
+
+	const std::string& root() const { return _root; }
+
+	// a file of the project, not an engine or system header
+	bool is_project(const std::string& path) const;
+
+	// the flags of the units and, if precompile, the precompiled headers of the first includes shared by enough units
+	void prepare(const std::vector<std::string>& units, bool precompile = true);
+
+	// parses the unit of prepare, on its precompiled header if any, nullptr if it fails or has errors, error
+	// receives the first one
+	CXTranslationUnit parse(size_t index, std::string& error);
+
+	// parses the unit of prepare alone by options, also if it has errors, error receives the first one
+	CXTranslationUnit parse_alone(size_t index, unsigned options, std::string& error);
+
+private:
+	struct preamble_pch {
+		std::string directive;
+		size_t unit = 0; // the first unit of it, for the flags
+		int units = 0;
+		std::string pch; // empty if not built
+	};
+
+	void build_pch(preamble_pch& preamble, int index);
+
+	const migrate_context& _ctx;
+	std::string _root; // with trailing '/'
+	clang::compile_commands _db;
+	std::vector<std::string> _units;
+	std::vector<std::vector<std::string>> _unit_args;
+	std::map<std::string, preamble_pch> _preambles; // by the include, the dir of a quoted one and the flags
+	std::vector<preamble_pch*> _unit_preambles;
+};
+
+// a file reached by a unit, the content is loaded for a project file only
+struct file_text {
+	std::string path;
+	std::string content;
+	bool project = false;
+};
+
+// the files of a unit by the CXFile of libclang, each loaded once, for a pass reading the source of the cursors
+class unit_files {
+public:
+	explicit unit_files(const unit_parser& parser) : _parser(parser) {}
+
+	file_text& file_of(CXFile file);
+
+	// the file and offset of loc if it's spelled where it's expanded, not in a macro, nullptr unless a project file
+	file_text* spelled_at(CXSourceLocation loc, unsigned& offset);
+
+	// the file and the range of cursor not empty, if both ends are spelled in the same project file
+	file_text* extent_of(CXCursor cursor, unsigned& begin, unsigned& end);
+
+private:
+	const unit_parser& _parser;
+	std::unordered_map<CXFile, file_text> _files;
+};
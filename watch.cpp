@@ -0,0 +1,232 @@
+// axmol-migrate watch: migrate the files of a tree incrementally as they are written.
+// The directories are watched by inotify, the files created, written or moved in are collected until no event arrived
+// for the debounce interval, then the batch is migrated by ax_migrate_files, the tree is never rescanned.
+// The migrated files are recorded in the manifest, so the events of the files written by migrating find them unchanged.
+#include "axmigrate.h"
+#include "base/logger.h"
+#include "yasio/string_view.hpp"
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__linux__)
+#	include <errno.h>
+#	include <poll.h>
+#	include <signal.h>
+#	include <sys/inotify.h>
+#	include <unistd.h>
+#	include <unordered_map>
+#endif
+
+namespace stdfs = std::filesystem;
+
+// returns the files replaced or shaders converted, -1 if fails
+extern int migrate_files(const ax_migrate_options& opts, int type, const std::vector<std::string>& files);
+
+#if defined(__linux__)
+namespace {
+	volatile sig_atomic_t g_stop = 0;
+
+	void on_stop_signal(int) {
+		g_stop = 1;
+	}
+
+	struct watcher {
+		int fd = -1;
+		std::unordered_map<int, std::string> dirs; // watch descriptor -> directory
+		std::vector<std::string> shader_suffixes;
+		std::set<std::string> cpp_files;
+		std::set<std::string> shader_files;
+
+		~watcher() {
+			if (fd != -1)
+				close(fd);
+		}
+
+		static bool is_excluded(std::string_view path) {
+			return path.find("/DragonBones/") != std::string_view::npos;
+		}
+
+		// same classification as the trees, the files of shader suffixes are shaders even if .cpp is in --filters
+		void collect(const std::string& path) {
+			if (is_excluded(path))
+				return;
+			std::string_view name{path};
+			auto slash = name.rfind('/');
+			if (slash != std::string_view::npos)
+				name.remove_prefix(slash + 1);
+			for (auto& suffix : shader_suffixes) {
+				if (cxx20::ic::ends_with(name, suffix)) {
+					shader_files.insert(path);
+					return;
+				}
+			}
+			for (auto suffix : {".h", ".hpp", ".cpp", ".mm", ".m", ".inl"}) {
+				if (cxx20::ic::ends_with(name, suffix)) {
+					cpp_files.insert(path);
+					return;
+				}
+			}
+			if (cxx20::ic::ends_with(name, "CMakeLists.txt"))
+				cpp_files.insert(path);
+		}
+
+		bool add_dir(const std::string& dir) {
+			int wd = inotify_add_watch(fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_ONLYDIR);
+			if (wd < 0) {
+				// ENOSPC: fs.inotify.max_user_watches reached
+				logger::warn("Watch {} fail: {}", dir, strerror(errno));
+				return false;
+			}
+			dirs[wd] = dir;
+			return true;
+		}
+
+		// the files of a directory created or moved in have no events of their own, collect them
+		void add_tree(const std::string& root, bool collect_files) {
+			if (!add_dir(root))
+				return;
+			std::error_code ec;
+			for (auto it = stdfs::recursive_directory_iterator(root, ec); !ec && it != stdfs::recursive_directory_iterator(); it.increment(ec)) {
+				auto path = it->path().generic_string();
+				if (it->is_directory(ec)) {
+					if (is_excluded(path + '/') || !add_dir(path))
+						it.disable_recursion_pending();
+				}
+				else if (collect_files && it->is_regular_file(ec))
+					collect(path);
+			}
+		}
+
+		void read_events() {
+			alignas(struct inotify_event) char buf[64 * 1024];
+			for (;;) {
+				auto n = read(fd, buf, sizeof(buf));
+				if (n <= 0)
+					break; // EAGAIN: drained
+				for (char* ptr = buf; ptr < buf + n;) {
+					auto event = reinterpret_cast<const struct inotify_event*>(ptr);
+					ptr += sizeof(struct inotify_event) + event->len;
+					if (event->mask & IN_Q_OVERFLOW) {
+						logger::warn("Watch events overflowed, some changes may be missed");
+						continue;
+					}
+					auto it = dirs.find(event->wd);
+					if (it == dirs.end())
+						continue;
+					if (event->mask & IN_IGNORED) { // the directory was removed
+						dirs.erase(it);
+						continue;
+					}
+					if (event->len == 0 || event->name[0] == '\0')
+						continue;
+					auto path = it->second + '/' + event->name;
+					if (event->mask & IN_ISDIR) {
+						if ((event->mask & (IN_CREATE | IN_MOVED_TO)) && !is_excluded(path + '/'))
+							add_tree(path, true);
+					}
+					else if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO))
+						collect(path); // IN_CREATE of a file is followed by IN_CLOSE_WRITE
+				}
+			}
+		}
+
+		void migrate_pending(const ax_migrate_options& opts) {
+			auto start = std::chrono::steady_clock::now();
+			std::vector<std::string> files{cpp_files.begin(), cpp_files.end()};
+			cpp_files.clear();
+			int hints = 0;
+			if (!files.empty())
+				hints += (std::max)(migrate_files(opts, AX_MIGRATE_TYPE_CPP, files), 0);
+			auto count = files.size();
+			files.assign(shader_files.begin(), shader_files.end());
+			shader_files.clear();
+			if (!files.empty())
+				hints += (std::max)(migrate_files(opts, AX_MIGRATE_TYPE_SHADER, files), 0);
+			count += files.size();
+			auto diff = std::chrono::steady_clock::now() - start;
+			logger::verbose("Migrated {} changed files, replaced totals: {}, cost: {:.3f}(ms)", count, hints,
+				std::chrono::duration_cast<std::chrono::microseconds>(diff).count() / 1000.0);
+		}
+
+		bool pending() const {
+			return !cpp_files.empty() || !shader_files.empty();
+		}
+	};
+}
+
+int watch(const ax_migrate_options& opts, const char* source_dir, int debounce_ms) {
+	watcher w;
+	w.fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (w.fd == -1) {
+		logger::error("inotify init fail: {}", strerror(errno));
+		return -1;
+	}
+
+	// the default suffixes of the shader trees and --filters
+	w.shader_suffixes = {".vert", ".frag", ".vsh", ".fsh"};
+	for (std::string_view filters = opts.filters ? opts.filters : ""; !filters.empty();) {
+		auto sep = filters.find(';');
+		auto filter = filters.substr(0, sep);
+		if (!filter.empty())
+			w.shader_suffixes.emplace_back(filter);
+		filters.remove_prefix(sep == std::string_view::npos ? filters.size() : sep + 1);
+	}
+
+	std::string root = stdfs::path{source_dir}.generic_string();
+	while (root.size() > 1 && root.back() == '/')
+		root.pop_back();
+	w.add_tree(root, false);
+	if (w.dirs.empty())
+		return -1;
+
+	signal(SIGINT, on_stop_signal);
+	signal(SIGTERM, on_stop_signal);
+	logger::info("Watching {} directories in {}, press Ctrl+C to stop", w.dirs.size(), root);
+	logger::flush();
+
+	// a batch waits for a quiet interval, but no longer than max_wait while the events keep coming
+	const auto debounce = std::chrono::milliseconds{debounce_ms};
+	const auto max_wait = debounce * 10;
+	std::chrono::steady_clock::time_point first_event;
+	while (!g_stop) {
+		int timeout = -1;
+		if (w.pending()) {
+			auto left = std::chrono::duration_cast<std::chrono::milliseconds>(first_event + max_wait - std::chrono::steady_clock::now());
+			timeout = static_cast<int>((std::max)((std::min)(left, debounce).count(), std::chrono::milliseconds::rep{0}));
+		}
+		pollfd pfd{w.fd, POLLIN, 0};
+		int ret = poll(&pfd, 1, timeout);
+		if (ret < 0) {
+			if (errno == EINTR)
+				continue;
+			logger::error("Watch fail: {}", strerror(errno));
+			return -1;
+		}
+		if (ret > 0) {
+			bool was_pending = w.pending();
+			w.read_events();
+			if (!was_pending && w.pending())
+				first_event = std::chrono::steady_clock::now();
+			if (!w.pending() || std::chrono::steady_clock::now() - first_event < max_wait)
+				continue;
+		}
+		w.migrate_pending(opts);
+		logger::flush();
+	}
+	if (w.pending())
+		w.migrate_pending(opts);
+	logger::info("Watch stopped");
+	return 0;
+}
+#else
+int watch(const ax_migrate_options&, const char*, int) {
+	logger::error("watch requires inotify, only supported on Linux");
+	return -1;
+}
+#endif